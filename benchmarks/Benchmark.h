@@ -0,0 +1,115 @@
+#pragma once
+
+/// Pina Engine Benchmarks - Micro-benchmark Harness
+/// Minimal self-registering benchmark runner (no external dependencies)
+///
+/// Usage:
+///   PINA_BENCHMARK(MyBenchmark) {
+///       setup();                      // Not timed
+///       while (state.run()) {
+///           work();                   // Timed
+///       }
+///       state.setItemsProcessed(n);   // Optional, per iteration
+///   }
+
+#include "Core/JobSystem.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Pina {
+namespace Bench {
+
+/// Per-run state handed to a benchmark body
+class State {
+public:
+    explicit State(uint64_t iterations) : m_iterations(iterations) {}
+
+    /// Returns true while the timed loop should keep going
+    bool run() {
+        if (!m_started) {
+            m_started = true;
+            m_start = Clock::now();
+        }
+        if (m_completed == m_iterations) {
+            m_end = Clock::now();
+            return false;
+        }
+        m_completed++;
+        return true;
+    }
+
+    /// Items handled per iteration (reported as throughput)
+    void setItemsProcessed(uint64_t items) { m_items = items; }
+
+    uint64_t getIterations() const { return m_iterations; }
+    uint64_t getItemsProcessed() const { return m_items; }
+
+    /// Elapsed time of the timed loop in seconds
+    double getSeconds() const {
+        return std::chrono::duration<double>(m_end - m_start).count();
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    uint64_t m_iterations = 0;
+    uint64_t m_completed = 0;
+    uint64_t m_items = 0;
+    bool m_started = false;
+    Clock::time_point m_start;
+    Clock::time_point m_end;
+};
+
+using BenchmarkFunction = void (*)(State&);
+
+/// Registered benchmark
+struct Benchmark {
+    std::string name;
+    BenchmarkFunction function = nullptr;
+};
+
+/// Global benchmark list (filled by static registration)
+inline std::vector<Benchmark>& getBenchmarks() {
+    static std::vector<Benchmark> s_benchmarks;
+    return s_benchmarks;
+}
+
+/// Registers a benchmark at static initialization time
+struct Registrar {
+    Registrar(const char* name, BenchmarkFunction function) {
+        getBenchmarks().push_back({name, function});
+    }
+};
+
+/// Job system (default worker count) shared by every benchmark
+/// Started on first use and left running until exit.
+inline JobSystem& getJobSystem() {
+    static JobSystem s_jobs;
+    if (!s_jobs.isRunning()) {
+        s_jobs.initialize();
+    }
+    return s_jobs;
+}
+
+/// Prevent the optimizer from discarding a computed value
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* s_sink;
+    s_sink = &value;
+#endif
+}
+
+} // namespace Bench
+} // namespace Pina
+
+/// Define and register a benchmark
+#define PINA_BENCHMARK(Name) \
+    static void Name(::Pina::Bench::State& state); \
+    static ::Pina::Bench::Registrar s_registrar_##Name(#Name, Name); \
+    static void Name(::Pina::Bench::State& state)
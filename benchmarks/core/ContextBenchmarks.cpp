@@ -0,0 +1,121 @@
+/// Context Benchmarks
+/// Core/Context subsystem lookup and per-frame update against a type_index map
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+template<int N>
+class BenchSubsystem : public Subsystem {
+public:
+    void update(float deltaTime) override { m_time += deltaTime; }
+    float getTime() const { return m_time; }
+
+private:
+    float m_time = 0.0f;
+};
+
+constexpr int kSubsystemCount = 16;
+constexpr int kLookupsPerIteration = 1024;
+
+template<int... N>
+void createAll(Context& context, std::integer_sequence<int, N...>) {
+    (context.createSubsystem<BenchSubsystem<N>>(), ...);
+}
+
+/// The registry layout Context used before dense IDs
+struct TypeIndexRegistry {
+    std::unordered_map<std::type_index, UNIQUE<Subsystem>> subsystems;
+    std::vector<std::type_index> order;
+
+    template<typename T>
+    void add() {
+        subsystems[std::type_index(typeid(T))] = MAKE_UNIQUE<T>();
+        order.push_back(std::type_index(typeid(T)));
+    }
+
+    template<typename T>
+    T* get() const {
+        auto it = subsystems.find(std::type_index(typeid(T)));
+        return it != subsystems.end() ? static_cast<T*>(it->second.get()) : nullptr;
+    }
+
+    void update(float deltaTime) {
+        for (const auto& type : order) {
+            auto it = subsystems.find(type);
+            if (it != subsystems.end()) {
+                it->second->update(deltaTime);
+            }
+        }
+    }
+};
+
+template<int... N>
+void addAll(TypeIndexRegistry& registry, std::integer_sequence<int, N...>) {
+    (registry.add<BenchSubsystem<N>>(), ...);
+}
+
+using AllSubsystems = std::make_integer_sequence<int, kSubsystemCount>;
+
+} // namespace
+
+// ============================================================================
+// Lookup (getSubsystem<T>() as called by Application accessors)
+// ============================================================================
+
+PINA_BENCHMARK(Context_Lookup_TypeIndexMap) {
+    TypeIndexRegistry registry;
+    addAll(registry, AllSubsystems());
+
+    while (state.run()) {
+        for (int i = 0; i < kLookupsPerIteration; ++i) {
+            Bench::doNotOptimize(registry.get<BenchSubsystem<7>>());
+        }
+    }
+    state.setItemsProcessed(kLookupsPerIteration);
+}
+
+PINA_BENCHMARK(Context_Lookup_Dense) {
+    Context context;
+    createAll(context, AllSubsystems());
+
+    while (state.run()) {
+        for (int i = 0; i < kLookupsPerIteration; ++i) {
+            Bench::doNotOptimize(context.getSubsystem<BenchSubsystem<7>>());
+        }
+    }
+    state.setItemsProcessed(kLookupsPerIteration);
+}
+
+// ============================================================================
+// Per-frame update of all subsystems
+// ============================================================================
+
+PINA_BENCHMARK(Context_Update_TypeIndexMap) {
+    TypeIndexRegistry registry;
+    addAll(registry, AllSubsystems());
+
+    while (state.run()) {
+        registry.update(0.016f);
+    }
+    state.setItemsProcessed(kSubsystemCount);
+    Bench::doNotOptimize(registry.get<BenchSubsystem<0>>()->getTime());
+}
+
+PINA_BENCHMARK(Context_Update_Dense) {
+    Context context;
+    createAll(context, AllSubsystems());
+
+    while (state.run()) {
+        context.updateSubsystems(0.016f);
+    }
+    state.setItemsProcessed(kSubsystemCount);
+    Bench::doNotOptimize(context.getSubsystem<BenchSubsystem<0>>()->getTime());
+}
@@ -0,0 +1,266 @@
+/// Event Benchmarks
+/// Core/EventQueue and EventDispatcher subscriptions against the structures they replaced
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr int kEventsPerFrame = 1024;
+
+/// The queue EventDispatcher used before in-place storage
+struct HeapEventQueue {
+    std::queue<UNIQUE<Event>> events;
+    size_t maxSize = 1024;
+
+    template<typename EventType>
+    void queue(const EventType& event) {
+        if (events.size() >= maxSize) {
+            events.pop();
+        }
+        events.push(MAKE_UNIQUE<EventType>(event));
+    }
+
+    void process(const std::function<void(Event&)>& handler) {
+        while (!events.empty()) {
+            auto event = std::move(events.front());
+            events.pop();
+            handler(*event);
+        }
+    }
+};
+
+} // namespace
+
+// ============================================================================
+// Queue + process (one frame worth of mouse-move input)
+// ============================================================================
+
+PINA_BENCHMARK(Event_QueueProcess_HeapQueue) {
+    HeapEventQueue queue;
+    float sum = 0.0f;
+    std::function<void(Event&)> handler = [&](Event& e) {
+        sum += static_cast<MouseMovedEvent&>(e).position.x;
+    };
+
+    while (state.run()) {
+        for (int i = 0; i < kEventsPerFrame; ++i) {
+            queue.queue(MouseMovedEvent(glm::vec2(static_cast<float>(i)), glm::vec2(1.0f)));
+        }
+        queue.process(handler);
+    }
+    state.setItemsProcessed(kEventsPerFrame);
+    Bench::doNotOptimize(sum);
+}
+
+PINA_BENCHMARK(Event_QueueProcess_RingBuffer) {
+    EventQueue queue;
+    float sum = 0.0f;
+    std::function<void(Event&)> handler = [&](Event& e) {
+        sum += static_cast<MouseMovedEvent&>(e).position.x;
+    };
+
+    while (state.run()) {
+        for (int i = 0; i < kEventsPerFrame; ++i) {
+            queue.push(MouseMovedEvent(glm::vec2(static_cast<float>(i)), glm::vec2(1.0f)));
+        }
+        while (!queue.empty()) {
+            handler(queue.front());
+            queue.pop();
+        }
+    }
+    state.setItemsProcessed(kEventsPerFrame);
+    Bench::doNotOptimize(sum);
+}
+
+// ============================================================================
+// EventDispatcher end to end (queue, processQueue, handler lookup)
+// ============================================================================
+
+PINA_BENCHMARK(Event_Dispatcher_QueueProcess) {
+    EventDispatcher dispatcher;
+    float sum = 0.0f;
+    dispatcher.subscribe<MouseMovedEvent>([&](MouseMovedEvent& e) { sum += e.position.x; });
+
+    while (state.run()) {
+        for (int i = 0; i < kEventsPerFrame; ++i) {
+            dispatcher.queue(MouseMovedEvent(glm::vec2(static_cast<float>(i)), glm::vec2(1.0f)));
+        }
+        dispatcher.processQueue();
+    }
+    state.setItemsProcessed(kEventsPerFrame);
+    Bench::doNotOptimize(sum);
+}
+
+// ============================================================================
+// Subscriptions (10k handlers across 100 event types)
+// ============================================================================
+
+namespace {
+
+constexpr int kEventTypes = 100;
+constexpr int kHandlersPerType = 100;
+
+template<int N>
+class BenchEvent : public EventBase<BenchEvent<N>> {
+public:
+    EventCategory getCategories() const override { return EventCategory::Application; }
+    const char* getName() const override { return "BenchEvent"; }
+};
+
+/// The subscription storage EventDispatcher used before slotted handler lists
+struct SortedHandlerMap {
+    struct Handler {
+        EventHandle handle;
+        EventCallback callback;
+        int32_t priority;
+    };
+
+    std::unordered_map<std::type_index, std::vector<Handler>> handlers;
+    EventHandle nextHandle = 1;
+
+    template<typename EventType>
+    EventHandle subscribe(std::function<void(EventType&)> callback, EventPriority priority) {
+        EventHandle handle = nextHandle++;
+
+        Handler handler;
+        handler.handle = handle;
+        handler.priority = static_cast<int32_t>(priority);
+        handler.callback = [callback](Event& e) { callback(static_cast<EventType&>(e)); };
+
+        auto& list = handlers[std::type_index(typeid(EventType))];
+        list.push_back(std::move(handler));
+        std::stable_sort(list.begin(), list.end(),
+            [](const Handler& a, const Handler& b) { return a.priority < b.priority; });
+        return handle;
+    }
+
+    bool unsubscribe(EventHandle handle) {
+        for (auto& [type, list] : handlers) {
+            auto it = std::find_if(list.begin(), list.end(),
+                [handle](const Handler& h) { return h.handle == handle; });
+            if (it != list.end()) {
+                list.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<typename EventType>
+    bool dispatch(EventType& event) {
+        auto it = handlers.find(std::type_index(typeid(EventType)));
+        if (it == handlers.end()) {
+            return false;
+        }
+        for (auto& handler : it->second) {
+            handler.callback(event);
+            if (event.isConsumed()) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+template<typename Registry, int... N>
+void subscribeAll(Registry& registry, std::vector<EventHandle>& handles, int& counter,
+                  std::integer_sequence<int, N...>) {
+    for (int i = 0; i < kHandlersPerType; ++i) {
+        auto priority = static_cast<EventPriority>((i * 7) % 5 - 2);
+        (handles.push_back(registry.template subscribe<BenchEvent<N>>(
+            [&counter](BenchEvent<N>&) { counter++; }, priority)), ...);
+    }
+}
+
+template<int N, typename Registry>
+void dispatchOne(Registry& registry) {
+    BenchEvent<N> event;
+    registry.dispatch(event);
+}
+
+template<typename Registry, int... N>
+void dispatchAll(Registry& registry, std::integer_sequence<int, N...>) {
+    (dispatchOne<N>(registry), ...);
+}
+
+using AllEventTypes = std::make_integer_sequence<int, kEventTypes>;
+
+/// Unsubscribe in a scattered order (every 7th handle, wrapping)
+std::vector<size_t> scatteredOrder(size_t count) {
+    std::vector<size_t> order;
+    order.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        order.push_back((i * 7919) % count);
+    }
+    return order;
+}
+
+} // namespace
+
+PINA_BENCHMARK(Event_SubscribeUnsubscribe_SortedMap) {
+    std::vector<EventHandle> handles;
+    auto order = scatteredOrder(kEventTypes * kHandlersPerType);
+    int counter = 0;
+
+    while (state.run()) {
+        SortedHandlerMap registry;
+        handles.clear();
+        subscribeAll(registry, handles, counter, AllEventTypes());
+        for (size_t index : order) {
+            registry.unsubscribe(handles[index]);
+        }
+    }
+    state.setItemsProcessed(kEventTypes * kHandlersPerType);
+}
+
+PINA_BENCHMARK(Event_SubscribeUnsubscribe_Slotted) {
+    std::vector<EventHandle> handles;
+    auto order = scatteredOrder(kEventTypes * kHandlersPerType);
+    int counter = 0;
+
+    while (state.run()) {
+        EventDispatcher dispatcher;
+        handles.clear();
+        subscribeAll(dispatcher, handles, counter, AllEventTypes());
+        for (size_t index : order) {
+            dispatcher.unsubscribe(handles[index]);
+        }
+    }
+    state.setItemsProcessed(kEventTypes * kHandlersPerType);
+}
+
+PINA_BENCHMARK(Event_DispatchAllTypes_SortedMap) {
+    SortedHandlerMap registry;
+    std::vector<EventHandle> handles;
+    int counter = 0;
+    subscribeAll(registry, handles, counter, AllEventTypes());
+
+    while (state.run()) {
+        dispatchAll(registry, AllEventTypes());
+    }
+    state.setItemsProcessed(kEventTypes * kHandlersPerType);
+    Bench::doNotOptimize(counter);
+}
+
+PINA_BENCHMARK(Event_DispatchAllTypes_Slotted) {
+    EventDispatcher dispatcher;
+    std::vector<EventHandle> handles;
+    int counter = 0;
+    subscribeAll(dispatcher, handles, counter, AllEventTypes());
+
+    while (state.run()) {
+        dispatchAll(dispatcher, AllEventTypes());
+    }
+    state.setItemsProcessed(kEventTypes * kHandlersPerType);
+    Bench::doNotOptimize(counter);
+}
@@ -0,0 +1,96 @@
+/// Job System Benchmarks
+/// Scheduling overhead and parallelFor scaling for Core/JobSystem
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr size_t kElementCount = 1 << 20;
+
+// Per-element work heavy enough to be worth distributing
+void transformRange(std::vector<float>& data, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        data[i] = std::sqrt(data[i] * 1.0001f + 1.0f);
+    }
+}
+
+void runParallelFor(Bench::State& state, size_t grainSize) {
+    JobSystem& jobs = Bench::getJobSystem();
+    std::vector<float> data(kElementCount, 1.0f);
+
+    while (state.run()) {
+        jobs.parallelFor(0, data.size(), grainSize, [&data](size_t begin, size_t end) {
+            transformRange(data, begin, end);
+        });
+    }
+    Bench::doNotOptimize(data[0]);
+    state.setItemsProcessed(kElementCount);
+}
+
+} // namespace
+
+// Baseline: same work on the calling thread
+PINA_BENCHMARK(JobSystem_SerialFor_1M) {
+    std::vector<float> data(kElementCount, 1.0f);
+
+    while (state.run()) {
+        transformRange(data, 0, data.size());
+    }
+    Bench::doNotOptimize(data[0]);
+    state.setItemsProcessed(kElementCount);
+}
+
+PINA_BENCHMARK(JobSystem_ParallelFor_1M_Grain1K) {
+    runParallelFor(state, 1024);
+}
+
+PINA_BENCHMARK(JobSystem_ParallelFor_1M_Grain16K) {
+    runParallelFor(state, 16 * 1024);
+}
+
+PINA_BENCHMARK(JobSystem_ParallelFor_1M_AutoGrain) {
+    runParallelFor(state, 0);
+}
+
+// Cost of submitting and completing empty jobs (scheduler overhead)
+PINA_BENCHMARK(JobSystem_SubmitWait_1K_EmptyJobs) {
+    JobSystem& jobs = Bench::getJobSystem();
+    constexpr int kJobCount = 1000;
+
+    while (state.run()) {
+        TaskGroup group;
+        for (int i = 0; i < kJobCount; ++i) {
+            jobs.submit([]() {}, &group);
+        }
+        jobs.wait(group);
+    }
+    state.setItemsProcessed(kJobCount);
+}
+
+// Fan-out / fan-in graph: 8 stages of 64 jobs, each stage depends on the last
+PINA_BENCHMARK(JobSystem_DependencyStages_8x64) {
+    JobSystem& jobs = Bench::getJobSystem();
+    constexpr int kStages = 8;
+    constexpr int kJobsPerStage = 64;
+    std::vector<float> data(kStages * kJobsPerStage * 256, 1.0f);
+
+    while (state.run()) {
+        TaskGroup groups[kStages];
+        for (int stage = 0; stage < kStages; ++stage) {
+            TaskGroup* dependency = stage > 0 ? &groups[stage - 1] : nullptr;
+            for (int job = 0; job < kJobsPerStage; ++job) {
+                size_t begin = static_cast<size_t>(stage * kJobsPerStage + job) * 256;
+                jobs.submit([&data, begin]() { transformRange(data, begin, begin + 256); },
+                            &groups[stage], {dependency});
+            }
+        }
+        jobs.wait(groups[kStages - 1]);
+    }
+    Bench::doNotOptimize(data[0]);
+    state.setItemsProcessed(kStages * kJobsPerStage);
+}
@@ -0,0 +1,136 @@
+/// Memory Benchmarks
+/// Core/Memory arenas and pools against new/delete for event and node churn
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr int kEventsPerFrame = 1024;
+constexpr int kNodesPerBatch = 256;
+
+} // namespace
+
+// ============================================================================
+// Event Churn (one frame worth of queued input events)
+// ============================================================================
+
+PINA_BENCHMARK(Memory_EventChurn_NewDelete) {
+    std::vector<Event*> events;
+    events.reserve(kEventsPerFrame);
+
+    while (state.run()) {
+        for (int i = 0; i < kEventsPerFrame; ++i) {
+            events.push_back(new MouseMovedEvent(glm::vec2(static_cast<float>(i)), glm::vec2(1.0f)));
+        }
+        for (Event* event : events) {
+            delete event;
+        }
+        events.clear();
+    }
+    state.setItemsProcessed(kEventsPerFrame);
+}
+
+PINA_BENCHMARK(Memory_EventChurn_Pool) {
+    PoolAllocator<MouseMovedEvent> pool(kEventsPerFrame);
+    std::vector<MouseMovedEvent*> events;
+    events.reserve(kEventsPerFrame);
+
+    while (state.run()) {
+        for (int i = 0; i < kEventsPerFrame; ++i) {
+            events.push_back(pool.create(glm::vec2(static_cast<float>(i)), glm::vec2(1.0f)));
+        }
+        for (MouseMovedEvent* event : events) {
+            pool.destroy(event);
+        }
+        events.clear();
+    }
+    state.setItemsProcessed(kEventsPerFrame);
+}
+
+PINA_BENCHMARK(Memory_EventChurn_FrameArena) {
+    FrameArena arena;
+    std::vector<Event*> events;
+    events.reserve(kEventsPerFrame);
+
+    while (state.run()) {
+        for (int i = 0; i < kEventsPerFrame; ++i) {
+            events.push_back(arena.create<MouseMovedEvent>(glm::vec2(static_cast<float>(i)), glm::vec2(1.0f)));
+        }
+        // MouseMovedEvent owns no resources, so the arena can drop them without destructors
+        events.clear();
+        arena.reset();
+    }
+    state.setItemsProcessed(kEventsPerFrame);
+}
+
+// ============================================================================
+// Node Churn (spawn and despawn a batch of scene nodes)
+// ============================================================================
+
+PINA_BENCHMARK(Memory_NodeChurn_NewDelete) {
+    std::vector<Node*> nodes;
+    nodes.reserve(kNodesPerBatch);
+
+    while (state.run()) {
+        for (int i = 0; i < kNodesPerBatch; ++i) {
+            nodes.push_back(new Node("Node"));
+        }
+        for (Node* node : nodes) {
+            delete node;
+        }
+        nodes.clear();
+    }
+    state.setItemsProcessed(kNodesPerBatch);
+}
+
+PINA_BENCHMARK(Memory_NodeChurn_Pool) {
+    PoolAllocator<Node> pool(kNodesPerBatch);
+    std::vector<Node*> nodes;
+    nodes.reserve(kNodesPerBatch);
+
+    while (state.run()) {
+        for (int i = 0; i < kNodesPerBatch; ++i) {
+            nodes.push_back(pool.create("Node"));
+        }
+        for (Node* node : nodes) {
+            pool.destroy(node);
+        }
+        nodes.clear();
+    }
+    state.setItemsProcessed(kNodesPerBatch);
+}
+
+// ============================================================================
+// Scratch Containers
+// ============================================================================
+
+PINA_BENCHMARK(Memory_ScratchVector_Heap) {
+    while (state.run()) {
+        std::vector<glm::mat4> matrices;
+        for (int i = 0; i < kNodesPerBatch; ++i) {
+            matrices.push_back(glm::mat4(1.0f));
+        }
+        Bench::doNotOptimize(matrices.back());
+    }
+    state.setItemsProcessed(kNodesPerBatch);
+}
+
+PINA_BENCHMARK(Memory_ScratchVector_FrameArena) {
+    FrameArena arena;
+
+    while (state.run()) {
+        {
+            FrameVector<glm::mat4> matrices{ArenaAllocator<glm::mat4, FrameArena>(&arena)};
+            for (int i = 0; i < kNodesPerBatch; ++i) {
+                matrices.push_back(glm::mat4(1.0f));
+            }
+            Bench::doNotOptimize(matrices.back());
+        }
+        arena.reset();
+    }
+    state.setItemsProcessed(kNodesPerBatch);
+}
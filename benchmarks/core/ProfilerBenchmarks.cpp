@@ -0,0 +1,42 @@
+/// Profiler Benchmarks
+/// Core/Profiler per-scope cost while disabled and while recording
+
+#include "Benchmark.h"
+#include <Pina.h>
+
+namespace {
+
+using namespace Pina;
+
+// Stays well below Profiler::EventsPerThread so nothing is dropped
+constexpr int kScopesPerIteration = 1024;
+
+} // namespace
+
+PINA_BENCHMARK(Profiler_Scope_Disabled) {
+    Profiler::setEnabled(false);
+
+    while (state.run()) {
+        for (int i = 0; i < kScopesPerIteration; ++i) {
+            ProfileScope scope("Disabled");
+            Bench::doNotOptimize(i);
+        }
+    }
+    state.setItemsProcessed(kScopesPerIteration);
+}
+
+PINA_BENCHMARK(Profiler_Scope_Recording) {
+    Profiler::clear();
+    Profiler::setEnabled(true);
+
+    while (state.run()) {
+        for (int i = 0; i < kScopesPerIteration; ++i) {
+            ProfileScope scope("Recording");
+            Bench::doNotOptimize(i);
+        }
+        Profiler::clear();
+    }
+    state.setItemsProcessed(kScopesPerIteration);
+
+    Profiler::setEnabled(false);
+}
@@ -0,0 +1,82 @@
+/// Pina Engine Benchmarks
+/// Entry point: runs all registered benchmarks (or those matching a filter)
+///
+/// Usage: pina-benchmarks [filter] [--min-time=seconds]
+
+#include "Benchmark.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+// Run a benchmark with growing iteration counts until it takes minTime
+Pina::Bench::State runBenchmark(const Pina::Bench::Benchmark& benchmark, double minTime) {
+    uint64_t iterations = 1;
+    while (true) {
+        Pina::Bench::State state(iterations);
+        benchmark.function(state);
+
+        double seconds = state.getSeconds();
+        if (seconds >= minTime || iterations >= (1ull << 30)) {
+            return state;
+        }
+
+        // Aim past minTime, growing at most 10x per round
+        double scale = seconds > 0.0 ? (minTime * 1.4) / seconds : 10.0;
+        if (scale > 10.0) scale = 10.0;
+        if (scale < 2.0) scale = 2.0;
+        iterations = static_cast<uint64_t>(static_cast<double>(iterations) * scale);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string filter;
+    double minTime = 0.5;
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--min-time=", 11) == 0) {
+            minTime = std::atof(argv[i] + 11);
+        } else {
+            filter = argv[i];
+        }
+    }
+
+    std::printf("%-48s %14s %12s %16s\n", "Benchmark", "Time/iter", "Iterations", "Items/s");
+    std::printf("%s\n", std::string(93, '-').c_str());
+
+    for (const auto& benchmark : Pina::Bench::getBenchmarks()) {
+        if (!filter.empty() && benchmark.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        Pina::Bench::State state = runBenchmark(benchmark, minTime);
+        double seconds = state.getSeconds();
+        double perIteration = seconds / static_cast<double>(state.getIterations());
+
+        const char* unit = "ns";
+        double value = perIteration * 1e9;
+        if (value >= 1e6) {
+            unit = "ms";
+            value /= 1e6;
+        } else if (value >= 1e3) {
+            unit = "us";
+            value /= 1e3;
+        }
+
+        char items[32] = "-";
+        if (state.getItemsProcessed() > 0 && seconds > 0.0) {
+            double rate = static_cast<double>(state.getItemsProcessed()) *
+                          static_cast<double>(state.getIterations()) / seconds;
+            std::snprintf(items, sizeof(items), "%.3fM", rate / 1e6);
+        }
+
+        std::printf("%-48s %11.3f %s %12llu %16s\n", benchmark.name.c_str(), value, unit,
+                    static_cast<unsigned long long>(state.getIterations()), items);
+    }
+
+    return 0;
+}
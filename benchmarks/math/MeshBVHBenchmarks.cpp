@@ -0,0 +1,133 @@
+/// Mesh BVH Benchmarks
+/// Math/MeshBVH build time (serial and on the job system) and raycasts against a brute-force triangle pass
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr int kRaysPerIteration = 1000;
+
+/// Wavy terrain grid of 2 * size * size triangles over a 100 x 100 square
+struct Terrain {
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> indices;
+
+    explicit Terrain(uint32_t size) {
+        const float step = 100.0f / size;
+        positions.reserve(static_cast<size_t>(size + 1) * (size + 1));
+        for (uint32_t z = 0; z <= size; ++z) {
+            for (uint32_t x = 0; x <= size; ++x) {
+                float px = x * step - 50.0f;
+                float pz = z * step - 50.0f;
+                positions.emplace_back(px, 3.0f * std::sin(px * 0.2f) * std::cos(pz * 0.15f), pz);
+            }
+        }
+        indices.reserve(static_cast<size_t>(size) * size * 6);
+        for (uint32_t z = 0; z < size; ++z) {
+            for (uint32_t x = 0; x < size; ++x) {
+                uint32_t i = z * (size + 1) + x;
+                indices.insert(indices.end(), {i, i + size + 1, i + 1, i + 1, i + size + 1, i + size + 2});
+            }
+        }
+    }
+
+    size_t triangleCount() const { return indices.size() / 3; }
+
+    /// Rays from above the terrain, aimed down at random points on it
+    std::vector<std::pair<glm::vec3, glm::vec3>> rays(int count) const {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(-50.0f, 50.0f);
+        std::vector<std::pair<glm::vec3, glm::vec3>> result;
+        for (int i = 0; i < count; ++i) {
+            glm::vec3 origin(position(rng), 30.0f, position(rng));
+            glm::vec3 target(position(rng), 0.0f, position(rng));
+            result.emplace_back(origin, glm::normalize(target - origin));
+        }
+        return result;
+    }
+};
+
+void build(Bench::State& state, uint32_t size, bool parallel) {
+    Terrain terrain(size);
+    JobSystem* jobs = parallel ? &Bench::getJobSystem() : nullptr;
+    MeshBVH bvh;
+    while (state.run()) {
+        bvh.build(terrain.positions.data(), terrain.indices.data(), terrain.triangleCount(), jobs);
+    }
+    state.setItemsProcessed(terrain.triangleCount());
+    Bench::doNotOptimize(bvh.getNodeCount());
+}
+
+void raycastBVH(Bench::State& state, uint32_t size) {
+    Terrain terrain(size);
+    auto rays = terrain.rays(kRaysPerIteration);
+    MeshBVH bvh;
+    bvh.build(terrain.positions.data(), terrain.indices.data(), terrain.triangleCount(), &Bench::getJobSystem());
+
+    size_t hits = 0;
+    while (state.run()) {
+        for (const auto& ray : rays) {
+            TriangleHit hit;
+            hits += bvh.raycast(terrain.positions.data(), terrain.indices.data(), ray.first, ray.second,
+                                1000.0f, hit);
+        }
+    }
+    state.setItemsProcessed(kRaysPerIteration);
+    Bench::doNotOptimize(hits);
+}
+
+void raycastBruteForce(Bench::State& state, uint32_t size, int rayCount) {
+    Terrain terrain(size);
+    auto rays = terrain.rays(rayCount);
+    const glm::vec3* positions = terrain.positions.data();
+    const uint32_t* indices = terrain.indices.data();
+
+    size_t hits = 0;
+    while (state.run()) {
+        for (const auto& ray : rays) {
+            float closest = 1000.0f;
+            bool found = false;
+            for (size_t t = 0; t < terrain.triangleCount(); ++t) {
+                float distance, u, v;
+                if (MeshBVH::intersectTriangle(ray.first, ray.second, positions[indices[t * 3]],
+                                               positions[indices[t * 3 + 1]], positions[indices[t * 3 + 2]],
+                                               closest, distance, u, v)) {
+                    closest = distance;
+                    found = true;
+                }
+            }
+            hits += found;
+        }
+    }
+    state.setItemsProcessed(rayCount);
+    Bench::doNotOptimize(hits);
+}
+
+} // namespace
+
+// ============================================================================
+// Build (items = triangles)
+// ============================================================================
+
+PINA_BENCHMARK(MeshBVH_Build_Serial_20k) { build(state, 100, false); }
+PINA_BENCHMARK(MeshBVH_Build_Parallel_20k) { build(state, 100, true); }
+PINA_BENCHMARK(MeshBVH_Build_Serial_500k) { build(state, 500, false); }
+PINA_BENCHMARK(MeshBVH_Build_Parallel_500k) { build(state, 500, true); }
+PINA_BENCHMARK(MeshBVH_Build_Serial_2M) { build(state, 1000, false); }
+PINA_BENCHMARK(MeshBVH_Build_Parallel_2M) { build(state, 1000, true); }
+
+// ============================================================================
+// Nearest-hit raycasts (items = rays)
+// ============================================================================
+
+PINA_BENCHMARK(MeshBVH_Ray_BruteForce_20k) { raycastBruteForce(state, 100, 100); }
+PINA_BENCHMARK(MeshBVH_Ray_BVH_20k) { raycastBVH(state, 100); }
+PINA_BENCHMARK(MeshBVH_Ray_BruteForce_2M) { raycastBruteForce(state, 1000, 4); }
+PINA_BENCHMARK(MeshBVH_Ray_BVH_2M) { raycastBVH(state, 1000); }
@@ -0,0 +1,279 @@
+/// SIMD Math Benchmarks
+/// Math/SimdMath batch kernels against the glm code they replace
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr size_t kMatrixCount = 10000;
+constexpr size_t kPointCount = 100000;
+
+/// Random inputs shared by every benchmark
+struct Inputs {
+    std::vector<glm::vec3> positions;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::vec3> scales;
+    std::vector<glm::mat4> matrices;
+    std::vector<glm::mat4> others;
+    std::vector<BoundingBox> boxes;
+    std::vector<glm::vec3> points;
+
+    Inputs() {
+        std::mt19937 rng(1);
+        std::uniform_real_distribution<float> value(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+        auto vec = [&]() { return glm::vec3(value(rng), value(rng), value(rng)); };
+
+        for (size_t i = 0; i < kMatrixCount; ++i) {
+            positions.push_back(vec());
+            rotations.push_back(glm::angleAxis(value(rng), glm::normalize(vec() + 0.01f)));
+            scales.push_back(glm::vec3(scale(rng), scale(rng), scale(rng)));
+            matrices.push_back(glm::translate(glm::mat4(1.0f), positions.back()) *
+                               glm::mat4_cast(rotations.back()) * glm::scale(glm::mat4(1.0f), scales.back()));
+            others.push_back(glm::translate(glm::mat4(1.0f), vec()) * glm::mat4_cast(rotations.back()));
+
+            BoundingBox box;
+            box.expand(vec());
+            box.expand(vec());
+            boxes.push_back(box);
+        }
+        for (size_t i = 0; i < kPointCount; ++i) {
+            points.push_back(vec());
+        }
+    }
+};
+
+const Inputs& inputs() {
+    static Inputs s_inputs;
+    return s_inputs;
+}
+
+/// The 8-corner box transform used before SimdMath
+BoundingBox transformCorners(const glm::mat4& m, const BoundingBox& box) {
+    BoundingBox result;
+    for (int corner = 0; corner < 8; ++corner) {
+        glm::vec3 p((corner & 1) ? box.max.x : box.min.x,
+                    (corner & 2) ? box.max.y : box.min.y,
+                    (corner & 4) ? box.max.z : box.min.z);
+        result.expand(glm::vec3(m * glm::vec4(p, 1.0f)));
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// TRS composition
+// ============================================================================
+
+PINA_BENCHMARK(SimdMath_ComposeTRS_Glm) {
+    const Inputs& in = inputs();
+    std::vector<glm::mat4> out(kMatrixCount);
+
+    while (state.run()) {
+        for (size_t i = 0; i < kMatrixCount; ++i) {
+            out[i] = glm::translate(glm::mat4(1.0f), in.positions[i]) * glm::mat4_cast(in.rotations[i]) *
+                     glm::scale(glm::mat4(1.0f), in.scales[i]);
+        }
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+PINA_BENCHMARK(SimdMath_ComposeTRS_Simd) {
+    const Inputs& in = inputs();
+    std::vector<glm::mat4> out(kMatrixCount);
+
+    while (state.run()) {
+        SimdMath::composeTRS(in.positions.data(), in.rotations.data(), in.scales.data(), out.data(), kMatrixCount);
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+// ============================================================================
+// Matrix multiply and inverse
+// ============================================================================
+
+PINA_BENCHMARK(SimdMath_Multiply_Glm) {
+    const Inputs& in = inputs();
+    std::vector<glm::mat4> out(kMatrixCount);
+
+    while (state.run()) {
+        for (size_t i = 0; i < kMatrixCount; ++i) {
+            out[i] = in.others[i] * in.matrices[i];
+        }
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+PINA_BENCHMARK(SimdMath_Multiply_Simd) {
+    const Inputs& in = inputs();
+    std::vector<glm::mat4> out(kMatrixCount);
+
+    while (state.run()) {
+        SimdMath::multiplyAffine(in.others.data(), in.matrices.data(), out.data(), kMatrixCount);
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+PINA_BENCHMARK(SimdMath_Inverse_Glm) {
+    const Inputs& in = inputs();
+    std::vector<glm::mat4> out(kMatrixCount);
+
+    while (state.run()) {
+        for (size_t i = 0; i < kMatrixCount; ++i) {
+            out[i] = glm::inverse(in.matrices[i]);
+        }
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+PINA_BENCHMARK(SimdMath_Inverse_Simd) {
+    const Inputs& in = inputs();
+    std::vector<glm::mat4> out(kMatrixCount);
+
+    while (state.run()) {
+        SimdMath::inverseAffine(in.matrices.data(), out.data(), kMatrixCount);
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+PINA_BENCHMARK(SimdMath_NormalMatrix_Glm) {
+    const Inputs& in = inputs();
+    std::vector<glm::mat3> out(kMatrixCount);
+
+    while (state.run()) {
+        for (size_t i = 0; i < kMatrixCount; ++i) {
+            out[i] = glm::transpose(glm::inverse(glm::mat3(in.matrices[i])));
+        }
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+PINA_BENCHMARK(SimdMath_NormalMatrix_Simd) {
+    const Inputs& in = inputs();
+    std::vector<glm::mat3> out(kMatrixCount);
+
+    while (state.run()) {
+        SimdMath::normalMatrix(in.matrices.data(), out.data(), kMatrixCount);
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+// ============================================================================
+// Points, normals and boxes
+// ============================================================================
+
+PINA_BENCHMARK(SimdMath_TransformPoints_Glm) {
+    const Inputs& in = inputs();
+    const glm::mat4& m = in.matrices[0];
+    std::vector<glm::vec3> out(kPointCount);
+
+    while (state.run()) {
+        for (size_t i = 0; i < kPointCount; ++i) {
+            out[i] = glm::vec3(m * glm::vec4(in.points[i], 1.0f));
+        }
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kPointCount);
+}
+
+PINA_BENCHMARK(SimdMath_TransformPoints_Simd) {
+    const Inputs& in = inputs();
+    std::vector<glm::vec3> out(kPointCount);
+
+    while (state.run()) {
+        SimdMath::transformPoints(in.matrices[0], in.points.data(), out.data(), kPointCount);
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kPointCount);
+}
+
+PINA_BENCHMARK(SimdMath_TransformNormals_Glm) {
+    const Inputs& in = inputs();
+    glm::mat3 n = glm::transpose(glm::inverse(glm::mat3(in.matrices[0])));
+    std::vector<glm::vec3> out(kPointCount);
+
+    while (state.run()) {
+        for (size_t i = 0; i < kPointCount; ++i) {
+            out[i] = glm::normalize(n * in.points[i]);
+        }
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kPointCount);
+}
+
+PINA_BENCHMARK(SimdMath_TransformNormals_Simd) {
+    const Inputs& in = inputs();
+    glm::mat3 n = SimdMath::normalMatrix(in.matrices[0]);
+    std::vector<glm::vec3> out(kPointCount);
+
+    while (state.run()) {
+        SimdMath::transformNormals(n, in.points.data(), out.data(), kPointCount);
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kPointCount);
+}
+
+PINA_BENCHMARK(SimdMath_TransformBoxes_Corners) {
+    const Inputs& in = inputs();
+    std::vector<BoundingBox> out(kMatrixCount);
+
+    while (state.run()) {
+        for (size_t i = 0; i < kMatrixCount; ++i) {
+            out[i] = transformCorners(in.matrices[i], in.boxes[i]);
+        }
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+PINA_BENCHMARK(SimdMath_TransformBoxes_Simd) {
+    const Inputs& in = inputs();
+    std::vector<BoundingBox> out(kMatrixCount);
+
+    while (state.run()) {
+        SimdMath::transformBoxes(in.matrices.data(), in.boxes.data(), out.data(), kMatrixCount);
+        Bench::doNotOptimize(out.data());
+    }
+    state.setItemsProcessed(kMatrixCount);
+}
+
+PINA_BENCHMARK(SimdMath_ExpandBox_Glm) {
+    const Inputs& in = inputs();
+    BoundingBox box;
+
+    while (state.run()) {
+        box = BoundingBox();
+        for (const glm::vec3& p : in.points) {
+            box.expand(p);
+        }
+        Bench::doNotOptimize(box);
+    }
+    state.setItemsProcessed(kPointCount);
+}
+
+PINA_BENCHMARK(SimdMath_ExpandBox_Simd) {
+    const Inputs& in = inputs();
+    BoundingBox box;
+
+    while (state.run()) {
+        box = BoundingBox();
+        SimdMath::expandBox(box, in.points.data(), kPointCount);
+        Bench::doNotOptimize(box);
+    }
+    state.setItemsProcessed(kPointCount);
+}
@@ -0,0 +1,124 @@
+/// Render Queue Benchmarks
+/// Graphics/RenderQueue radix sort against std::sort, and SceneRenderer gather/sort/submit with a serial and a job system gather,
+/// with and without instancing
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr size_t kMeshCount = 8;
+constexpr size_t kMaterialCount = 16;
+
+/// Keys spread over a few states and many depths, like a real opaque pass
+std::vector<uint64_t> randomKeys(size_t count) {
+    std::mt19937_64 rng(11);
+    std::vector<uint64_t> keys(count);
+    for (uint64_t& key : keys) {
+        key = (rng() % kMaterialCount) << 40 | (rng() % kMeshCount) << 24 | (rng() & 0xffffff);
+    }
+    return keys;
+}
+
+/// Cubes in front of the camera, each with one of kMeshCount meshes and
+/// kMaterialCount materials, assigned at random
+struct Field {
+    RecordingDevice device;
+    Scene scene;
+    Camera* camera = nullptr;
+    UNIQUE<Shader> shader;
+    UNIQUE<Shader> instancedShader;
+    SceneRenderer renderer{&device};
+
+    explicit Field(size_t count) {
+        device.setRecording(false);
+        scene.setDevice(&device);
+        shader = device.createShader();
+        instancedShader = device.createShader();
+        renderer.setFrustumCulling(false);
+
+        std::vector<StaticMesh*> meshes;
+        for (size_t i = 0; i < kMeshCount; ++i) {
+            meshes.push_back(scene.createCube("Mesh")->getMesh());
+        }
+        std::vector<Material> materials;
+        for (size_t i = 0; i < kMaterialCount; ++i) {
+            materials.push_back(Material::createPlastic(Color(i / float(kMaterialCount), 0.5f, 0.5f)));
+        }
+
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> position(-40.0f, 40.0f);
+        std::uniform_real_distribution<float> depth(-90.0f, -5.0f);
+        for (size_t i = 0; i < count; ++i) {
+            Node* node = scene.createNode("Cube");
+            node->setMesh(meshes[rng() % kMeshCount]);
+            node->setMaterial(materials[rng() % kMaterialCount]);
+            node->getTransform().setLocalPosition(glm::vec3(position(rng), position(rng), depth(rng)));
+        }
+        camera = scene.getOrCreateDefaultCamera();
+        scene.update(0.0f);
+    }
+};
+
+void sortRadix(Bench::State& state, size_t count) {
+    std::vector<uint64_t> keys = randomKeys(count);
+    RenderQueue queue;
+    for (uint64_t key : keys) {
+        RenderItem item;
+        item.key = key;
+        queue.add(item);
+    }
+    while (state.run()) {
+        queue.sort();
+    }
+    state.setItemsProcessed(count);
+    Bench::doNotOptimize(queue.getOrder().front());
+}
+
+void sortStd(Bench::State& state, size_t count) {
+    std::vector<uint64_t> keys = randomKeys(count);
+    std::vector<uint32_t> order(count);
+    while (state.run()) {
+        for (size_t i = 0; i < count; ++i) {
+            order[i] = static_cast<uint32_t>(i);
+        }
+        std::stable_sort(order.begin(), order.end(), [&keys](uint32_t a, uint32_t b) {
+            return keys[a] < keys[b];
+        });
+    }
+    state.setItemsProcessed(count);
+    Bench::doNotOptimize(order.front());
+}
+
+void render(Bench::State& state, size_t count, bool parallel, bool instanced = false) {
+    Field field(count);
+    field.renderer.setJobSystem(parallel ? &Bench::getJobSystem() : nullptr);
+    field.renderer.setInstancedShader(instanced ? field.instancedShader.get() : nullptr);
+    while (state.run()) {
+        field.renderer.renderOpaque(&field.scene, field.shader.get(), field.camera);
+    }
+    state.setItemsProcessed(count);
+    Bench::doNotOptimize(field.renderer.getQueueStats().materialChanges);
+}
+
+} // namespace
+
+// ============================================================================
+// Sort keys (items = draws)
+// ============================================================================
+
+PINA_BENCHMARK(RenderQueue_Sort_StableSort_100k) { sortStd(state, 100000); }
+PINA_BENCHMARK(RenderQueue_Sort_Radix_100k) { sortRadix(state, 100000); }
+
+// ============================================================================
+// Gather, sort and submit an opaque pass (items = nodes)
+// ============================================================================
+
+PINA_BENCHMARK(RenderQueue_Render_Serial_20k) { render(state, 20000, false); }
+PINA_BENCHMARK(RenderQueue_Render_Parallel_20k) { render(state, 20000, true); }
+PINA_BENCHMARK(RenderQueue_Render_Instanced_20k) { render(state, 20000, false, true); }
@@ -0,0 +1,409 @@
+/// Scene Benchmarks
+/// Scene/NodePool handles, index links and traversal against the unique_ptr child vectors and recursive walks they replaced
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <functional>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr int kGroups = 1000;
+constexpr int kNodesPerGroup = 1000;    // 1M nodes below the groups
+constexpr int kReparentsPerFrame = 10000;
+constexpr int kLookupsPerFrame = 100000;
+
+/// The Node/Scene pair before NodePool: every node is its own heap
+/// allocation owned by its parent's child vector, reparenting searches the
+/// old parent's vector, and IDs resolve through a hash map
+struct OwnedNode {
+    uint64_t id = 0;
+    std::string name;
+    bool enabled = true;
+    Transform transform;
+    OwnedNode* parent = nullptr;
+    std::vector<UNIQUE<OwnedNode>> children;
+    Model* model = nullptr;
+    StaticMesh* mesh = nullptr;
+    Material material;
+    bool hasMaterial = false;
+    bool castsShadow = true;
+    bool receivesShadow = true;
+};
+
+struct OwnedScene {
+    UNIQUE<OwnedNode> root = MAKE_UNIQUE<OwnedNode>();
+    std::unordered_map<uint64_t, OwnedNode*> nodesByID;
+    uint64_t nextID = 1;
+
+    OwnedNode* createNode(const std::string& name, OwnedNode* parent) {
+        auto node = MAKE_UNIQUE<OwnedNode>();
+        node->id = nextID++;
+        node->name = name;
+        node->parent = parent;
+        node->transform.setParent(&parent->transform);
+        nodesByID[node->id] = node.get();
+        parent->children.push_back(std::move(node));
+        return parent->children.back().get();
+    }
+
+    void setParent(OwnedNode* node, OwnedNode* newParent) {
+        auto& siblings = node->parent->children;
+        for (auto it = siblings.begin(); it != siblings.end(); ++it) {
+            if (it->get() == node) {
+                it->release();
+                siblings.erase(it);
+                break;
+            }
+        }
+        node->parent = newParent;
+        newParent->children.push_back(UNIQUE<OwnedNode>(node));
+        node->transform.setParent(&newParent->transform);
+    }
+
+    void unregister(OwnedNode* node) {
+        nodesByID.erase(node->id);
+        for (auto& child : node->children) {
+            unregister(child.get());
+        }
+    }
+
+    void destroyChildren(OwnedNode* node) {
+        for (auto& child : node->children) {
+            unregister(child.get());
+        }
+        node->children.clear();
+    }
+
+    void traverse(OwnedNode* node, const std::function<void(OwnedNode*)>& callback) {
+        callback(node);
+        for (auto& child : node->children) {
+            traverse(child.get(), callback);
+        }
+    }
+};
+
+/// Root -> kGroups groups -> kNodesPerGroup leaves each
+template<typename SceneT, typename NodeT>
+std::vector<NodeT*> buildGroups(SceneT& scene, NodeT* root, std::vector<NodeT*>* leaves) {
+    std::vector<NodeT*> groups;
+    groups.reserve(kGroups);
+    for (int g = 0; g < kGroups; ++g) {
+        groups.push_back(scene.createNode("Group", root));
+    }
+    for (NodeT* group : groups) {
+        for (int i = 0; i < kNodesPerGroup; ++i) {
+            NodeT* leaf = scene.createNode("Leaf", group);
+            if (leaves) {
+                leaves->push_back(leaf);
+            }
+        }
+    }
+    return groups;
+}
+
+} // namespace
+
+// ============================================================================
+// Build and tear down 1M nodes
+// ============================================================================
+
+PINA_BENCHMARK(Scene_BuildDestroy_UniquePtr) {
+    while (state.run()) {
+        OwnedScene scene;
+        buildGroups<OwnedScene, OwnedNode>(scene, scene.root.get(), nullptr);
+        scene.destroyChildren(scene.root.get());
+    }
+    state.setItemsProcessed(static_cast<uint64_t>(kGroups) * kNodesPerGroup);
+}
+
+PINA_BENCHMARK(Scene_BuildDestroy_Pool) {
+    while (state.run()) {
+        Scene scene;
+        buildGroups<Scene, Node>(scene, scene.getRoot(), nullptr);
+        scene.getRoot()->removeAllChildren();
+    }
+    state.setItemsProcessed(static_cast<uint64_t>(kGroups) * kNodesPerGroup);
+}
+
+// ============================================================================
+// Reparent 10k random leaves between groups
+// ============================================================================
+
+PINA_BENCHMARK(Scene_Reparent_UniquePtr) {
+    OwnedScene scene;
+    std::vector<OwnedNode*> leaves;
+    std::vector<OwnedNode*> groups = buildGroups<OwnedScene, OwnedNode>(scene, scene.root.get(), &leaves);
+    std::mt19937 rng(1);
+
+    while (state.run()) {
+        for (int i = 0; i < kReparentsPerFrame; ++i) {
+            scene.setParent(leaves[rng() % leaves.size()], groups[rng() % groups.size()]);
+        }
+    }
+    state.setItemsProcessed(kReparentsPerFrame);
+    scene.destroyChildren(scene.root.get());
+}
+
+PINA_BENCHMARK(Scene_Reparent_Pool) {
+    Scene scene;
+    std::vector<Node*> leaves;
+    std::vector<Node*> groups = buildGroups<Scene, Node>(scene, scene.getRoot(), &leaves);
+    std::mt19937 rng(1);
+
+    while (state.run()) {
+        for (int i = 0; i < kReparentsPerFrame; ++i) {
+            leaves[rng() % leaves.size()]->setParent(groups[rng() % groups.size()]);
+        }
+    }
+    state.setItemsProcessed(kReparentsPerFrame);
+}
+
+// ============================================================================
+// Visit every node
+// ============================================================================
+
+PINA_BENCHMARK(Scene_Traverse_UniquePtr) {
+    OwnedScene scene;
+    buildGroups<OwnedScene, OwnedNode>(scene, scene.root.get(), nullptr);
+    size_t enabled = 0;
+
+    while (state.run()) {
+        scene.traverse(scene.root.get(), [&enabled](OwnedNode* node) { enabled += node->enabled; });
+    }
+    state.setItemsProcessed(scene.nodesByID.size());
+    Bench::doNotOptimize(enabled);
+    scene.destroyChildren(scene.root.get());
+}
+
+PINA_BENCHMARK(Scene_Traverse_Pool) {
+    Scene scene;
+    buildGroups<Scene, Node>(scene, scene.getRoot(), nullptr);
+    size_t enabled = 0;
+
+    while (state.run()) {
+        scene.traverse([&enabled](Node* node) { enabled += node->isEnabled(); });
+    }
+    state.setItemsProcessed(scene.getNodeCount());
+    Bench::doNotOptimize(enabled);
+}
+
+PINA_BENCHMARK(Scene_ForEachNode_Pool) {
+    Scene scene;
+    buildGroups<Scene, Node>(scene, scene.getRoot(), nullptr);
+    size_t enabled = 0;
+
+    while (state.run()) {
+        scene.forEachNode([&enabled](Node* node) { enabled += node->isEnabled(); });
+    }
+    state.setItemsProcessed(scene.getNodeCount());
+    Bench::doNotOptimize(enabled);
+}
+
+// ============================================================================
+// Look up 100k random nodes by ID
+// ============================================================================
+
+PINA_BENCHMARK(Scene_FindByID_UniquePtr) {
+    OwnedScene scene;
+    std::vector<OwnedNode*> leaves;
+    buildGroups<OwnedScene, OwnedNode>(scene, scene.root.get(), &leaves);
+    std::vector<uint64_t> ids;
+    std::mt19937 rng(1);
+    for (int i = 0; i < kLookupsPerFrame; ++i) {
+        ids.push_back(leaves[rng() % leaves.size()]->id);
+    }
+    size_t found = 0;
+
+    while (state.run()) {
+        for (uint64_t id : ids) {
+            found += scene.nodesByID.find(id) != scene.nodesByID.end();
+        }
+    }
+    state.setItemsProcessed(kLookupsPerFrame);
+    Bench::doNotOptimize(found);
+    scene.destroyChildren(scene.root.get());
+}
+
+PINA_BENCHMARK(Scene_FindByID_Pool) {
+    Scene scene;
+    std::vector<Node*> leaves;
+    buildGroups<Scene, Node>(scene, scene.getRoot(), &leaves);
+    std::vector<uint64_t> ids;
+    std::mt19937 rng(1);
+    for (int i = 0; i < kLookupsPerFrame; ++i) {
+        ids.push_back(leaves[rng() % leaves.size()]->getID());
+    }
+    size_t found = 0;
+
+    while (state.run()) {
+        for (uint64_t id : ids) {
+            found += scene.findNode(id) != nullptr;
+        }
+    }
+    state.setItemsProcessed(kLookupsPerFrame);
+    Bench::doNotOptimize(found);
+}
+
+// ============================================================================
+// Walk 100k nodes in hierarchy order (as SceneRenderer does)
+// ============================================================================
+
+namespace {
+
+constexpr int kWalkGroups = 100;
+constexpr int kWalkSubgroups = 10;
+constexpr int kWalkLeaves = 99;         // ~100k nodes, three levels deep
+
+void buildWalkScene(Scene& scene) {
+    for (int g = 0; g < kWalkGroups; ++g) {
+        Node* group = scene.createNode("Group");
+        for (int s = 0; s < kWalkSubgroups; ++s) {
+            Node* subgroup = group->addChild("Subgroup");
+            for (int i = 0; i < kWalkLeaves; ++i) {
+                subgroup->addChild("Leaf")->setEnabled(i % 8 != 0);
+            }
+        }
+    }
+}
+
+/// SceneRenderer::renderNodeRecursive before the iterators: one call frame
+/// and one std::function call per node
+void walkRecursive(Node* node, const std::function<void(Node*)>& callback) {
+    if (!node->isEnabled()) return;
+    callback(node);
+    for (Node* child = node->getFirstChild(); child; child = child->getNextSibling()) {
+        walkRecursive(child, callback);
+    }
+}
+
+} // namespace
+
+PINA_BENCHMARK(Scene_Walk_Recursive) {
+    Scene scene;
+    buildWalkScene(scene);
+    size_t visited = 0;
+
+    while (state.run()) {
+        walkRecursive(scene.getRoot(), [&visited](Node* node) { visited += node->hasModel() ? 2 : 1; });
+    }
+    state.setItemsProcessed(scene.getNodeCount());
+    Bench::doNotOptimize(visited);
+}
+
+PINA_BENCHMARK(Scene_Walk_TraverseEnabled) {
+    Scene scene;
+    buildWalkScene(scene);
+    size_t visited = 0;
+
+    while (state.run()) {
+        scene.traverseEnabled([&visited](Node* node) { visited += node->hasModel() ? 2 : 1; });
+    }
+    state.setItemsProcessed(scene.getNodeCount());
+    Bench::doNotOptimize(visited);
+}
+
+PINA_BENCHMARK(Scene_Walk_Visitor) {
+    Scene scene;
+    buildWalkScene(scene);
+    size_t visited = 0;
+
+    while (state.run()) {
+        scene.visitEnabled([&visited](Node* node) { visited += node->hasModel() ? 2 : 1; });
+    }
+    state.setItemsProcessed(scene.getNodeCount());
+    Bench::doNotOptimize(visited);
+}
+
+PINA_BENCHMARK(Scene_Walk_Iterator) {
+    Scene scene;
+    buildWalkScene(scene);
+    size_t visited = 0;
+
+    while (state.run()) {
+        for (NodeIterator it(scene.getRoot(), true); it; ++it) {
+            visited += it->hasModel() ? 2 : 1;
+        }
+    }
+    state.setItemsProcessed(scene.getNodeCount());
+    Bench::doNotOptimize(visited);
+}
+
+// ============================================================================
+// Look up 100 named nodes among 100k by name
+// ============================================================================
+
+namespace {
+
+constexpr int kNamedTargets = 100;
+
+/// Walk scene plus kNamedTargets uniquely named nodes spread through it
+std::vector<std::string> buildNamedScene(Scene& scene) {
+    buildWalkScene(scene);
+    std::vector<Node*> subgroups;
+    scene.visit([&subgroups](Node* node) {
+        if (node->getName() == "Subgroup") subgroups.push_back(node);
+    });
+
+    std::vector<std::string> names;
+    for (int i = 0; i < kNamedTargets; ++i) {
+        names.push_back("Target" + std::to_string(i));
+        subgroups[(static_cast<size_t>(i) * 7919) % subgroups.size()]->addChild(names.back());
+    }
+    return names;
+}
+
+/// Node::findDescendant before the name index: children first, then a
+/// recursive string-compare search
+Node* findDescendantRecursive(Node* node, const std::string& name) {
+    for (Node* child = node->getFirstChild(); child; child = child->getNextSibling()) {
+        if (child->getName() == name) return child;
+    }
+    for (Node* child = node->getFirstChild(); child; child = child->getNextSibling()) {
+        if (Node* found = findDescendantRecursive(child, name)) return found;
+    }
+    return nullptr;
+}
+
+} // namespace
+
+PINA_BENCHMARK(Scene_FindByName_Search) {
+    Scene scene;
+    std::vector<std::string> names = buildNamedScene(scene);
+    size_t found = 0;
+
+    while (state.run()) {
+        for (const std::string& name : names) {
+            found += findDescendantRecursive(scene.getRoot(), name) != nullptr;
+        }
+    }
+    state.setItemsProcessed(names.size());
+    Bench::doNotOptimize(found);
+}
+
+PINA_BENCHMARK(Scene_FindByName_Index) {
+    Scene scene;
+    std::vector<std::string> names = buildNamedScene(scene);
+
+    // Names shared by ~1k and ~100k nodes must stay as cheap as unique ones
+    const std::string duplicates[] = {"Subgroup", "Leaf"};
+    size_t found = 0;
+
+    while (state.run()) {
+        for (const std::string& name : names) {
+            found += scene.findNode(name) != nullptr;
+        }
+        for (const std::string& name : duplicates) {
+            found += scene.findNode(name) != nullptr;
+        }
+        found += scene.findNodeByPath("Group/Subgroup/Leaf") != nullptr;
+    }
+    state.setItemsProcessed(names.size() + 3);
+    Bench::doNotOptimize(found);
+}
+
@@ -0,0 +1,193 @@
+/// Spatial Benchmarks
+/// Scene/SpatialIndex queries and incremental refit against brute-force passes over every node's world bounds
+
+#include "Benchmark.h"
+#include <Pina.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr float kWorldSize = 1000.0f;   // Nodes spread over a square this wide
+constexpr int kQueriesPerFrame = 100;
+
+/// Unit cubes scattered over the XZ plane, sharing one mesh
+struct Field {
+    RecordingDevice device;
+    Scene scene;
+    std::vector<Node*> nodes;
+    std::mt19937 rng{3};
+
+    explicit Field(size_t count) {
+        scene.setDevice(&device);
+
+        StaticMesh* mesh = nullptr;
+        std::uniform_real_distribution<float> position(-kWorldSize * 0.5f, kWorldSize * 0.5f);
+        std::uniform_real_distribution<float> height(0.0f, 20.0f);
+        nodes.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            Node* node;
+            if (!mesh) {
+                node = scene.createCube("Cube");
+                mesh = node->getMesh();
+            } else {
+                node = scene.createNode("Cube");
+            }
+            node->getTransform().setLocalPosition(glm::vec3(position(rng), height(rng), position(rng)));
+            node->setMesh(mesh);
+            nodes.push_back(node);
+        }
+        scene.update(0.0f);
+    }
+
+    /// Camera on the ground looking across the field (sees a few percent)
+    std::vector<Frustum> frustums(int count) {
+        std::uniform_real_distribution<float> position(-kWorldSize * 0.5f, kWorldSize * 0.5f);
+        glm::mat4 projection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f);
+        std::vector<Frustum> result;
+        for (int i = 0; i < count; ++i) {
+            glm::vec3 eye(position(rng), 10.0f, position(rng));
+            glm::vec3 target(position(rng), 10.0f, position(rng));
+            result.emplace_back(projection * glm::lookAt(eye, target, glm::vec3(0.0f, 1.0f, 0.0f)));
+        }
+        return result;
+    }
+
+    std::vector<Ray> rays(int count) {
+        std::uniform_real_distribution<float> position(-kWorldSize * 0.5f, kWorldSize * 0.5f);
+        std::vector<Ray> result;
+        for (int i = 0; i < count; ++i) {
+            glm::vec3 origin(position(rng), 10.0f, position(rng));
+            glm::vec3 target(position(rng), 0.0f, position(rng));
+            result.emplace_back(origin, target - origin);
+        }
+        return result;
+    }
+};
+
+void frustumBruteForce(Bench::State& state, size_t count) {
+    Field field(count);
+    std::vector<Frustum> frustums = field.frustums(kQueriesPerFrame);
+    size_t visible = 0;
+    while (state.run()) {
+        for (const Frustum& frustum : frustums) {
+            for (Node* node : field.nodes) {
+                visible += frustum.intersects(node->getTransform().getWorldBounds());
+            }
+        }
+    }
+    state.setItemsProcessed(kQueriesPerFrame);
+    Bench::doNotOptimize(visible);
+}
+
+void frustumIndex(Bench::State& state, size_t count) {
+    Field field(count);
+    std::vector<Frustum> frustums = field.frustums(kQueriesPerFrame);
+    const SpatialIndex& index = field.scene.getSpatialIndex();
+    std::vector<Node*> found;
+    size_t visible = 0;
+    while (state.run()) {
+        for (const Frustum& frustum : frustums) {
+            index.queryFrustum(frustum, found);
+            visible += found.size();
+        }
+    }
+    state.setItemsProcessed(kQueriesPerFrame);
+    Bench::doNotOptimize(visible);
+}
+
+void rayBruteForce(Bench::State& state, size_t count) {
+    Field field(count);
+    std::vector<Ray> rays = field.rays(kQueriesPerFrame);
+    size_t hits = 0;
+    while (state.run()) {
+        for (const Ray& ray : rays) {
+            glm::vec3 origin = ray.origin;
+            glm::vec3 invDirection = glm::vec3(1.0f) / glm::vec3(ray.direction);
+            Node* closest = nullptr;
+            float closestDistance = kWorldSize;
+            for (Node* node : field.nodes) {
+                float entry;
+                if (node->getTransform().getWorldBounds().intersectsRay(origin, invDirection, closestDistance, entry)) {
+                    closest = node;
+                    closestDistance = entry;
+                }
+            }
+            hits += closest != nullptr;
+        }
+    }
+    state.setItemsProcessed(kQueriesPerFrame);
+    Bench::doNotOptimize(hits);
+}
+
+void rayIndex(Bench::State& state, size_t count) {
+    Field field(count);
+    std::vector<Ray> rays = field.rays(kQueriesPerFrame);
+    const SpatialIndex& index = field.scene.getSpatialIndex();
+    size_t hits = 0;
+    while (state.run()) {
+        for (const Ray& ray : rays) {
+            hits += index.raycastBounds(ray, kWorldSize) != nullptr;
+        }
+    }
+    state.setItemsProcessed(kQueriesPerFrame);
+    Bench::doNotOptimize(hits);
+}
+
+/// Move some nodes a little each frame, then update the scene
+void refit(Bench::State& state, size_t count, size_t moving) {
+    Field field(count);
+    std::uniform_real_distribution<float> step(-0.5f, 0.5f);
+    std::vector<glm::vec3> steps;
+    for (int i = 0; i < 64; ++i) {
+        steps.emplace_back(step(field.rng), 0.0f, step(field.rng));
+    }
+
+    const size_t stride = moving ? count / moving : 0;
+    size_t frame = 0;
+    while (state.run()) {
+        for (size_t i = 0; stride && i < field.nodes.size(); i += stride) {
+            size_t node = i + frame % stride;
+            field.nodes[node]->getTransform().translate(steps[(node + frame) % steps.size()]);
+        }
+        field.scene.update(0.0f);
+        frame++;
+    }
+    state.setItemsProcessed(count);
+    Bench::doNotOptimize(field.scene.getSpatialIndex().getLastRefitCount());
+}
+
+} // namespace
+
+// ============================================================================
+// 100 frustum queries (camera far plane 150 over a 1000 x 1000 field)
+// ============================================================================
+
+PINA_BENCHMARK(Spatial_Frustum_BruteForce_1k) { frustumBruteForce(state, 1000); }
+PINA_BENCHMARK(Spatial_Frustum_Index_1k) { frustumIndex(state, 1000); }
+PINA_BENCHMARK(Spatial_Frustum_BruteForce_10k) { frustumBruteForce(state, 10000); }
+PINA_BENCHMARK(Spatial_Frustum_Index_10k) { frustumIndex(state, 10000); }
+PINA_BENCHMARK(Spatial_Frustum_BruteForce_100k) { frustumBruteForce(state, 100000); }
+PINA_BENCHMARK(Spatial_Frustum_Index_100k) { frustumIndex(state, 100000); }
+
+// ============================================================================
+// 100 nearest-hit raycasts
+// ============================================================================
+
+PINA_BENCHMARK(Spatial_Ray_BruteForce_1k) { rayBruteForce(state, 1000); }
+PINA_BENCHMARK(Spatial_Ray_Index_1k) { rayIndex(state, 1000); }
+PINA_BENCHMARK(Spatial_Ray_BruteForce_10k) { rayBruteForce(state, 10000); }
+PINA_BENCHMARK(Spatial_Ray_Index_10k) { rayIndex(state, 10000); }
+PINA_BENCHMARK(Spatial_Ray_BruteForce_100k) { rayBruteForce(state, 100000); }
+PINA_BENCHMARK(Spatial_Ray_Index_100k) { rayIndex(state, 100000); }
+
+// ============================================================================
+// Scene::update() with 100k tracked nodes, a fraction of them moving
+// ============================================================================
+
+PINA_BENCHMARK(Spatial_Refit_100k_Static) { refit(state, 100000, 0); }
+PINA_BENCHMARK(Spatial_Refit_100k_Moving1Percent) { refit(state, 100000, 1000); }
+PINA_BENCHMARK(Spatial_Refit_100k_Moving10Percent) { refit(state, 100000, 10000); }
@@ -0,0 +1,407 @@
+/// Transform Benchmarks
+/// Scene/TransformSystem batched updates against the recursive dirty-marking Transform it replaced
+
+#include "Benchmark.h"
+#include <Pina.h>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/matrix_decompose.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+using namespace Pina;
+
+constexpr int kWideChildren = 50000;
+constexpr int kDeepChains = 50;
+constexpr int kDeepChainLength = 1000;
+constexpr int kSettersPerFrame = 10;
+
+/// The Transform/Node pair before TransformSystem: every setter marks the
+/// whole subtree dirty and world matrices recurse up through the parents
+struct RecursiveTransform {
+    glm::vec3 position{0.0f};
+    glm::quat rotation{1.0f, 0.0f, 0.0f, 0.0f};
+    glm::vec3 scale{1.0f};
+    mutable glm::mat4 localMatrix{1.0f};
+    mutable glm::mat4 worldMatrix{1.0f};
+    mutable bool dirty = true;
+    mutable bool worldDirty = true;
+
+    RecursiveTransform* parent = nullptr;
+    std::vector<RecursiveTransform*> children;
+
+    void setLocalPosition(const glm::vec3& value) {
+        position = value;
+        markDirty();
+    }
+
+    void markDirty() {
+        dirty = true;
+        worldDirty = true;
+        for (RecursiveTransform* child : children) {
+            child->markDirty();
+        }
+    }
+
+    const glm::mat4& getWorldMatrix() const {
+        if (worldDirty || dirty) {
+            if (dirty) {
+                localMatrix = glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation) *
+                              glm::scale(glm::mat4(1.0f), scale);
+                dirty = false;
+            }
+            worldMatrix = parent ? parent->getWorldMatrix() * localMatrix : localMatrix;
+            worldDirty = false;
+        }
+        return worldMatrix;
+    }
+};
+
+/// Hierarchy shapes, built the same way for both implementations
+template<typename T>
+struct Hierarchy {
+    TransformSystem system;     // Holds the entries of Transform hierarchies
+    std::vector<T> transforms;
+    std::vector<size_t> roots;
+
+    void resize(size_t count);
+    void link(size_t child, size_t parent);
+};
+
+template<>
+void Hierarchy<RecursiveTransform>::resize(size_t count) {
+    transforms.resize(count);
+}
+
+template<>
+void Hierarchy<Transform>::resize(size_t count) {
+    transforms.reserve(count);
+    while (transforms.size() < count) {
+        transforms.emplace_back(system);
+    }
+}
+
+template<>
+void Hierarchy<RecursiveTransform>::link(size_t child, size_t parent) {
+    transforms[child].parent = &transforms[parent];
+    transforms[parent].children.push_back(&transforms[child]);
+}
+
+template<>
+void Hierarchy<Transform>::link(size_t child, size_t parent) {
+    transforms[child].setParent(&transforms[parent]);
+}
+
+/// One root with kWideChildren direct children
+template<typename T>
+void buildWide(Hierarchy<T>& h) {
+    h.resize(kWideChildren + 1);
+    h.roots = {0};
+    for (size_t i = 1; i < h.transforms.size(); ++i) {
+        h.link(i, 0);
+    }
+}
+
+/// kDeepChains chains of kDeepChainLength each
+template<typename T>
+void buildDeep(Hierarchy<T>& h) {
+    h.resize(static_cast<size_t>(kDeepChains) * kDeepChainLength);
+    for (size_t c = 0; c < kDeepChains; ++c) {
+        size_t first = c * kDeepChainLength;
+        h.roots.push_back(first);
+        for (size_t i = 1; i < kDeepChainLength; ++i) {
+            h.link(first + i, first + i - 1);
+        }
+    }
+}
+
+/// Move every root a few times, then read every world matrix (as rendering does)
+template<typename T>
+float moveRootsAndRead(Hierarchy<T>& h, int frame) {
+    for (int s = 0; s < kSettersPerFrame; ++s) {
+        for (size_t root : h.roots) {
+            h.transforms[root].setLocalPosition(glm::vec3(static_cast<float>(frame + s), 0.0f, 0.0f));
+        }
+    }
+    if constexpr (std::is_same<T, Transform>::value) {
+        h.system.update();
+    }
+
+    float sum = 0.0f;
+    for (const T& t : h.transforms) {
+        sum += t.getWorldMatrix()[3].x;
+    }
+    return sum;
+}
+
+/// Nothing moves; read every world matrix
+template<typename T>
+float readOnly(Hierarchy<T>& h) {
+    if constexpr (std::is_same<T, Transform>::value) {
+        h.system.update();
+    }
+
+    float sum = 0.0f;
+    for (const T& t : h.transforms) {
+        sum += t.getWorldMatrix()[3].x;
+    }
+    return sum;
+}
+
+} // namespace
+
+// ============================================================================
+// Wide hierarchy (root with 50k children)
+// ============================================================================
+
+PINA_BENCHMARK(Transform_Wide_MoveRoot_Recursive) {
+    Hierarchy<RecursiveTransform> h;
+    buildWide(h);
+    int frame = 0;
+    float sum = 0.0f;
+
+    while (state.run()) {
+        sum += moveRootsAndRead(h, frame++);
+    }
+    state.setItemsProcessed(h.transforms.size());
+    Bench::doNotOptimize(sum);
+}
+
+PINA_BENCHMARK(Transform_Wide_MoveRoot_System) {
+    Hierarchy<Transform> h;
+    buildWide(h);
+    int frame = 0;
+    float sum = 0.0f;
+
+    while (state.run()) {
+        sum += moveRootsAndRead(h, frame++);
+    }
+    state.setItemsProcessed(h.transforms.size());
+    Bench::doNotOptimize(sum);
+}
+
+// ============================================================================
+// Deep hierarchy (50 chains of 1000)
+// ============================================================================
+
+PINA_BENCHMARK(Transform_Deep_MoveRoot_Recursive) {
+    Hierarchy<RecursiveTransform> h;
+    buildDeep(h);
+    int frame = 0;
+    float sum = 0.0f;
+
+    while (state.run()) {
+        sum += moveRootsAndRead(h, frame++);
+    }
+    state.setItemsProcessed(h.transforms.size());
+    Bench::doNotOptimize(sum);
+}
+
+PINA_BENCHMARK(Transform_Deep_MoveRoot_System) {
+    Hierarchy<Transform> h;
+    buildDeep(h);
+    int frame = 0;
+    float sum = 0.0f;
+
+    while (state.run()) {
+        sum += moveRootsAndRead(h, frame++);
+    }
+    state.setItemsProcessed(h.transforms.size());
+    Bench::doNotOptimize(sum);
+}
+
+// ============================================================================
+// Static hierarchy (nothing changes between frames)
+// ============================================================================
+
+PINA_BENCHMARK(Transform_Deep_Static_Recursive) {
+    Hierarchy<RecursiveTransform> h;
+    buildDeep(h);
+    float sum = 0.0f;
+
+    while (state.run()) {
+        sum += readOnly(h);
+    }
+    state.setItemsProcessed(h.transforms.size());
+    Bench::doNotOptimize(sum);
+}
+
+PINA_BENCHMARK(Transform_Deep_Static_System) {
+    Hierarchy<Transform> h;
+    buildDeep(h);
+    float sum = 0.0f;
+
+    while (state.run()) {
+        sum += readOnly(h);
+    }
+    state.setItemsProcessed(h.transforms.size());
+    Bench::doNotOptimize(sum);
+}
+
+// ============================================================================
+// City scene (root -> 200 blocks -> 1000 buildings), every block moving
+// ============================================================================
+
+namespace {
+
+constexpr int kCityBlocks = 200;
+constexpr int kBuildingsPerBlock = 1000;
+
+struct City {
+    TransformSystem system;
+    std::vector<TransformSystem::ID> blocks;
+
+    City() {
+        TransformSystem::ID root = system.create();
+        for (int b = 0; b < kCityBlocks; ++b) {
+            TransformSystem::ID block = system.create();
+            system.setParent(block, root);
+            blocks.push_back(block);
+        }
+        BoundingBox bounds;
+        bounds.expand(glm::vec3(-1.0f));
+        bounds.expand(glm::vec3(1.0f));
+        for (int b = 0; b < kCityBlocks; ++b) {
+            for (int i = 0; i < kBuildingsPerBlock; ++i) {
+                TransformSystem::ID building = system.create();
+                system.setParent(building, blocks[b]);
+                system.setLocalPosition(building, glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+                system.setLocalBounds(building, bounds);
+            }
+        }
+        system.update();
+    }
+
+    void frame(int index) {
+        for (TransformSystem::ID block : blocks) {
+            system.setLocalPosition(block, glm::vec3(0.0f, static_cast<float>(index), 0.0f));
+        }
+        system.update();
+    }
+};
+
+} // namespace
+
+PINA_BENCHMARK(Transform_City_Update_Serial) {
+    City city;
+    int frame = 0;
+
+    while (state.run()) {
+        city.frame(frame++);
+    }
+    state.setItemsProcessed(city.system.getCount());
+}
+
+PINA_BENCHMARK(Transform_City_Update_Parallel) {
+    JobSystem jobs;
+    jobs.initialize();
+    City city;
+    city.system.setJobSystem(&jobs);
+    int frame = 0;
+
+    while (state.run()) {
+        city.frame(frame++);
+    }
+    state.setItemsProcessed(city.system.getCount());
+    jobs.shutdown();
+}
+
+// ============================================================================
+// World-space getters (10k rotated children read every frame)
+// ============================================================================
+
+namespace {
+
+constexpr int kGetterChildren = 10000;
+
+struct GetterScene {
+    TransformSystem system;
+    Transform root{system};
+    std::vector<Transform> children;
+
+    GetterScene() {
+        children.reserve(kGetterChildren);
+        for (int i = 0; i < kGetterChildren; ++i) {
+            children.emplace_back(system);
+        }
+        root.setLocalRotationEuler(10.0f, 20.0f, 30.0f);
+        root.setLocalScale(2.0f);
+        for (size_t i = 0; i < children.size(); ++i) {
+            children[i].setParent(&root);
+            children[i].setLocalPosition(static_cast<float>(i), 0.0f, 0.0f);
+            children[i].setLocalRotationEuler(0.0f, static_cast<float>(i % 360), 0.0f);
+        }
+        system.update();
+    }
+};
+
+/// getWorldRotation() before the cache
+glm::quat decomposeRotation(const glm::mat4& world) {
+    glm::vec3 scale;
+    glm::quat rotation;
+    glm::vec3 translation;
+    glm::vec3 skew;
+    glm::vec4 perspective;
+    glm::decompose(world, scale, rotation, translation, skew, perspective);
+    return rotation;
+}
+
+} // namespace
+
+PINA_BENCHMARK(Transform_Directions_Decompose) {
+    GetterScene scene;
+    glm::vec3 sum(0.0f);
+
+    while (state.run()) {
+        for (const Transform& t : scene.children) {
+            const glm::mat4& world = t.getWorldMatrix();
+            sum += glm::normalize(decomposeRotation(world) * glm::vec3(0.0f, 0.0f, -1.0f));
+            sum += glm::normalize(decomposeRotation(world) * glm::vec3(1.0f, 0.0f, 0.0f));
+            sum += glm::normalize(decomposeRotation(world) * glm::vec3(0.0f, 1.0f, 0.0f));
+        }
+    }
+    state.setItemsProcessed(scene.children.size());
+    Bench::doNotOptimize(sum);
+}
+
+PINA_BENCHMARK(Transform_Directions_Cached) {
+    GetterScene scene;
+    glm::vec3 sum(0.0f);
+
+    while (state.run()) {
+        for (const Transform& t : scene.children) {
+            sum += t.getForward();
+            sum += t.getRight();
+            sum += t.getUp();
+        }
+    }
+    state.setItemsProcessed(scene.children.size());
+    Bench::doNotOptimize(sum);
+}
+
+PINA_BENCHMARK(Transform_NormalMatrix_Inverse) {
+    GetterScene scene;
+    glm::vec3 sum(0.0f);
+
+    while (state.run()) {
+        for (const Transform& t : scene.children) {
+            sum += glm::transpose(glm::inverse(glm::mat3(t.getWorldMatrix())))[2];
+        }
+    }
+    state.setItemsProcessed(scene.children.size());
+    Bench::doNotOptimize(sum);
+}
+
+PINA_BENCHMARK(Transform_NormalMatrix_Cached) {
+    GetterScene scene;
+    glm::vec3 sum(0.0f);
+
+    while (state.run()) {
+        for (const Transform& t : scene.children) {
+            sum += t.getNormalMatrix()[2];
+        }
+    }
+    state.setItemsProcessed(scene.children.size());
+    Bench::doNotOptimize(sum);
+}
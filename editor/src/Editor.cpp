@@ -56,6 +56,7 @@ void Editor::onInit() {
     m_viewportPanel->setShader(m_shader.get());
     m_viewportPanel->setInput(getInput());
     m_viewportPanel->setGraphicsDevice(m_device.get());
+    m_viewportPanel->setJobSystem(getJobSystem());
 
     // Setup default scene
     setupDefaultScene();
@@ -144,9 +145,7 @@ void Editor::renderMenuBar() {
                 if (m_selection->hasSelection()) {
                     Pina::Node* selected = m_selection->getSelected();
                     m_selection->deselect();
-                    if (selected && selected->getParent()) {
-                        selected->getParent()->removeChild(selected);
-                    }
+                    m_scene->destroyNode(selected);
                 }
             }
             ImGui::EndMenu();
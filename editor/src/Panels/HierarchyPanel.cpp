@@ -25,10 +25,16 @@ void HierarchyPanel::onRender() {
         // Render the scene tree starting from root
         Pina::Node* root = m_scene->getRoot();
         if (root) {
-            // Render children of root (root itself is typically not shown)
-            for (size_t i = 0; i < root->getChildCount(); ++i) {
-                renderNode(root->getChild(i));
-            }
+            // Scoped by scene, as node IDs are only unique within one
+            ImGui::PushID(m_scene);
+            renderTree(root);
+            ImGui::PopID();
+        }
+
+        // Delete after the tree is drawn, so no node is destroyed mid-walk
+        if (m_pendingDelete.isValid()) {
+            m_scene->destroyNode(m_pendingDelete);
+            m_pendingDelete = Pina::NodeHandle();
         }
 
         // Context menu for empty space (create new node)
@@ -41,9 +47,33 @@ void HierarchyPanel::onRender() {
     }
 }
 
-void HierarchyPanel::renderNode(Pina::Node* node) {
-    if (!node) return;
+void HierarchyPanel::renderTree(Pina::Node* root) {
+    // Walked iteratively so deep imported hierarchies cannot overflow the
+    // stack; an open tree node stays pushed until the walk leaves its subtree
+    uint32_t openDepth = 0;
+    for (Pina::NodeIterator it(root); it; ++it) {
+        uint32_t depth = it.getDepth();
+        if (depth == 0) continue;   // Root itself is not shown
+
+        // Close tree nodes this node is not inside of
+        for (; openDepth >= depth; --openDepth) {
+            Pina::Widgets::treePop();
+            ImGui::PopID();
+        }
+
+        if (renderNode(*it)) {
+            openDepth = depth;
+        } else {
+            it.skipChildren();
+        }
+    }
+    for (; openDepth > 0; --openDepth) {
+        Pina::Widgets::treePop();
+        ImGui::PopID();
+    }
+}
 
+bool HierarchyPanel::renderNode(Pina::Node* node) {
     bool isSelected = m_selection && m_selection->getSelected() == node;
     bool hasChildren = node->getChildCount() > 0;
 
@@ -56,10 +86,14 @@ void HierarchyPanel::renderNode(Pina::Node* node) {
         flags = flags | Pina::UITreeNodeFlags::Leaf;
     }
 
-    // Create unique ID for ImGui
-    ImGui::PushID(static_cast<int>(node->getID()));
+    // Create unique ID for ImGui (popped by renderTree() once the subtree is done)
+    // All 64 bits are hashed: the generation keeps a node reusing a
+    // destroyed node's slot from inheriting its open/selected state
+    uint64_t id = node->getID();
+    const char* idBytes = reinterpret_cast<const char*>(&id);
+    ImGui::PushID(idBytes, idBytes + sizeof(id));
 
-    Pina::Widgets::TreeNode treeNode(node->getName().c_str(), flags);
+    bool open = Pina::Widgets::beginTreeNode(node->getName().c_str(), flags);
 
     // Handle selection on click
     if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen()) {
@@ -74,14 +108,11 @@ void HierarchyPanel::renderNode(Pina::Node* node) {
         ImGui::EndPopup();
     }
 
-    // Render children if node is open
-    if (treeNode) {
-        for (size_t i = 0; i < node->getChildCount(); ++i) {
-            renderNode(node->getChild(i));
-        }
+    // An open node keeps its ID and tree level pushed for its children
+    if (!open) {
+        ImGui::PopID();
     }
-
-    ImGui::PopID();
+    return open;
 }
 
 void HierarchyPanel::showContextMenu(Pina::Node* node) {
@@ -103,11 +134,8 @@ void HierarchyPanel::showContextMenu(Pina::Node* node) {
             m_selection->deselect();
         }
 
-        // Remove from parent
-        Pina::Node* parent = node->getParent();
-        if (parent) {
-            parent->removeChild(node);
-        }
+        // Destroyed once the tree walk is done
+        m_pendingDelete = node->getHandle();
     }
 
     ImGui::Separator();
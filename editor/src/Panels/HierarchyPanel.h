@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Panel.h"
+#include "Scene/NodeHandle.h"
 
 namespace Pina {
     class Scene;
@@ -21,7 +22,8 @@ public:
     void setScene(Pina::Scene* scene) { m_scene = scene; }
 
 private:
-    void renderNode(Pina::Node* node);
+    void renderTree(Pina::Node* root);
+    bool renderNode(Pina::Node* node);
     void showContextMenu(Pina::Node* node);
 
     Pina::Scene* m_scene = nullptr;
@@ -29,6 +31,7 @@ private:
 
     // Context menu state
     Pina::Node* m_contextMenuNode = nullptr;
+    Pina::NodeHandle m_pendingDelete;       // Node chosen for deletion this frame
 };
 
 } // namespace PinaEditor
@@ -9,6 +9,7 @@
 #include <Pina.h>
 #include <imgui.h>
 #include <iostream>
+#include <limits>
 
 #ifdef __APPLE__
 #include <OpenGL/gl3.h>
@@ -37,9 +38,17 @@ ViewportPanel::~ViewportPanel() {
 void ViewportPanel::setGraphicsDevice(Pina::GraphicsDevice* device) {
     m_graphicsDevice = device;
     m_sceneRenderer = std::make_unique<Pina::SceneRenderer>(device);
+    m_sceneRenderer->setJobSystem(m_jobSystem);
     m_gizmoRenderer = std::make_unique<GizmoRenderer>(device);
 }
 
+void ViewportPanel::setJobSystem(Pina::JobSystem* jobs) {
+    m_jobSystem = jobs;
+    if (m_sceneRenderer) {
+        m_sceneRenderer->setJobSystem(jobs);
+    }
+}
+
 void ViewportPanel::createFramebuffer(int width, int height) {
     if (width <= 0 || height <= 0) return;
 
@@ -107,6 +116,8 @@ void ViewportPanel::onRender() {
 
         ImVec2 viewportSize = ImGui::GetContentRegionAvail();
         m_viewportSize = glm::vec2(viewportSize.x, viewportSize.y);
+        ImVec2 viewportPos = ImGui::GetCursorScreenPos();
+        m_viewportPosition = glm::vec2(viewportPos.x, viewportPos.y);
 
         // Ensure minimum size
         if (viewportSize.x < 1) viewportSize.x = 1;
@@ -137,6 +148,13 @@ void ViewportPanel::onRender() {
             // Unbind framebuffer
             glBindFramebuffer(GL_FRAMEBUFFER, 0);
 
+            // Click selection, unless the click grabbed a gizmo handle
+            Gizmo* gizmo = getActiveGizmo();
+            if (m_viewportHovered && m_input && m_input->isMouseButtonPressed(Pina::MouseButton::Left) &&
+                !(gizmo && gizmo->isDragging())) {
+                pickNode();
+            }
+
             // Display the framebuffer texture in ImGui
             // Flip the texture vertically by using UV coords (0,1) to (1,0)
             ImGui::Image(
@@ -280,20 +298,7 @@ void ViewportPanel::renderGizmos() {
     if (m_selection && m_selection->hasSelection()) {
         Pina::Node* selected = m_selection->getSelected();
         if (selected) {
-            // Get the appropriate gizmo
-            Gizmo* activeGizmo = nullptr;
-            switch (m_gizmoMode) {
-                case GizmoMode::Translate:
-                    activeGizmo = m_translateGizmo.get();
-                    break;
-                case GizmoMode::Rotate:
-                    activeGizmo = m_rotateGizmo.get();
-                    break;
-                case GizmoMode::Scale:
-                    activeGizmo = m_scaleGizmo.get();
-                    break;
-            }
-
+            Gizmo* activeGizmo = getActiveGizmo();
             if (activeGizmo) {
                 // Set viewport bounds for proper coordinate conversion
                 ImVec2 windowPos = ImGui::GetWindowPos();
@@ -315,6 +320,65 @@ void ViewportPanel::renderGizmos() {
     m_gizmoRenderer->flush(camera);
 }
 
+void ViewportPanel::pickNode() {
+    if (!m_scene || !m_selection || !m_editorCamera) return;
+
+    Pina::Camera* camera = m_editorCamera->getCamera();
+    if (!camera || m_viewportSize.x <= 0.0f || m_viewportSize.y <= 0.0f) return;
+
+    // Mouse to normalized viewport coordinates (origin at bottom-left)
+    glm::vec2 mouse = m_input->getMousePosition() - m_viewportPosition;
+    glm::vec2 screen(mouse.x / m_viewportSize.x, 1.0f - mouse.y / m_viewportSize.y);
+    if (screen.x < 0.0f || screen.x > 1.0f || screen.y < 0.0f || screen.y > 1.0f) return;
+
+    glm::mat4 invViewProj = glm::inverse(camera->getProjectionMatrix() * camera->getViewMatrix());
+    Pina::Ray ray = Pina::Ray::fromScreen(Pina::Vector2(screen.x, screen.y), invViewProj);
+
+    // Mesh and model triangles through the scene's BVHs
+    Pina::RaycastHit hit = m_scene->raycast(ray);
+    Pina::Node* picked = hit.node;
+    float pickedDistance = hit ? hit.distance : std::numeric_limits<float>::max();
+
+    // Nodes without geometry are picked by the marker cube drawn in renderGizmos()
+    const glm::vec3 origin = ray.origin;
+    const glm::vec3 direction = ray.direction;
+    Pina::BoundingBox marker;
+    marker.min = glm::vec3(-0.15f);
+    marker.max = glm::vec3(0.15f);
+    m_scene->traverse([&](Pina::Node* node) {
+        if (node == m_scene->getRoot() || node->hasModel() || node->hasMesh() ||
+            !node->isEnabledInHierarchy()) {
+            return;
+        }
+        glm::mat4 toLocal = glm::inverse(node->getTransform().getWorldMatrix());
+        glm::vec3 localOrigin = glm::vec3(toLocal * glm::vec4(origin, 1.0f));
+        glm::vec3 localDirection = glm::vec3(toLocal * glm::vec4(direction, 0.0f));
+        float entry;
+        if (marker.intersectsRay(localOrigin, glm::vec3(1.0f) / localDirection, pickedDistance, entry)) {
+            picked = node;
+            pickedDistance = entry;
+        }
+    });
+
+    if (picked) {
+        m_selection->select(picked);
+    } else {
+        m_selection->deselect();
+    }
+}
+
+Gizmo* ViewportPanel::getActiveGizmo() const {
+    switch (m_gizmoMode) {
+        case GizmoMode::Translate:
+            return m_translateGizmo.get();
+        case GizmoMode::Rotate:
+            return m_rotateGizmo.get();
+        case GizmoMode::Scale:
+            return m_scaleGizmo.get();
+    }
+    return nullptr;
+}
+
 GizmoMode ViewportPanel::getGizmoMode() const {
     return m_gizmoMode;
 }
@@ -9,6 +9,7 @@ namespace Pina {
     class Shader;
     class Input;
     class GraphicsDevice;
+    class JobSystem;
 }
 
 namespace PinaEditor {
@@ -19,6 +20,7 @@ class GizmoRenderer;
 class TranslateGizmo;
 class RotateGizmo;
 class ScaleGizmo;
+class Gizmo;
 enum class GizmoMode;
 
 /// Shading mode for viewport rendering
@@ -42,6 +44,9 @@ public:
     void setShader(Pina::Shader* shader) { m_shader = shader; }
     void setGraphicsDevice(Pina::GraphicsDevice* device);
 
+    /// Run the scene renderer's gather and occlusion culling on a job system
+    void setJobSystem(Pina::JobSystem* jobs);
+
     // Gizmo control
     GizmoMode getGizmoMode() const;
     void setGizmoMode(GizmoMode mode);
@@ -59,10 +64,17 @@ private:
     void renderScene();
     void renderGizmos();
 
+    /// Select the node under the mouse (mesh triangles first, then node markers)
+    void pickNode();
+
+    /// Gizmo for the current mode
+    Gizmo* getActiveGizmo() const;
+
     Pina::Scene* m_scene = nullptr;
     Pina::Shader* m_shader = nullptr;
     Pina::Input* m_input = nullptr;
     Pina::GraphicsDevice* m_graphicsDevice = nullptr;
+    Pina::JobSystem* m_jobSystem = nullptr;
     Selection* m_selection = nullptr;
     EditorCamera* m_editorCamera = nullptr;
 
@@ -75,6 +87,7 @@ private:
     GizmoMode m_gizmoMode;
     ShadingMode m_shadingMode = ShadingMode::Smooth;
 
+    glm::vec2 m_viewportPosition = glm::vec2(0.0f);  // Screen position of the image's top-left corner
     glm::vec2 m_viewportSize = glm::vec2(800, 600);
     bool m_viewportFocused = false;
     bool m_viewportHovered = false;
@@ -1,12 +1,21 @@
 #include "Application.h"
 #include "Context.h"
 #include "EventDispatcher.h"
+#include "JobSystem.h"
+#include "Profiler.h"
 #include "../Platform/Window.h"
 #include "../Platform/Graphics.h"
 #include "../Input/Input.h"
+#include "../Input/InputRecorder.h"
 #include "../UI/UI.h"
 #include "../Graphics/GraphicsDevice.h"
 #include "../Graphics/RenderPipeline.h"
+#include "../Scene/Scene.h"
+#include "../Platform/Headless/HeadlessWindow.h"
+#include "../Platform/Headless/HeadlessGraphics.h"
+#include "../Platform/Headless/HeadlessInput.h"
+#include "../Platform/Headless/ReplayInput.h"
+#include "../UI/Headless/HeadlessUI.h"
 
 // Platform-specific includes for connecting input to window
 #ifdef __APPLE__
@@ -15,6 +24,7 @@
 #endif
 
 #include <chrono>
+#include <iostream>
 
 namespace Pina {
 
@@ -42,6 +52,10 @@ EventDispatcher* Application::getEventDispatcher() const {
     return m_context ? m_context->getSubsystem<EventDispatcher>() : nullptr;
 }
 
+JobSystem* Application::getJobSystem() const {
+    return m_context ? m_context->getSubsystem<JobSystem>() : nullptr;
+}
+
 GraphicsDevice* Application::getDevice() {
     return m_device.get();
 }
@@ -52,12 +66,19 @@ RenderPipeline* Application::getPipeline() {
 
 void Application::createDeviceAndPipeline() {
     if (m_config.autoCreateDevice && !m_device) {
-        m_device = GraphicsDevice::create(GraphicsBackend::OpenGL);
+        GraphicsBackend backend = m_config.headless ? GraphicsBackend::Null : GraphicsBackend::OpenGL;
+        m_device = GraphicsDevice::create(backend);
+    }
+
+    // Report the device's GPU memory through the context
+    if (m_device) {
+        m_context->setGPUMemoryTracker(m_device->getGPUMemoryTracker());
     }
 
     if (m_config.autoCreatePipeline && m_device && !m_pipeline) {
         m_pipeline = MAKE_UNIQUE<RenderPipeline>(m_device.get());
         m_pipeline->setClearColor(m_config.clearColor);
+        m_pipeline->setJobSystem(getJobSystem());
     }
 }
 
@@ -66,6 +87,16 @@ void Application::createSubsystems() {
     auto* eventDispatcher = new EventDispatcher();
     m_context->registerSubsystem<EventDispatcher>(eventDispatcher);
 
+    // Create job system early so it shuts down after everything that uses it
+    JobSystemConfig jobConfig;
+    jobConfig.workerCount = m_config.jobWorkerCount;
+    m_context->registerSubsystem<JobSystem>(new JobSystem(jobConfig));
+
+    if (m_config.headless) {
+        createHeadlessSubsystems(eventDispatcher);
+        return;
+    }
+
     // Create window (uses platform default)
     Window* window = Window::createDefault();
     m_context->registerSubsystem<Window>(window);
@@ -74,9 +105,17 @@ void Application::createSubsystems() {
     Graphics* graphics = Graphics::createDefault(GraphicsBackend::OpenGL);
     m_context->registerSubsystem<Graphics>(graphics);
 
-    // Create input (uses platform default)
-    Input* input = Input::createDefault(window);
-    m_context->registerSubsystem<Input>(input);
+    // Create input (uses platform default, or replays a recorded session)
+    Input* input = nullptr;
+    if (m_config.inputReplayPath.empty()) {
+        input = Input::createDefault(window);
+    } else if (ReplayInput* replay = createReplayInput(window)) {
+        replay->setEventDispatcher(eventDispatcher);
+        input = replay;
+    }
+    if (input) {
+        m_context->registerSubsystem<Input>(input);
+    }
 
     // Create UI (uses platform default)
     UISubsystem* ui = UISubsystem::createDefault();
@@ -93,13 +132,53 @@ void Application::createSubsystems() {
 #endif
 }
 
+void Application::createHeadlessSubsystems(EventDispatcher* eventDispatcher) {
+    auto* window = new HeadlessWindow();
+    m_context->registerSubsystem<Window>(window);
+
+    m_context->registerSubsystem<Graphics>(new HeadlessGraphics());
+
+    HeadlessInput* input = m_config.inputReplayPath.empty() ? new HeadlessInput(window)
+                                                            : createReplayInput(window);
+    if (input) {
+        input->setEventDispatcher(eventDispatcher);
+        m_context->registerSubsystem<Input>(input);
+    }
+
+    m_context->registerSubsystem<UISubsystem>(new HeadlessUI());
+}
+
+ReplayInput* Application::createReplayInput(Window* window) {
+    InputRecording recording;
+    if (!recording.load(m_config.inputReplayPath)) {
+        std::cerr << "Application::createReplayInput - Failed to load "
+                  << m_config.inputReplayPath << std::endl;
+        return nullptr;
+    }
+
+    m_replayInput = new ReplayInput(std::move(recording), window);
+    return m_replayInput;
+}
+
 int Application::run() {
+    // Start recording before subsystems are created
+    if (!m_config.profileTracePath.empty()) {
+        Profiler::setThreadName("Main");
+        Profiler::setEnabled(true);
+    }
+
     // Create context
     m_context = MAKE_UNIQUE<Context>();
 
     // Create subsystems
     createSubsystems();
 
+    // Record input from the first event on (events during init are frame 0)
+    if (!m_config.inputRecordPath.empty()) {
+        m_inputRecorder = MAKE_UNIQUE<InputRecorder>();
+        m_inputRecorder->start(getEventDispatcher());
+    }
+
     // Get subsystems
     auto* window = getWindow();
     auto* graphics = getGraphics();
@@ -160,6 +239,9 @@ int Application::run() {
     // Initialize all subsystems
     m_context->initializeSubsystems();
 
+    // Scenes split large transform updates across the job workers
+    Scene::setDefaultJobSystem(getJobSystem());
+
     // User init
     onInit();
 
@@ -176,47 +258,104 @@ int Application::run() {
 
     // Main loop
     m_running = true;
+    m_frameCount = 0;
     auto lastTime = std::chrono::high_resolution_clock::now();
 
+    // Replays step at a fixed rate so runs are repeatable
+    float fixedDeltaTime = m_config.fixedDeltaTime;
+    if (m_replayInput && fixedDeltaTime <= 0.0f) {
+        fixedDeltaTime = 1.0f / 60.0f;
+    }
+
     while (m_running && !window->shouldClose()) {
+        PINA_PROFILE_SCOPE("Frame");
+
         // Calculate delta time
         auto currentTime = std::chrono::high_resolution_clock::now();
         float deltaTime = std::chrono::duration<float>(currentTime - lastTime).count();
         lastTime = currentTime;
+        if (fixedDeltaTime > 0.0f) {
+            deltaTime = fixedDeltaTime;
+        }
 
         // Poll events
-        window->pollEvents();
+        {
+            PINA_PROFILE_SCOPE("Application::pollEvents");
+            window->pollEvents();
+        }
 
         // Update subsystems
         m_context->updateSubsystems(deltaTime);
 
         // Update
-        onUpdate(deltaTime);
+        {
+            PINA_PROFILE_SCOPE("Application::onUpdate");
+            onUpdate(deltaTime);
+        }
 
         // Render
-        graphics->makeCurrent();
-        onRender();
+        {
+            PINA_PROFILE_SCOPE("Application::onRender");
+            graphics->makeCurrent();
+            onRender();
+        }
 
         // UI rendering
-        ui->beginFrame();
-        onRenderUI();
-        ui->endFrame();
+        {
+            PINA_PROFILE_SCOPE("Application::renderUI");
+            ui->beginFrame();
+            onRenderUI();
+            ui->endFrame();
+        }
 
-        graphics->swapBuffers();
+        {
+            PINA_PROFILE_SCOPE("Application::swapBuffers");
+            graphics->swapBuffers();
+        }
 
         // End frame for input (clear per-frame state)
         input->endFrame();
+        if (m_inputRecorder) {
+            m_inputRecorder->endFrame();
+        }
+
+        // Release per-frame scratch memory
+        m_frameArena.reset();
+
+        m_frameCount++;
+        if (m_config.maxFrames > 0 && m_frameCount >= m_config.maxFrames) {
+            m_running = false;
+        }
+        if (m_replayInput && m_replayInput->isFinished()) {
+            m_running = false;
+        }
     }
 
     // User shutdown
     onShutdown();
 
+    // Write the input recording (before the dispatcher goes away)
+    if (m_inputRecorder) {
+        m_inputRecorder->stop();
+        m_inputRecorder->save(m_config.inputRecordPath);
+        m_inputRecorder.reset();
+    }
+
     // Cleanup pipeline and device (before subsystems)
     m_pipeline.reset();
     m_device.reset();
 
     // Shutdown subsystems (in reverse order)
+    if (Scene::getDefaultJobSystem() == getJobSystem()) {
+        Scene::setDefaultJobSystem(nullptr);
+    }
     m_context->shutdownSubsystems();
+    m_replayInput = nullptr;
+
+    if (!m_config.profileTracePath.empty()) {
+        Profiler::setEnabled(false);
+        Profiler::exportChromeTrace(m_config.profileTracePath);
+    }
 
     return 0;
 }
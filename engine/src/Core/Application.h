@@ -8,6 +8,7 @@
 #include "Context.h"
 #include "../Math/Color.h"
 #include <string>
+#include <cstdint>
 
 namespace Pina {
 
@@ -16,10 +17,13 @@ class Graphics;
 class Input;
 class UISubsystem;
 class EventDispatcher;
+class JobSystem;
 class GraphicsDevice;
 class RenderPipeline;
 class Scene;
 class Camera;
+class InputRecorder;
+class ReplayInput;
 
 /// Application configuration
 struct PINA_API ApplicationConfig {
@@ -39,6 +43,21 @@ struct PINA_API ApplicationConfig {
     bool autoCreateDevice = true;     // Auto-create GraphicsDevice
     bool autoCreatePipeline = true;   // Auto-create RenderPipeline
     Color clearColor = Color(0.1f, 0.1f, 0.12f);  // Default clear color
+
+    // Headless mode (no window/GPU: headless platform + RecordingDevice)
+    bool headless = false;
+    uint64_t maxFrames = 0;           // Stop after N frames (0 = run until closed)
+
+    // Job system
+    uint32_t jobWorkerCount = 0;      // Worker threads (0 = hardware threads - 1)
+
+    // Profiling (needs a build with PINA_ENABLE_PROFILING)
+    std::string profileTracePath;     // Record scopes and write a Chrome trace here on exit
+
+    // Input record/replay (repeatable sessions)
+    std::string inputRecordPath;      // Record input events and write them here on exit
+    std::string inputReplayPath;      // Replay this recording instead of live input; quit when it ends
+    float fixedDeltaTime = 0.0f;      // Delta time for every frame (0 = measured; replays default to 1/60)
 };
 
 /// Base application class
@@ -54,6 +73,9 @@ public:
     /// Request application to quit
     void quit() { m_running = false; }
 
+    /// Number of frames completed by the main loop
+    uint64_t getFrameCount() const { return m_frameCount; }
+
     // ========================================================================
     // Subsystem Access
     // ========================================================================
@@ -73,6 +95,7 @@ public:
     Input* getInput() const;
     UISubsystem* getUI() const;
     EventDispatcher* getEventDispatcher() const;
+    JobSystem* getJobSystem() const;
 
     // ========================================================================
     // Simplified API Accessors
@@ -84,6 +107,9 @@ public:
     /// Get the render pipeline (auto-created if autoCreatePipeline is true)
     RenderPipeline* getPipeline();
 
+    /// Get per-frame scratch memory (reset at the end of every frame)
+    FrameArena& getFrameArena() { return m_frameArena; }
+
 protected:
     /// Application configuration - set in subclass constructor
     ApplicationConfig m_config;
@@ -108,10 +134,18 @@ protected:
 
 private:
     void createSubsystems();
+    void createHeadlessSubsystems(EventDispatcher* eventDispatcher);
     void createDeviceAndPipeline();
+    ReplayInput* createReplayInput(Window* window);
 
     UNIQUE<Context> m_context;
     bool m_running = false;
+    uint64_t m_frameCount = 0;
+    FrameArena m_frameArena;
+
+    // Input record/replay (set from ApplicationConfig)
+    UNIQUE<InputRecorder> m_inputRecorder;
+    ReplayInput* m_replayInput = nullptr;     // Owned by the context
 
     // Simplified API resources (auto-created if enabled)
     UNIQUE<GraphicsDevice> m_device;
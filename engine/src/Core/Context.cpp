@@ -1,13 +1,62 @@
 /// Pina Engine - Context Implementation
 
 #include "Context.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include "../Graphics/GPUMemory.h"
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
 
 namespace Pina {
 
 // Static factory registry
 std::unordered_map<std::type_index, SubsystemFactory> Context::s_factories;
 
+namespace {
+
+/// Type to slot mapping shared by every module that links the engine
+struct SubsystemTypeRegistry {
+    std::mutex mutex;
+    std::unordered_map<std::type_index, SubsystemID> ids;
+};
+
+SubsystemTypeRegistry& getTypeRegistry() {
+    static SubsystemTypeRegistry registry;
+    return registry;
+}
+
+/// Readable, interned form of a typeid name
+/// GCC and Clang mangle it ("N4Pina9JobSystemE"), MSVC prefixes "class ";
+/// both become "Pina::JobSystem". Called once per registration, not per frame.
+const char* readableTypeName(const char* typeName) {
+    std::string name = typeName;
+#if defined(__GNUG__)
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(typeName, nullptr, nullptr, &status);
+    if (status == 0 && demangled) {
+        name = demangled;
+    }
+    std::free(demangled);
+#else
+    for (const char* prefix : {"class ", "struct "}) {
+        if (name.compare(0, std::strlen(prefix), prefix) == 0) {
+            name.erase(0, std::strlen(prefix));
+            break;
+        }
+    }
+#endif
+    return Profiler::intern(name);
+}
+
+} // namespace
+
 Context::Context() = default;
 
 Context::~Context() {
@@ -18,34 +67,344 @@ void Context::clearFactories() {
     s_factories.clear();
 }
 
-void Context::initializeSubsystems() {
-    for (const auto& typeId : m_registrationOrder) {
-        auto it = m_subsystems.find(typeId);
-        if (it != m_subsystems.end()) {
-            it->second->initialize();
+// ============================================================================
+// Subsystem Type IDs
+// ============================================================================
+
+SubsystemID Context::allocateSubsystemID(const std::type_index& type) {
+    SubsystemTypeRegistry& registry = getTypeRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto it = registry.ids.find(type);
+    if (it != registry.ids.end()) {
+        return it->second;
+    }
+
+    SubsystemID id = static_cast<SubsystemID>(registry.ids.size());
+    registry.ids.emplace(type, id);
+    return id;
+}
+
+SubsystemID Context::getSubsystemTypeCount() {
+    SubsystemTypeRegistry& registry = getTypeRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return static_cast<SubsystemID>(registry.ids.size());
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+void Context::registerSubsystem(SubsystemID id, const char* typeName, Subsystem* subsystem) {
+    subsystem->setContext(this);
+
+    if (id >= m_subsystems.size()) {
+        m_subsystems.resize(id + 1);
+    }
+
+    SubsystemDependencies deps;
+    subsystem->declareDependencies(deps);
+
+    // Re-registering a type replaces the instance but keeps its update slot
+    bool replacing = m_subsystems[id] != nullptr;
+    m_subsystems[id] = UNIQUE<Subsystem>(subsystem);
+
+    if (replacing) {
+        for (auto& entry : m_updateOrder) {
+            if (entry.id == id) {
+                entry.subsystem = subsystem;
+                entry.deps = deps;
+            }
         }
+    } else {
+        m_updateOrder.push_back({ subsystem, id, readableTypeName(typeName), deps });
     }
+
+    m_schedulesDirty = true;
 }
 
-void Context::updateSubsystems(float deltaTime) {
-    for (const auto& typeId : m_registrationOrder) {
-        auto it = m_subsystems.find(typeId);
-        if (it != m_subsystems.end()) {
-            it->second->update(deltaTime);
+void Context::unregisterSubsystem(SubsystemID id) {
+    if (id >= m_subsystems.size() || !m_subsystems[id]) {
+        return;
+    }
+
+    m_subsystems[id]->shutdown();
+
+    auto orderIt = std::find_if(m_updateOrder.begin(), m_updateOrder.end(),
+                                [id](const SubsystemEntry& entry) { return entry.id == id; });
+    if (orderIt != m_updateOrder.end()) {
+        m_updateOrder.erase(orderIt);
+    }
+
+    m_subsystems[id].reset();
+    m_schedulesDirty = true;
+}
+
+const char* Context::getSubsystemName(SubsystemID id) const {
+    for (const auto& entry : m_updateOrder) {
+        if (entry.id == id) {
+            return entry.name;
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// Scheduling
+// ============================================================================
+
+namespace {
+
+bool contains(const std::vector<SubsystemID>& ids, SubsystemID id) {
+    return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+/// Does a subsystem write a slot (every subsystem writes itself)
+bool writesTo(SubsystemID self, const SubsystemDependencies& deps, SubsystemID id) {
+    return id == self || contains(deps.getWrites(), id);
+}
+
+/// Does a subsystem read anything the other one writes
+bool readsFrom(const SubsystemDependencies& reader, SubsystemID writer, const SubsystemDependencies& writerDeps) {
+    for (SubsystemID id : reader.getReads()) {
+        if (writesTo(writer, writerDeps, id)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool writesOverlap(SubsystemID a, const SubsystemDependencies& aDeps, SubsystemID b, const SubsystemDependencies& bDeps) {
+    if (writesTo(b, bDeps, a)) return true;
+    for (SubsystemID id : aDeps.getWrites()) {
+        if (writesTo(b, bDeps, id)) {
+            return true;
         }
     }
+    return false;
+}
+
+} // namespace
+
+void Context::buildSchedules() {
+    std::vector<size_t> all(m_updateOrder.size());
+    std::vector<size_t> phases[static_cast<size_t>(SubsystemPhase::Count)];
+
+    for (size_t i = 0; i < m_updateOrder.size(); ++i) {
+        all[i] = i;
+        phases[static_cast<size_t>(m_updateOrder[i].deps.getPhase())].push_back(i);
+    }
+
+    m_initSchedule = buildSchedule(all);
+    for (size_t phase = 0; phase < static_cast<size_t>(SubsystemPhase::Count); ++phase) {
+        m_phaseSchedules[phase] = buildSchedule(phases[phase]);
+    }
+
+    m_schedulesDirty = false;
+}
+
+Context::Schedule Context::buildSchedule(const std::vector<size_t>& nodes) const {
+    size_t count = nodes.size();
+    std::vector<std::vector<size_t>> successors(count);
+    std::vector<uint32_t> predecessors(count, 0);
+
+    auto addEdge = [&](size_t from, size_t to) {
+        successors[from].push_back(to);
+        predecessors[to]++;
+    };
+
+    // Order every conflicting pair; nodes are in registration order
+    for (size_t i = 0; i < count; ++i) {
+        const SubsystemEntry& a = m_updateOrder[nodes[i]];
+        for (size_t j = i + 1; j < count; ++j) {
+            const SubsystemEntry& b = m_updateOrder[nodes[j]];
+
+            if (a.deps.isExclusive() || b.deps.isExclusive()) {
+                addEdge(i, j);
+                continue;
+            }
+
+            bool aReadsB = readsFrom(a.deps, b.id, b.deps);
+            bool bReadsA = readsFrom(b.deps, a.id, a.deps);
+
+            if (aReadsB && !bReadsA) {
+                addEdge(j, i);
+            } else if (aReadsB || bReadsA || writesOverlap(a.id, a.deps, b.id, b.deps)) {
+                addEdge(i, j);
+            }
+        }
+    }
+
+    // Kahn's algorithm, assigning each node the step after its latest predecessor
+    std::vector<size_t> step(count, 0);
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < count; ++i) {
+        if (predecessors[i] == 0) {
+            ready.push_back(i);
+        }
+    }
+
+    size_t visited = 0;
+    while (!ready.empty()) {
+        size_t node = ready.back();
+        ready.pop_back();
+        visited++;
+
+        for (size_t next : successors[node]) {
+            step[next] = std::max(step[next], step[node] + 1);
+            if (--predecessors[next] == 0) {
+                ready.push_back(next);
+            }
+        }
+    }
+
+    if (visited < count) {
+        std::cerr << "Context::buildSchedule - Subsystem dependency cycle, "
+                  << "falling back to registration order" << std::endl;
+        for (size_t i = 0; i < count; ++i) {
+            step[i] = i;
+        }
+    }
+
+    Schedule schedule;
+    for (size_t i = 0; i < count; ++i) {
+        if (step[i] >= schedule.size()) {
+            schedule.resize(step[i] + 1);
+        }
+
+        const SubsystemEntry& entry = m_updateOrder[nodes[i]];
+        if (entry.deps.isMainThread()) {
+            schedule[step[i]].mainThread.push_back(nodes[i]);
+        } else {
+            schedule[step[i]].workers.push_back(nodes[i]);
+        }
+    }
+    return schedule;
+}
+
+void Context::runSchedule(const Schedule& schedule, const std::function<void(Subsystem*)>& fn) {
+    JobSystem* jobs = getSubsystem<JobSystem>();
+    bool parallel = jobs && jobs->isRunning() && jobs->getWorkerCount() > 0;
+
+    auto run = [this, &fn](size_t index) {
+        const SubsystemEntry& entry = m_updateOrder[index];
+        PINA_PROFILE_SCOPE(entry.name);
+        fn(entry.subsystem);
+    };
+
+    for (const auto& step : schedule) {
+        size_t size = step.workers.size() + step.mainThread.size();
+
+        if (!parallel || size <= 1) {
+            for (size_t index : step.workers) run(index);
+            for (size_t index : step.mainThread) run(index);
+            continue;
+        }
+
+        // Keep one worker-safe subsystem for this thread if none needs it
+        size_t submitted = step.mainThread.empty() ? step.workers.size() - 1 : step.workers.size();
+
+        TaskGroup group;
+        for (size_t i = 0; i < submitted; ++i) {
+            size_t index = step.workers[i];
+            jobs->submit([&run, index]() { run(index); }, &group);
+        }
+
+        for (size_t i = submitted; i < step.workers.size(); ++i) {
+            run(step.workers[i]);
+        }
+        for (size_t index : step.mainThread) {
+            run(index);
+        }
+
+        jobs->wait(group);
+    }
+}
+
+size_t Context::getUpdateStepCount(SubsystemPhase phase) {
+    if (m_schedulesDirty) {
+        buildSchedules();
+    }
+    return m_phaseSchedules[static_cast<size_t>(phase)].size();
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void Context::initializeSubsystems() {
+    PINA_PROFILE_SCOPE("Context::initializeSubsystems");
+
+    if (m_schedulesDirty) {
+        buildSchedules();
+    }
+
+    // Start the job system first so it can run the rest
+    JobSystem* jobs = getSubsystem<JobSystem>();
+    if (jobs) {
+        PINA_PROFILE_SCOPE("JobSystem::initialize");
+        jobs->initialize();
+    }
+
+    runSchedule(m_initSchedule, [jobs](Subsystem* subsystem) {
+        if (subsystem != jobs) {
+            subsystem->initialize();
+        }
+    });
+}
+
+void Context::updateSubsystems(float deltaTime) {
+    PINA_PROFILE_SCOPE("Context::updateSubsystems");
+
+    if (m_schedulesDirty) {
+        buildSchedules();
+    }
+
+    for (const auto& schedule : m_phaseSchedules) {
+        runSchedule(schedule, [deltaTime](Subsystem* subsystem) {
+            subsystem->update(deltaTime);
+        });
+    }
 }
 
 void Context::shutdownSubsystems() {
+    PINA_PROFILE_SCOPE("Context::shutdownSubsystems");
+
     // Shutdown in reverse order
-    for (auto it = m_registrationOrder.rbegin(); it != m_registrationOrder.rend(); ++it) {
-        auto subsystemIt = m_subsystems.find(*it);
-        if (subsystemIt != m_subsystems.end()) {
-            subsystemIt->second->shutdown();
-        }
+    for (auto it = m_updateOrder.rbegin(); it != m_updateOrder.rend(); ++it) {
+        it->subsystem->shutdown();
+    }
+
+    // Destroy in reverse order too (later subsystems may reference earlier ones)
+    while (!m_updateOrder.empty()) {
+        m_subsystems[m_updateOrder.back().id].reset();
+        m_updateOrder.pop_back();
     }
     m_subsystems.clear();
-    m_registrationOrder.clear();
+    m_schedulesDirty = true;
+}
+
+// ============================================================================
+// Memory Accounting
+// ============================================================================
+
+MemoryTagStats Context::getMemoryStats(MemoryTag tag) const {
+    return MemoryTracker::getStats(tag);
+}
+
+std::string Context::dumpMemoryStats() const {
+    return MemoryTracker::toJSON(m_gpuMemory.get());
+}
+
+bool Context::dumpMemoryStats(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Context::dumpMemoryStats - Failed to open " << path << std::endl;
+        return false;
+    }
+
+    file << dumpMemoryStats();
+    return static_cast<bool>(file);
 }
 
 } // namespace Pina
@@ -2,17 +2,24 @@
 
 /// Pina Engine - Context (Subsystem Registry)
 /// Central registry for all engine subsystems with factory support for user overrides
+/// Subsystems are stored in a dense array indexed by a per-type slot ID and
+/// scheduled from their declared dependencies (see SubsystemDependencies)
 
 #include "Export.h"
 #include "Memory.h"
+#include "MemoryTracker.h"
 #include "Subsystem.h"
+#include <cstdint>
 #include <typeindex>
 #include <unordered_map>
 #include <vector>
 #include <functional>
+#include <string>
 
 namespace Pina {
 
+class GPUMemoryTracker;
+
 /// Factory function type for creating subsystems
 using SubsystemFactory = std::function<Subsystem*()>;
 
@@ -44,6 +51,20 @@ public:
     /// Clear all registered factories (mainly for testing)
     static void clearFactories();
 
+    // ========================================================================
+    // Subsystem Type IDs
+    // ========================================================================
+
+    /// Get the slot ID of a subsystem type
+    /// Assigned once per type on first use and cached in a static, so lookups
+    /// never hash. IDs are allocated by the engine library, keyed by type, so
+    /// they agree across module boundaries (hot-reloaded game libraries).
+    template<typename T>
+    static SubsystemID getSubsystemID();
+
+    /// Number of subsystem types that have been assigned IDs
+    static SubsystemID getSubsystemTypeCount();
+
     // ========================================================================
     // Subsystem Creation & Registration
     // ========================================================================
@@ -74,6 +95,11 @@ public:
     template<typename T>
     bool hasSubsystem() const;
 
+    /// Get the readable type name of a registered subsystem, as its profile
+    /// scopes show it ("Pina::JobSystem"; nullptr if not registered)
+    template<typename T>
+    const char* getSubsystemName() const { return getSubsystemName(getSubsystemID<T>()); }
+
     /// Remove a subsystem (calls shutdown first)
     template<typename T>
     void removeSubsystem();
@@ -82,18 +108,81 @@ public:
     // Lifecycle
     // ========================================================================
 
-    /// Initialize all registered subsystems (in registration order)
+    /// Initialize all registered subsystems
+    /// A registered JobSystem starts first; independent subsystems then
+    /// initialize in parallel on its workers.
     void initializeSubsystems();
 
-    /// Update all subsystems (called each frame)
+    /// Update all subsystems phase by phase (called each frame)
+    /// Independent subsystems within a phase update in parallel when a
+    /// running JobSystem is registered.
     void updateSubsystems(float deltaTime);
 
-    /// Shutdown all subsystems (in reverse registration order)
+    /// Shutdown all subsystems (in reverse registration order, on this thread)
     void shutdownSubsystems();
 
+    /// Number of registered subsystems
+    size_t getSubsystemCount() const { return m_updateOrder.size(); }
+
+    /// Number of sequential steps in a phase's update schedule
+    /// (subsystems within one step run in parallel)
+    size_t getUpdateStepCount(SubsystemPhase phase);
+
+    // ========================================================================
+    // Memory Accounting
+    // ========================================================================
+
+    /// Get CPU allocation counters for a tag (process-wide)
+    MemoryTagStats getMemoryStats(MemoryTag tag) const;
+
+    /// Set the GPU tracker included in memory reports (usually the app's device)
+    void setGPUMemoryTracker(SHARED<GPUMemoryTracker> tracker) { m_gpuMemory = std::move(tracker); }
+
+    /// Get the GPU tracker (nullptr if none was set)
+    const GPUMemoryTracker* getGPUMemoryTracker() const { return m_gpuMemory.get(); }
+
+    /// Serialize CPU tag and GPU resource counters as JSON
+    std::string dumpMemoryStats() const;
+
+    /// Write the JSON memory report to a file
+    bool dumpMemoryStats(const std::string& path) const;
+
 private:
-    std::unordered_map<std::type_index, UNIQUE<Subsystem>> m_subsystems;
-    std::vector<std::type_index> m_registrationOrder;
+    /// Registered subsystem in update order
+    struct SubsystemEntry {
+        Subsystem* subsystem = nullptr;
+        SubsystemID id = 0;
+        const char* name = nullptr;     // Readable type name, interned (profiler scopes)
+        SubsystemDependencies deps;
+    };
+
+    /// Subsystems that may run concurrently (indices into m_updateOrder)
+    struct ScheduleStep {
+        std::vector<size_t> workers;    // May run on job workers
+        std::vector<size_t> mainThread; // Run on the calling thread
+    };
+
+    using Schedule = std::vector<ScheduleStep>;
+
+    static SubsystemID allocateSubsystemID(const std::type_index& type);
+
+    /// @param typeName typeid(T).name(), made readable once here
+    void registerSubsystem(SubsystemID id, const char* typeName, Subsystem* subsystem);
+    void unregisterSubsystem(SubsystemID id);
+    const char* getSubsystemName(SubsystemID id) const;
+
+    void buildSchedules();
+    Schedule buildSchedule(const std::vector<size_t>& nodes) const;
+    void runSchedule(const Schedule& schedule, const std::function<void(Subsystem*)>& fn);
+
+    std::vector<UNIQUE<Subsystem>> m_subsystems;   // Indexed by SubsystemID
+    std::vector<SubsystemEntry> m_updateOrder;     // Registration order
+    SHARED<GPUMemoryTracker> m_gpuMemory;
+
+    // Built on first use after registration changes
+    bool m_schedulesDirty = true;
+    Schedule m_initSchedule;
+    Schedule m_phaseSchedules[static_cast<size_t>(SubsystemPhase::Count)];
 
     static std::unordered_map<std::type_index, SubsystemFactory> s_factories;
 };
@@ -126,6 +215,14 @@ bool Context::hasFactory() {
     return s_factories.find(std::type_index(typeid(T))) != s_factories.end();
 }
 
+template<typename T>
+SubsystemID Context::getSubsystemID() {
+    static_assert(std::is_base_of<Subsystem, T>::value, "T must derive from Subsystem");
+
+    static const SubsystemID s_id = allocateSubsystemID(std::type_index(typeid(T)));
+    return s_id;
+}
+
 template<typename T, typename DefaultImpl, typename... Args>
 T* Context::createSubsystem(Args&&... args) {
     static_assert(std::is_base_of<Subsystem, T>::value, "T must derive from Subsystem");
@@ -150,10 +247,7 @@ template<typename T>
 void Context::registerSubsystem(T* subsystem) {
     static_assert(std::is_base_of<Subsystem, T>::value, "T must derive from Subsystem");
 
-    std::type_index typeId(typeid(T));
-    subsystem->setContext(this);
-    m_registrationOrder.push_back(typeId);
-    m_subsystems[typeId] = UNIQUE<Subsystem>(subsystem);
+    registerSubsystem(getSubsystemID<T>(), typeid(T).name(), subsystem);
 }
 
 template<typename T>
@@ -163,38 +257,25 @@ void Context::registerSubsystem(UNIQUE<T> subsystem) {
 
 template<typename T>
 T* Context::getSubsystem() const {
-    static_assert(std::is_base_of<Subsystem, T>::value, "T must derive from Subsystem");
-
-    auto it = m_subsystems.find(std::type_index(typeid(T)));
-    if (it != m_subsystems.end()) {
-        return static_cast<T*>(it->second.get());
+    SubsystemID id = getSubsystemID<T>();
+    if (id < m_subsystems.size()) {
+        return static_cast<T*>(m_subsystems[id].get());
     }
     return nullptr;
 }
 
 template<typename T>
 bool Context::hasSubsystem() const {
-    return m_subsystems.find(std::type_index(typeid(T))) != m_subsystems.end();
+    return getSubsystem<T>() != nullptr;
 }
 
 template<typename T>
 void Context::removeSubsystem() {
-    auto typeId = std::type_index(typeid(T));
-    auto it = m_subsystems.find(typeId);
-    if (it != m_subsystems.end()) {
-        it->second->shutdown();
-        m_subsystems.erase(it);
-
-        // Remove from registration order
-        auto orderIt = std::find(m_registrationOrder.begin(), m_registrationOrder.end(), typeId);
-        if (orderIt != m_registrationOrder.end()) {
-            m_registrationOrder.erase(orderIt);
-        }
-    }
+    unregisterSubsystem(getSubsystemID<T>());
 }
 
 // ============================================================================
-// Subsystem::getSubsystem implementation (requires Context to be complete)
+// Subsystem templates (require Context to be complete)
 // ============================================================================
 
 template<typename T>
@@ -202,6 +283,18 @@ T* Subsystem::getSubsystem() const {
     return m_context ? m_context->getSubsystem<T>() : nullptr;
 }
 
+template<typename T>
+SubsystemDependencies& SubsystemDependencies::reads() {
+    m_reads.push_back(Context::getSubsystemID<T>());
+    return *this;
+}
+
+template<typename T>
+SubsystemDependencies& SubsystemDependencies::writes() {
+    m_writes.push_back(Context::getSubsystemID<T>());
+    return *this;
+}
+
 // ============================================================================
 // Macro for registering subsystem factories (static initializer)
 // ============================================================================
@@ -0,0 +1,38 @@
+/// Pina Engine - Event System Implementation
+
+#include "Event.h"
+#include <mutex>
+#include <unordered_map>
+
+namespace Pina {
+
+namespace {
+
+/// Type to ID mapping shared by every module that links the engine
+struct EventTypeRegistry {
+    std::mutex mutex;
+    std::unordered_map<std::type_index, EventTypeID> ids;
+};
+
+EventTypeRegistry& getTypeRegistry() {
+    static EventTypeRegistry registry;
+    return registry;
+}
+
+} // namespace
+
+EventTypeID Event::getTypeIDFor(const std::type_index& type) {
+    EventTypeRegistry& registry = getTypeRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto it = registry.ids.find(type);
+    if (it != registry.ids.end()) {
+        return it->second;
+    }
+
+    EventTypeID id = static_cast<EventTypeID>(registry.ids.size());
+    registry.ids.emplace(type, id);
+    return id;
+}
+
+} // namespace Pina
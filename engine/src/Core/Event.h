@@ -4,6 +4,7 @@
 /// Base class and utilities for the event system
 
 #include "Export.h"
+#include "MemoryTracker.h"
 #include <cstdint>
 #include <typeindex>
 
@@ -38,14 +39,26 @@ inline bool hasCategory(EventCategory cats, EventCategory flag) {
 // Base Event Class
 // ============================================================================
 
+/// Dense per-type event ID (0, 1, 2... in order of first use)
+using EventTypeID = uint32_t;
+
 /// Abstract base class for all events
-class PINA_API Event {
+class PINA_API Event : public TrackedObject<MemoryTag::Events> {
 public:
     virtual ~Event() = default;
 
     /// Get event type info for dispatch
     virtual std::type_index getTypeIndex() const = 0;
 
+    /// Get dense type ID for handler lookup
+    /// EventBase returns a cached ID; the default looks it up by type index.
+    virtual EventTypeID getTypeID() const { return getTypeIDFor(getTypeIndex()); }
+
+    /// Get or assign the ID of an event type (thread-safe)
+    /// IDs are allocated by the engine library, keyed by type, so they agree
+    /// across module boundaries.
+    static EventTypeID getTypeIDFor(const std::type_index& type);
+
     /// Get event categories for filtering
     virtual EventCategory getCategories() const = 0;
 
@@ -79,6 +92,16 @@ public:
     static std::type_index staticTypeIndex() {
         return std::type_index(typeid(Derived));
     }
+
+    EventTypeID getTypeID() const override {
+        return staticTypeID();
+    }
+
+    /// Get static dense type ID (assigned on first use and cached)
+    static EventTypeID staticTypeID() {
+        static const EventTypeID s_id = getTypeIDFor(std::type_index(typeid(Derived)));
+        return s_id;
+    }
 };
 
 } // namespace Pina
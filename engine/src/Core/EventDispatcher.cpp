@@ -1,9 +1,15 @@
 /// Pina Engine - Event Dispatcher Implementation
 
 #include "EventDispatcher.h"
+#include <algorithm>
 
 namespace Pina {
 
+EventDispatcher::EventDispatcher(size_t concurrentQueueCapacity)
+    : m_concurrentQueue(concurrentQueueCapacity)
+{
+}
+
 // ============================================================================
 // Subsystem Lifecycle
 // ============================================================================
@@ -27,16 +33,14 @@ void EventDispatcher::shutdown() {
 // ============================================================================
 
 bool EventDispatcher::unsubscribe(EventHandle handle) {
-    for (auto& [typeIndex, handlers] : m_handlers) {
-        auto it = std::find_if(handlers.begin(), handlers.end(),
-            [handle](const Handler& h) { return h.handle == handle; });
+    EventTypeID type = static_cast<EventTypeID>(handle >> (HandleSlotBits + HandleGenerationBits));
+    uint32_t generation = static_cast<uint32_t>((handle >> HandleSlotBits) & HandleGenerationMask);
+    uint32_t slot = static_cast<uint32_t>(handle & HandleSlotMask);
 
-        if (it != handlers.end()) {
-            handlers.erase(it);
-            return true;
-        }
+    if (type >= m_handlers.size() || !m_handlers[type]) {
+        return false;
     }
-    return false;
+    return m_handlers[type]->remove(slot, generation);
 }
 
 // ============================================================================
@@ -44,17 +48,58 @@ bool EventDispatcher::unsubscribe(EventHandle handle) {
 // ============================================================================
 
 void EventDispatcher::processQueue() {
+    // Nested calls from handlers leave the remaining events to the outer loop
+    if (m_processingQueue) return;
+    m_processingQueue = true;
+
+    // Events from other threads first; bounded so a handler that keeps
+    // posting cannot stall the frame
+    m_concurrentQueue.drain([this](Event& event) {
+        dispatchToHandlers(event);
+    }, m_concurrentQueue.getCapacity());
+    m_discardDispatchQueue = false;  // Nothing dispatched from the local queue yet
+
+    // Events queued by handlers are processed in the same call
     while (!m_eventQueue.empty()) {
-        auto event = std::move(m_eventQueue.front());
-        m_eventQueue.pop();
-
-        dispatchToHandlers(*event, event->getTypeIndex());
+        m_eventQueue.swap(m_dispatchQueue);
+        m_eventQueue.setMaxSize(m_maxQueueSize);
+
+        while (!m_dispatchQueue.empty()) {
+            Event& event = m_dispatchQueue.front();
+            dispatchToHandlers(event);
+
+            if (m_discardDispatchQueue) {
+                m_discardDispatchQueue = false;
+                m_dispatchQueue.clear();
+                break;
+            }
+            m_dispatchQueue.pop();
+        }
     }
+
+    m_dispatchQueue.setMaxSize(m_maxQueueSize);
+    m_processingQueue = false;
 }
 
 void EventDispatcher::clearQueue() {
-    while (!m_eventQueue.empty()) {
-        m_eventQueue.pop();
+    m_eventQueue.clear();
+
+    if (m_processingQueue) {
+        // The front event is still being dispatched; drop the rest afterwards
+        m_discardDispatchQueue = true;
+    } else {
+        m_dispatchQueue.clear();
+        m_concurrentQueue.clear();
+    }
+}
+
+void EventDispatcher::setMaxQueueSize(size_t size) {
+    m_maxQueueSize = size;
+    m_eventQueue.setMaxSize(size);
+
+    // The dispatch queue is resized once the current batch is finished
+    if (!m_processingQueue) {
+        m_dispatchQueue.setMaxSize(size);
     }
 }
 
@@ -62,27 +107,126 @@ void EventDispatcher::clearQueue() {
 // Internal Helpers
 // ============================================================================
 
-void EventDispatcher::sortHandlers(HandlerList& handlers) {
-    std::stable_sort(handlers.begin(), handlers.end(),
-        [](const Handler& a, const Handler& b) {
-            return a.priority < b.priority;  // Lower priority value = higher priority
-        });
+bool EventDispatcher::dispatchToHandlers(Event& event) {
+    EventTypeID type = event.getTypeID();
+    if (type >= m_handlers.size() || !m_handlers[type]) {
+        return false;
+    }
+    return m_handlers[type]->dispatchEvent(event);
+}
+
+// ============================================================================
+// Handler Lists
+// ============================================================================
+
+uint32_t EventDispatcher::HandlerListBase::allocateSlot() {
+    if (!m_freeSlots.empty()) {
+        uint32_t slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        return slot;
+    }
+
+    m_slots.emplace_back();
+    return static_cast<uint32_t>(m_slots.size() - 1);
+}
+
+EventHandle EventDispatcher::HandlerListBase::insert(EventTypeID type, uint32_t slot,
+                                                     int32_t priority, void* callback) {
+    Slot& entry = m_slots[slot];
+    entry.alive = true;
+    m_liveCount++;
+
+    if (m_dispatchDepth > 0) {
+        // Joins m_order once the outermost dispatch finishes
+        m_pending.push_back({slot, priority, callback});
+    } else {
+        insertOrdered({slot, priority, callback});
+    }
+
+    return (static_cast<uint64_t>(type) << (HandleSlotBits + HandleGenerationBits)) |
+           (static_cast<uint64_t>(entry.generation) << HandleSlotBits) |
+           static_cast<uint64_t>(slot);
 }
 
-bool EventDispatcher::dispatchToHandlers(Event& event, const std::type_index& typeIndex) {
-    auto it = m_handlers.find(typeIndex);
-    if (it == m_handlers.end()) {
+void EventDispatcher::HandlerListBase::insertOrdered(const OrderEntry& entry) {
+    // Lower value = higher priority; equal priorities keep subscription order
+    auto it = std::upper_bound(m_order.begin(), m_order.end(), entry.priority,
+        [](int32_t value, const OrderEntry& other) { return value < other.priority; });
+    m_order.insert(it, entry);
+}
+
+bool EventDispatcher::HandlerListBase::remove(uint32_t slot, uint32_t generation) {
+    if (slot >= m_slots.size()) {
         return false;
     }
 
-    for (auto& handler : it->second) {
-        handler.callback(event);
-        if (event.isConsumed()) {
-            return true;
+    Slot& entry = m_slots[slot];
+    if (!entry.alive || entry.generation != generation) {
+        return false;
+    }
+
+    // Invalidate outstanding handles to this slot
+    entry.alive = false;
+    entry.generation = static_cast<uint32_t>((entry.generation + 1) & HandleGenerationMask);
+    if (entry.generation == 0) {
+        entry.generation = 1;
+    }
+    m_liveCount--;
+    m_removed.push_back(slot);
+
+    if (m_dispatchDepth > 0) {
+        // The callback may be the one currently running
+        m_deferredCallbacks.push_back(slot);
+        return true;
+    }
+
+    releaseCallback(slot);
+
+    // Amortized O(1): compact once removed slots outnumber live ones
+    if (m_removed.size() * 2 > m_order.size()) {
+        compact();
+    }
+    return true;
+}
+
+void EventDispatcher::HandlerListBase::removeAll() {
+    for (uint32_t slot = 0; slot < m_slots.size(); ++slot) {
+        if (m_slots[slot].alive) {
+            remove(slot, m_slots[slot].generation);
         }
     }
+}
+
+void EventDispatcher::HandlerListBase::endDispatch() {
+    if (--m_dispatchDepth > 0) {
+        return;
+    }
+
+    for (uint32_t slot : m_deferredCallbacks) {
+        releaseCallback(slot);
+    }
+    m_deferredCallbacks.clear();
+
+    for (const OrderEntry& entry : m_pending) {
+        if (m_slots[entry.slot].alive) {
+            insertOrdered(entry);
+        }
+        // Otherwise unsubscribed before it was listed; freed by compact()
+    }
+    m_pending.clear();
+
+    if (m_removed.size() * 2 > m_order.size()) {
+        compact();
+    }
+}
+
+void EventDispatcher::HandlerListBase::compact() {
+    m_order.erase(std::remove_if(m_order.begin(), m_order.end(),
+        [this](const OrderEntry& entry) { return !m_slots[entry.slot].alive; }),
+        m_order.end());
 
-    return false;
+    m_freeSlots.insert(m_freeSlots.end(), m_removed.begin(), m_removed.end());
+    m_removed.clear();
 }
 
 } // namespace Pina
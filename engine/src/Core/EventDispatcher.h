@@ -7,12 +7,11 @@
 #include "Memory.h"
 #include "Subsystem.h"
 #include "Event.h"
+#include "EventQueue.h"
+#include <deque>
 #include <functional>
 #include <vector>
-#include <unordered_map>
 #include <typeindex>
-#include <queue>
-#include <algorithm>
 
 namespace Pina {
 
@@ -20,7 +19,8 @@ namespace Pina {
 // Types
 // ============================================================================
 
-/// Handle for unsubscribing from events
+/// Handle for unsubscribing from events (0 is never a valid handle)
+/// Encodes the event type and handler slot, checked by a generation count.
 using EventHandle = uint64_t;
 
 /// Generic event callback type
@@ -40,10 +40,13 @@ enum class EventPriority : int32_t {
 // ============================================================================
 
 /// Central event dispatcher subsystem
-/// Manages event subscriptions and dispatches events to handlers
+/// Manages event subscriptions and dispatches events to handlers.
+/// Everything except queueFromAnyThread() must be called from the thread
+/// that updates the dispatcher.
 class PINA_API EventDispatcher : public Subsystem {
 public:
-    EventDispatcher() = default;
+    /// @param concurrentQueueCapacity Events queueFromAnyThread() can hold between updates
+    explicit EventDispatcher(size_t concurrentQueueCapacity = 4096);
     ~EventDispatcher() override = default;
 
     // ========================================================================
@@ -54,6 +57,11 @@ public:
     void update(float deltaTime) override;
     void shutdown() override;
 
+    /// Queued events reach arbitrary handlers, so flush alone before other updates
+    void declareDependencies(SubsystemDependencies& deps) const override {
+        deps.phase(SubsystemPhase::PreUpdate).exclusive();
+    }
+
     // ========================================================================
     // Subscription API
     // ========================================================================
@@ -91,6 +99,14 @@ public:
     template<typename EventType>
     void queue(const EventType& event);
 
+    /// Queue event for deferred dispatch from any thread (lock-free)
+    /// Events posted by one thread are dispatched in the order they were
+    /// posted. Dispatch happens on the thread that calls processQueue().
+    /// @param event Event to queue (will be copied)
+    /// @return false if the concurrent queue was full and the event was dropped
+    template<typename EventType>
+    bool queueFromAnyThread(const EventType& event);
+
     /// Process all queued events (called automatically in update())
     void processQueue();
 
@@ -102,42 +118,158 @@ public:
     // ========================================================================
 
     /// Set maximum queue size (oldest events dropped when exceeded)
-    void setMaxQueueSize(size_t size) { m_maxQueueSize = size; }
+    void setMaxQueueSize(size_t size);
 
     /// Get current queue size
-    size_t getQueueSize() const { return m_eventQueue.size(); }
+    size_t getQueueSize() const {
+        return m_eventQueue.size() + m_dispatchQueue.size() + m_concurrentQueue.sizeApprox();
+    }
+
+    /// Get number of queued events dropped because a queue was full
+    uint64_t getDroppedEventCount() const {
+        return m_eventQueue.getDroppedCount() + m_dispatchQueue.getDroppedCount() +
+               m_concurrentQueue.getDroppedCount();
+    }
 
     /// Get number of handlers for a specific event type
     template<typename EventType>
     size_t getHandlerCount() const;
 
 private:
-    /// Internal handler storage
-    struct Handler {
-        EventHandle handle;
-        EventCallback callback;
-        int32_t priority;
+    // Handle layout: [type ID:16][generation:24][handler slot:24]
+    static constexpr uint32_t HandleSlotBits = 24;
+    static constexpr uint32_t HandleGenerationBits = 24;
+    static constexpr uint64_t HandleSlotMask = (1ull << HandleSlotBits) - 1;
+    static constexpr uint64_t HandleGenerationMask = (1ull << HandleGenerationBits) - 1;
+
+    /// Type-independent handler bookkeeping for one event type
+    /// Slots never move, so handles index them directly. m_order lists slots
+    /// by priority and does not change while a dispatch is iterating it:
+    /// subscriptions made during dispatch wait in m_pending, and removed slots
+    /// stay in m_order (skipped) until it is compacted.
+    class PINA_API HandlerListBase {
+    public:
+        virtual ~HandlerListBase() = default;
+
+        /// Dispatch a type-erased event (one virtual call per event)
+        virtual bool dispatchEvent(Event& event) = 0;
+
+        /// Insert an allocated slot by priority (after equal priorities)
+        /// @param callback The slot's stored callback (address stays valid)
+        EventHandle insert(EventTypeID type, uint32_t slot, int32_t priority, void* callback);
+
+        /// Remove a live handler; false if the generation does not match
+        bool remove(uint32_t slot, uint32_t generation);
+
+        /// Remove every handler
+        void removeAll();
+
+        size_t getLiveCount() const { return m_liveCount; }
+
+    protected:
+        /// Reuse a free slot or add one; the caller stores the callback
+        uint32_t allocateSlot();
+
+        /// Destroy the callback of a removed slot
+        virtual void releaseCallback(uint32_t slot) = 0;
+
+        void beginDispatch() { m_dispatchDepth++; }
+        void endDispatch();
+
+        struct Slot {
+            uint32_t generation = 1;
+            bool alive = false;
+        };
+
+        /// Dispatch order entry, self-contained so dispatch walks it linearly
+        struct OrderEntry {
+            uint32_t slot;
+            int32_t priority;
+            void* callback;
+        };
+
+        std::vector<Slot> m_slots;
+        std::vector<OrderEntry> m_order;    // By priority (may contain removed slots)
+
+    private:
+        void compact();
+        void insertOrdered(const OrderEntry& entry);
+
+        std::vector<OrderEntry> m_pending;  // Subscribed during dispatch
+        std::vector<uint32_t> m_removed;    // Removed but still listed in m_order
+        std::vector<uint32_t> m_deferredCallbacks;  // Removed during dispatch
+        std::vector<uint32_t> m_freeSlots;
+        size_t m_liveCount = 0;
+        uint32_t m_dispatchDepth = 0;
     };
 
-    using HandlerList = std::vector<Handler>;
+    /// Handlers for one event type, stored with their typed callbacks
+    /// Dispatch calls each std::function<void(EventType&)> directly.
+    template<typename EventType>
+    class HandlerList final : public HandlerListBase {
+    public:
+        EventHandle add(EventTypeID type, std::function<void(EventType&)> callback, int32_t priority);
+        bool dispatch(EventType& event);
 
-    std::unordered_map<std::type_index, HandlerList> m_handlers;
-    std::queue<UNIQUE<Event>> m_eventQueue;
+        bool dispatchEvent(Event& event) override { return dispatch(static_cast<EventType&>(event)); }
 
-    EventHandle m_nextHandle = 1;
-    size_t m_maxQueueSize = 1024;
+    protected:
+        void releaseCallback(uint32_t slot) override { m_callbacks[slot] = nullptr; }
 
-    /// Sort handlers by priority after adding new one
-    void sortHandlers(HandlerList& handlers);
+    private:
+        std::deque<std::function<void(EventType&)>> m_callbacks;   // Stable while called
+    };
+
+    /// Dense ID of the static event type (cached per type)
+    template<typename EventType>
+    static EventTypeID getEventTypeID();
 
-    /// Dispatch to handlers for a specific type
-    bool dispatchToHandlers(Event& event, const std::type_index& typeIndex);
+    /// Get (creating if needed) the handler list for an event type
+    template<typename EventType>
+    HandlerList<EventType>& getHandlerList();
+
+    /// Indexed by EventTypeID
+    std::vector<UNIQUE<HandlerListBase>> m_handlers;
+
+    // Events are queued into m_eventQueue; processQueue() swaps it with
+    // m_dispatchQueue so handlers can queue more events (and trigger drops)
+    // without touching the event being dispatched.
+    EventQueue m_eventQueue;
+    EventQueue m_dispatchQueue;
+
+    // Events posted by other threads, drained at the start of processQueue()
+    ConcurrentEventQueue m_concurrentQueue;
+
+    size_t m_maxQueueSize = 1024;
+    bool m_processingQueue = false;
+    bool m_discardDispatchQueue = false;
+
+    /// Dispatch a queued event to the handlers of its dynamic type
+    bool dispatchToHandlers(Event& event);
 };
 
 // ============================================================================
 // Template Implementations
 // ============================================================================
 
+template<typename EventType>
+EventTypeID EventDispatcher::getEventTypeID() {
+    static const EventTypeID s_id = Event::getTypeIDFor(std::type_index(typeid(EventType)));
+    return s_id;
+}
+
+template<typename EventType>
+EventDispatcher::HandlerList<EventType>& EventDispatcher::getHandlerList() {
+    EventTypeID type = getEventTypeID<EventType>();
+    if (type >= m_handlers.size()) {
+        m_handlers.resize(type + 1);
+    }
+    if (!m_handlers[type]) {
+        m_handlers[type] = MAKE_UNIQUE<HandlerList<EventType>>();
+    }
+    return static_cast<HandlerList<EventType>&>(*m_handlers[type]);
+}
+
 template<typename EventType>
 EventHandle EventDispatcher::subscribe(
     std::function<void(EventType&)> callback,
@@ -146,27 +278,16 @@ EventHandle EventDispatcher::subscribe(
     static_assert(std::is_base_of<Event, EventType>::value,
                   "EventType must derive from Event");
 
-    auto typeIndex = std::type_index(typeid(EventType));
-    EventHandle handle = m_nextHandle++;
-
-    // Wrap typed callback in generic callback
-    Handler handler;
-    handler.handle = handle;
-    handler.priority = static_cast<int32_t>(priority);
-    handler.callback = [callback](Event& e) {
-        callback(static_cast<EventType&>(e));
-    };
-
-    m_handlers[typeIndex].push_back(std::move(handler));
-    sortHandlers(m_handlers[typeIndex]);
-
-    return handle;
+    return getHandlerList<EventType>().add(getEventTypeID<EventType>(), std::move(callback),
+                                           static_cast<int32_t>(priority));
 }
 
 template<typename EventType>
 void EventDispatcher::unsubscribeAll() {
-    auto typeIndex = std::type_index(typeid(EventType));
-    m_handlers.erase(typeIndex);
+    EventTypeID type = getEventTypeID<EventType>();
+    if (type < m_handlers.size() && m_handlers[type]) {
+        m_handlers[type]->removeAll();
+    }
 }
 
 template<typename EventType>
@@ -174,7 +295,11 @@ bool EventDispatcher::dispatch(EventType& event) {
     static_assert(std::is_base_of<Event, EventType>::value,
                   "EventType must derive from Event");
 
-    return dispatchToHandlers(event, std::type_index(typeid(EventType)));
+    EventTypeID type = getEventTypeID<EventType>();
+    if (type >= m_handlers.size() || !m_handlers[type]) {
+        return false;
+    }
+    return static_cast<HandlerList<EventType>&>(*m_handlers[type]).dispatch(event);
 }
 
 template<typename EventType>
@@ -182,22 +307,63 @@ void EventDispatcher::queue(const EventType& event) {
     static_assert(std::is_base_of<Event, EventType>::value,
                   "EventType must derive from Event");
 
-    if (m_eventQueue.size() >= m_maxQueueSize) {
-        // Drop oldest event
-        m_eventQueue.pop();
-    }
+    // Copied in place; drops the oldest event when full
+    m_eventQueue.push(event);
+}
 
-    m_eventQueue.push(MAKE_UNIQUE<EventType>(event));
+template<typename EventType>
+bool EventDispatcher::queueFromAnyThread(const EventType& event) {
+    static_assert(std::is_base_of<Event, EventType>::value,
+                  "EventType must derive from Event");
+
+    return m_concurrentQueue.push(event);
 }
 
 template<typename EventType>
 size_t EventDispatcher::getHandlerCount() const {
-    auto typeIndex = std::type_index(typeid(EventType));
-    auto it = m_handlers.find(typeIndex);
-    if (it != m_handlers.end()) {
-        return it->second.size();
+    EventTypeID type = getEventTypeID<EventType>();
+    if (type < m_handlers.size() && m_handlers[type]) {
+        return m_handlers[type]->getLiveCount();
     }
     return 0;
 }
 
+template<typename EventType>
+EventHandle EventDispatcher::HandlerList<EventType>::add(
+    EventTypeID type, std::function<void(EventType&)> callback, int32_t priority)
+{
+    uint32_t slot = allocateSlot();
+    if (slot == m_callbacks.size()) {
+        m_callbacks.push_back(std::move(callback));
+    } else {
+        m_callbacks[slot] = std::move(callback);
+    }
+    return insert(type, slot, priority, &m_callbacks[slot]);
+}
+
+template<typename EventType>
+bool EventDispatcher::HandlerList<EventType>::dispatch(EventType& event) {
+    beginDispatch();
+
+    using Callback = std::function<void(EventType&)>;
+
+    bool consumed = false;
+    const size_t count = m_order.size();
+    for (size_t i = 0; i < count; ++i) {
+        const OrderEntry& entry = m_order[i];
+        if (!m_slots[entry.slot].alive) {
+            continue;
+        }
+
+        (*static_cast<Callback*>(entry.callback))(event);
+        if (event.isConsumed()) {
+            consumed = true;
+            break;
+        }
+    }
+
+    endDispatch();
+    return consumed;
+}
+
 } // namespace Pina
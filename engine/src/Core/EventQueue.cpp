@@ -0,0 +1,183 @@
+/// Pina Engine - Event Queue Implementation
+
+#include "EventQueue.h"
+#include "MemoryTracker.h"
+#include <utility>
+
+namespace Pina {
+
+EventQueue::EventQueue(size_t maxSize)
+    : m_maxSize(maxSize)
+{
+}
+
+EventQueue::~EventQueue() {
+    clear();
+    reallocate(0);
+}
+
+void EventQueue::pop() {
+    if (m_size == 0) return;
+
+    destroy(m_slots[m_head]);
+    m_head = (m_head + 1) % m_capacity;
+    m_size--;
+
+    // Restart at the beginning of the buffer once drained
+    if (m_size == 0) {
+        m_head = 0;
+    }
+}
+
+void EventQueue::clear() {
+    while (m_size > 0) {
+        pop();
+    }
+}
+
+void EventQueue::swap(EventQueue& other) noexcept {
+    std::swap(m_slots, other.m_slots);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_maxSize, other.m_maxSize);
+    std::swap(m_head, other.m_head);
+    std::swap(m_size, other.m_size);
+    std::swap(m_dropped, other.m_dropped);
+}
+
+void EventQueue::setMaxSize(size_t maxSize) {
+    m_maxSize = maxSize;
+
+    while (m_size > m_maxSize) {
+        dropOldest();
+    }
+
+    if (m_size == 0 && m_capacity != m_maxSize) {
+        reallocate(m_maxSize);
+    }
+}
+
+EventQueue::Slot* EventQueue::acquireSlot() {
+    if (m_maxSize == 0) {
+        m_dropped++;
+        return nullptr;
+    }
+
+    if (m_size == 0 && m_capacity != m_maxSize) {
+        reallocate(m_maxSize);
+    }
+
+    size_t limit = m_maxSize < m_capacity ? m_maxSize : m_capacity;
+    if (m_size >= limit) {
+        dropOldest();
+    }
+
+    Slot* slot = &m_slots[(m_head + m_size) % m_capacity];
+    m_size++;
+    return slot;
+}
+
+void EventQueue::destroy(Slot& slot) {
+    Event* event = slot.event;
+    slot.event = nullptr;
+
+    if (event == reinterpret_cast<Event*>(slot.storage)) {
+        event->~Event();
+    } else {
+        delete event;
+    }
+}
+
+void EventQueue::dropOldest() {
+    pop();
+    m_dropped++;
+}
+
+void EventQueue::reallocate(size_t capacity) {
+    if (m_slots) {
+        MemoryTracker::deallocate(m_slots, sizeof(Slot) * m_capacity, MemoryTag::Events);
+        m_slots = nullptr;
+    }
+
+    m_capacity = capacity;
+    m_head = 0;
+    if (m_capacity > 0) {
+        m_slots = static_cast<Slot*>(MemoryTracker::allocate(sizeof(Slot) * m_capacity, MemoryTag::Events));
+    }
+}
+
+// ============================================================================
+// ConcurrentEventQueue
+// ============================================================================
+
+ConcurrentEventQueue::ConcurrentEventQueue(size_t capacity) {
+    size_t rounded = 2;
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+    m_mask = rounded - 1;
+
+    m_cells = static_cast<Cell*>(MemoryTracker::allocate(sizeof(Cell) * rounded, MemoryTag::Events));
+    for (size_t i = 0; i < rounded; ++i) {
+        ::new (&m_cells[i].sequence) std::atomic<size_t>(i);
+        m_cells[i].event = nullptr;
+    }
+}
+
+ConcurrentEventQueue::~ConcurrentEventQueue() {
+    clear();
+
+    for (size_t i = 0; i <= m_mask; ++i) {
+        m_cells[i].sequence.~atomic();
+    }
+    MemoryTracker::deallocate(m_cells, sizeof(Cell) * (m_mask + 1), MemoryTag::Events);
+}
+
+void ConcurrentEventQueue::clear() {
+    drain([](Event&) {}, m_mask + 1);
+}
+
+size_t ConcurrentEventQueue::sizeApprox() const {
+    size_t enqueued = m_enqueuePosition.load(std::memory_order_relaxed);
+    return enqueued > m_dequeuePosition ? enqueued - m_dequeuePosition : 0;
+}
+
+ConcurrentEventQueue::Cell* ConcurrentEventQueue::acquireCell(size_t& position) {
+    position = m_enqueuePosition.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = m_cells[position & m_mask];
+        size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (diff == 0) {
+            // Cell is free for this position; claim it
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                        std::memory_order_relaxed)) {
+                return &cell;
+            }
+        } else if (diff < 0) {
+            // Consumer has not released this cell from the previous lap
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        } else {
+            // Another producer claimed it first
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void ConcurrentEventQueue::releaseCell(Cell& cell) {
+    Event* event = cell.event;
+    cell.event = nullptr;
+
+    if (event == reinterpret_cast<Event*>(cell.storage)) {
+        event->~Event();
+    } else {
+        delete event;
+    }
+
+    // Free for the position one lap ahead
+    m_dequeuePosition++;
+    cell.sequence.store(m_dequeuePosition + m_mask, std::memory_order_release);
+}
+
+} // namespace Pina
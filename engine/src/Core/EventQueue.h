@@ -0,0 +1,207 @@
+#pragma once
+
+/// Pina Engine - Event Queue
+/// Bounded FIFO ring buffers that store events in place (no per-event allocation)
+
+#include "Export.h"
+#include "Event.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace Pina {
+
+/// Bounded FIFO of polymorphic events
+/// Events are copy-constructed into fixed-size inline slots of a ring buffer
+/// that is allocated once; events larger than SlotSize fall back to the heap.
+/// When full, pushing drops the oldest event. Not thread-safe.
+class PINA_API EventQueue {
+public:
+    /// Largest event stored inline (one cache line)
+    static constexpr size_t SlotSize = 64;
+
+    explicit EventQueue(size_t maxSize = 1024);
+    ~EventQueue();
+
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+
+    /// Copy an event to the back (drops the oldest if full)
+    template<typename EventType>
+    void push(const EventType& event);
+
+    /// Oldest event (queue must not be empty)
+    Event& front() { return *m_slots[m_head].event; }
+
+    /// Destroy the oldest event
+    void pop();
+
+    /// Destroy all events
+    void clear();
+
+    /// Exchange contents and limits with another queue
+    void swap(EventQueue& other) noexcept;
+
+    /// Set the maximum number of queued events
+    /// Shrinking drops the oldest events; growing takes effect immediately
+    /// if the queue is empty, otherwise the next time it drains.
+    void setMaxSize(size_t maxSize);
+
+    size_t getMaxSize() const { return m_maxSize; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /// Slots currently allocated
+    size_t getCapacity() const { return m_capacity; }
+
+    /// Events dropped because the queue was full
+    uint64_t getDroppedCount() const { return m_dropped; }
+
+    /// Whether an event type is stored without a heap allocation
+    template<typename EventType>
+    static constexpr bool storesInline() {
+        return sizeof(EventType) <= SlotSize && alignof(EventType) <= alignof(std::max_align_t);
+    }
+
+private:
+    struct Slot {
+        alignas(std::max_align_t) unsigned char storage[SlotSize];
+        Event* event;   // Points into storage, or to a heap-allocated event
+    };
+
+    /// Claim the slot after the newest event, dropping the oldest if full
+    Slot* acquireSlot();
+    void destroy(Slot& slot);
+    void dropOldest();
+    void reallocate(size_t capacity);
+
+    Slot* m_slots = nullptr;
+    size_t m_capacity = 0;    // Allocated slots
+    size_t m_maxSize = 0;     // Logical limit (capacity catches up when empty)
+    size_t m_head = 0;
+    size_t m_size = 0;
+    uint64_t m_dropped = 0;
+};
+
+/// Bounded lock-free multi-producer, single-consumer queue of events
+/// Any thread may push; one thread (the owner of the EventDispatcher) drains.
+/// Each producer's events are drained in the order it pushed them. Memory is
+/// fixed at construction: pushing into a full queue drops the new event.
+class PINA_API ConcurrentEventQueue {
+public:
+    static constexpr size_t SlotSize = EventQueue::SlotSize;
+
+    /// @param capacity Maximum queued events (rounded up to a power of 2)
+    explicit ConcurrentEventQueue(size_t capacity = 4096);
+    ~ConcurrentEventQueue();
+
+    ConcurrentEventQueue(const ConcurrentEventQueue&) = delete;
+    ConcurrentEventQueue& operator=(const ConcurrentEventQueue&) = delete;
+
+    /// Copy an event to the back (any thread)
+    /// @return false if the queue was full and the event was dropped
+    template<typename EventType>
+    bool push(const EventType& event);
+
+    /// Call fn(Event&) for up to maxCount events in FIFO order, destroying
+    /// each afterwards (consumer thread only)
+    /// Stops early at an event a producer has not finished writing yet.
+    /// @return Number of events drained
+    template<typename Fn>
+    size_t drain(Fn&& fn, size_t maxCount);
+
+    /// Destroy all published events (consumer thread only)
+    void clear();
+
+    size_t getCapacity() const { return m_mask + 1; }
+
+    /// Approximate number of queued events
+    size_t sizeApprox() const;
+
+    /// Events dropped because the queue was full
+    uint64_t getDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;   // == position when free, position + 1 when published
+        alignas(std::max_align_t) unsigned char storage[SlotSize];
+        Event* event;
+    };
+
+    /// Claim the cell for the next position, or nullptr if full
+    Cell* acquireCell(size_t& position);
+
+    /// Destroy a drained event and hand its cell back to producers
+    void releaseCell(Cell& cell);
+
+    Cell* m_cells = nullptr;
+    size_t m_mask = 0;
+
+    // Producer and consumer positions live on separate cache lines
+    alignas(64) std::atomic<size_t> m_enqueuePosition{0};
+    alignas(64) size_t m_dequeuePosition = 0;
+    std::atomic<uint64_t> m_dropped{0};
+};
+
+// ============================================================================
+// Template Implementations
+// ============================================================================
+
+template<typename EventType>
+void EventQueue::push(const EventType& event) {
+    static_assert(std::is_base_of<Event, EventType>::value,
+                  "EventType must derive from Event");
+
+    Slot* slot = acquireSlot();
+    if (!slot) {
+        return;
+    }
+
+    if constexpr (storesInline<EventType>()) {
+        slot->event = ::new (slot->storage) EventType(event);
+    } else {
+        slot->event = new EventType(event);
+    }
+}
+
+template<typename EventType>
+bool ConcurrentEventQueue::push(const EventType& event) {
+    static_assert(std::is_base_of<Event, EventType>::value,
+                  "EventType must derive from Event");
+
+    size_t position;
+    Cell* cell = acquireCell(position);
+    if (!cell) {
+        return false;
+    }
+
+    if constexpr (EventQueue::storesInline<EventType>()) {
+        cell->event = ::new (cell->storage) EventType(event);
+    } else {
+        cell->event = new EventType(event);
+    }
+
+    // Publish to the consumer
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename Fn>
+size_t ConcurrentEventQueue::drain(Fn&& fn, size_t maxCount) {
+    size_t count = 0;
+    while (count < maxCount) {
+        Cell& cell = m_cells[m_dequeuePosition & m_mask];
+        if (cell.sequence.load(std::memory_order_acquire) != m_dequeuePosition + 1) {
+            break;  // Empty, or the next producer is still writing
+        }
+
+        fn(*cell.event);
+        releaseCell(cell);
+        count++;
+    }
+    return count;
+}
+
+} // namespace Pina
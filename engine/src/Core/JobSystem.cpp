@@ -0,0 +1,373 @@
+/// Pina Engine - Job System Implementation
+
+#include "JobSystem.h"
+#include "Profiler.h"
+
+namespace Pina {
+
+namespace {
+
+// Per-thread identity: which job system the thread belongs to and its queue index
+thread_local JobSystem* s_threadSystem = nullptr;
+thread_local uint32_t s_threadIndex = ~0u;
+
+// Yields before an idle worker goes to sleep
+constexpr int kSpinCount = 64;
+
+uint32_t roundUpToPowerOfTwo(uint32_t value) {
+    uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace
+
+// ============================================================================
+// TaskGroup
+// ============================================================================
+
+TaskGroup::~TaskGroup() {
+    // The last finishing job decrements under the lock; wait for it to leave
+    std::lock_guard<std::mutex> lock(m_mutex);
+}
+
+// ============================================================================
+// WorkStealingQueue
+// ============================================================================
+
+WorkStealingQueue::WorkStealingQueue(uint32_t capacity) {
+    uint32_t size = roundUpToPowerOfTwo(capacity < 2 ? 2 : capacity);
+    m_buffer = std::unique_ptr<std::atomic<Job*>[]>(new std::atomic<Job*>[size]);
+    for (uint32_t i = 0; i < size; ++i) {
+        m_buffer[i].store(nullptr, std::memory_order_relaxed);
+    }
+    m_mask = static_cast<int64_t>(size) - 1;
+}
+
+bool WorkStealingQueue::push(Job* job) {
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t top = m_top.load(std::memory_order_acquire);
+    if (bottom - top > m_mask) {
+        return false;
+    }
+
+    m_buffer[bottom & m_mask].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    return true;
+}
+
+Job* WorkStealingQueue::pop() {
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        // Empty
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = m_buffer[bottom & m_mask].load(std::memory_order_relaxed);
+    if (top == bottom) {
+        // Last item: race against stealers for it
+        if (!m_top.compare_exchange_strong(top, top + 1,
+                                           std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job* WorkStealingQueue::steal() {
+    int64_t top = m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom) {
+        return nullptr;
+    }
+
+    Job* job = m_buffer[top & m_mask].load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1,
+                                       std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return job;
+}
+
+size_t WorkStealingQueue::size() const {
+    int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    int64_t top = m_top.load(std::memory_order_relaxed);
+    return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+// ============================================================================
+// JobSystem Lifecycle
+// ============================================================================
+
+JobSystem::JobSystem(const JobSystemConfig& config)
+    : m_config(config)
+{
+}
+
+JobSystem::~JobSystem() {
+    shutdown();
+}
+
+void JobSystem::initialize() {
+    if (isRunning()) return;
+
+    uint32_t workerCount = m_config.workerCount;
+    if (workerCount == 0) {
+        uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+
+    // Queue 0 belongs to the initializing (main) thread
+    m_queues.clear();
+    for (uint32_t i = 0; i <= workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkStealingQueue>(m_config.queueCapacity));
+    }
+
+    s_threadSystem = this;
+    s_threadIndex = 0;
+
+    m_running.store(true, std::memory_order_release);
+
+    m_workers.reserve(workerCount);
+    for (uint32_t i = 1; i <= workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+}
+
+void JobSystem::shutdown() {
+    if (!isRunning()) return;
+
+    m_running.store(false, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+
+    // Workers are gone: run whatever is left on this thread so groups complete
+    // and no job leaks. Jobs released from here execute inline.
+    while (Job* job = findJob(0)) {
+        execute(job);
+    }
+
+    if (s_threadSystem == this) {
+        s_threadSystem = nullptr;
+        s_threadIndex = ~0u;
+    }
+}
+
+// ============================================================================
+// Submission
+// ============================================================================
+
+void JobSystem::submit(std::function<void()> function, TaskGroup* group) {
+    submit(std::move(function), group, {});
+}
+
+void JobSystem::submit(std::function<void()> function, TaskGroup* group,
+                       std::initializer_list<TaskGroup*> dependencies) {
+    Job* job = new Job();
+    job->function = std::move(function);
+    job->group = group;
+
+    if (group) {
+        group->m_pending.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // One extra count keeps the job from being scheduled while dependencies
+    // are still being registered
+    job->dependencies.store(static_cast<uint32_t>(dependencies.size()) + 1, std::memory_order_relaxed);
+
+    for (TaskGroup* dependency : dependencies) {
+        bool satisfied = true;
+        if (dependency) {
+            std::lock_guard<std::mutex> lock(dependency->m_mutex);
+            if (dependency->m_pending.load(std::memory_order_acquire) > 0) {
+                dependency->m_continuations.push_back(job);
+                satisfied = false;
+            }
+        }
+        if (satisfied) {
+            release(job);
+        }
+    }
+
+    release(job);
+}
+
+void JobSystem::wait(TaskGroup& group) {
+    uint32_t index = getThreadIndex();
+
+    while (!group.isDone()) {
+        // Help instead of blocking; external threads can only yield
+        if (index != ~0u && executeOne(index)) {
+            continue;
+        }
+        std::this_thread::yield();
+    }
+}
+
+uint32_t JobSystem::getThreadIndex() const {
+    return s_threadSystem == this ? s_threadIndex : ~0u;
+}
+
+// ============================================================================
+// Scheduling
+// ============================================================================
+
+void JobSystem::workerLoop(uint32_t index) {
+    s_threadSystem = this;
+    s_threadIndex = index;
+    Profiler::setThreadName("Job Worker " + std::to_string(index));
+
+    while (m_running.load(std::memory_order_acquire)) {
+        if (executeOne(index)) {
+            continue;
+        }
+
+        // Spin briefly, then sleep until something is queued
+        bool pending = false;
+        for (int spin = 0; spin < kSpinCount && !pending; ++spin) {
+            std::this_thread::yield();
+            pending = m_queuedJobs.load() > 0;
+        }
+        if (pending) {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_sleepingWorkers.fetch_add(1);
+        m_wakeCondition.wait(lock, [this]() {
+            return m_queuedJobs.load() > 0 || !m_running.load(std::memory_order_acquire);
+        });
+        m_sleepingWorkers.fetch_sub(1);
+    }
+
+    s_threadSystem = nullptr;
+    s_threadIndex = ~0u;
+}
+
+void JobSystem::schedule(Job* job) {
+    // Without workers there is nobody to hand the job to
+    if (!isRunning() || m_workers.empty()) {
+        execute(job);
+        return;
+    }
+
+    uint32_t index = getThreadIndex();
+    bool queued = index != ~0u && m_queues[index]->push(job);
+    if (!queued) {
+        // External thread or full deque
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        m_injectionQueue.push_back(job);
+    }
+
+    m_queuedJobs.fetch_add(1);
+
+    // Pairs with the sleeper count in workerLoop: either the worker sees the
+    // queued job before waiting, or we see it sleeping and wake it
+    if (m_sleepingWorkers.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(m_wakeMutex);
+        }
+        m_wakeCondition.notify_one();
+    }
+}
+
+Job* JobSystem::findJob(uint32_t index) {
+    Job* job = nullptr;
+    uint32_t queueCount = static_cast<uint32_t>(m_queues.size());
+
+    // Own deque first (LIFO, cache-warm)
+    if (index < queueCount) {
+        job = m_queues[index]->pop();
+    }
+
+    // Then jobs injected from outside
+    if (!job) {
+        std::lock_guard<std::mutex> lock(m_injectionMutex);
+        if (!m_injectionQueue.empty()) {
+            job = m_injectionQueue.front();
+            m_injectionQueue.pop_front();
+        }
+    }
+
+    // Then steal the oldest job from another thread
+    if (!job && queueCount > 0) {
+        uint32_t start = index < queueCount ? index + 1 : 0;
+        for (uint32_t i = 0; i < queueCount && !job; ++i) {
+            uint32_t victim = (start + i) % queueCount;
+            if (victim != index) {
+                job = m_queues[victim]->steal();
+            }
+        }
+    }
+
+    if (job) {
+        m_queuedJobs.fetch_sub(1);
+    }
+    return job;
+}
+
+bool JobSystem::executeOne(uint32_t index) {
+    Job* job = findJob(index);
+    if (!job) {
+        return false;
+    }
+    execute(job);
+    return true;
+}
+
+void JobSystem::execute(Job* job) {
+    if (job->function) {
+        PINA_PROFILE_SCOPE("Job");
+        job->function();
+    }
+    finish(job);
+}
+
+void JobSystem::finish(Job* job) {
+    TaskGroup* group = job->group;
+    delete job;
+
+    if (!group) return;
+
+    // Decrement under the lock so a continuation is never added after the
+    // group was drained, and so ~TaskGroup waits for us to let go
+    std::vector<Job*> ready;
+    {
+        std::lock_guard<std::mutex> lock(group->m_mutex);
+        if (group->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            ready.swap(group->m_continuations);
+        }
+    }
+
+    for (Job* continuation : ready) {
+        release(continuation);
+    }
+}
+
+void JobSystem::release(Job* job) {
+    if (job->dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        schedule(job);
+    }
+}
+
+} // namespace Pina
@@ -0,0 +1,195 @@
+#pragma once
+
+/// Pina Engine - Job System
+/// Work-stealing job scheduler with task groups, dependencies and parallelFor
+
+#include "Export.h"
+#include "Subsystem.h"
+#include "MemoryTracker.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Pina {
+
+class TaskGroup;
+
+/// Job system configuration
+struct PINA_API JobSystemConfig {
+    uint32_t workerCount = 0;       // 0 = hardware threads - 1
+    uint32_t queueCapacity = 4096;  // Per-thread deque capacity (rounded up to power of 2)
+};
+
+/// Unit of work owned by the job system
+struct Job : TrackedObject<MemoryTag::Jobs> {
+    std::function<void()> function;
+    TaskGroup* group = nullptr;
+    std::atomic<uint32_t> dependencies{0};
+};
+
+/// Group of jobs that can be waited on and used as a dependency
+/// Counts jobs submitted with this group that have not finished yet.
+/// Must outlive all of its jobs and any job that depends on it; wait on it
+/// before destroying it.
+class PINA_API TaskGroup {
+public:
+    TaskGroup() = default;
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /// Check if all jobs in the group have finished
+    bool isDone() const { return m_pending.load(std::memory_order_acquire) == 0; }
+
+    /// Number of unfinished jobs
+    uint32_t getPendingCount() const { return m_pending.load(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> m_pending{0};
+    std::mutex m_mutex;
+    std::vector<Job*> m_continuations;  // Jobs waiting for this group
+};
+
+/// Fixed-capacity Chase-Lev work-stealing deque
+/// The owning thread pushes/pops at the bottom, other threads steal from the top.
+class WorkStealingQueue {
+public:
+    explicit WorkStealingQueue(uint32_t capacity);
+
+    /// Push a job (owner thread only). Returns false if full.
+    bool push(Job* job);
+
+    /// Pop the most recently pushed job (owner thread only)
+    Job* pop();
+
+    /// Steal the oldest job (any thread)
+    Job* steal();
+
+    /// Approximate number of queued jobs
+    size_t size() const;
+
+private:
+    std::unique_ptr<std::atomic<Job*>[]> m_buffer;
+    int64_t m_mask = 0;
+    std::atomic<int64_t> m_top{0};
+    std::atomic<int64_t> m_bottom{0};
+};
+
+/// Job system subsystem
+/// The thread that calls initialize() becomes thread 0 and takes part in
+/// execution while waiting; worker threads are 1..N. Jobs submitted from
+/// threads outside the system go through a shared injection queue.
+class PINA_API JobSystem : public Subsystem {
+public:
+    explicit JobSystem(const JobSystemConfig& config = {});
+    ~JobSystem() override;
+
+    // Subsystem lifecycle
+    void initialize() override;
+    void shutdown() override;
+
+    /// Started and stopped by the thread that owns the Context
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.mainThread(); }
+
+    // ========================================================================
+    // Submission
+    // ========================================================================
+
+    /// Submit a job, optionally tracked by a group
+    void submit(std::function<void()> function, TaskGroup* group = nullptr);
+
+    /// Submit a job that runs once all dependency groups have finished
+    void submit(std::function<void()> function, TaskGroup* group,
+                std::initializer_list<TaskGroup*> dependencies);
+
+    /// Wait for a group to finish, executing queued jobs while waiting
+    void wait(TaskGroup& group);
+
+    /// Run fn(rangeBegin, rangeEnd) over [begin, end) split into chunks of grainSize
+    /// @param grainSize Indices per job (0 = choose from worker count)
+    /// Blocks (helping) until all chunks are done.
+    template<typename Fn>
+    void parallelFor(size_t begin, size_t end, size_t grainSize, Fn&& fn);
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Number of worker threads (excluding the main thread)
+    uint32_t getWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+    /// Total threads executing jobs (workers + main thread)
+    uint32_t getThreadCount() const { return getWorkerCount() + 1; }
+
+    /// Index of the calling thread (0 = main, 1..N = workers, ~0u = external)
+    uint32_t getThreadIndex() const;
+
+    /// Check if workers are running
+    bool isRunning() const { return m_running.load(std::memory_order_acquire); }
+
+private:
+    void workerLoop(uint32_t index);
+    void schedule(Job* job);
+    Job* findJob(uint32_t index);
+    bool executeOne(uint32_t index);
+    void execute(Job* job);
+    void finish(Job* job);
+    void release(Job* job);
+
+    JobSystemConfig m_config;
+    std::vector<std::thread> m_workers;
+    std::vector<std::unique_ptr<WorkStealingQueue>> m_queues;  // [0] = main thread
+    std::atomic<bool> m_running{false};
+
+    // Injection queue for external threads and deque overflow
+    std::mutex m_injectionMutex;
+    std::deque<Job*> m_injectionQueue;
+
+    // Sleeping workers
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    std::atomic<int64_t> m_queuedJobs{0};
+    std::atomic<uint32_t> m_sleepingWorkers{0};
+};
+
+// ============================================================================
+// Template Implementations
+// ============================================================================
+
+template<typename Fn>
+void JobSystem::parallelFor(size_t begin, size_t end, size_t grainSize, Fn&& fn) {
+    if (begin >= end) return;
+
+    size_t count = end - begin;
+    if (grainSize == 0) {
+        // Aim for a few chunks per thread so stealing can balance the load
+        size_t chunks = static_cast<size_t>(getThreadCount()) * 4;
+        grainSize = (count + chunks - 1) / chunks;
+    }
+
+    // Not worth splitting, or no workers to split across
+    if (!isRunning() || getWorkerCount() == 0 || count <= grainSize) {
+        fn(begin, end);
+        return;
+    }
+
+    TaskGroup group;
+    for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize) {
+        size_t chunkEnd = chunkBegin + grainSize < end ? chunkBegin + grainSize : end;
+        submit([&fn, chunkBegin, chunkEnd]() { fn(chunkBegin, chunkEnd); }, &group);
+    }
+    wait(group);
+}
+
+} // namespace Pina
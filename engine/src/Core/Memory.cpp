@@ -0,0 +1,175 @@
+/// Pina Engine - Memory Management Implementation
+
+#include "Memory.h"
+#include <atomic>
+
+namespace Pina {
+
+namespace {
+
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Last FrameArena sub-arena used by this thread
+struct ThreadArenaCache {
+    uint64_t owner = 0;
+    LinearArena* arena = nullptr;
+};
+
+thread_local ThreadArenaCache s_threadArenaCache;
+
+std::atomic<uint64_t> s_nextFrameArenaID{1};
+
+} // namespace
+
+// ============================================================================
+// LinearArena
+// ============================================================================
+
+LinearArena::LinearArena(size_t blockSize, MemoryTag tag)
+    : m_blockSize(blockSize > 0 ? blockSize : 1)
+    , m_tag(tag)
+{
+}
+
+LinearArena::~LinearArena() {
+    freeBlocks();
+}
+
+void* LinearArena::allocate(size_t size, size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        alignment = alignof(std::max_align_t);
+    }
+
+    // Try the current block, then blocks kept from before the last reset
+    while (m_current < m_blocks.size()) {
+        Block& block = m_blocks[m_current];
+        uintptr_t base = reinterpret_cast<uintptr_t>(block.data);
+        size_t aligned = alignUp(base + m_offset, alignment) - base;
+
+        if (aligned + size <= block.size) {
+            m_used += (aligned - m_offset) + size;
+            m_offset = aligned + size;
+            if (m_used > m_peakUsed) {
+                m_peakUsed = m_used;
+            }
+            return block.data + aligned;
+        }
+
+        m_current++;
+        m_offset = 0;
+    }
+
+    // Out of space: add a block big enough for this request
+    size_t required = size + alignment;
+    addBlock(required > m_blockSize ? required : m_blockSize);
+    m_current = m_blocks.size() - 1;
+    m_offset = 0;
+    return allocate(size, alignment);
+}
+
+void LinearArena::reset() {
+    // Merge into one block so next time everything fits without chaining
+    if (m_blocks.size() > 1) {
+        size_t capacity = getCapacity();
+        freeBlocks();
+        addBlock(capacity);
+    }
+
+    m_current = 0;
+    m_offset = 0;
+    m_used = 0;
+}
+
+size_t LinearArena::getCapacity() const {
+    size_t capacity = 0;
+    for (const auto& block : m_blocks) {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void LinearArena::addBlock(size_t size) {
+    Block block;
+    block.data = static_cast<char*>(MemoryTracker::allocate(size, m_tag));
+    block.size = size;
+    m_blocks.push_back(block);
+}
+
+void LinearArena::freeBlocks() {
+    for (auto& block : m_blocks) {
+        MemoryTracker::deallocate(block.data, block.size, m_tag);
+    }
+    m_blocks.clear();
+}
+
+// ============================================================================
+// FrameArena
+// ============================================================================
+
+FrameArena::FrameArena(size_t blockSize)
+    : m_blockSize(blockSize)
+    , m_id(s_nextFrameArenaID.fetch_add(1))
+{
+}
+
+FrameArena::~FrameArena() {
+    if (s_threadArenaCache.owner == m_id) {
+        s_threadArenaCache = ThreadArenaCache();
+    }
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+    return getThreadArena().allocate(size, alignment);
+}
+
+LinearArena& FrameArena::getThreadArena() {
+    // Fast path: this thread used this arena last
+    if (s_threadArenaCache.owner == m_id) {
+        return *s_threadArenaCache.arena;
+    }
+
+    std::thread::id thread = std::this_thread::get_id();
+    LinearArena* arena = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_arenas) {
+            if (entry.first == thread) {
+                arena = entry.second.get();
+                break;
+            }
+        }
+        if (!arena) {
+            m_arenas.emplace_back(thread, MAKE_UNIQUE<LinearArena>(m_blockSize, MemoryTag::Frame));
+            arena = m_arenas.back().second.get();
+        }
+    }
+
+    s_threadArenaCache.owner = m_id;
+    s_threadArenaCache.arena = arena;
+    return *arena;
+}
+
+void FrameArena::reset() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& entry : m_arenas) {
+        entry.second->reset();
+    }
+}
+
+size_t FrameArena::getUsed() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t used = 0;
+    for (const auto& entry : m_arenas) {
+        used += entry.second->getUsed();
+    }
+    return used;
+}
+
+size_t FrameArena::getThreadArenaCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_arenas.size();
+}
+
+} // namespace Pina
@@ -1,9 +1,19 @@
 #pragma once
 
 /// Pina Engine - Memory Management
-/// Type aliases for smart pointers
+/// Type aliases for smart pointers, linear/frame arenas, pool allocator
+/// and STL allocator adapters
 
+#include "Export.h"
+#include "MemoryTracker.h"
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace Pina {
 
@@ -28,4 +38,308 @@ SHARED<T> MAKE_SHARED(Args&&... args) {
     return std::make_shared<T>(std::forward<Args>(args)...);
 }
 
+// ============================================================================
+// Linear Arena
+// ============================================================================
+
+/// Bump allocator over a list of memory blocks
+/// Individual allocations are never freed; reset() releases everything at
+/// once. Destructors of objects created in the arena are NOT run.
+/// Not thread-safe (see FrameArena for per-thread arenas).
+class PINA_API LinearArena {
+public:
+    /// @param blockSize Default size of each reserved block
+    /// @param tag Memory tracker tag for reserved blocks
+    explicit LinearArena(size_t blockSize = 64 * 1024, MemoryTag tag = MemoryTag::General);
+    ~LinearArena();
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    /// Allocate uninitialized memory (alignment must be a power of 2)
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /// Allocate and construct an object
+    template<typename T, typename... Args>
+    T* create(Args&&... args);
+
+    /// Allocate an uninitialized array
+    template<typename T>
+    T* allocateArray(size_t count);
+
+    /// Release all allocations, keeping the memory for reuse
+    /// If the arena grew past one block, the blocks are merged into one.
+    void reset();
+
+    /// Bytes handed out since the last reset (including alignment padding)
+    size_t getUsed() const { return m_used; }
+
+    /// Highest getUsed() seen since construction
+    size_t getPeakUsed() const { return m_peakUsed; }
+
+    /// Total bytes reserved across all blocks
+    size_t getCapacity() const;
+
+    /// Number of reserved blocks
+    size_t getBlockCount() const { return m_blocks.size(); }
+
+private:
+    struct Block {
+        char* data = nullptr;
+        size_t size = 0;
+    };
+
+    void addBlock(size_t size);
+    void freeBlocks();
+
+    std::vector<Block> m_blocks;
+    size_t m_blockSize = 0;
+    MemoryTag m_tag = MemoryTag::General;
+    size_t m_current = 0;   // Index of block being bumped
+    size_t m_offset = 0;    // Offset into current block
+    size_t m_used = 0;
+    size_t m_peakUsed = 0;
+};
+
+// ============================================================================
+// Frame Arena
+// ============================================================================
+
+/// Per-frame scratch memory with one LinearArena per allocating thread
+/// (blocks are tracked under MemoryTag::Frame)
+/// Application resets its frame arena at the end of every main loop
+/// iteration; memory from it must not be kept across frames.
+/// allocate() is safe from any thread; reset() must not run concurrently
+/// with allocations.
+class PINA_API FrameArena {
+public:
+    explicit FrameArena(size_t blockSize = 256 * 1024);
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /// Allocate from the calling thread's sub-arena
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /// Allocate and construct an object (destructor is never run)
+    template<typename T, typename... Args>
+    T* create(Args&&... args);
+
+    /// Allocate an uninitialized array
+    template<typename T>
+    T* allocateArray(size_t count);
+
+    /// Get the calling thread's sub-arena (created on first use)
+    LinearArena& getThreadArena();
+
+    /// Reset all sub-arenas
+    void reset();
+
+    /// Bytes used across all sub-arenas since the last reset
+    size_t getUsed() const;
+
+    /// Number of threads that have allocated from this arena
+    size_t getThreadArenaCount() const;
+
+private:
+    size_t m_blockSize = 0;
+    uint64_t m_id = 0;  // Unique per instance (validates thread-local cache)
+
+    mutable std::mutex m_mutex;
+    std::vector<std::pair<std::thread::id, UNIQUE<LinearArena>>> m_arenas;
+};
+
+// ============================================================================
+// Pool Allocator
+// ============================================================================
+
+/// Fixed-size object pool with free-list reuse
+/// Grows in chunks of blocksPerChunk objects; memory is returned to the
+/// system only when the pool is destroyed. Not thread-safe.
+template<typename T>
+class PoolAllocator {
+public:
+    explicit PoolAllocator(size_t blocksPerChunk = 256, MemoryTag tag = MemoryTag::General);
+    ~PoolAllocator();
+
+    PoolAllocator(const PoolAllocator&) = delete;
+    PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+    /// Get uninitialized storage for one T
+    T* allocate();
+
+    /// Return storage to the free list (does not run the destructor)
+    void deallocate(T* ptr);
+
+    /// Allocate and construct
+    template<typename... Args>
+    T* create(Args&&... args);
+
+    /// Destruct and deallocate
+    void destroy(T* ptr);
+
+    /// Number of live allocations
+    size_t getAllocatedCount() const { return m_allocated; }
+
+    /// Number of slots reserved across all chunks
+    size_t getCapacity() const { return m_chunks.size() * m_blocksPerChunk; }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    void addChunk();
+
+    std::vector<Slot*> m_chunks;
+    Slot* m_freeList = nullptr;
+    size_t m_blocksPerChunk = 0;
+    MemoryTag m_tag = MemoryTag::General;
+    size_t m_allocated = 0;
+};
+
+// ============================================================================
+// STL Allocator Adapter
+// ============================================================================
+
+/// STL allocator that draws from a LinearArena or FrameArena
+/// deallocate() is a no-op; memory is reclaimed when the arena resets.
+/// Usage: std::vector<int, ArenaAllocator<int>> v(ArenaAllocator<int>(&arena));
+template<typename T, typename Arena = LinearArena>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = ArenaAllocator<U, Arena>;
+    };
+
+    explicit ArenaAllocator(Arena* arena) noexcept : m_arena(arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U, Arena>& other) noexcept : m_arena(other.getArena()) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* ptr, size_t count) noexcept {
+        (void)ptr;
+        (void)count;
+    }
+
+    Arena* getArena() const noexcept { return m_arena; }
+
+private:
+    Arena* m_arena = nullptr;
+};
+
+template<typename T, typename U, typename Arena>
+bool operator==(const ArenaAllocator<T, Arena>& a, const ArenaAllocator<U, Arena>& b) noexcept {
+    return a.getArena() == b.getArena();
+}
+
+template<typename T, typename U, typename Arena>
+bool operator!=(const ArenaAllocator<T, Arena>& a, const ArenaAllocator<U, Arena>& b) noexcept {
+    return !(a == b);
+}
+
+/// Vector backed by per-frame memory (valid until the frame arena resets)
+template<typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T, FrameArena>>;
+
+// ============================================================================
+// Template Implementations
+// ============================================================================
+
+template<typename T, typename... Args>
+T* LinearArena::create(Args&&... args) {
+    void* memory = allocate(sizeof(T), alignof(T));
+    return ::new (memory) T(std::forward<Args>(args)...);
+}
+
+template<typename T>
+T* LinearArena::allocateArray(size_t count) {
+    return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+}
+
+template<typename T, typename... Args>
+T* FrameArena::create(Args&&... args) {
+    return getThreadArena().create<T>(std::forward<Args>(args)...);
+}
+
+template<typename T>
+T* FrameArena::allocateArray(size_t count) {
+    return getThreadArena().allocateArray<T>(count);
+}
+
+template<typename T>
+PoolAllocator<T>::PoolAllocator(size_t blocksPerChunk, MemoryTag tag)
+    : m_blocksPerChunk(blocksPerChunk > 0 ? blocksPerChunk : 1)
+    , m_tag(tag)
+{
+}
+
+template<typename T>
+PoolAllocator<T>::~PoolAllocator() {
+    for (Slot* chunk : m_chunks) {
+        MemoryTracker::deallocate(chunk, sizeof(Slot) * m_blocksPerChunk, m_tag);
+    }
+}
+
+template<typename T>
+T* PoolAllocator<T>::allocate() {
+    if (!m_freeList) {
+        addChunk();
+    }
+
+    Slot* slot = m_freeList;
+    m_freeList = slot->next;
+    m_allocated++;
+    return reinterpret_cast<T*>(slot->storage);
+}
+
+template<typename T>
+void PoolAllocator<T>::deallocate(T* ptr) {
+    if (!ptr) return;
+
+    Slot* slot = reinterpret_cast<Slot*>(ptr);
+    slot->next = m_freeList;
+    m_freeList = slot;
+    m_allocated--;
+}
+
+template<typename T>
+template<typename... Args>
+T* PoolAllocator<T>::create(Args&&... args) {
+    T* memory = allocate();
+    return ::new (memory) T(std::forward<Args>(args)...);
+}
+
+template<typename T>
+void PoolAllocator<T>::destroy(T* ptr) {
+    if (!ptr) return;
+
+    ptr->~T();
+    deallocate(ptr);
+}
+
+template<typename T>
+void PoolAllocator<T>::addChunk() {
+    static_assert(alignof(Slot) <= alignof(std::max_align_t),
+                  "PoolAllocator does not support over-aligned types");
+
+    Slot* chunk = static_cast<Slot*>(MemoryTracker::allocate(sizeof(Slot) * m_blocksPerChunk, m_tag));
+    m_chunks.push_back(chunk);
+
+    // Thread the new slots onto the free list in address order
+    for (size_t i = m_blocksPerChunk; i > 0; --i) {
+        chunk[i - 1].next = m_freeList;
+        m_freeList = &chunk[i - 1];
+    }
+}
+
 } // namespace Pina
@@ -0,0 +1,167 @@
+/// Pina Engine - Memory Tracker Implementation
+
+#include "MemoryTracker.h"
+#include "../Graphics/GPUMemory.h"
+#include <atomic>
+#include <sstream>
+
+namespace Pina {
+
+namespace {
+
+struct TagCounters {
+    std::atomic<uint64_t> liveBytes{0};
+    std::atomic<uint64_t> peakBytes{0};
+    std::atomic<uint64_t> liveAllocations{0};
+    std::atomic<uint64_t> totalAllocations{0};
+};
+
+constexpr size_t kTagCount = static_cast<size_t>(MemoryTag::Count);
+
+// Function-local so tracking works during static initialization
+TagCounters* getCounters() {
+    static TagCounters s_counters[kTagCount];
+    return s_counters;
+}
+
+TagCounters& getCounters(MemoryTag tag) {
+    size_t index = static_cast<size_t>(tag);
+    return getCounters()[index < kTagCount ? index : 0];
+}
+
+void updatePeak(std::atomic<uint64_t>& peak, uint64_t value) {
+    uint64_t current = peak.load(std::memory_order_relaxed);
+    while (value > current &&
+           !peak.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+const char* toString(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::General: return "General";
+        case MemoryTag::Scene:   return "Scene";
+        case MemoryTag::Render:  return "Render";
+        case MemoryTag::Assets:  return "Assets";
+        case MemoryTag::Events:  return "Events";
+        case MemoryTag::Jobs:    return "Jobs";
+        case MemoryTag::Frame:   return "Frame";
+        case MemoryTag::Count:   break;
+    }
+    return "Unknown";
+}
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+void MemoryTracker::recordAllocation(MemoryTag tag, size_t bytes) {
+    TagCounters& counters = getCounters(tag);
+    uint64_t live = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    updatePeak(counters.peakBytes, live);
+}
+
+void MemoryTracker::recordFree(MemoryTag tag, size_t bytes) {
+    TagCounters& counters = getCounters(tag);
+    counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void* MemoryTracker::allocate(size_t bytes, MemoryTag tag) {
+    void* ptr = ::operator new(bytes);
+    recordAllocation(tag, bytes);
+    return ptr;
+}
+
+void MemoryTracker::deallocate(void* ptr, size_t bytes, MemoryTag tag) {
+    if (!ptr) return;
+
+    recordFree(tag, bytes);
+    ::operator delete(ptr);
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+MemoryTagStats MemoryTracker::getStats(MemoryTag tag) {
+    const TagCounters& counters = getCounters(tag);
+
+    MemoryTagStats stats;
+    stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+    stats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+uint64_t MemoryTracker::getTotalLiveBytes() {
+    uint64_t total = 0;
+    for (size_t i = 0; i < kTagCount; ++i) {
+        total += getCounters()[i].liveBytes.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void MemoryTracker::resetPeaks() {
+    for (size_t i = 0; i < kTagCount; ++i) {
+        TagCounters& counters = getCounters()[i];
+        counters.peakBytes.store(counters.liveBytes.load(std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+    }
+}
+
+// ============================================================================
+// Serialization
+// ============================================================================
+
+std::string MemoryTracker::toJSON(const GPUMemoryTracker* gpu) {
+    std::ostringstream json;
+
+    json << "{\n";
+    json << "  \"cpu\": {\n";
+    json << "    \"totalLiveBytes\": " << getTotalLiveBytes() << ",\n";
+    json << "    \"tags\": {\n";
+    for (size_t i = 0; i < kTagCount; ++i) {
+        MemoryTag tag = static_cast<MemoryTag>(i);
+        MemoryTagStats stats = getStats(tag);
+        json << "      \"" << toString(tag) << "\": {"
+             << "\"liveBytes\": " << stats.liveBytes << ", "
+             << "\"peakBytes\": " << stats.peakBytes << ", "
+             << "\"liveAllocations\": " << stats.liveAllocations << ", "
+             << "\"totalAllocations\": " << stats.totalAllocations << "}"
+             << (i + 1 < kTagCount ? ",\n" : "\n");
+    }
+    json << "    }\n";
+    json << "  }";
+
+    if (gpu) {
+        constexpr size_t kTypeCount = static_cast<size_t>(GPUResourceType::Count);
+
+        json << ",\n";
+        json << "  \"gpu\": {\n";
+        json << "    \"totalLiveBytes\": " << gpu->getTotalLiveBytes() << ",\n";
+        json << "    \"peakBytes\": " << gpu->getPeakBytes() << ",\n";
+        json << "    \"resources\": {\n";
+        for (size_t i = 0; i < kTypeCount; ++i) {
+            GPUResourceType type = static_cast<GPUResourceType>(i);
+            const GPUResourceStats& stats = gpu->getStats(type);
+            json << "      \"" << toString(type) << "\": {"
+                 << "\"liveCount\": " << stats.liveCount << ", "
+                 << "\"liveBytes\": " << stats.liveBytes << ", "
+                 << "\"peakBytes\": " << stats.peakBytes << ", "
+                 << "\"totalCreated\": " << stats.totalCreated << "}"
+                 << (i + 1 < kTypeCount ? ",\n" : "\n");
+        }
+        json << "    }\n";
+        json << "  }";
+    }
+
+    json << "\n}\n";
+    return json.str();
+}
+
+} // namespace Pina
@@ -0,0 +1,129 @@
+#pragma once
+
+/// Pina Engine - Memory Tracker
+/// Tagged CPU allocation accounting (live bytes, peak bytes, allocation counts)
+
+#include "Export.h"
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+
+namespace Pina {
+
+class GPUMemoryTracker;
+
+/// Allocation tags (which part of the engine owns the memory)
+enum class MemoryTag : uint8_t {
+    General,    // Untagged
+    Scene,      // Nodes, scenes
+    Render,     // Pipeline, compositor, passes
+    Assets,     // Meshes, models
+    Events,     // Queued events
+    Jobs,       // Job system jobs
+    Frame,      // Frame arena blocks
+
+    Count
+};
+
+/// Get a readable name for a memory tag
+PINA_API const char* toString(MemoryTag tag);
+
+/// Counters for one tag
+struct PINA_API MemoryTagStats {
+    uint64_t liveBytes = 0;         // Currently allocated
+    uint64_t peakBytes = 0;         // Highest liveBytes seen
+    uint64_t liveAllocations = 0;   // Allocations not yet freed
+    uint64_t totalAllocations = 0;  // Allocations ever made
+};
+
+/// Process-wide tagged allocation tracker (thread-safe)
+class PINA_API MemoryTracker {
+public:
+    /// Record an allocation / free of bytes under a tag
+    static void recordAllocation(MemoryTag tag, size_t bytes);
+    static void recordFree(MemoryTag tag, size_t bytes);
+
+    /// Allocate / free raw memory and record it
+    static void* allocate(size_t bytes, MemoryTag tag);
+    static void deallocate(void* ptr, size_t bytes, MemoryTag tag);
+
+    /// Get a snapshot of a tag's counters
+    static MemoryTagStats getStats(MemoryTag tag);
+
+    /// Live bytes across all tags
+    static uint64_t getTotalLiveBytes();
+
+    /// Reset peaks to the current live values (e.g. after loading)
+    static void resetPeaks();
+
+    /// Serialize all tags (and optionally GPU resources) as JSON
+    static std::string toJSON(const GPUMemoryTracker* gpu = nullptr);
+};
+
+/// Mixin that routes a class's heap allocations through the tracker
+/// Usage: class Node : public TrackedObject<MemoryTag::Scene> { ... };
+/// Polymorphic classes need a virtual destructor so the freed size is right.
+template<MemoryTag Tag>
+class TrackedObject {
+public:
+    static void* operator new(size_t size) {
+        return MemoryTracker::allocate(size, Tag);
+    }
+
+    static void operator delete(void* ptr, size_t size) {
+        MemoryTracker::deallocate(ptr, size, Tag);
+    }
+
+    // Placement forms (arenas and pools construct in their own memory)
+    static void* operator new(size_t size, void* place) noexcept {
+        (void)size;
+        return place;
+    }
+
+    static void operator delete(void* ptr, void* place) noexcept {
+        (void)ptr;
+        (void)place;
+    }
+
+protected:
+    TrackedObject() = default;
+    ~TrackedObject() = default;
+};
+
+/// STL allocator that records its allocations under a tag
+template<typename T, MemoryTag Tag = MemoryTag::General>
+class TrackedAllocator {
+public:
+    using value_type = T;
+
+    template<typename U>
+    struct rebind {
+        using other = TrackedAllocator<U, Tag>;
+    };
+
+    TrackedAllocator() noexcept = default;
+
+    template<typename U>
+    TrackedAllocator(const TrackedAllocator<U, Tag>&) noexcept {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(MemoryTracker::allocate(count * sizeof(T), Tag));
+    }
+
+    void deallocate(T* ptr, size_t count) noexcept {
+        MemoryTracker::deallocate(ptr, count * sizeof(T), Tag);
+    }
+};
+
+template<typename T, typename U, MemoryTag Tag>
+bool operator==(const TrackedAllocator<T, Tag>&, const TrackedAllocator<U, Tag>&) noexcept {
+    return true;
+}
+
+template<typename T, typename U, MemoryTag Tag>
+bool operator!=(const TrackedAllocator<T, Tag>&, const TrackedAllocator<U, Tag>&) noexcept {
+    return false;
+}
+
+} // namespace Pina
@@ -0,0 +1,56 @@
+/// Pina Engine - Name Implementation
+
+#include "Name.h"
+#include <mutex>
+#include <unordered_set>
+
+namespace Pina {
+
+namespace {
+
+/// Interned strings (node-based, so element addresses never move)
+struct NameTable {
+    std::mutex mutex;
+    std::unordered_set<std::string> strings;
+    const std::string* empty = &*strings.insert(std::string()).first;
+};
+
+NameTable& getTable() {
+    static NameTable table;
+    return table;
+}
+
+} // namespace
+
+Name::Name()
+    : m_str(getTable().empty)
+{
+}
+
+Name::Name(const std::string& str) {
+    NameTable& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    m_str = &*table.strings.insert(str).first;
+}
+
+Name::Name(const char* str)
+    : Name(std::string(str ? str : ""))
+{
+}
+
+bool Name::find(const std::string& str, Name& out) {
+    NameTable& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    auto it = table.strings.find(str);
+    if (it == table.strings.end()) return false;
+    out = Name(&*it);
+    return true;
+}
+
+size_t Name::getInternedCount() {
+    NameTable& table = getTable();
+    std::lock_guard<std::mutex> lock(table.mutex);
+    return table.strings.size();
+}
+
+} // namespace Pina
@@ -0,0 +1,55 @@
+#pragma once
+
+/// Pina Engine - Name
+/// Interned strings that compare and hash as pointers
+
+#include "Export.h"
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace Pina {
+
+/// Interned string
+/// Every distinct string is stored once for the process lifetime; a Name is
+/// a pointer to that copy, so equal names compare, hash and copy as a
+/// pointer. Interning is thread-safe; reading a Name needs no lock.
+class PINA_API Name {
+public:
+    /// Empty name
+    Name();
+
+    /// Intern a string
+    Name(const std::string& str);
+    Name(const char* str);
+
+    /// Find an already interned string without adding it
+    /// @return false (and out untouched) if nothing was ever interned as str;
+    ///         used by queries so looking up unknown names costs no memory
+    static bool find(const std::string& str, Name& out);
+
+    /// Interned string
+    const std::string& str() const { return *m_str; }
+    const char* c_str() const { return m_str->c_str(); }
+
+    /// Check if this is the empty name
+    bool isEmpty() const { return m_str->empty(); }
+
+    bool operator==(const Name& other) const { return m_str == other.m_str; }
+    bool operator!=(const Name& other) const { return m_str != other.m_str; }
+
+    /// Hash functor for unordered containers
+    struct Hash {
+        size_t operator()(const Name& name) const { return std::hash<const void*>()(name.m_str); }
+    };
+
+    /// Number of distinct strings interned so far
+    static size_t getInternedCount();
+
+private:
+    explicit Name(const std::string* str) : m_str(str) {}
+
+    const std::string* m_str;
+};
+
+} // namespace Pina
@@ -0,0 +1,298 @@
+/// Pina Engine - CPU Profiler Implementation
+
+#include "Profiler.h"
+#include "Memory.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <unordered_set>
+
+namespace Pina {
+
+namespace {
+
+/// Single-writer event buffer owned by one thread at a time
+struct ThreadBuffer {
+    UNIQUE<ProfileEvent[]> events;
+    std::atomic<size_t> count{0};      // Published with release by the writer
+    std::atomic<uint64_t> dropped{0};
+    uint32_t threadID = 0;
+    std::string threadName;            // Guarded by Registry::mutex
+    bool inUse = true;                 // Guarded by Registry::mutex
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<UNIQUE<ThreadBuffer>> buffers;
+    std::unordered_set<std::string> names;
+    std::atomic<bool> enabled{false};
+    std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+Registry& getRegistry() {
+    static Registry registry;
+    return registry;
+}
+
+/// Returns the thread's buffer to the registry when the thread exits
+struct ThreadBufferHandle {
+    ThreadBuffer* buffer = nullptr;
+    std::string name;
+
+    ~ThreadBufferHandle() {
+        if (buffer) {
+            Registry& registry = getRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            buffer->inUse = false;
+        }
+    }
+};
+
+thread_local ThreadBufferHandle s_threadBuffer;
+thread_local uint32_t s_depth = 0;
+
+ThreadBuffer* getThreadBuffer() {
+    if (s_threadBuffer.buffer) {
+        return s_threadBuffer.buffer;
+    }
+
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // Reuse a buffer released by an exited thread, keeping its events
+    ThreadBuffer* buffer = nullptr;
+    for (auto& candidate : registry.buffers) {
+        if (!candidate->inUse) {
+            buffer = candidate.get();
+            break;
+        }
+    }
+
+    if (!buffer) {
+        auto created = MAKE_UNIQUE<ThreadBuffer>();
+        created->events = UNIQUE<ProfileEvent[]>(new ProfileEvent[Profiler::EventsPerThread]);
+        created->threadID = static_cast<uint32_t>(registry.buffers.size());
+        buffer = created.get();
+        registry.buffers.push_back(std::move(created));
+    }
+
+    buffer->inUse = true;
+    buffer->threadName = s_threadBuffer.name;
+    s_threadBuffer.buffer = buffer;
+    return buffer;
+}
+
+void writeEscaped(std::ostream& out, const char* text) {
+    for (const char* c = text; *c; ++c) {
+        switch (*c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(*c) < 0x20) {
+                    char code[8];
+                    std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(*c));
+                    out << code;
+                } else {
+                    out << *c;
+                }
+        }
+    }
+}
+
+/// Chrome trace timestamps are microseconds
+void writeMicroseconds(std::ostream& out, uint64_t ns) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%llu.%03llu",
+                  static_cast<unsigned long long>(ns / 1000),
+                  static_cast<unsigned long long>(ns % 1000));
+    out << text;
+}
+
+} // namespace
+
+// ============================================================================
+// Profiler
+// ============================================================================
+
+void Profiler::setEnabled(bool enabled) {
+    getRegistry().enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Profiler::isEnabled() {
+    return getRegistry().enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t Profiler::now() {
+    auto elapsed = std::chrono::steady_clock::now() - getRegistry().epoch;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+void Profiler::record(const char* name, uint64_t startNs, uint64_t endNs, uint32_t depth) {
+    ThreadBuffer* buffer = getThreadBuffer();
+
+    size_t index = buffer->count.load(std::memory_order_relaxed);
+    if (index >= EventsPerThread) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ProfileEvent& event = buffer->events[index];
+    event.name = name;
+    event.startNs = startNs;
+    event.durationNs = endNs > startNs ? endNs - startNs : 0;
+    event.threadID = buffer->threadID;
+    event.depth = depth;
+
+    buffer->count.store(index + 1, std::memory_order_release);
+}
+
+const char* Profiler::intern(const std::string& name) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.names.insert(name).first->c_str();
+}
+
+void Profiler::setThreadName(const std::string& name) {
+    s_threadBuffer.name = name;
+
+    if (s_threadBuffer.buffer) {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        s_threadBuffer.buffer->threadName = name;
+    }
+}
+
+std::vector<ProfileEvent> Profiler::getEvents() {
+    Registry& registry = getRegistry();
+    std::vector<ProfileEvent> events;
+
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (const auto& buffer : registry.buffers) {
+            size_t count = buffer->count.load(std::memory_order_acquire);
+            events.insert(events.end(), buffer->events.get(), buffer->events.get() + count);
+        }
+    }
+
+    std::stable_sort(events.begin(), events.end(), [](const ProfileEvent& a, const ProfileEvent& b) {
+        return a.startNs < b.startNs;
+    });
+    return events;
+}
+
+uint64_t Profiler::getDroppedCount() {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    uint64_t dropped = 0;
+    for (const auto& buffer : registry.buffers) {
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+void Profiler::clear() {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    for (auto& buffer : registry.buffers) {
+        buffer->count.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+std::string Profiler::toChromeTrace() {
+    std::vector<ProfileEvent> events = getEvents();
+
+    std::vector<std::pair<uint32_t, std::string>> threadNames;
+    {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (const auto& buffer : registry.buffers) {
+            if (!buffer->threadName.empty()) {
+                threadNames.emplace_back(buffer->threadID, buffer->threadName);
+            }
+        }
+    }
+
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"displayTimeUnit\": \"ms\",\n";
+    json << "  \"traceEvents\": [";
+
+    bool first = true;
+    for (const auto& thread : threadNames) {
+        json << (first ? "\n" : ",\n");
+        json << "    {\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread.first
+             << ", \"args\": {\"name\": \"";
+        writeEscaped(json, thread.second.c_str());
+        json << "\"}}";
+        first = false;
+    }
+
+    for (const auto& event : events) {
+        json << (first ? "\n" : ",\n");
+        json << "    {\"name\": \"";
+        writeEscaped(json, event.name ? event.name : "");
+        json << "\", \"cat\": \"pina\", \"ph\": \"X\", \"ts\": ";
+        writeMicroseconds(json, event.startNs);
+        json << ", \"dur\": ";
+        writeMicroseconds(json, event.durationNs);
+        json << ", \"pid\": 1, \"tid\": " << event.threadID << "}";
+        first = false;
+    }
+
+    json << "\n  ]\n";
+    json << "}\n";
+    return json.str();
+}
+
+bool Profiler::exportChromeTrace(const std::string& path) {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "Profiler::exportChromeTrace - Failed to open " << path << std::endl;
+        return false;
+    }
+
+    file << toChromeTrace();
+    return static_cast<bool>(file);
+}
+
+// ============================================================================
+// ProfileScope
+// ============================================================================
+
+ProfileScope::ProfileScope(const char* name) {
+    if (name && Profiler::isEnabled()) {
+        begin(name);
+    }
+}
+
+ProfileScope::ProfileScope(const std::string& name) {
+    if (Profiler::isEnabled()) {
+        begin(Profiler::intern(name));
+    }
+}
+
+ProfileScope::~ProfileScope() {
+    if (m_name) {
+        uint64_t end = Profiler::now();
+        s_depth--;
+        Profiler::record(m_name, m_start, end, m_depth);
+    }
+}
+
+void ProfileScope::begin(const char* name) {
+    m_name = name;
+    m_depth = s_depth++;
+    m_start = Profiler::now();
+}
+
+} // namespace Pina
@@ -0,0 +1,108 @@
+#pragma once
+
+/// Pina Engine - CPU Profiler
+/// Scoped timing markers recorded into per-thread buffers with Chrome Trace
+/// Event export (load the JSON in chrome://tracing or ui.perfetto.dev)
+
+#include "Export.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pina {
+
+/// One completed profile scope
+struct PINA_API ProfileEvent {
+    const char* name = nullptr;   // Static or interned string
+    uint64_t startNs = 0;         // Nanoseconds since the profiler epoch
+    uint64_t durationNs = 0;
+    uint32_t threadID = 0;        // Profiler thread index (not the OS id)
+    uint32_t depth = 0;           // Nesting depth on its thread
+};
+
+/// Process-wide CPU profiler
+/// Each thread appends to its own fixed-size buffer without locking; events
+/// past a buffer's capacity are dropped and counted. Recording is off until
+/// setEnabled(true). Scopes are compiled out unless PINA_ENABLE_PROFILING is
+/// defined (the build defines it for all but Release configurations).
+class PINA_API Profiler {
+public:
+    /// Events each thread can hold between clear() calls
+    static constexpr size_t EventsPerThread = 32 * 1024;
+
+    /// Start or stop recording new scopes
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /// Nanoseconds since the profiler epoch (steady clock)
+    static uint64_t now();
+
+    /// Append a completed scope to the calling thread's buffer
+    static void record(const char* name, uint64_t startNs, uint64_t endNs, uint32_t depth);
+
+    /// Get a stable copy of a dynamic name (kept for the process lifetime)
+    static const char* intern(const std::string& name);
+
+    /// Name the calling thread in exported traces
+    static void setThreadName(const std::string& name);
+
+    /// Copy all recorded events, sorted by start time
+    static std::vector<ProfileEvent> getEvents();
+
+    /// Events dropped because a thread buffer was full
+    static uint64_t getDroppedCount();
+
+    /// Discard recorded events
+    /// Call while no scopes are open on other threads (e.g. between frames).
+    static void clear();
+
+    /// Serialize recorded events as Chrome Trace Event JSON
+    static std::string toChromeTrace();
+
+    /// Write the Chrome trace to a file
+    static bool exportChromeTrace(const std::string& path);
+};
+
+/// Records the time between construction and destruction
+/// Use through PINA_PROFILE_SCOPE so release builds compile it out.
+class PINA_API ProfileScope {
+public:
+    /// @param name Must outlive the profiler (string literal or interned)
+    explicit ProfileScope(const char* name);
+
+    /// Dynamic names are interned (only while recording)
+    explicit ProfileScope(const std::string& name);
+
+    ~ProfileScope();
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    void begin(const char* name);
+
+    const char* m_name = nullptr;
+    uint64_t m_start = 0;
+    uint32_t m_depth = 0;
+};
+
+} // namespace Pina
+
+// ============================================================================
+// Profiling Macros
+// ============================================================================
+
+#define PINA_PROFILE_CONCAT_INNER(a, b) a##b
+#define PINA_PROFILE_CONCAT(a, b) PINA_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(PINA_ENABLE_PROFILING)
+    /// Time the enclosing scope: PINA_PROFILE_SCOPE("Physics");
+    #define PINA_PROFILE_SCOPE(name) \
+        ::Pina::ProfileScope PINA_PROFILE_CONCAT(pinaProfileScope_, __LINE__)(name)
+    /// Time the enclosing function
+    #define PINA_PROFILE_FUNCTION() PINA_PROFILE_SCOPE(__func__)
+#else
+    #define PINA_PROFILE_SCOPE(name) ((void)0)
+    #define PINA_PROFILE_FUNCTION() ((void)0)
+#endif
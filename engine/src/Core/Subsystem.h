@@ -4,11 +4,65 @@
 /// Base class for all engine subsystems (Window, Graphics, Input, etc.)
 
 #include "Export.h"
+#include <cstdint>
+#include <vector>
 
 namespace Pina {
 
 class Context;
 
+/// Dense per-type subsystem slot (0, 1, 2... in order of first use)
+using SubsystemID = uint32_t;
+
+/// Frame stage a subsystem updates in (stages run one after another)
+enum class SubsystemPhase : uint8_t {
+    PreUpdate,      // Gather input, flush queues
+    Update,         // Default
+    PostUpdate,     // Consume results of Update
+
+    Count
+};
+
+/// What a subsystem touches, used by Context to schedule updates
+/// Every subsystem implicitly writes itself. Within a phase, subsystems that
+/// do not conflict may update in parallel on job worker threads; conflicting
+/// ones run in registration order, except that a reader runs after the
+/// subsystem it reads. The same rules order initialize() across phases.
+class PINA_API SubsystemDependencies {
+public:
+    /// Reads T's state: runs after T, never concurrently with a writer of T
+    template<typename T>
+    SubsystemDependencies& reads();
+
+    /// Mutates T: never concurrently with another reader or writer of T
+    template<typename T>
+    SubsystemDependencies& writes();
+
+    /// Update in this phase (default Update)
+    SubsystemDependencies& phase(SubsystemPhase phase) { m_phase = phase; return *this; }
+
+    /// Initialize and update on the thread that drives the Context
+    /// (required for OS windowing, GL contexts and UI backends)
+    SubsystemDependencies& mainThread() { m_mainThread = true; return *this; }
+
+    /// Conflict with every other subsystem and run on the main thread
+    /// This is the default for subsystems that do not declare dependencies.
+    SubsystemDependencies& exclusive() { m_exclusive = true; m_mainThread = true; return *this; }
+
+    const std::vector<SubsystemID>& getReads() const { return m_reads; }
+    const std::vector<SubsystemID>& getWrites() const { return m_writes; }
+    SubsystemPhase getPhase() const { return m_phase; }
+    bool isMainThread() const { return m_mainThread; }
+    bool isExclusive() const { return m_exclusive; }
+
+private:
+    std::vector<SubsystemID> m_reads;
+    std::vector<SubsystemID> m_writes;
+    SubsystemPhase m_phase = SubsystemPhase::Update;
+    bool m_mainThread = false;
+    bool m_exclusive = false;
+};
+
 /// Base class for all engine subsystems
 /// Provides lifecycle methods and context access
 class PINA_API Subsystem {
@@ -31,6 +85,11 @@ public:
     /// Called on shutdown, before destruction
     virtual void shutdown() {}
 
+    /// Declare phase, data dependencies and threading requirements
+    /// Read once when the Context builds its schedule. The default is
+    /// exclusive (serialized on the main thread), which is always safe.
+    virtual void declareDependencies(SubsystemDependencies& deps) const { deps.exclusive(); }
+
     /// Get the owning context
     Context* getContext() const { return m_context; }
 
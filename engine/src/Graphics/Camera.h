@@ -78,6 +78,10 @@ public:
     /// Get camera target
     const glm::vec3& getTarget() const { return m_target; }
 
+    /// Get the clipping plane distances
+    float getNearPlane() const { return m_nearPlane; }
+    float getFarPlane() const { return m_farPlane; }
+
     // ========================================================================
     // Input Handling (for controllable cameras)
     // ========================================================================
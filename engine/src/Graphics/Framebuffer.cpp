@@ -2,7 +2,6 @@
 
 #include "Framebuffer.h"
 #include "GraphicsDevice.h"
-#include "OpenGL/GLFramebuffer.h"
 
 namespace Pina {
 
@@ -11,8 +10,7 @@ UNIQUE<Framebuffer> Framebuffer::create(GraphicsDevice* device, const Framebuffe
         return nullptr;
     }
 
-    // Currently only OpenGL backend
-    return MAKE_UNIQUE<GLFramebuffer>(spec);
+    return device->createFramebuffer(spec);
 }
 
 } // namespace Pina
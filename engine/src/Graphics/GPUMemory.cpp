@@ -0,0 +1,157 @@
+/// Pina Engine - GPU Memory Accounting Implementation
+
+#include "GPUMemory.h"
+
+namespace Pina {
+
+const char* toString(GPUResourceType type) {
+    switch (type) {
+        case GPUResourceType::VertexBuffer: return "VertexBuffer";
+        case GPUResourceType::IndexBuffer:  return "IndexBuffer";
+        case GPUResourceType::Texture:      return "Texture";
+        case GPUResourceType::Framebuffer:  return "Framebuffer";
+        case GPUResourceType::Count:        break;
+    }
+    return "Unknown";
+}
+
+// ============================================================================
+// GPUMemoryTracker
+// ============================================================================
+
+void GPUMemoryTracker::recordCreate(GPUResourceType type, size_t bytes) {
+    GPUResourceStats& stats = m_stats[static_cast<size_t>(type)];
+    stats.liveCount++;
+    stats.totalCreated++;
+    stats.liveBytes += bytes;
+    m_liveBytes += bytes;
+    updatePeaks(stats);
+}
+
+void GPUMemoryTracker::recordDestroy(GPUResourceType type, size_t bytes) {
+    GPUResourceStats& stats = m_stats[static_cast<size_t>(type)];
+    stats.liveCount--;
+    stats.liveBytes -= bytes;
+    m_liveBytes -= bytes;
+}
+
+void GPUMemoryTracker::recordResize(GPUResourceType type, size_t oldBytes, size_t newBytes) {
+    GPUResourceStats& stats = m_stats[static_cast<size_t>(type)];
+    stats.liveBytes = stats.liveBytes - oldBytes + newBytes;
+    m_liveBytes = m_liveBytes - oldBytes + newBytes;
+    updatePeaks(stats);
+}
+
+const GPUResourceStats& GPUMemoryTracker::getStats(GPUResourceType type) const {
+    return m_stats[static_cast<size_t>(type)];
+}
+
+void GPUMemoryTracker::updatePeaks(GPUResourceStats& stats) {
+    if (stats.liveBytes > stats.peakBytes) {
+        stats.peakBytes = stats.liveBytes;
+    }
+    if (m_liveBytes > m_peakBytes) {
+        m_peakBytes = m_liveBytes;
+    }
+}
+
+// ============================================================================
+// GPUAllocation
+// ============================================================================
+
+GPUAllocation::GPUAllocation(SHARED<GPUMemoryTracker> tracker, GPUResourceType type, size_t bytes)
+    : m_tracker(std::move(tracker))
+    , m_type(type)
+    , m_bytes(bytes)
+{
+    if (m_tracker) {
+        m_tracker->recordCreate(m_type, m_bytes);
+    }
+}
+
+GPUAllocation::~GPUAllocation() {
+    release();
+}
+
+GPUAllocation::GPUAllocation(GPUAllocation&& other) noexcept
+    : m_tracker(std::move(other.m_tracker))
+    , m_type(other.m_type)
+    , m_bytes(other.m_bytes)
+{
+    other.m_bytes = 0;
+}
+
+GPUAllocation& GPUAllocation::operator=(GPUAllocation&& other) noexcept {
+    if (this != &other) {
+        release();
+        m_tracker = std::move(other.m_tracker);
+        m_type = other.m_type;
+        m_bytes = other.m_bytes;
+        other.m_bytes = 0;
+    }
+    return *this;
+}
+
+void GPUAllocation::resize(size_t bytes) {
+    if (m_tracker && bytes != m_bytes) {
+        m_tracker->recordResize(m_type, m_bytes, bytes);
+    }
+    m_bytes = bytes;
+}
+
+void GPUAllocation::release() {
+    if (m_tracker) {
+        m_tracker->recordDestroy(m_type, m_bytes);
+        m_tracker.reset();
+    }
+    m_bytes = 0;
+}
+
+// ============================================================================
+// Size Estimation
+// ============================================================================
+
+size_t getTextureFormatSize(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::R8:              return 1;
+        case TextureFormat::RG8:             return 2;
+        case TextureFormat::RGB8:            return 3;
+        case TextureFormat::RGBA8:           return 4;
+        case TextureFormat::R16F:            return 2;
+        case TextureFormat::RG16F:           return 4;
+        case TextureFormat::RGB16F:          return 6;
+        case TextureFormat::RGBA16F:         return 8;
+        case TextureFormat::R32F:            return 4;
+        case TextureFormat::RG32F:           return 8;
+        case TextureFormat::RGB32F:          return 12;
+        case TextureFormat::RGBA32F:         return 16;
+        case TextureFormat::Depth16:         return 2;
+        case TextureFormat::Depth24:         return 3;
+        case TextureFormat::Depth32F:        return 4;
+        case TextureFormat::Depth24Stencil8: return 4;
+        case TextureFormat::None:            return 0;
+    }
+    return 0;
+}
+
+size_t computeTextureBytes(uint32_t width, uint32_t height, uint32_t channels, bool mipmapped) {
+    size_t bytes = static_cast<size_t>(width) * height * channels;
+    return mipmapped ? bytes + bytes / 3 : bytes;
+}
+
+size_t computeFramebufferBytes(const FramebufferSpec& spec) {
+    if (spec.width <= 0 || spec.height <= 0) return 0;
+
+    size_t pixels = static_cast<size_t>(spec.width) * static_cast<size_t>(spec.height);
+    size_t samples = spec.samples > 1 ? static_cast<size_t>(spec.samples) : 1;
+
+    size_t bytesPerPixel = 0;
+    for (TextureFormat format : spec.colorAttachments) {
+        bytesPerPixel += getTextureFormatSize(format);
+    }
+    bytesPerPixel += getTextureFormatSize(spec.depthAttachment);
+
+    return pixels * samples * bytesPerPixel;
+}
+
+} // namespace Pina
@@ -0,0 +1,98 @@
+#pragma once
+
+/// Pina Engine - GPU Memory Accounting
+/// Byte-size tracking for buffers, textures and framebuffers created by a GraphicsDevice
+
+#include "../Core/Export.h"
+#include "../Core/Memory.h"
+#include "Framebuffer.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Pina {
+
+/// Kind of GPU resource
+enum class GPUResourceType : uint8_t {
+    VertexBuffer,
+    IndexBuffer,
+    Texture,
+    Framebuffer,
+
+    Count
+};
+
+/// Get a readable name for a resource type
+PINA_API const char* toString(GPUResourceType type);
+
+/// Counters for one resource type
+struct PINA_API GPUResourceStats {
+    uint64_t liveCount = 0;     // Resources currently alive
+    uint64_t liveBytes = 0;     // Estimated bytes currently allocated
+    uint64_t peakBytes = 0;     // Highest liveBytes seen
+    uint64_t totalCreated = 0;  // Resources ever created
+};
+
+/// Per-device GPU memory accounting
+/// Sizes are estimates from dimensions and formats (drivers may pad).
+/// Not thread-safe: resources are created/destroyed on the render thread.
+class PINA_API GPUMemoryTracker {
+public:
+    void recordCreate(GPUResourceType type, size_t bytes);
+    void recordDestroy(GPUResourceType type, size_t bytes);
+    void recordResize(GPUResourceType type, size_t oldBytes, size_t newBytes);
+
+    /// Get counters for a resource type
+    const GPUResourceStats& getStats(GPUResourceType type) const;
+
+    /// Bytes across all resource types
+    uint64_t getTotalLiveBytes() const { return m_liveBytes; }
+
+    /// Highest total seen
+    uint64_t getPeakBytes() const { return m_peakBytes; }
+
+private:
+    void updatePeaks(GPUResourceStats& stats);
+
+    std::array<GPUResourceStats, static_cast<size_t>(GPUResourceType::Count)> m_stats{};
+    uint64_t m_liveBytes = 0;
+    uint64_t m_peakBytes = 0;
+};
+
+/// RAII record of one resource's GPU memory
+/// Shares ownership of the tracker so resources may outlive their device.
+class PINA_API GPUAllocation {
+public:
+    GPUAllocation() = default;
+    GPUAllocation(SHARED<GPUMemoryTracker> tracker, GPUResourceType type, size_t bytes);
+    ~GPUAllocation();
+
+    GPUAllocation(const GPUAllocation&) = delete;
+    GPUAllocation& operator=(const GPUAllocation&) = delete;
+    GPUAllocation(GPUAllocation&& other) noexcept;
+    GPUAllocation& operator=(GPUAllocation&& other) noexcept;
+
+    /// Change the recorded size (buffer re-upload, framebuffer resize)
+    void resize(size_t bytes);
+
+    /// Stop tracking (records the free)
+    void release();
+
+    size_t getBytes() const { return m_bytes; }
+
+private:
+    SHARED<GPUMemoryTracker> m_tracker;
+    GPUResourceType m_type = GPUResourceType::VertexBuffer;
+    size_t m_bytes = 0;
+};
+
+/// Bytes per pixel of an attachment format (0 for None)
+PINA_API size_t getTextureFormatSize(TextureFormat format);
+
+/// Estimated size of a texture (full mip chain adds a third)
+PINA_API size_t computeTextureBytes(uint32_t width, uint32_t height, uint32_t channels, bool mipmapped);
+
+/// Estimated size of all attachments of a framebuffer
+PINA_API size_t computeFramebufferBytes(const FramebufferSpec& spec);
+
+} // namespace Pina
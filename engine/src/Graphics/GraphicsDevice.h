@@ -11,6 +11,7 @@
 #include "VertexLayout.h"
 #include "Texture.h"
 #include "Framebuffer.h"
+#include "GPUMemory.h"
 
 namespace Pina {
 
@@ -82,6 +83,9 @@ public:
     /// Enable/disable depth buffer writes
     virtual void setDepthWrite(bool enabled) = 0;
 
+    /// Bind a raw texture ID (e.g. a framebuffer attachment) to a texture unit
+    virtual void bindTexture(uint32_t textureID, uint32_t slot) = 0;
+
     // ========================================================================
     // Drawing
     // ========================================================================
@@ -94,12 +98,30 @@ public:
     /// @note Shader must be bound before calling this method
     virtual void drawIndexed(VertexArray* vao) = 0;
 
+    /// Draw indexed vertices instanceCount times (per-instance attributes
+    /// come from vertex buffers added with an instanced VertexLayout)
+    /// @note Shader must be bound before calling this method
+    virtual void drawIndexedInstanced(VertexArray* vao, uint32_t instanceCount) = 0;
+
+    // ========================================================================
+    // Memory Accounting
+    // ========================================================================
+
+    /// GPU memory of buffers, textures and framebuffers created by this device
+    const GPUMemoryTracker& getGPUMemory() const { return *m_gpuMemory; }
+
+    /// Shared tracker handed to resources (they may outlive the device)
+    const SHARED<GPUMemoryTracker>& getGPUMemoryTracker() const { return m_gpuMemory; }
+
     // ========================================================================
     // Factory
     // ========================================================================
 
     /// Create a graphics device for the specified backend
     static UNIQUE<GraphicsDevice> create(GraphicsBackend backend);
+
+protected:
+    SHARED<GPUMemoryTracker> m_gpuMemory = MAKE_SHARED<GPUMemoryTracker>();
 };
 
 } // namespace Pina
@@ -0,0 +1,42 @@
+#pragma once
+
+/// Pina Engine - Instance Data
+/// Per-instance vertex attributes for instanced mesh draws
+
+#include "../Core/Export.h"
+#include "../Math/Color.h"
+#include "VertexLayout.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+
+namespace Pina {
+
+/// Attributes of one instance in StaticMesh::drawInstanced()
+///
+/// Stored interleaved in the mesh's instance buffer, after the mesh's own
+/// vertex attributes (locations 0-2). Matrices take one location per
+/// column, so the instanced shaders in ShaderLibrary read:
+///   aInstanceModel (mat4)  locations 3-6
+///   aInstanceNormal (mat3) locations 7-9
+///   aInstanceColor (vec4)  location 10
+struct PINA_API InstanceData {
+    static constexpr uint32_t FirstLocation = 3;
+
+    glm::mat4 model = glm::mat4(1.0f);
+    glm::mat3 normal = glm::mat3(1.0f);     // transpose(inverse(mat3(model)))
+    Color color = Color::white();           // Multiplies the material's diffuse color and alpha
+
+    /// Vertex layout of the instance buffer (advanced once per instance)
+    static VertexLayout getLayout() {
+        VertexLayout layout;
+        layout.push("aInstanceModel", ShaderDataType::Mat4);
+        layout.push("aInstanceNormal", ShaderDataType::Mat3);
+        layout.push("aInstanceColor", ShaderDataType::Float4);
+        layout.setInstanced(true);
+        return layout;
+    }
+};
+
+static_assert(sizeof(InstanceData) == 4 * (16 + 9 + 4), "InstanceData must match its vertex layout");
+
+} // namespace Pina
@@ -1,7 +1,7 @@
 /// Pina Engine - Light Manager Implementation
 
 #include "LightManager.h"
-#include "../OpenGL/GLCommon.h"
+#include "../GraphicsDevice.h"
 
 namespace Pina {
 
@@ -312,8 +312,8 @@ DirectionalLight* LightManager::getShadowCastingLight() const {
     return nullptr;
 }
 
-void LightManager::uploadShadowUniforms(Shader* shader, uint32_t shadowMapTextureID) const {
-    if (!shader) return;
+void LightManager::uploadShadowUniforms(Shader* shader, GraphicsDevice* device, uint32_t shadowMapTextureID) const {
+    if (!shader || !device) return;
 
     // Upload light space matrix
     shader->setMat4("uLightSpaceMatrix", m_lightSpaceMatrix);
@@ -322,8 +322,7 @@ void LightManager::uploadShadowUniforms(Shader* shader, uint32_t shadowMapTextur
     shader->setInt("uShadowMap", 8);
 
     // Bind the shadow map texture
-    glActiveTexture(GL_TEXTURE8);
-    glBindTexture(GL_TEXTURE_2D, shadowMapTextureID);
+    device->bindTexture(shadowMapTextureID, 8);
 }
 
 } // namespace Pina
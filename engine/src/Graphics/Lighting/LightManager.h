@@ -16,6 +16,8 @@
 
 namespace Pina {
 
+class GraphicsDevice;
+
 /// GPU-friendly light data structure (matches GLSL uniform layout)
 /// Uses vec4 for proper GPU memory alignment
 struct PINA_API LightData {
@@ -109,8 +111,9 @@ public:
 
     /// Upload shadow-related uniforms to a shader
     /// @param shader Shader to upload uniforms to
-    /// @param shadowMapTextureID OpenGL texture ID for shadow map
-    void uploadShadowUniforms(Shader* shader, uint32_t shadowMapTextureID) const;
+    /// @param device Graphics device used to bind the shadow map
+    /// @param shadowMapTextureID Texture ID of the shadow map depth attachment
+    void uploadShadowUniforms(Shader* shader, GraphicsDevice* device, uint32_t shadowMapTextureID) const;
 
     /// Get the first directional light that casts shadows
     /// @return Pointer to shadow-casting directional light, or nullptr if none
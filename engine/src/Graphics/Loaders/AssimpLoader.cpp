@@ -2,6 +2,8 @@
 /// Simplified approach - read vertex data directly like LearnOpenGL
 
 #include "AssimpLoader.h"
+#include "../../Core/Profiler.h"
+#include "../../Math/SimdMath.h"
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
@@ -102,7 +104,10 @@ static void buildMeshTransforms(
 // Main Load Function
 // ============================================================================
 
-UNIQUE<Model> AssimpLoader::load(GraphicsDevice* device, const std::string& path) {
+UNIQUE<Model> AssimpLoader::load(GraphicsDevice* device, const std::string& path,
+                                 const ModelLoadOptions& options) {
+    PINA_PROFILE_FUNCTION();
+
     Assimp::Importer importer;
 
     // Detect format
@@ -119,7 +124,11 @@ UNIQUE<Model> AssimpLoader::load(GraphicsDevice* device, const std::string& path
         std::cout << "  UV flip enabled for this format" << std::endl;
     }
 
-    const aiScene* scene = importer.ReadFile(path, flags);
+    const aiScene* scene = nullptr;
+    {
+        PINA_PROFILE_SCOPE("Assimp::ReadFile");
+        scene = importer.ReadFile(path, flags);
+    }
 
     if (!scene) {
         std::cerr << "Assimp error loading " << path << ": " << importer.GetErrorString() << std::endl;
@@ -150,8 +159,10 @@ UNIQUE<Model> AssimpLoader::load(GraphicsDevice* device, const std::string& path
     ctx.directory = model->m_directory;
     ctx.scene = scene;
     ctx.format = static_cast<int>(format);
+    ctx.keepCpuGeometry = options.keepCpuGeometry || options.buildBVH;
 
     // Process materials first
+    PINA_PROFILE_SCOPE("AssimpLoader::processScene");
     for (unsigned int i = 0; i < scene->mNumMaterials; ++i) {
         Material mat = processMaterial(scene->mMaterials[i], ctx);
         model->m_materials.push_back(std::move(mat));
@@ -190,6 +201,10 @@ UNIQUE<Model> AssimpLoader::load(GraphicsDevice* device, const std::string& path
         }
     }
 
+    if (options.buildBVH) {
+        model->buildBVHs(options.jobSystem);
+    }
+
     std::cout << "Loaded model: " << path << std::endl;
     std::cout << "  Meshes: " << model->m_meshes.size() << std::endl;
     std::cout << "  Materials: " << model->m_materials.size() << std::endl;
@@ -228,29 +243,32 @@ UNIQUE<StaticMesh> AssimpLoader::processMesh(aiMesh* mesh, LoadContext& ctx, con
     vertices.reserve(mesh->mNumVertices * 8);
     indices.reserve(mesh->mNumFaces * 3);
 
-    // Calculate normal matrix for transforming normals
-    glm::mat3 normalMatrix = glm::transpose(glm::inverse(glm::mat3(transform)));
-
-    // Process vertices with transform applied
-    for (unsigned int i = 0; i < mesh->mNumVertices; ++i) {
-        // Position - apply transform
-        glm::vec4 localPos(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z, 1.0f);
-        glm::vec4 worldPos = transform * localPos;
-
-        vertices.push_back(worldPos.x);
-        vertices.push_back(worldPos.y);
-        vertices.push_back(worldPos.z);
-
-        // Expand bounding box with transformed position
-        ctx.model->m_boundingBox.expand(glm::vec3(worldPos));
-
-        // Normal - apply normal matrix
-        if (mesh->HasNormals()) {
-            glm::vec3 localNorm(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z);
-            glm::vec3 worldNorm = glm::normalize(normalMatrix * localNorm);
-            vertices.push_back(worldNorm.x);
-            vertices.push_back(worldNorm.y);
-            vertices.push_back(worldNorm.z);
+    // Transform positions and normals in batches
+    static_assert(sizeof(aiVector3D) == sizeof(glm::vec3), "aiVector3D must be three floats");
+    const size_t vertexCount = mesh->mNumVertices;
+    std::vector<glm::vec3> positions(vertexCount);
+    SimdMath::transformPoints(transform, reinterpret_cast<const glm::vec3*>(mesh->mVertices),
+                              positions.data(), vertexCount);
+    SimdMath::expandBox(ctx.model->m_boundingBox, positions.data(), vertexCount);
+
+    std::vector<glm::vec3> normals;
+    if (mesh->HasNormals()) {
+        normals.resize(vertexCount);
+        SimdMath::transformNormals(SimdMath::normalMatrix(transform),
+                                   reinterpret_cast<const glm::vec3*>(mesh->mNormals),
+                                   normals.data(), vertexCount);
+    }
+
+    // Interleave vertices
+    for (size_t i = 0; i < vertexCount; ++i) {
+        vertices.push_back(positions[i].x);
+        vertices.push_back(positions[i].y);
+        vertices.push_back(positions[i].z);
+
+        if (!normals.empty()) {
+            vertices.push_back(normals[i].x);
+            vertices.push_back(normals[i].y);
+            vertices.push_back(normals[i].z);
         } else {
             vertices.push_back(0.0f);
             vertices.push_back(1.0f);
@@ -293,7 +311,7 @@ UNIQUE<StaticMesh> AssimpLoader::processMesh(aiMesh* mesh, LoadContext& ctx, con
         return nullptr;
     }
 
-    return StaticMesh::create(ctx.device, vertices, indices);
+    return StaticMesh::create(ctx.device, vertices, indices, ctx.keepCpuGeometry);
 }
 
 // ============================================================================
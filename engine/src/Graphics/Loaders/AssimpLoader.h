@@ -31,8 +31,10 @@ public:
     /// Load a model from file
     /// @param device Graphics device for creating resources
     /// @param path Path to the model file
+    /// @param options CPU geometry and BVH options
     /// @return Loaded model, or nullptr on failure
-    static UNIQUE<Model> load(GraphicsDevice* device, const std::string& path);
+    static UNIQUE<Model> load(GraphicsDevice* device, const std::string& path,
+                              const ModelLoadOptions& options = {});
 
 private:
     /// Internal loading context
@@ -43,6 +45,7 @@ private:
         std::unordered_map<std::string, size_t> loadedTextures;  // path -> texture index
         const aiScene* scene;  // For accessing embedded textures
         int format;            // ModelFormat enum value (internal)
+        bool keepCpuGeometry;  // Keep positions and indices on the CPU
     };
 
     static void processNode(aiNode* node, const aiScene* scene, LoadContext& ctx, const glm::mat4& parentTransform);
@@ -1,6 +1,7 @@
 /// Pina Engine - Material Implementation
 
 #include "Material.h"
+#include <cstring>
 
 namespace Pina {
 
@@ -22,6 +23,63 @@ MaterialWorkflow Material::getWorkflow() const {
     return MaterialWorkflow::BlinnPhong;
 }
 
+bool Material::operator==(const Material& other) const {
+    return m_diffuse == other.m_diffuse && m_specular == other.m_specular &&
+           m_ambient == other.m_ambient && m_emissive == other.m_emissive &&
+           m_shininess == other.m_shininess && m_albedo == other.m_albedo &&
+           m_metallic == other.m_metallic && m_roughness == other.m_roughness &&
+           m_ao == other.m_ao && m_opacity == other.m_opacity &&
+           m_diffuseMap == other.m_diffuseMap && m_specularMap == other.m_specularMap &&
+           m_normalMap == other.m_normalMap && m_albedoMap == other.m_albedoMap &&
+           m_metallicMap == other.m_metallicMap && m_roughnessMap == other.m_roughnessMap &&
+           m_metallicRoughnessMap == other.m_metallicRoughnessMap && m_aoMap == other.m_aoMap &&
+           m_emissionMap == other.m_emissionMap && m_opacityMap == other.m_opacityMap &&
+           m_hasPBRValues == other.m_hasPBRValues && m_hasPBRTextures == other.m_hasPBRTextures;
+}
+
+uint64_t Material::hash() const {
+    // FNV-1a over whole words, then a final avalanche for the low bits
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](uint64_t value) {
+        hash = (hash ^ value) * 1099511628211ull;
+    };
+    auto mixFloat = [&mix](float value) {
+        value += 0.0f;  // -0 hashes as +0, as they compare equal
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        mix(bits);
+    };
+    auto mixColor = [&mixFloat](const Color& color) {
+        mixFloat(color.r);
+        mixFloat(color.g);
+        mixFloat(color.b);
+        mixFloat(color.a);
+    };
+
+    mixColor(m_diffuse);
+    mixColor(m_specular);
+    mixColor(m_ambient);
+    mixColor(m_emissive);
+    mixFloat(m_shininess);
+    mixColor(m_albedo);
+    mixFloat(m_metallic);
+    mixFloat(m_roughness);
+    mixFloat(m_ao);
+    mixFloat(m_opacity);
+
+    const Texture* maps[] = {m_diffuseMap, m_specularMap, m_normalMap, m_albedoMap, m_metallicMap,
+                             m_roughnessMap, m_metallicRoughnessMap, m_aoMap, m_emissionMap, m_opacityMap};
+    for (const Texture* map : maps) {
+        mix(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(map)));
+    }
+    mix((m_hasPBRValues ? 1u : 0u) | (m_hasPBRTextures ? 2u : 0u));
+
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
 Material Material::createDefault() {
     Material mat;
     mat.m_diffuse = Color::white();
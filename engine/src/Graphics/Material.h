@@ -6,6 +6,7 @@
 
 #include "../Core/Export.h"
 #include "../Math/Color.h"
+#include <cstdint>
 
 namespace Pina {
 
@@ -35,6 +36,17 @@ public:
     /// Check if this material uses PBR
     bool isPBR() const { return getWorkflow() == MaterialWorkflow::PBR_MetallicRoughness; }
 
+    // ========================================================================
+    // Comparison
+    // ========================================================================
+
+    /// Check if two materials upload identical uniforms and textures
+    bool operator==(const Material& other) const;
+    bool operator!=(const Material& other) const { return !(*this == other); }
+
+    /// Hash of every property (equal materials hash equally)
+    uint64_t hash() const;
+
     // ========================================================================
     // Phong/Blinn-Phong Properties
     // ========================================================================
@@ -12,7 +12,7 @@ namespace Pina {
 
 /// Base class for all mesh types
 /// Provides common functionality for drawing and managing vertex data
-class PINA_API Mesh {
+class PINA_API Mesh : public TrackedObject<MemoryTag::Assets> {
 public:
     virtual ~Mesh() = default;
 
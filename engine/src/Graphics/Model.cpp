@@ -2,15 +2,29 @@
 
 #include "Model.h"
 #include "Loaders/AssimpLoader.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
 #include <iostream>
 #include <algorithm>
 #include <cctype>
 
 namespace Pina {
 
-UNIQUE<Model> Model::load(GraphicsDevice* device, const std::string& path) {
+UNIQUE<Model> Model::load(GraphicsDevice* device, const std::string& path, const ModelLoadOptions& options) {
     // Use Assimp for all formats (testing)
-    return AssimpLoader::load(device, path);
+    return AssimpLoader::load(device, path, options);
+}
+
+UNIQUE<Model> Model::create() {
+    return UNIQUE<Model>(new Model());
+}
+
+size_t Model::addMesh(UNIQUE<StaticMesh> mesh, const Material& material) {
+    m_boundingBox.expand(mesh->getBoundingBox());
+    m_meshMaterialIndices.push_back(m_materials.size());
+    m_materials.push_back(material);
+    m_meshes.push_back(std::move(mesh));
+    return m_meshes.size() - 1;
 }
 
 void Model::draw(Shader* shader, LightManager* lightManager) {
@@ -52,6 +66,26 @@ const Material* Model::getMaterial(size_t index) const {
     return &m_materials[index];
 }
 
+const Material* Model::getMeshMaterial(size_t meshIndex) const {
+    size_t materialIndex = meshIndex < m_meshMaterialIndices.size() ? m_meshMaterialIndices[meshIndex] : 0;
+    return getMaterial(materialIndex);
+}
+
+void Model::buildBVHs(JobSystem* jobs) {
+    PINA_PROFILE_FUNCTION();
+
+    auto build = [this, jobs](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            m_meshes[i]->buildBVH(jobs);
+        }
+    };
+    if (jobs) {
+        jobs->parallelFor(0, m_meshes.size(), 1, build);
+    } else {
+        build(0, m_meshes.size());
+    }
+}
+
 bool Model::hasPBRMaterials() const {
     for (const auto& material : m_materials) {
         if (material.isPBR()) {
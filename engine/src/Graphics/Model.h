@@ -11,48 +11,25 @@
 #include "Shader.h"
 #include "Primitives/StaticMesh.h"
 #include "Lighting/LightManager.h"
+#include "../Math/BoundingBox.h"
 #include <vector>
 #include <string>
 #include <glm/glm.hpp>
 
 namespace Pina {
 
-/// Axis-aligned bounding box
-struct PINA_API BoundingBox {
-    glm::vec3 min{std::numeric_limits<float>::max()};
-    glm::vec3 max{std::numeric_limits<float>::lowest()};
+class JobSystem;
 
-    /// Expand the bounding box to include a point
-    void expand(const glm::vec3& point) {
-        min = glm::min(min, point);
-        max = glm::max(max, point);
-    }
-
-    /// Get center of the bounding box
-    glm::vec3 getCenter() const {
-        return (min + max) * 0.5f;
-    }
-
-    /// Get size (extent) of the bounding box
-    glm::vec3 getSize() const {
-        return max - min;
-    }
-
-    /// Get the maximum dimension (largest of width, height, depth)
-    float getMaxDimension() const {
-        glm::vec3 size = getSize();
-        return glm::max(glm::max(size.x, size.y), size.z);
-    }
-
-    /// Check if bounding box is valid (has been expanded at least once)
-    bool isValid() const {
-        return min.x <= max.x && min.y <= max.y && min.z <= max.z;
-    }
+/// Options for Model::load()
+struct PINA_API ModelLoadOptions {
+    bool keepCpuGeometry = false;       // Keep mesh positions and indices on the CPU
+    bool buildBVH = false;              // Build a triangle BVH per mesh for raycasts (keeps CPU geometry)
+    JobSystem* jobSystem = nullptr;     // Builds the BVHs in parallel if set
 };
 
 /// 3D model container
 /// Holds multiple meshes with their associated materials and textures
-class PINA_API Model {
+class PINA_API Model : public TrackedObject<MemoryTag::Assets> {
 public:
     ~Model() = default;
 
@@ -60,8 +37,13 @@ public:
     /// Supports OBJ, glTF, FBX, COLLADA, and 50+ other formats via assimp
     /// @param device Graphics device for creating GPU resources
     /// @param path Path to the model file
+    /// @param options CPU geometry and BVH options
     /// @return Loaded model, or nullptr on failure
-    static UNIQUE<Model> load(GraphicsDevice* device, const std::string& path);
+    static UNIQUE<Model> load(GraphicsDevice* device, const std::string& path,
+                              const ModelLoadOptions& options = {});
+
+    /// Create an empty model to fill with addMesh() (procedural geometry)
+    static UNIQUE<Model> create();
 
     /// Draw the model (all meshes)
     /// Binds each mesh's material and draws it
@@ -91,6 +73,15 @@ public:
     StaticMesh* getMesh(size_t index);
     const StaticMesh* getMesh(size_t index) const;
 
+    /// Add a mesh with its own material
+    /// Add meshes before attaching the model to nodes (their bounds are set then).
+    /// @return Index of the mesh
+    size_t addMesh(UNIQUE<StaticMesh> mesh, const Material& material);
+
+    /// Build the triangle BVH of every mesh with CPU geometry
+    /// Meshes are built in parallel on the job system if one is given.
+    void buildBVHs(JobSystem* jobs = nullptr);
+
     // ========================================================================
     // Material Access
     // ========================================================================
@@ -102,6 +93,9 @@ public:
     Material* getMaterial(size_t index);
     const Material* getMaterial(size_t index) const;
 
+    /// Get the material a mesh is drawn with (nullptr if it has none)
+    const Material* getMeshMaterial(size_t meshIndex) const;
+
     /// Check if any material uses PBR workflow
     bool hasPBRMaterials() const;
 
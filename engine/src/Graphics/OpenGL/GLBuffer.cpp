@@ -8,8 +8,9 @@ namespace Pina {
 // GLVertexBuffer
 // ============================================================================
 
-GLVertexBuffer::GLVertexBuffer(const void* data, size_t size)
+GLVertexBuffer::GLVertexBuffer(const void* data, size_t size, SHARED<GPUMemoryTracker> tracker)
     : m_size(size)
+    , m_allocation(std::move(tracker), GPUResourceType::VertexBuffer, size)
 {
     glGenBuffers(1, &m_bufferID);
     glBindBuffer(GL_ARRAY_BUFFER, m_bufferID);
@@ -32,14 +33,16 @@ void GLVertexBuffer::setData(const void* data, size_t size) {
     glBindBuffer(GL_ARRAY_BUFFER, m_bufferID);
     glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
     m_size = size;
+    m_allocation.resize(size);
 }
 
 // ============================================================================
 // GLIndexBuffer
 // ============================================================================
 
-GLIndexBuffer::GLIndexBuffer(const uint32_t* indices, uint32_t count)
+GLIndexBuffer::GLIndexBuffer(const uint32_t* indices, uint32_t count, SHARED<GPUMemoryTracker> tracker)
     : m_count(count)
+    , m_allocation(std::move(tracker), GPUResourceType::IndexBuffer, count * sizeof(uint32_t))
 {
     // Save currently bound VAO to restore later
     //GLint previousVAO = 0;
@@ -117,17 +120,30 @@ void GLVertexArray::addVertexBuffer(VertexBuffer* buffer, const VertexLayout& la
                 break;
         }
 
-        glEnableVertexAttribArray(m_attributeIndex);
-        glVertexAttribPointer(
-            m_attributeIndex,
-            ShaderDataTypeComponentCount(attr.type),
-            glType,
-            normalized,
-            layout.getStride(),
-            reinterpret_cast<const void*>(static_cast<uintptr_t>(attr.offset))
-        );
-
-        m_attributeIndex++;
+        // Matrices take one attribute location per column
+        uint32_t columns = 1;
+        if (attr.type == ShaderDataType::Mat3) {
+            columns = 3;
+        } else if (attr.type == ShaderDataType::Mat4) {
+            columns = 4;
+        }
+        GLint componentCount = static_cast<GLint>(ShaderDataTypeComponentCount(attr.type) / columns);
+        uint32_t columnSize = attr.size / columns;
+
+        for (uint32_t column = 0; column < columns; ++column) {
+            glEnableVertexAttribArray(m_attributeIndex);
+            glVertexAttribPointer(
+                m_attributeIndex,
+                componentCount,
+                glType,
+                normalized,
+                layout.getStride(),
+                reinterpret_cast<const void*>(static_cast<uintptr_t>(attr.offset + column * columnSize))
+            );
+            glVertexAttribDivisor(m_attributeIndex, layout.isInstanced() ? 1 : 0);
+
+            m_attributeIndex++;
+        }
     }
 }
 
@@ -3,6 +3,7 @@
 /// Pina Engine - OpenGL Buffer Implementations
 
 #include "../Buffer.h"
+#include "../GPUMemory.h"
 #include "GLCommon.h"
 
 namespace Pina {
@@ -10,7 +11,7 @@ namespace Pina {
 /// OpenGL Vertex Buffer
 class GLVertexBuffer : public VertexBuffer {
 public:
-    GLVertexBuffer(const void* data, size_t size);
+    GLVertexBuffer(const void* data, size_t size, SHARED<GPUMemoryTracker> tracker = nullptr);
     ~GLVertexBuffer() override;
 
     void bind() override;
@@ -22,12 +23,13 @@ public:
 private:
     GLuint m_bufferID = 0;
     size_t m_size = 0;
+    GPUAllocation m_allocation;
 };
 
 /// OpenGL Index Buffer
 class GLIndexBuffer : public IndexBuffer {
 public:
-    GLIndexBuffer(const uint32_t* indices, uint32_t count);
+    GLIndexBuffer(const uint32_t* indices, uint32_t count, SHARED<GPUMemoryTracker> tracker = nullptr);
     ~GLIndexBuffer() override;
 
     void bind() override;
@@ -39,6 +41,7 @@ public:
 private:
     GLuint m_bufferID = 0;
     uint32_t m_count = 0;
+    GPUAllocation m_allocation;
 };
 
 /// OpenGL Vertex Array Object
@@ -5,6 +5,7 @@
 #include "GLBuffer.h"
 #include "GLTexture.h"
 #include "GLFramebuffer.h"
+#include "../Recording/RecordingDevice.h"
 #include <iostream>
 
 namespace Pina {
@@ -37,11 +38,11 @@ UNIQUE<Shader> GLDevice::createShader() {
 }
 
 UNIQUE<VertexBuffer> GLDevice::createVertexBuffer(const void* data, size_t size) {
-    return MAKE_UNIQUE<GLVertexBuffer>(data, size);
+    return MAKE_UNIQUE<GLVertexBuffer>(data, size, m_gpuMemory);
 }
 
 UNIQUE<IndexBuffer> GLDevice::createIndexBuffer(const uint32_t* indices, uint32_t count) {
-    return MAKE_UNIQUE<GLIndexBuffer>(indices, count);
+    return MAKE_UNIQUE<GLIndexBuffer>(indices, count, m_gpuMemory);
 }
 
 UNIQUE<VertexArray> GLDevice::createVertexArray() {
@@ -52,11 +53,11 @@ UNIQUE<Texture> GLDevice::createTexture(const unsigned char* data,
                                         uint32_t width,
                                         uint32_t height,
                                         uint32_t channels) {
-    return MAKE_UNIQUE<GLTexture>(data, width, height, channels);
+    return MAKE_UNIQUE<GLTexture>(data, width, height, channels, m_gpuMemory);
 }
 
 UNIQUE<Framebuffer> GLDevice::createFramebuffer(const FramebufferSpec& spec) {
-    return MAKE_UNIQUE<GLFramebuffer>(spec);
+    return MAKE_UNIQUE<GLFramebuffer>(spec, m_gpuMemory);
 }
 
 // ============================================================================
@@ -114,6 +115,11 @@ void GLDevice::setDepthWrite(bool enabled) {
     glDepthMask(enabled ? GL_TRUE : GL_FALSE);
 }
 
+void GLDevice::bindTexture(uint32_t textureID, uint32_t slot) {
+    glActiveTexture(GL_TEXTURE0 + slot);
+    glBindTexture(GL_TEXTURE_2D, textureID);
+}
+
 // ============================================================================
 // Drawing
 // ============================================================================
@@ -131,6 +137,15 @@ void GLDevice::drawIndexed(VertexArray* vao) {
     }
 }
 
+void GLDevice::drawIndexedInstanced(VertexArray* vao, uint32_t instanceCount) {
+    vao->bind();
+    IndexBuffer* ibo = vao->getIndexBuffer();
+    if (ibo && instanceCount > 0) {
+        glDrawElementsInstanced(GL_TRIANGLES, ibo->getCount(), GL_UNSIGNED_INT, nullptr,
+                                static_cast<GLsizei>(instanceCount));
+    }
+}
+
 // ============================================================================
 // Factory
 // ============================================================================
@@ -140,6 +155,9 @@ UNIQUE<GraphicsDevice> GraphicsDevice::create(GraphicsBackend backend) {
         case GraphicsBackend::OpenGL:
             return MAKE_UNIQUE<GLDevice>();
 
+        case GraphicsBackend::Null:
+            return MAKE_UNIQUE<RecordingDevice>();
+
         case GraphicsBackend::Metal:
         case GraphicsBackend::Vulkan:
         case GraphicsBackend::DirectX12:
@@ -34,10 +34,12 @@ public:
     void setBlending(bool enabled) override;
     void setWireframe(bool enabled) override;
     void setDepthWrite(bool enabled) override;
+    void bindTexture(uint32_t textureID, uint32_t slot) override;
 
     // Drawing
     void draw(VertexArray* vao, uint32_t vertexCount) override;
     void drawIndexed(VertexArray* vao) override;
+    void drawIndexedInstanced(VertexArray* vao, uint32_t instanceCount) override;
 };
 
 } // namespace Pina
@@ -9,8 +9,9 @@ namespace Pina {
 // Constructor / Destructor
 // ============================================================================
 
-GLFramebuffer::GLFramebuffer(const FramebufferSpec& spec)
+GLFramebuffer::GLFramebuffer(const FramebufferSpec& spec, SHARED<GPUMemoryTracker> tracker)
     : m_spec(spec)
+    , m_allocation(std::move(tracker), GPUResourceType::Framebuffer, computeFramebufferBytes(spec))
 {
     invalidate();
 }
@@ -24,6 +25,7 @@ GLFramebuffer::GLFramebuffer(GLFramebuffer&& other) noexcept
     , m_framebufferID(other.m_framebufferID)
     , m_colorAttachments(std::move(other.m_colorAttachments))
     , m_depthAttachment(other.m_depthAttachment)
+    , m_allocation(std::move(other.m_allocation))
 {
     other.m_framebufferID = 0;
     other.m_depthAttachment = 0;
@@ -37,6 +39,7 @@ GLFramebuffer& GLFramebuffer::operator=(GLFramebuffer&& other) noexcept {
         m_framebufferID = other.m_framebufferID;
         m_colorAttachments = std::move(other.m_colorAttachments);
         m_depthAttachment = other.m_depthAttachment;
+        m_allocation = std::move(other.m_allocation);
 
         other.m_framebufferID = 0;
         other.m_depthAttachment = 0;
@@ -81,6 +84,7 @@ void GLFramebuffer::resize(int width, int height) {
     m_spec.width = width;
     m_spec.height = height;
     invalidate();
+    m_allocation.resize(computeFramebufferBytes(m_spec));
 }
 
 void GLFramebuffer::clearColor(float r, float g, float b, float a) {
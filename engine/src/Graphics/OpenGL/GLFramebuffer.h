@@ -3,6 +3,7 @@
 /// Pina Engine - OpenGL Framebuffer Implementation
 
 #include "../Framebuffer.h"
+#include "../GPUMemory.h"
 #include "GLCommon.h"
 #include <vector>
 
@@ -11,7 +12,7 @@ namespace Pina {
 /// OpenGL framebuffer implementation
 class GLFramebuffer : public Framebuffer {
 public:
-    explicit GLFramebuffer(const FramebufferSpec& spec);
+    explicit GLFramebuffer(const FramebufferSpec& spec, SHARED<GPUMemoryTracker> tracker = nullptr);
     ~GLFramebuffer() override;
 
     // No copying
@@ -68,6 +69,7 @@ private:
     GLuint m_framebufferID = 0;
     std::vector<GLuint> m_colorAttachments;
     GLuint m_depthAttachment = 0;
+    GPUAllocation m_allocation;
 };
 
 } // namespace Pina
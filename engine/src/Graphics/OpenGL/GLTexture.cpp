@@ -5,8 +5,11 @@
 
 namespace Pina {
 
-GLTexture::GLTexture(const unsigned char* data, uint32_t width, uint32_t height, uint32_t channels)
-    : m_width(width), m_height(height), m_channels(channels) {
+GLTexture::GLTexture(const unsigned char* data, uint32_t width, uint32_t height, uint32_t channels,
+                     SHARED<GPUMemoryTracker> tracker)
+    : m_width(width), m_height(height), m_channels(channels)
+    , m_allocation(std::move(tracker), GPUResourceType::Texture,
+                   computeTextureBytes(width, height, channels, true)) {
 
     glGenTextures(1, &m_textureID);
     glBindTexture(GL_TEXTURE_2D, m_textureID);
@@ -56,7 +59,8 @@ GLTexture::GLTexture(GLTexture&& other) noexcept
     , m_width(other.m_width)
     , m_height(other.m_height)
     , m_channels(other.m_channels)
-    , m_boundSlot(other.m_boundSlot) {
+    , m_boundSlot(other.m_boundSlot)
+    , m_allocation(std::move(other.m_allocation)) {
     other.m_textureID = 0;
 }
 
@@ -73,6 +77,7 @@ GLTexture& GLTexture::operator=(GLTexture&& other) noexcept {
         m_height = other.m_height;
         m_channels = other.m_channels;
         m_boundSlot = other.m_boundSlot;
+        m_allocation = std::move(other.m_allocation);
 
         other.m_textureID = 0;
     }
@@ -3,6 +3,7 @@
 /// Pina Engine - OpenGL Texture Implementation
 
 #include "../Texture.h"
+#include "../GPUMemory.h"
 #include "GLCommon.h"
 
 namespace Pina {
@@ -15,7 +16,9 @@ public:
     /// @param width Image width in pixels
     /// @param height Image height in pixels
     /// @param channels Number of channels (3=RGB, 4=RGBA)
-    GLTexture(const unsigned char* data, uint32_t width, uint32_t height, uint32_t channels);
+    /// @param tracker GPU memory tracker to report to (optional)
+    GLTexture(const unsigned char* data, uint32_t width, uint32_t height, uint32_t channels,
+              SHARED<GPUMemoryTracker> tracker = nullptr);
     ~GLTexture() override;
 
     // No copying
@@ -46,6 +49,7 @@ private:
     uint32_t m_height = 0;
     uint32_t m_channels = 0;
     uint32_t m_boundSlot = 0;
+    GPUAllocation m_allocation;
 
     static GLenum toGLFilter(TextureFilter filter, bool minFilter);
     static GLenum toGLWrap(TextureWrap wrap);
@@ -43,60 +43,41 @@ public:
         if (!shader) {
             return;
         }
+        Shader* instancedShader = nullptr;
+        if (instancing) {
+            instancedShader = usePBR ? ctx.pbrInstancedShader : ctx.standardInstancedShader;
+        }
 
-        shader->bind();
-
-        // Upload camera matrices
-        shader->setMat4("uView", ctx.camera->getViewMatrix());
-        shader->setMat4("uProjection", ctx.camera->getProjectionMatrix());
-
-        // Upload lighting
+        // Upload the per-frame uniforms, leaving the main shader bound
         if (ctx.lights) {
             ctx.lights->setViewPosition(ctx.camera->getPosition());
-            ctx.lights->uploadToShader(shader);
         }
-
-        // Upload shadow map and uniforms if enabled
-        if (enableShadows && !shadowMapInput.empty() && ctx.lights) {
-            uint32_t shadowMapID = ctx.getDepthTextureID(shadowMapInput);
-            if (shadowMapID != 0) {
-                // Upload light space matrix and bind shadow map
-                ctx.lights->uploadShadowUniforms(shader, shadowMapID);
-                shader->setInt("uEnableShadows", 1);
-
-                // Upload shadow parameters from light
-                DirectionalLight* shadowLight = ctx.lights->getShadowCastingLight();
-                if (shadowLight) {
-                    shader->setFloat("uShadowBias", shadowLight->getShadowBias());
-                    shader->setFloat("uShadowNormalBias", shadowLight->getShadowNormalBias());
-                    shader->setFloat("uShadowSoftness", shadowLight->getShadowSoftness());
-                } else {
-                    shader->setFloat("uShadowBias", 0.005f);
-                    shader->setFloat("uShadowNormalBias", 0.02f);
-                    shader->setFloat("uShadowSoftness", 1.5f);
-                }
-            } else {
-                shader->setInt("uEnableShadows", 0);
-            }
-        } else {
-            shader->setInt("uEnableShadows", 0);
+        if (instancedShader) {
+            setupShader(ctx, instancedShader);
         }
+        setupShader(ctx, shader);
 
         // Set wireframe mode
         ctx.device->setWireframe(wireframe);
 
         // Render scene with two-pass rendering for proper transparency
         if (m_sceneRenderer) {
+            m_sceneRenderer->setFrustumCulling(frustumCulling);
+            m_sceneRenderer->setOcclusionCulling(occlusionCulling);
+            m_sceneRenderer->setTransparentNodeGrouping(groupTransparentByNode);
+            m_sceneRenderer->setJobSystem(jobSystem);
+            m_sceneRenderer->setInstancedShader(instancedShader);
+
             // Pass 1: Opaque objects
             ctx.device->setBlending(false);
             ctx.device->setDepthWrite(true);
-            m_sceneRenderer->renderOpaque(ctx.scene, shader);
+            m_sceneRenderer->renderOpaque(ctx.scene, shader, ctx.camera);
 
-            // Pass 2: Transparent objects (if enabled)
+            // Pass 2: Transparent objects back to front (if enabled)
             if (enableTransparency) {
                 ctx.device->setBlending(true);
                 ctx.device->setDepthWrite(false);
-                m_sceneRenderer->renderTransparent(ctx.scene, shader);
+                m_sceneRenderer->renderTransparent(ctx.scene, shader, ctx.camera);
                 ctx.device->setDepthWrite(true);
                 ctx.device->setBlending(false);
             }
@@ -119,13 +100,74 @@ public:
     /// Whether to enable transparency rendering
     bool enableTransparency = true;
 
+    /// Sort transparent meshes by their node's depth, keeping each node's
+    /// meshes together (default: by each mesh's own depth)
+    bool groupTransparentByNode = false;
+
     /// Whether to use PBR shader (vs standard Blinn-Phong)
     bool usePBR = false;
 
     /// Wireframe rendering mode
     bool wireframe = false;
 
+    /// Skip nodes whose world bounds are outside the camera frustum
+    bool frustumCulling = true;
+
+    /// Skip nodes hidden behind occluder meshes (CPU depth buffer)
+    bool occlusionCulling = false;
+
+    /// Draw nodes sharing a mesh and material with one instanced draw
+    /// (needs the instanced shaders in the context)
+    bool instancing = true;
+
+    /// Job system for the draw gather and occlusion culling (nullptr = render thread only)
+    JobSystem* jobSystem = nullptr;
+
+    /// Get the scene renderer (for visible/culled statistics)
+    SceneRenderer* getSceneRenderer() { return m_sceneRenderer.get(); }
+    const SceneRenderer* getSceneRenderer() const { return m_sceneRenderer.get(); }
+
 private:
+    /// Bind a shader and upload the camera, lights and shadow uniforms
+    void setupShader(RenderContext& ctx, Shader* shader) {
+        shader->bind();
+
+        // Upload camera matrices
+        shader->setMat4("uView", ctx.camera->getViewMatrix());
+        shader->setMat4("uProjection", ctx.camera->getProjectionMatrix());
+
+        // Upload lighting
+        if (ctx.lights) {
+            ctx.lights->uploadToShader(shader);
+        }
+
+        // Upload shadow map and uniforms if enabled
+        if (enableShadows && !shadowMapInput.empty() && ctx.lights) {
+            uint32_t shadowMapID = ctx.getDepthTextureID(shadowMapInput);
+            if (shadowMapID != 0) {
+                // Upload light space matrix and bind shadow map
+                ctx.lights->uploadShadowUniforms(shader, ctx.device, shadowMapID);
+                shader->setInt("uEnableShadows", 1);
+
+                // Upload shadow parameters from light
+                DirectionalLight* shadowLight = ctx.lights->getShadowCastingLight();
+                if (shadowLight) {
+                    shader->setFloat("uShadowBias", shadowLight->getShadowBias());
+                    shader->setFloat("uShadowNormalBias", shadowLight->getShadowNormalBias());
+                    shader->setFloat("uShadowSoftness", shadowLight->getShadowSoftness());
+                } else {
+                    shader->setFloat("uShadowBias", 0.005f);
+                    shader->setFloat("uShadowNormalBias", 0.02f);
+                    shader->setFloat("uShadowSoftness", 1.5f);
+                }
+            } else {
+                shader->setInt("uEnableShadows", 0);
+            }
+        } else {
+            shader->setInt("uEnableShadows", 0);
+        }
+    }
+
     UNIQUE<SceneRenderer> m_sceneRenderer;
 };
 
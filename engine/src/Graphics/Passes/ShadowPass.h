@@ -10,6 +10,9 @@
 #include "../../Core/Memory.h"
 #include "../../Scene/Scene.h"
 #include "../../Scene/Node.h"
+#include "../../Scene/NodeIterator.h"
+#include "../../Math/Frustum.h"
+#include "../../Math/SimdMath.h"
 #include "../Model.h"
 #include "../Lighting/DirectionalLight.h"
 #include <glm/glm.hpp>
@@ -119,9 +122,18 @@ public:
     /// Orthographic projection size (for directional lights)
     float orthoSize = 20.0f;
 
+    /// Skip casters whose world bounds are outside the light's view volume
+    bool frustumCulling = true;
+
     /// Get the computed light space matrix (for use in scene pass)
     const glm::mat4& getLightSpaceMatrix() const { return m_lightSpaceMatrix; }
 
+    /// Get number of shadow casters drawn last frame
+    size_t getRenderedCasterCount() const { return m_renderedCasterCount; }
+
+    /// Get number of shadow casters skipped by frustum culling last frame
+    size_t getCulledCasterCount() const { return m_culledCasterCount; }
+
 private:
     glm::mat4 calculateLightSpaceMatrix(RenderContext& ctx) {
         // Get the first shadow-casting directional light
@@ -169,17 +181,41 @@ private:
     }
 
     void renderSceneDepth(RenderContext& ctx, Shader* shader) {
+        m_renderedCasterCount = 0;
+        m_culledCasterCount = 0;
+
         if (!ctx.scene) return;
 
         Node* root = ctx.scene->getRoot();
         if (!root) return;
 
-        renderNodeDepthRecursive(root, shader);
-    }
+        // The light space matrix is the light's view-projection, so its
+        // frustum is the orthographic box the shadow map covers
+        SimdMath::FrustumPlanes planes;
+        if (frustumCulling) {
+            planes = SimdMath::preparePlanes(Frustum(m_lightSpaceMatrix));
+        }
 
-    void renderNodeDepthRecursive(Node* node, Shader* shader) {
-        if (!node || !node->isEnabled()) return;
+        // Enabled nodes only; a disabled node hides its subtree
+        for (NodeIterator it(root, true); it; ++it) {
+            Node* node = *it;
+            if (!node->getCastsShadow() || (!node->hasModel() && !node->hasMesh())) continue;
+
+            // Nodes without bounds are always drawn
+            if (frustumCulling) {
+                const BoundingBox& bounds = node->getTransform().getWorldBounds();
+                if (bounds.isValid() && !SimdMath::intersects(planes, bounds)) {
+                    m_culledCasterCount++;
+                    continue;
+                }
+            }
+
+            m_renderedCasterCount++;
+            renderNodeDepth(node, shader);
+        }
+    }
 
+    void renderNodeDepth(Node* node, Shader* shader) {
         // Only render nodes that cast shadows
         if (node->getCastsShadow()) {
             // Render model if present
@@ -204,11 +240,6 @@ private:
                 node->getMesh()->draw();
             }
         }
-
-        // Recursively process children
-        for (size_t i = 0; i < node->getChildCount(); ++i) {
-            renderNodeDepthRecursive(node->getChild(i), shader);
-        }
     }
 
     static const char* getShadowVertexShader() {
@@ -239,6 +270,8 @@ void main() {
 
     UNIQUE<Shader> m_shadowShader;
     glm::mat4 m_lightSpaceMatrix = glm::mat4(1.0f);
+    size_t m_renderedCasterCount = 0;
+    size_t m_culledCasterCount = 0;
 };
 
 } // namespace Pina
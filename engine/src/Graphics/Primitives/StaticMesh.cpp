@@ -9,7 +9,8 @@ StaticMesh::StaticMesh(GraphicsDevice* device,
                        const float* vertices,
                        uint32_t vertexCount,
                        const uint32_t* indices,
-                       uint32_t indexCount)
+                       uint32_t indexCount,
+                       bool keepCpuGeometry)
     : Mesh(device)
     , m_indexCount(indexCount)
 {
@@ -35,28 +36,91 @@ StaticMesh::StaticMesh(GraphicsDevice* device,
     layout.push("aTexCoord", ShaderDataType::Float2);
     m_vao->addVertexBuffer(m_vbo.get(), layout);
     m_vao->setIndexBuffer(m_ibo.get());
+
+    // Bounds for culling (positions are the first three floats of each vertex)
+    for (uint32_t i = 0; i < vertexCount; ++i) {
+        const float* position = vertices + i * 8;
+        m_boundingBox.expand(glm::vec3(position[0], position[1], position[2]));
+    }
+
+    if (keepCpuGeometry) {
+        m_positions.reserve(vertexCount);
+        for (uint32_t i = 0; i < vertexCount; ++i) {
+            const float* position = vertices + i * 8;
+            m_positions.emplace_back(position[0], position[1], position[2]);
+        }
+        m_indices.assign(indices, indices + indexCount);
+    }
 }
 
 void StaticMesh::draw() {
     m_device->drawIndexed(m_vao.get());
 }
 
+void StaticMesh::drawInstanced(const InstanceData* instances, uint32_t count) {
+    if (!instances || count == 0) return;
+
+    size_t size = count * sizeof(InstanceData);
+    if (!m_instanceVbo) {
+        // Attach after the vertex attributes, so the instance data starts at location 3
+        m_instanceVbo = m_device->createVertexBuffer(instances, size);
+        m_vao->addVertexBuffer(m_instanceVbo.get(), InstanceData::getLayout());
+    } else {
+        m_instanceVbo->setData(instances, size);
+    }
+    m_device->drawIndexedInstanced(m_vao.get(), count);
+}
+
+bool StaticMesh::buildBVH(JobSystem* jobs) {
+    if (!hasCpuGeometry()) return false;
+    m_bvh.build(m_positions.data(), m_indices.data(), m_indices.size() / 3, jobs);
+    return true;
+}
+
+bool StaticMesh::raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                         TriangleHit& hit) const {
+    if (m_bvh.isBuilt()) {
+        return m_bvh.raycast(m_positions.data(), m_indices.data(), origin, direction, maxDistance, hit);
+    }
+
+    bool found = false;
+    size_t triangleCount = m_positions.empty() ? 0 : m_indices.size() / 3;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        float distance, u, v;
+        if (MeshBVH::intersectTriangle(origin, direction, m_positions[m_indices[t * 3]],
+                                       m_positions[m_indices[t * 3 + 1]], m_positions[m_indices[t * 3 + 2]],
+                                       maxDistance, distance, u, v) &&
+            (!found || distance < maxDistance)) {
+            found = true;
+            maxDistance = distance;
+            hit.triangle = static_cast<uint32_t>(t);
+            hit.distance = distance;
+            hit.u = u;
+            hit.v = v;
+        }
+    }
+    return found;
+}
+
 UNIQUE<StaticMesh> StaticMesh::create(GraphicsDevice* device,
                                       const float* vertices,
                                       uint32_t vertexCount,
                                       const uint32_t* indices,
-                                      uint32_t indexCount) {
-    return UNIQUE<StaticMesh>(new StaticMesh(device, vertices, vertexCount, indices, indexCount));
+                                      uint32_t indexCount,
+                                      bool keepCpuGeometry) {
+    return UNIQUE<StaticMesh>(new StaticMesh(device, vertices, vertexCount, indices, indexCount,
+                                             keepCpuGeometry));
 }
 
 UNIQUE<StaticMesh> StaticMesh::create(GraphicsDevice* device,
                                       const std::vector<float>& vertices,
-                                      const std::vector<uint32_t>& indices) {
+                                      const std::vector<uint32_t>& indices,
+                                      bool keepCpuGeometry) {
     // Each vertex has 8 floats (pos + normal + texcoord)
     uint32_t vertexCount = static_cast<uint32_t>(vertices.size() / 8);
     uint32_t indexCount = static_cast<uint32_t>(indices.size());
 
-    return create(device, vertices.data(), vertexCount, indices.data(), indexCount);
+    return create(device, vertices.data(), vertexCount, indices.data(), indexCount, keepCpuGeometry);
 }
 
 } // namespace Pina
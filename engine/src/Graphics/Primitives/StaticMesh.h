@@ -4,11 +4,16 @@
 /// Mesh class for loaded 3D geometry with indexed rendering
 
 #include "../Mesh.h"
+#include "../InstanceData.h"
+#include "../../Math/BoundingBox.h"
+#include "../../Math/MeshBVH.h"
 #include <vector>
 #include <cstdint>
 
 namespace Pina {
 
+class JobSystem;
+
 /// Static mesh for loaded 3D geometry
 /// Uses indexed rendering for efficient vertex reuse
 class PINA_API StaticMesh : public Mesh {
@@ -19,35 +24,82 @@ public:
     /// @param vertexCount Number of vertices
     /// @param indices Index data
     /// @param indexCount Number of indices
+    /// @param keepCpuGeometry Keep a CPU copy of positions and indices
     /// @return Unique pointer to the created mesh
     static UNIQUE<StaticMesh> create(GraphicsDevice* device,
                                      const float* vertices,
                                      uint32_t vertexCount,
                                      const uint32_t* indices,
-                                     uint32_t indexCount);
+                                     uint32_t indexCount,
+                                     bool keepCpuGeometry = false);
 
     /// Create from vectors (convenience)
     static UNIQUE<StaticMesh> create(GraphicsDevice* device,
                                      const std::vector<float>& vertices,
-                                     const std::vector<uint32_t>& indices);
+                                     const std::vector<uint32_t>& indices,
+                                     bool keepCpuGeometry = false);
 
     ~StaticMesh() override = default;
 
     /// Draw using indexed rendering
     void draw();
 
+    /// Draw count instances in one call
+    /// The attributes are copied to the mesh's instance buffer (created on
+    /// first use), so the array may be reused as soon as this returns.
+    void drawInstanced(const InstanceData* instances, uint32_t count);
+
     /// Get index count
     uint32_t getIndexCount() const { return m_indexCount; }
 
+    /// Get the bounds of the vertex positions (local space)
+    const BoundingBox& getBoundingBox() const { return m_boundingBox; }
+
+    // ========================================================================
+    // CPU Geometry
+    // ========================================================================
+
+    /// Check if a CPU copy of the geometry was kept (needed for occlusion and raycasts)
+    bool hasCpuGeometry() const { return !m_positions.empty(); }
+
+    /// Get the vertex positions (empty without CPU geometry)
+    const std::vector<glm::vec3>& getPositions() const { return m_positions; }
+
+    /// Get the triangle indices (empty without CPU geometry)
+    const std::vector<uint32_t>& getIndices() const { return m_indices; }
+
+    /// Build the triangle BVH used by raycast() (needs CPU geometry)
+    /// @param jobs Job system for large meshes (nullptr = serial)
+    /// @return false without CPU geometry
+    bool buildBVH(JobSystem* jobs = nullptr);
+
+    /// Check if the triangle BVH was built
+    bool hasBVH() const { return m_bvh.isBuilt(); }
+
+    /// Get the triangle BVH (empty until buildBVH())
+    const MeshBVH& getBVH() const { return m_bvh; }
+
+    /// Find the nearest triangle hit by a local-space ray (see MeshBVH::raycast())
+    /// Uses the BVH if built, otherwise tests every triangle.
+    /// @return false if nothing is hit or the mesh has no CPU geometry
+    bool raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                 TriangleHit& hit) const;
+
 private:
     StaticMesh(GraphicsDevice* device,
                const float* vertices,
                uint32_t vertexCount,
                const uint32_t* indices,
-               uint32_t indexCount);
+               uint32_t indexCount,
+               bool keepCpuGeometry);
 
     UNIQUE<IndexBuffer> m_ibo;
+    UNIQUE<VertexBuffer> m_instanceVbo;     // Per-instance attributes (see drawInstanced())
     uint32_t m_indexCount = 0;
+    BoundingBox m_boundingBox;
+    std::vector<glm::vec3> m_positions;
+    std::vector<uint32_t> m_indices;
+    MeshBVH m_bvh;
 };
 
 } // namespace Pina
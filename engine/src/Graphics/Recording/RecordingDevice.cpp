@@ -0,0 +1,312 @@
+/// Pina Engine - Recording Graphics Device Implementation
+
+#include "RecordingDevice.h"
+#include "RecordingResources.h"
+#include <algorithm>
+
+namespace Pina {
+
+const char* toString(RecordedCommandType type) {
+    switch (type) {
+        case RecordedCommandType::BeginFrame:        return "BeginFrame";
+        case RecordedCommandType::EndFrame:          return "EndFrame";
+        case RecordedCommandType::Clear:             return "Clear";
+        case RecordedCommandType::SetViewport:       return "SetViewport";
+        case RecordedCommandType::SetDepthTest:      return "SetDepthTest";
+        case RecordedCommandType::SetBlending:       return "SetBlending";
+        case RecordedCommandType::SetWireframe:      return "SetWireframe";
+        case RecordedCommandType::SetDepthWrite:     return "SetDepthWrite";
+        case RecordedCommandType::BindShader:        return "BindShader";
+        case RecordedCommandType::UnbindShader:      return "UnbindShader";
+        case RecordedCommandType::BindVertexArray:   return "BindVertexArray";
+        case RecordedCommandType::UnbindVertexArray: return "UnbindVertexArray";
+        case RecordedCommandType::BindTexture:       return "BindTexture";
+        case RecordedCommandType::UnbindTexture:     return "UnbindTexture";
+        case RecordedCommandType::BindFramebuffer:   return "BindFramebuffer";
+        case RecordedCommandType::UnbindFramebuffer: return "UnbindFramebuffer";
+        case RecordedCommandType::SetUniform:        return "SetUniform";
+        case RecordedCommandType::UpdateBuffer:      return "UpdateBuffer";
+        case RecordedCommandType::ResizeFramebuffer: return "ResizeFramebuffer";
+        case RecordedCommandType::ClearFramebuffer:  return "ClearFramebuffer";
+        case RecordedCommandType::BlitFramebuffer:   return "BlitFramebuffer";
+        case RecordedCommandType::Draw:              return "Draw";
+        case RecordedCommandType::DrawIndexed:       return "DrawIndexed";
+        case RecordedCommandType::DrawIndexedInstanced: return "DrawIndexedInstanced";
+        case RecordedCommandType::Count:             break;
+    }
+    return "Unknown";
+}
+
+RecordingDevice::RecordingDevice() = default;
+
+RecordingDevice::~RecordingDevice() = default;
+
+// ============================================================================
+// Resource Creation
+// ============================================================================
+
+UNIQUE<Shader> RecordingDevice::createShader() {
+    return MAKE_UNIQUE<RecordingShader>(this);
+}
+
+UNIQUE<VertexBuffer> RecordingDevice::createVertexBuffer(const void* data, size_t size) {
+    (void)data;
+    return MAKE_UNIQUE<RecordingVertexBuffer>(this, size);
+}
+
+UNIQUE<IndexBuffer> RecordingDevice::createIndexBuffer(const uint32_t* indices, uint32_t count) {
+    (void)indices;
+    return MAKE_UNIQUE<RecordingIndexBuffer>(this, count);
+}
+
+UNIQUE<VertexArray> RecordingDevice::createVertexArray() {
+    return MAKE_UNIQUE<RecordingVertexArray>(this);
+}
+
+UNIQUE<Texture> RecordingDevice::createTexture(const unsigned char* data,
+                                               uint32_t width,
+                                               uint32_t height,
+                                               uint32_t channels) {
+    (void)data;
+    return MAKE_UNIQUE<RecordingTexture>(this, width, height, channels);
+}
+
+UNIQUE<Framebuffer> RecordingDevice::createFramebuffer(const FramebufferSpec& spec) {
+    return MAKE_UNIQUE<RecordingFramebuffer>(this, spec);
+}
+
+// ============================================================================
+// Frame Lifecycle
+// ============================================================================
+
+void RecordingDevice::beginFrame() {
+    record(RecordedCommandType::BeginFrame);
+}
+
+void RecordingDevice::endFrame() {
+    record(RecordedCommandType::EndFrame);
+}
+
+// ============================================================================
+// State Management
+// ============================================================================
+
+void RecordingDevice::clear(float r, float g, float b, float a) {
+    m_stats.clears++;
+
+    if (m_recording) {
+        RecordedCommand command;
+        command.type = RecordedCommandType::Clear;
+        command.resource = m_boundFramebuffer;
+        command.floats = glm::vec4(r, g, b, a);
+        push(std::move(command));
+    }
+}
+
+void RecordingDevice::setViewport(int x, int y, int width, int height) {
+    glm::ivec4 viewport(x, y, width, height);
+
+    m_stats.stateChanges++;
+    if (viewport == m_viewport) {
+        m_stats.redundantStateChanges++;
+    }
+    m_viewport = viewport;
+
+    if (m_recording) {
+        RecordedCommand command;
+        command.type = RecordedCommandType::SetViewport;
+        command.ints = viewport;
+        push(std::move(command));
+    }
+}
+
+void RecordingDevice::setDepthTest(bool enabled) {
+    recordState(RecordedCommandType::SetDepthTest, m_depthTest, enabled);
+}
+
+void RecordingDevice::setBlending(bool enabled) {
+    recordState(RecordedCommandType::SetBlending, m_blending, enabled);
+}
+
+void RecordingDevice::setWireframe(bool enabled) {
+    recordState(RecordedCommandType::SetWireframe, m_wireframe, enabled);
+}
+
+void RecordingDevice::setDepthWrite(bool enabled) {
+    recordState(RecordedCommandType::SetDepthWrite, m_depthWrite, enabled);
+}
+
+void RecordingDevice::bindTexture(uint32_t textureID, uint32_t slot) {
+    record(RecordedCommandType::BindTexture, textureID, slot);
+}
+
+// ============================================================================
+// Drawing
+// ============================================================================
+
+void RecordingDevice::draw(VertexArray* vao, uint32_t vertexCount) {
+    if (!vao) return;
+
+    vao->bind();
+    record(RecordedCommandType::Draw, vao->getID(), vertexCount);
+}
+
+void RecordingDevice::drawIndexed(VertexArray* vao) {
+    if (!vao) return;
+
+    vao->bind();
+    IndexBuffer* ibo = vao->getIndexBuffer();
+    if (ibo) {
+        record(RecordedCommandType::DrawIndexed, vao->getID(), ibo->getCount());
+    }
+}
+
+void RecordingDevice::drawIndexedInstanced(VertexArray* vao, uint32_t instanceCount) {
+    if (!vao) return;
+
+    vao->bind();
+    IndexBuffer* ibo = vao->getIndexBuffer();
+    if (!ibo || instanceCount == 0) return;
+
+    m_stats.drawCalls++;
+    m_stats.instancedDrawCalls++;
+    m_stats.instancesSubmitted += instanceCount;
+    m_stats.indicesSubmitted += static_cast<uint64_t>(ibo->getCount()) * instanceCount;
+
+    if (m_recording) {
+        RecordedCommand command;
+        command.type = RecordedCommandType::DrawIndexedInstanced;
+        command.resource = vao->getID();
+        command.count = ibo->getCount();
+        command.ints.x = static_cast<int>(instanceCount);
+        push(std::move(command));
+    }
+}
+
+// ============================================================================
+// Command Log
+// ============================================================================
+
+size_t RecordingDevice::countCommands(RecordedCommandType type) const {
+    return static_cast<size_t>(std::count_if(m_commands.begin(), m_commands.end(),
+        [type](const RecordedCommand& command) { return command.type == type; }));
+}
+
+std::vector<std::string> RecordingDevice::getUploadedUniforms() const {
+    std::vector<std::string> names;
+    for (const auto& command : m_commands) {
+        if (command.type == RecordedCommandType::SetUniform) {
+            names.push_back(command.name);
+        }
+    }
+    return names;
+}
+
+void RecordingDevice::reset() {
+    clearCommands();
+    resetStats();
+}
+
+// ============================================================================
+// Resource Interface
+// ============================================================================
+
+void RecordingDevice::record(RecordedCommandType type, uint32_t resource, uint32_t count) {
+    switch (type) {
+        case RecordedCommandType::EndFrame:
+            m_stats.frames++;
+            break;
+        case RecordedCommandType::BindShader:
+            m_stats.shaderBinds++;
+            m_boundShader = resource;
+            break;
+        case RecordedCommandType::UnbindShader:
+            m_boundShader = 0;
+            break;
+        case RecordedCommandType::BindVertexArray:
+            m_stats.vertexArrayBinds++;
+            m_boundVertexArray = resource;
+            break;
+        case RecordedCommandType::UnbindVertexArray:
+            m_boundVertexArray = 0;
+            break;
+        case RecordedCommandType::BindTexture:
+            m_stats.textureBinds++;
+            break;
+        case RecordedCommandType::BindFramebuffer:
+            m_stats.framebufferBinds++;
+            m_boundFramebuffer = resource;
+            break;
+        case RecordedCommandType::UnbindFramebuffer:
+            m_boundFramebuffer = 0;
+            break;
+        case RecordedCommandType::UpdateBuffer:
+            m_stats.bufferUpdates++;
+            break;
+        case RecordedCommandType::Draw:
+            m_stats.drawCalls++;
+            m_stats.verticesSubmitted += count;
+            break;
+        case RecordedCommandType::DrawIndexed:
+            m_stats.drawCalls++;
+            m_stats.indicesSubmitted += count;
+            break;
+        default:
+            break;
+    }
+
+    if (m_recording) {
+        RecordedCommand command;
+        command.type = type;
+        command.resource = resource;
+        command.count = count;
+        push(std::move(command));
+    }
+}
+
+void RecordingDevice::recordUniform(uint32_t shader, const std::string& name) {
+    m_stats.uniformUploads++;
+
+    if (m_recording) {
+        RecordedCommand command;
+        command.type = RecordedCommandType::SetUniform;
+        command.resource = shader;
+        command.name = name;
+        push(std::move(command));
+    }
+}
+
+void RecordingDevice::recordFramebufferClear(uint32_t framebuffer, const glm::vec4& color, float depth,
+                                             bool clearColor, bool clearDepth) {
+    m_stats.clears++;
+
+    if (m_recording) {
+        RecordedCommand command;
+        command.type = RecordedCommandType::ClearFramebuffer;
+        command.resource = framebuffer;
+        command.ints = glm::ivec4(clearColor ? 1 : 0, clearDepth ? 1 : 0, 0, 0);
+        command.floats = clearColor ? color : glm::vec4(depth);
+        push(std::move(command));
+    }
+}
+
+void RecordingDevice::push(RecordedCommand&& command) {
+    m_commands.push_back(std::move(command));
+}
+
+void RecordingDevice::recordState(RecordedCommandType type, bool& current, bool enabled) {
+    m_stats.stateChanges++;
+    if (current == enabled) {
+        m_stats.redundantStateChanges++;
+    }
+    current = enabled;
+
+    if (m_recording) {
+        RecordedCommand command;
+        command.type = type;
+        command.ints.x = enabled ? 1 : 0;
+        push(std::move(command));
+    }
+}
+
+} // namespace Pina
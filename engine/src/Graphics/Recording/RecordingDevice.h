@@ -0,0 +1,204 @@
+#pragma once
+
+/// Pina Engine - Recording Graphics Device
+/// GPU-less device that records draw calls, state changes and uniform
+/// uploads into an inspectable command log (headless runs, CI, benchmarks)
+
+#include "../GraphicsDevice.h"
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
+
+namespace Pina {
+
+/// Type of a recorded device command
+enum class RecordedCommandType : uint8_t {
+    // Frame lifecycle
+    BeginFrame,
+    EndFrame,
+
+    // Device state
+    Clear,
+    SetViewport,
+    SetDepthTest,
+    SetBlending,
+    SetWireframe,
+    SetDepthWrite,
+
+    // Resource binding
+    BindShader,
+    UnbindShader,
+    BindVertexArray,
+    UnbindVertexArray,
+    BindTexture,
+    UnbindTexture,
+    BindFramebuffer,
+    UnbindFramebuffer,
+
+    // Uniforms
+    SetUniform,
+
+    // Resource updates
+    UpdateBuffer,
+    ResizeFramebuffer,
+    ClearFramebuffer,
+    BlitFramebuffer,
+
+    // Drawing
+    Draw,
+    DrawIndexed,
+    DrawIndexedInstanced,
+
+    Count
+};
+
+/// Get a readable name for a command type
+PINA_API const char* toString(RecordedCommandType type);
+
+/// Single entry in the command log
+struct PINA_API RecordedCommand {
+    RecordedCommandType type = RecordedCommandType::BeginFrame;
+    uint32_t resource = 0;              // Shader/VAO/texture/framebuffer ID (0 = default/none)
+    uint32_t count = 0;                 // Vertex/index count, texture slot, buffer size
+    glm::ivec4 ints = glm::ivec4(0);    // Viewport rect, state flags, instance count (x)
+    glm::vec4 floats = glm::vec4(0.0f); // Clear color / depth
+    std::string name;                   // Uniform name (SetUniform only)
+};
+
+/// Aggregate counters, kept even when the command log is disabled
+struct PINA_API RecordingStats {
+    uint32_t frames = 0;
+    uint32_t drawCalls = 0;             // draw() + drawIndexed() + drawIndexedInstanced()
+    uint32_t instancedDrawCalls = 0;    // drawIndexedInstanced()
+    uint64_t instancesSubmitted = 0;    // Instances from instanced draws
+    uint64_t verticesSubmitted = 0;     // Vertices from non-indexed draws
+    uint64_t indicesSubmitted = 0;      // Indices from indexed draws (times instances)
+    uint32_t clears = 0;
+    uint32_t stateChanges = 0;          // Viewport/depth/blend/wireframe/depth-write calls
+    uint32_t redundantStateChanges = 0; // State calls that did not change anything
+    uint32_t shaderBinds = 0;
+    uint32_t vertexArrayBinds = 0;
+    uint32_t textureBinds = 0;
+    uint32_t framebufferBinds = 0;
+    uint32_t uniformUploads = 0;
+    uint32_t bufferUpdates = 0;
+};
+
+/// Graphics device that records instead of rendering
+/// Every resource it creates reports back to it, so the log captures the
+/// full command stream of RenderPipeline, passes and SceneRenderer.
+/// Disable recording to run as a pure null device (counters only).
+class PINA_API RecordingDevice : public GraphicsDevice {
+public:
+    RecordingDevice();
+    ~RecordingDevice() override;
+
+    // Resource Creation
+    UNIQUE<Shader> createShader() override;
+    UNIQUE<VertexBuffer> createVertexBuffer(const void* data, size_t size) override;
+    UNIQUE<IndexBuffer> createIndexBuffer(const uint32_t* indices, uint32_t count) override;
+    UNIQUE<VertexArray> createVertexArray() override;
+    UNIQUE<Texture> createTexture(const unsigned char* data,
+                                  uint32_t width,
+                                  uint32_t height,
+                                  uint32_t channels) override;
+    UNIQUE<Framebuffer> createFramebuffer(const FramebufferSpec& spec) override;
+
+    // Frame Lifecycle
+    void beginFrame() override;
+    void endFrame() override;
+
+    // State Management
+    void clear(float r, float g, float b, float a = 1.0f) override;
+    void setViewport(int x, int y, int width, int height) override;
+    void setDepthTest(bool enabled) override;
+    void setBlending(bool enabled) override;
+    void setWireframe(bool enabled) override;
+    void setDepthWrite(bool enabled) override;
+    void bindTexture(uint32_t textureID, uint32_t slot) override;
+
+    // Drawing
+    void draw(VertexArray* vao, uint32_t vertexCount) override;
+    void drawIndexed(VertexArray* vao) override;
+    void drawIndexedInstanced(VertexArray* vao, uint32_t instanceCount) override;
+
+    // ========================================================================
+    // Command Log
+    // ========================================================================
+
+    /// Enable/disable appending to the command log (stats are always kept)
+    void setRecording(bool enabled) { m_recording = enabled; }
+    bool isRecording() const { return m_recording; }
+
+    /// Get all recorded commands in submission order
+    const std::vector<RecordedCommand>& getCommands() const { return m_commands; }
+
+    /// Count recorded commands of a given type
+    size_t countCommands(RecordedCommandType type) const;
+
+    /// Get uniform names uploaded since the log was last cleared, in order
+    std::vector<std::string> getUploadedUniforms() const;
+
+    /// Clear the command log (stats are kept)
+    void clearCommands() { m_commands.clear(); }
+
+    /// Get aggregate counters
+    const RecordingStats& getStats() const { return m_stats; }
+
+    /// Reset aggregate counters
+    void resetStats() { m_stats = RecordingStats(); }
+
+    /// Clear the command log and reset counters
+    void reset();
+
+    // ========================================================================
+    // Tracked State
+    // ========================================================================
+
+    uint32_t getBoundShader() const { return m_boundShader; }
+    uint32_t getBoundVertexArray() const { return m_boundVertexArray; }
+    uint32_t getBoundFramebuffer() const { return m_boundFramebuffer; }
+    bool isDepthTestEnabled() const { return m_depthTest; }
+    bool isBlendingEnabled() const { return m_blending; }
+    bool isWireframeEnabled() const { return m_wireframe; }
+    bool isDepthWriteEnabled() const { return m_depthWrite; }
+    glm::ivec4 getViewport() const { return m_viewport; }
+
+    // ========================================================================
+    // Resource Interface (used by recording resources)
+    // ========================================================================
+
+    /// Allocate a unique non-zero resource ID
+    uint32_t allocateID() { return m_nextID++; }
+
+    /// Record a command and update counters/tracked state
+    void record(RecordedCommandType type, uint32_t resource = 0, uint32_t count = 0);
+
+    /// Record a uniform upload on a shader
+    void recordUniform(uint32_t shader, const std::string& name);
+
+    /// Record a framebuffer clear
+    void recordFramebufferClear(uint32_t framebuffer, const glm::vec4& color, float depth,
+                                bool clearColor, bool clearDepth);
+
+private:
+    void push(RecordedCommand&& command);
+    void recordState(RecordedCommandType type, bool& current, bool enabled);
+
+    std::vector<RecordedCommand> m_commands;
+    RecordingStats m_stats;
+    bool m_recording = true;
+    uint32_t m_nextID = 1;
+
+    // Tracked state (mirrors GLDevice defaults)
+    uint32_t m_boundShader = 0;
+    uint32_t m_boundVertexArray = 0;
+    uint32_t m_boundFramebuffer = 0;
+    bool m_depthTest = true;
+    bool m_blending = false;
+    bool m_wireframe = false;
+    bool m_depthWrite = true;
+    glm::ivec4 m_viewport = glm::ivec4(0);
+};
+
+} // namespace Pina
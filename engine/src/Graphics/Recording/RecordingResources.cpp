@@ -0,0 +1,218 @@
+/// Pina Engine - Recording Resource Implementations
+
+#include "RecordingResources.h"
+#include "RecordingDevice.h"
+
+namespace Pina {
+
+// ============================================================================
+// RecordingShader
+// ============================================================================
+
+RecordingShader::RecordingShader(RecordingDevice* device)
+    : m_device(device)
+    , m_id(device->allocateID())
+{
+}
+
+bool RecordingShader::load(const std::string& vertexSrc, const std::string& fragmentSrc) {
+    m_loaded = !vertexSrc.empty() && !fragmentSrc.empty();
+    return m_loaded;
+}
+
+void RecordingShader::bind() {
+    m_device->record(RecordedCommandType::BindShader, m_id);
+}
+
+void RecordingShader::unbind() {
+    m_device->record(RecordedCommandType::UnbindShader, m_id);
+}
+
+void RecordingShader::setInt(const std::string& name, int value) {
+    upload(name, value);
+}
+
+void RecordingShader::setFloat(const std::string& name, float value) {
+    upload(name, value);
+}
+
+void RecordingShader::setVec2(const std::string& name, const glm::vec2& value) {
+    upload(name, value);
+}
+
+void RecordingShader::setVec3(const std::string& name, const glm::vec3& value) {
+    upload(name, value);
+}
+
+void RecordingShader::setVec4(const std::string& name, const glm::vec4& value) {
+    upload(name, value);
+}
+
+void RecordingShader::setMat3(const std::string& name, const glm::mat3& value) {
+    upload(name, value);
+}
+
+void RecordingShader::setMat4(const std::string& name, const glm::mat4& value) {
+    upload(name, value);
+}
+
+const RecordedUniform* RecordingShader::getUniform(const std::string& name) const {
+    auto it = m_uniforms.find(name);
+    return it != m_uniforms.end() ? &it->second : nullptr;
+}
+
+void RecordingShader::upload(const std::string& name, const RecordedUniform& value) {
+    m_device->recordUniform(m_id, name);
+    m_uniforms[name] = value;
+}
+
+// ============================================================================
+// RecordingVertexBuffer
+// ============================================================================
+
+RecordingVertexBuffer::RecordingVertexBuffer(RecordingDevice* device, size_t size)
+    : m_device(device)
+    , m_id(device->allocateID())
+    , m_size(size)
+    , m_allocation(device->getGPUMemoryTracker(), GPUResourceType::VertexBuffer, size)
+{
+}
+
+void RecordingVertexBuffer::setData(const void* data, size_t size) {
+    (void)data;
+    m_size = size;
+    m_allocation.resize(size);
+    m_device->record(RecordedCommandType::UpdateBuffer, m_id, static_cast<uint32_t>(size));
+}
+
+// ============================================================================
+// RecordingIndexBuffer
+// ============================================================================
+
+RecordingIndexBuffer::RecordingIndexBuffer(RecordingDevice* device, uint32_t count)
+    : m_id(device->allocateID())
+    , m_count(count)
+    , m_allocation(device->getGPUMemoryTracker(), GPUResourceType::IndexBuffer, count * sizeof(uint32_t))
+{
+}
+
+// ============================================================================
+// RecordingVertexArray
+// ============================================================================
+
+RecordingVertexArray::RecordingVertexArray(RecordingDevice* device)
+    : m_device(device)
+    , m_id(device->allocateID())
+{
+}
+
+void RecordingVertexArray::bind() {
+    m_device->record(RecordedCommandType::BindVertexArray, m_id);
+}
+
+void RecordingVertexArray::unbind() {
+    m_device->record(RecordedCommandType::UnbindVertexArray, m_id);
+}
+
+void RecordingVertexArray::addVertexBuffer(VertexBuffer* buffer, const VertexLayout& layout) {
+    (void)layout;
+    if (buffer) {
+        m_vertexBuffers.push_back(buffer);
+    }
+}
+
+// ============================================================================
+// RecordingTexture
+// ============================================================================
+
+RecordingTexture::RecordingTexture(RecordingDevice* device, uint32_t width, uint32_t height, uint32_t channels)
+    : m_device(device)
+    , m_id(device->allocateID())
+    , m_width(width)
+    , m_height(height)
+    , m_channels(channels)
+    , m_allocation(device->getGPUMemoryTracker(), GPUResourceType::Texture,
+                   computeTextureBytes(width, height, channels, true))
+{
+}
+
+void RecordingTexture::bind(uint32_t slot) {
+    m_slot = slot;
+    m_device->record(RecordedCommandType::BindTexture, m_id, slot);
+}
+
+void RecordingTexture::unbind() {
+    m_device->record(RecordedCommandType::UnbindTexture, m_id, m_slot);
+}
+
+// ============================================================================
+// RecordingFramebuffer
+// ============================================================================
+
+RecordingFramebuffer::RecordingFramebuffer(RecordingDevice* device, const FramebufferSpec& spec)
+    : m_device(device)
+    , m_spec(spec)
+    , m_id(device->allocateID())
+    , m_allocation(device->getGPUMemoryTracker(), GPUResourceType::Framebuffer, computeFramebufferBytes(spec))
+{
+    for (TextureFormat format : m_spec.colorAttachments) {
+        if (format != TextureFormat::None && !isDepthFormat(format)) {
+            m_colorAttachments.push_back(device->allocateID());
+        }
+    }
+
+    if (m_spec.depthAttachment != TextureFormat::None) {
+        m_depthAttachment = device->allocateID();
+    }
+}
+
+void RecordingFramebuffer::bind() {
+    m_device->record(RecordedCommandType::BindFramebuffer, m_id);
+    m_device->setViewport(0, 0, m_spec.width, m_spec.height);
+}
+
+void RecordingFramebuffer::unbind() {
+    m_device->record(RecordedCommandType::UnbindFramebuffer, m_id);
+}
+
+uint32_t RecordingFramebuffer::getColorAttachmentID(int index) const {
+    if (index < 0 || index >= static_cast<int>(m_colorAttachments.size())) {
+        return 0;
+    }
+    return m_colorAttachments[index];
+}
+
+void RecordingFramebuffer::resize(int width, int height) {
+    if (width <= 0 || height <= 0) return;
+    if (width == m_spec.width && height == m_spec.height) return;
+
+    m_spec.width = width;
+    m_spec.height = height;
+    m_allocation.resize(computeFramebufferBytes(m_spec));
+    m_device->record(RecordedCommandType::ResizeFramebuffer, m_id);
+}
+
+void RecordingFramebuffer::clearColor(float r, float g, float b, float a) {
+    m_device->recordFramebufferClear(m_id, glm::vec4(r, g, b, a), 1.0f, true, false);
+}
+
+void RecordingFramebuffer::clearDepth(float depth) {
+    m_device->recordFramebufferClear(m_id, glm::vec4(0.0f), depth, false, true);
+}
+
+void RecordingFramebuffer::clear(float r, float g, float b, float a, float depth) {
+    m_device->recordFramebufferClear(m_id, glm::vec4(r, g, b, a), depth, true, true);
+}
+
+void RecordingFramebuffer::blitTo(Framebuffer* target, bool blitColor, bool blitDepth) {
+    (void)blitColor;
+    (void)blitDepth;
+
+    // Blits to the default framebuffer record target ID 0
+    auto* recordingTarget = dynamic_cast<RecordingFramebuffer*>(target);
+    uint32_t targetID = recordingTarget ? recordingTarget->getID() : 0;
+
+    m_device->record(RecordedCommandType::BlitFramebuffer, m_id, targetID);
+}
+
+} // namespace Pina
@@ -0,0 +1,200 @@
+#pragma once
+
+/// Pina Engine - Recording Resource Implementations
+/// GPU-less shader, buffer, texture and framebuffer objects that report
+/// every bind, upload and operation to their RecordingDevice
+
+#include "../Shader.h"
+#include "../Buffer.h"
+#include "../Texture.h"
+#include "../Framebuffer.h"
+#include "../GPUMemory.h"
+#include <glm/glm.hpp>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace Pina {
+
+class RecordingDevice;
+
+/// Last value uploaded to a uniform (same alternatives as ShaderPass uniforms)
+using RecordedUniform = std::variant<int, float, glm::vec2, glm::vec3, glm::vec4, glm::mat3, glm::mat4>;
+
+/// Recording shader - keeps the last value of every uniform
+class PINA_API RecordingShader : public Shader {
+public:
+    explicit RecordingShader(RecordingDevice* device);
+    ~RecordingShader() override = default;
+
+    bool load(const std::string& vertexSrc, const std::string& fragmentSrc) override;
+    void bind() override;
+    void unbind() override;
+
+    void setInt(const std::string& name, int value) override;
+    void setFloat(const std::string& name, float value) override;
+    void setVec2(const std::string& name, const glm::vec2& value) override;
+    void setVec3(const std::string& name, const glm::vec3& value) override;
+    void setVec4(const std::string& name, const glm::vec4& value) override;
+    void setMat3(const std::string& name, const glm::mat3& value) override;
+    void setMat4(const std::string& name, const glm::mat4& value) override;
+
+    uint32_t getID() const override { return m_id; }
+
+    /// Check if source was loaded
+    bool isLoaded() const { return m_loaded; }
+
+    /// Get the last uploaded value of a uniform (nullptr if never set)
+    const RecordedUniform* getUniform(const std::string& name) const;
+
+    /// Get all uniforms uploaded so far
+    const std::unordered_map<std::string, RecordedUniform>& getUniforms() const { return m_uniforms; }
+
+private:
+    void upload(const std::string& name, const RecordedUniform& value);
+
+    RecordingDevice* m_device = nullptr;
+    uint32_t m_id = 0;
+    bool m_loaded = false;
+    std::unordered_map<std::string, RecordedUniform> m_uniforms;
+};
+
+/// Recording vertex buffer
+class PINA_API RecordingVertexBuffer : public VertexBuffer {
+public:
+    RecordingVertexBuffer(RecordingDevice* device, size_t size);
+    ~RecordingVertexBuffer() override = default;
+
+    void bind() override {}
+    void unbind() override {}
+    void setData(const void* data, size_t size) override;
+
+    uint32_t getID() const override { return m_id; }
+    size_t getSize() const { return m_size; }
+
+private:
+    RecordingDevice* m_device = nullptr;
+    uint32_t m_id = 0;
+    size_t m_size = 0;
+    GPUAllocation m_allocation;
+};
+
+/// Recording index buffer
+class PINA_API RecordingIndexBuffer : public IndexBuffer {
+public:
+    RecordingIndexBuffer(RecordingDevice* device, uint32_t count);
+    ~RecordingIndexBuffer() override = default;
+
+    void bind() override {}
+    void unbind() override {}
+
+    uint32_t getCount() const override { return m_count; }
+    uint32_t getID() const override { return m_id; }
+
+private:
+    uint32_t m_id = 0;
+    uint32_t m_count = 0;
+    GPUAllocation m_allocation;
+};
+
+/// Recording vertex array
+class PINA_API RecordingVertexArray : public VertexArray {
+public:
+    explicit RecordingVertexArray(RecordingDevice* device);
+    ~RecordingVertexArray() override = default;
+
+    void bind() override;
+    void unbind() override;
+
+    void addVertexBuffer(VertexBuffer* buffer, const VertexLayout& layout) override;
+    void setIndexBuffer(IndexBuffer* buffer) override { m_indexBuffer = buffer; }
+    IndexBuffer* getIndexBuffer() const override { return m_indexBuffer; }
+
+    uint32_t getID() const override { return m_id; }
+
+    /// Get attached vertex buffers
+    const std::vector<VertexBuffer*>& getVertexBuffers() const { return m_vertexBuffers; }
+
+private:
+    RecordingDevice* m_device = nullptr;
+    uint32_t m_id = 0;
+    std::vector<VertexBuffer*> m_vertexBuffers;
+    IndexBuffer* m_indexBuffer = nullptr;
+};
+
+/// Recording texture
+class PINA_API RecordingTexture : public Texture {
+public:
+    RecordingTexture(RecordingDevice* device, uint32_t width, uint32_t height, uint32_t channels);
+    ~RecordingTexture() override = default;
+
+    void bind(uint32_t slot = 0) override;
+    void unbind() override;
+
+    uint32_t getWidth() const override { return m_width; }
+    uint32_t getHeight() const override { return m_height; }
+    uint32_t getChannels() const override { return m_channels; }
+    uint32_t getID() const override { return m_id; }
+
+private:
+    RecordingDevice* m_device = nullptr;
+    uint32_t m_id = 0;
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    uint32_t m_channels = 0;
+    uint32_t m_slot = 0;
+    GPUAllocation m_allocation;
+};
+
+/// Recording framebuffer
+class PINA_API RecordingFramebuffer : public Framebuffer {
+public:
+    RecordingFramebuffer(RecordingDevice* device, const FramebufferSpec& spec);
+    ~RecordingFramebuffer() override = default;
+
+    // ========================================================================
+    // Binding
+    // ========================================================================
+
+    void bind() override;
+    void unbind() override;
+
+    // ========================================================================
+    // Properties
+    // ========================================================================
+
+    int getWidth() const override { return m_spec.width; }
+    int getHeight() const override { return m_spec.height; }
+    const FramebufferSpec& getSpec() const override { return m_spec; }
+
+    // ========================================================================
+    // Attachments
+    // ========================================================================
+
+    uint32_t getColorAttachmentID(int index = 0) const override;
+    uint32_t getDepthAttachmentID() const override { return m_depthAttachment; }
+    int getColorAttachmentCount() const override { return static_cast<int>(m_colorAttachments.size()); }
+
+    // ========================================================================
+    // Operations
+    // ========================================================================
+
+    void resize(int width, int height) override;
+    void clearColor(float r, float g, float b, float a = 1.0f) override;
+    void clearDepth(float depth = 1.0f) override;
+    void clear(float r, float g, float b, float a = 1.0f, float depth = 1.0f) override;
+    void blitTo(Framebuffer* target, bool blitColor = true, bool blitDepth = false) override;
+
+    uint32_t getID() const { return m_id; }
+
+private:
+    RecordingDevice* m_device = nullptr;
+    FramebufferSpec m_spec;
+    uint32_t m_id = 0;
+    std::vector<uint32_t> m_colorAttachments;
+    uint32_t m_depthAttachment = 0;
+    GPUAllocation m_allocation;
+};
+
+} // namespace Pina
@@ -8,6 +8,7 @@
 #include "../Scene/Scene.h"
 #include "../Graphics/Camera.h"
 #include "../Graphics/Lighting/LightManager.h"
+#include "../Core/Profiler.h"
 #include <iostream>
 
 namespace Pina {
@@ -68,6 +69,7 @@ RenderCompositor::~RenderCompositor() {
 
 void RenderCompositor::addPass(UNIQUE<RenderPass> pass) {
     pass->initialize(m_context);
+    pass->getProfileName();
     m_passes.push_back(std::move(pass));
 }
 
@@ -76,6 +78,7 @@ void RenderCompositor::insertPass(UNIQUE<RenderPass> pass, size_t index) {
         index = m_passes.size();
     }
     pass->initialize(m_context);
+    pass->getProfileName();
     m_passes.insert(m_passes.begin() + static_cast<ptrdiff_t>(index), std::move(pass));
 }
 
@@ -129,11 +132,14 @@ void RenderCompositor::render(Scene* scene, Camera* camera, float deltaTime) {
 }
 
 void RenderCompositor::render(Scene* scene, Camera* camera, float deltaTime,
-                               Shader* standardShader, Shader* pbrShader, Shader* shadowShader) {
+                               Shader* standardShader, Shader* pbrShader, Shader* shadowShader,
+                               Shader* standardInstancedShader, Shader* pbrInstancedShader) {
     if (!scene || !camera) {
         return;
     }
 
+    PINA_PROFILE_SCOPE("RenderCompositor::render");
+
     // Update context
     m_context.scene = scene;
     m_context.camera = camera;
@@ -146,6 +152,8 @@ void RenderCompositor::render(Scene* scene, Camera* camera, float deltaTime,
     m_context.standardShader = standardShader;
     m_context.pbrShader = pbrShader;
     m_context.shadowShader = shadowShader;
+    m_context.standardInstancedShader = standardInstancedShader;
+    m_context.pbrInstancedShader = pbrInstancedShader;
 
     // Reset ping-pong buffers
     m_readBuffer = m_pingBuffer.get();
@@ -171,7 +179,10 @@ void RenderCompositor::render(Scene* scene, Camera* camera, float deltaTime,
         }
 
         // Execute the pass
-        pass->execute(m_context);
+        {
+            PINA_PROFILE_SCOPE(pass->getProfileName());
+            pass->execute(m_context);
+        }
 
         // Swap buffers if needed
         if (pass->needsSwap && !pass->renderToScreen) {
@@ -23,7 +23,7 @@ class VertexBuffer;
 class Shader;
 
 /// Manages render pass chain
-class PINA_API RenderCompositor {
+class PINA_API RenderCompositor : public TrackedObject<MemoryTag::Render> {
 public:
     explicit RenderCompositor(GraphicsDevice* device);
     ~RenderCompositor();
@@ -92,8 +92,11 @@ public:
     /// @param standardShader Standard Blinn-Phong shader
     /// @param pbrShader PBR shader
     /// @param shadowShader Shadow depth shader
+    /// @param standardInstancedShader Instanced standard shader (nullptr = no instancing)
+    /// @param pbrInstancedShader Instanced PBR shader (nullptr = no instancing)
     void render(Scene* scene, Camera* camera, float deltaTime,
-                Shader* standardShader, Shader* pbrShader, Shader* shadowShader);
+                Shader* standardShader, Shader* pbrShader, Shader* shadowShader,
+                Shader* standardInstancedShader = nullptr, Shader* pbrInstancedShader = nullptr);
 
     /// Handle viewport resize
     void resize(int width, int height);
@@ -117,6 +117,10 @@ struct PINA_API RenderContext {
     /// PBR shader
     Shader* pbrShader = nullptr;
 
+    /// Instanced variants of the standard and PBR shaders
+    Shader* standardInstancedShader = nullptr;
+    Shader* pbrInstancedShader = nullptr;
+
     /// Shadow depth shader
     Shader* shadowShader = nullptr;
 
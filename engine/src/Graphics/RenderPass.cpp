@@ -4,9 +4,17 @@
 #include "RenderContext.h"
 #include "Framebuffer.h"
 #include "GraphicsDevice.h"
+#include "../Core/Profiler.h"
 
 namespace Pina {
 
+const char* RenderPass::getProfileName() {
+    if (!m_profileName || name != m_profileName) {
+        m_profileName = Profiler::intern(name);
+    }
+    return m_profileName;
+}
+
 void RenderPass::bindOutput(RenderContext& ctx) {
     if (renderToScreen) {
         // Bind default framebuffer (screen)
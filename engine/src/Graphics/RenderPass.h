@@ -14,7 +14,7 @@ namespace Pina {
 struct RenderContext;
 
 /// Abstract base class for all render passes
-class PINA_API RenderPass {
+class PINA_API RenderPass : public TrackedObject<MemoryTag::Render> {
 public:
     virtual ~RenderPass() = default;
 
@@ -66,10 +66,18 @@ public:
     /// Clear depth buffer (if clear is true)
     bool clearDepth = true;
 
+    /// Interned copy of name for profile scopes
+    /// Interned when the pass is added to a compositor and again only after a
+    /// rename, so per-frame scopes skip the profiler's name registry lock.
+    const char* getProfileName();
+
 protected:
     /// Helper to bind the correct output target
     /// Binds screen (FBO 0) if renderToScreen, otherwise writeBuffer
     void bindOutput(RenderContext& ctx);
+
+private:
+    const char* m_profileName = nullptr;
 };
 
 } // namespace Pina
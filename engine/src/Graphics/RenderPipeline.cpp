@@ -55,6 +55,25 @@ void RenderPipeline::createDefaultShaders() {
         }
     }
 
+    // Instanced variants (same fragment shaders, per-instance matrices)
+    m_standardInstancedShader = m_device->createShader();
+    if (m_standardInstancedShader) {
+        if (!m_standardInstancedShader->load(
+            ShaderLibrary::getStandardInstancedVertexShader(),
+            ShaderLibrary::getStandardFragmentShader())) {
+            std::cerr << "RenderPipeline: Failed to create instanced standard shader" << std::endl;
+        }
+    }
+
+    m_pbrInstancedShader = m_device->createShader();
+    if (m_pbrInstancedShader) {
+        if (!m_pbrInstancedShader->load(
+            ShaderLibrary::getPBRInstancedVertexShader(),
+            ShaderLibrary::getPBRFragmentShader())) {
+            std::cerr << "RenderPipeline: Failed to create instanced PBR shader" << std::endl;
+        }
+    }
+
     // Shadow shader is created by ShadowPass itself
 }
 
@@ -116,7 +135,9 @@ void RenderPipeline::render(Scene* scene, Camera* camera, float deltaTime) {
     m_compositor->render(scene, camera, deltaTime,
                          m_standardShader.get(),
                          m_pbrShader.get(),
-                         m_shadowShader.get());
+                         m_shadowShader.get(),
+                         m_standardInstancedShader.get(),
+                         m_pbrInstancedShader.get());
 }
 
 void RenderPipeline::resize(int width, int height) {
@@ -234,6 +255,36 @@ bool RenderPipeline::getPBREnabled() const {
     return m_scenePass ? m_scenePass->usePBR : false;
 }
 
+void RenderPipeline::setOcclusionCullingEnabled(bool enabled) {
+    if (m_scenePass) {
+        m_scenePass->occlusionCulling = enabled;
+    }
+}
+
+bool RenderPipeline::getOcclusionCullingEnabled() const {
+    return m_scenePass ? m_scenePass->occlusionCulling : false;
+}
+
+void RenderPipeline::setInstancingEnabled(bool enabled) {
+    if (m_scenePass) {
+        m_scenePass->instancing = enabled;
+    }
+}
+
+bool RenderPipeline::getInstancingEnabled() const {
+    return m_scenePass ? m_scenePass->instancing : false;
+}
+
+void RenderPipeline::setJobSystem(JobSystem* jobs) {
+    if (m_scenePass) {
+        m_scenePass->jobSystem = jobs;
+    }
+}
+
+JobSystem* RenderPipeline::getJobSystem() const {
+    return m_scenePass ? m_scenePass->jobSystem : nullptr;
+}
+
 // ========================================================================
 // Pass Access
 // ========================================================================
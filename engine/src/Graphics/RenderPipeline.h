@@ -15,6 +15,7 @@ namespace Pina {
 // Forward declarations
 class Scene;
 class Camera;
+class JobSystem;
 class ClearPass;
 class ScenePass;
 class ShadowPass;
@@ -24,7 +25,7 @@ class FXAAPass;
 
 /// High-level rendering pipeline with sensible defaults
 /// Provides simple API for common rendering tasks
-class PINA_API RenderPipeline {
+class PINA_API RenderPipeline : public TrackedObject<MemoryTag::Render> {
 public:
     explicit RenderPipeline(GraphicsDevice* device);
     ~RenderPipeline();
@@ -81,6 +82,19 @@ public:
     void setPBREnabled(bool enabled);
     bool getPBREnabled() const;
 
+    /// Enable/disable CPU occlusion culling in the scene pass
+    void setOcclusionCullingEnabled(bool enabled);
+    bool getOcclusionCullingEnabled() const;
+
+    /// Enable/disable instanced draws of nodes sharing a mesh and material
+    void setInstancingEnabled(bool enabled);
+    bool getInstancingEnabled() const;
+
+    /// Run the scene pass's draw gather and occlusion culling on a job
+    /// system (nullptr = render thread only; Application sets its own)
+    void setJobSystem(JobSystem* jobs);
+    JobSystem* getJobSystem() const;
+
     // ========================================================================
     // Advanced Access
     // ========================================================================
@@ -96,6 +110,8 @@ public:
     Shader* getStandardShader() { return m_standardShader.get(); }
     Shader* getPBRShader() { return m_pbrShader.get(); }
     Shader* getShadowShader() { return m_shadowShader.get(); }
+    Shader* getStandardInstancedShader() { return m_standardInstancedShader.get(); }
+    Shader* getPBRInstancedShader() { return m_pbrInstancedShader.get(); }
 
     // ========================================================================
     // Pass Access
@@ -120,6 +136,8 @@ private:
     UNIQUE<Shader> m_standardShader;
     UNIQUE<Shader> m_pbrShader;
     UNIQUE<Shader> m_shadowShader;
+    UNIQUE<Shader> m_standardInstancedShader;
+    UNIQUE<Shader> m_pbrInstancedShader;
 
     // Cached pass pointers (owned by compositor)
     ClearPass* m_clearPass = nullptr;
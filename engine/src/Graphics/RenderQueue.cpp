@@ -0,0 +1,287 @@
+/// Pina Engine - Render Queue Implementation
+
+#include "RenderQueue.h"
+#include "Shader.h"
+#include "Material.h"
+#include "Primitives/StaticMesh.h"
+#include "Lighting/LightManager.h"
+#include "../Core/Profiler.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Pina {
+
+namespace {
+
+constexpr uint32_t RadixBits = 8;
+constexpr uint32_t RadixSize = 1u << RadixBits;
+constexpr uint32_t RadixPasses = 64 / RadixBits;
+
+/// Fold a 64-bit hash to its low bits
+uint64_t fold(uint64_t hash, uint32_t bits) {
+    hash ^= hash >> 32;
+    hash ^= hash >> 16;
+    return hash & ((1ull << bits) - 1);
+}
+
+/// Spread the bits of a pointer (allocations share their low and high bits)
+uint64_t hashPointer(const void* pointer) {
+    uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer));
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+    return value;
+}
+
+/// Check if two draws use the same material (nullptr keeps the bound one)
+bool sameMaterial(const Material* a, const Material* b) {
+    return a == b || (a && b && *a == *b);
+}
+
+} // namespace
+
+RenderQueueStats& RenderQueueStats::operator+=(const RenderQueueStats& other) {
+    items += other.items;
+    drawCalls += other.drawCalls;
+    instancedDrawCalls += other.instancedDrawCalls;
+    instances += other.instances;
+    shaderChanges += other.shaderChanges;
+    materialChanges += other.materialChanges;
+    meshChanges += other.meshChanges;
+    transformChanges += other.transformChanges;
+    return *this;
+}
+
+// ============================================================================
+// Keys
+// ============================================================================
+
+uint64_t RenderQueue::makeKey(RenderBucket bucket, const Material* material, const StaticMesh* mesh,
+                              uint32_t depth) {
+    const uint64_t key = static_cast<uint64_t>(bucket) << (64 - BucketBits);
+    const uint64_t depthMask = (1ull << DepthBits) - 1;
+    if (bucket == RenderBucket::Transparent) {
+        // Back to front only: reordering equal depths by state would change the blend
+        uint64_t inverted = depthMask - (depth & depthMask);
+        return key | (inverted << (64 - BucketBits - DepthBits));
+    }
+
+    // Shader 0 is reserved for draws without a material
+    uint64_t shader = material ? static_cast<uint64_t>(material->getWorkflow()) + 1 : 0;
+    uint64_t materialId = material ? fold(material->hash(), MaterialBits) : 0;
+    uint64_t meshId = fold(hashPointer(mesh), MeshBits);
+    uint64_t state = (shader << (MaterialBits + MeshBits)) | (materialId << MeshBits) | meshId;
+    return key | (state << DepthBits) | (depth & depthMask);
+}
+
+uint32_t RenderQueue::quantizeDepth(float depth, float nearPlane, float farPlane) {
+    const float range = farPlane - nearPlane;
+    float t = range > 0.0f ? (depth - nearPlane) / range : 0.0f;
+    t = std::min(std::max(t, 0.0f), 1.0f);   // NaN clamps to 0
+    const float scale = static_cast<float>((1u << DepthBits) - 1);
+    return static_cast<uint32_t>(t * scale);
+}
+
+// ============================================================================
+// Gather
+// ============================================================================
+
+void RenderQueue::clear() {
+    m_worldMatrices.clear();
+    m_normalMatrices.clear();
+    m_tints.clear();
+    m_items.clear();
+    m_order.clear();
+    m_sorted = false;
+}
+
+void RenderQueue::resize(size_t transformCount, size_t itemCount) {
+    m_worldMatrices.resize(transformCount);
+    m_normalMatrices.resize(transformCount);
+    m_tints.resize(transformCount);
+    m_items.resize(itemCount);
+    m_sorted = false;
+}
+
+uint32_t RenderQueue::addTransform(const glm::mat4& world, const glm::mat3& normal, const Color& tint) {
+    m_worldMatrices.push_back(world);
+    m_normalMatrices.push_back(normal);
+    m_tints.push_back(tint);
+    return static_cast<uint32_t>(m_worldMatrices.size() - 1);
+}
+
+// ============================================================================
+// Sort
+// ============================================================================
+
+void RenderQueue::sort() {
+    PINA_PROFILE_FUNCTION();
+
+    const size_t count = m_items.size();
+    m_keys.resize(count);
+    m_keysScratch.resize(count);
+    m_order.resize(count);
+    m_orderScratch.resize(count);
+
+    // One read of the keys builds the histograms of every pass
+    uint32_t histograms[RadixPasses][RadixSize];
+    std::memset(histograms, 0, sizeof(histograms));
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t key = m_items[i].key;
+        m_keys[i] = key;
+        m_order[i] = static_cast<uint32_t>(i);
+        for (uint32_t pass = 0; pass < RadixPasses; ++pass) {
+            histograms[pass][(key >> (pass * RadixBits)) & (RadixSize - 1)]++;
+        }
+    }
+
+    // Least significant digit first; each pass is stable, so the sort is too
+    for (uint32_t pass = 0; pass < RadixPasses && count > 1; ++pass) {
+        uint32_t* histogram = histograms[pass];
+        const uint32_t shift = pass * RadixBits;
+
+        // Skip digits every key shares (most of a key's fields are constant)
+        if (histogram[(m_keys[0] >> shift) & (RadixSize - 1)] == count) continue;
+
+        uint32_t offset = 0;
+        for (uint32_t digit = 0; digit < RadixSize; ++digit) {
+            uint32_t digitCount = histogram[digit];
+            histogram[digit] = offset;
+            offset += digitCount;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t slot = histogram[(m_keys[i] >> shift) & (RadixSize - 1)]++;
+            m_keysScratch[slot] = m_keys[i];
+            m_orderScratch[slot] = m_order[i];
+        }
+        m_keys.swap(m_keysScratch);
+        m_order.swap(m_orderScratch);
+    }
+
+    m_sorted = true;
+}
+
+// ============================================================================
+// Submit
+// ============================================================================
+
+void RenderQueue::submit(Shader* shader, LightManager* lightManager, RenderQueueStats& stats,
+                         Shader* instancedShader) {
+    PINA_PROFILE_FUNCTION();
+
+    // Materials are uniforms, so each shader keeps its own (0 = shader, 1 = instancedShader)
+    Shader* shaders[2] = {shader, instancedShader};
+    const Material* boundMaterials[2] = {nullptr, nullptr};
+    size_t active = 0;
+    bool hasPBR = false;
+    bool boundPBR = false;
+
+    const StaticMesh* boundMesh = nullptr;
+    uint32_t boundTransform = 0;
+    bool hasTransform = false;
+    const Color white = Color::white();
+    Color boundTint = white;    // The shaders' default, restored on return
+
+    auto bindShader = [&](size_t index) {
+        if (active != index) {
+            shaders[index]->bind();
+            active = index;
+        }
+    };
+
+    auto bindMaterial = [&](const Material* material) {
+        if (!material || sameMaterial(material, boundMaterials[active])) return;
+
+        const bool pbr = material->isPBR();
+        if (lightManager) {
+            if (pbr) {
+                lightManager->uploadPBRMaterial(shaders[active], *material);
+            } else {
+                lightManager->uploadMaterial(shaders[active], *material);
+            }
+        }
+        if (!hasPBR || pbr != boundPBR) {
+            stats.shaderChanges++;
+        }
+        boundMaterials[active] = material;
+        boundPBR = pbr;
+        hasPBR = true;
+        stats.materialChanges++;
+    };
+
+    auto bindMesh = [&](const StaticMesh* mesh) {
+        if (mesh != boundMesh) {
+            boundMesh = mesh;
+            stats.meshChanges++;
+        }
+    };
+
+    auto itemAt = [this](size_t i) -> const RenderItem& { return m_items[m_sorted ? m_order[i] : i]; };
+
+    const size_t count = m_items.size();
+    size_t begin = 0;
+    while (begin < count) {
+        const RenderItem& first = itemAt(begin);
+
+        // Run of draws that differ only in transform
+        size_t end = begin + 1;
+        if (instancedShader) {
+            while (end < count && itemAt(end).mesh == first.mesh &&
+                   sameMaterial(itemAt(end).material, first.material)) {
+                ++end;
+            }
+        }
+
+        const uint32_t run = static_cast<uint32_t>(end - begin);
+        if (run >= MinInstances) {
+            bindShader(1);
+            bindMaterial(first.material);
+            bindMesh(first.mesh);
+
+            m_instances.resize(run);
+            for (uint32_t i = 0; i < run; ++i) {
+                uint32_t transform = itemAt(begin + i).transform;
+                InstanceData& instance = m_instances[i];
+                instance.model = m_worldMatrices[transform];
+                instance.normal = m_normalMatrices[transform];
+                instance.color = m_tints[transform];
+            }
+            first.mesh->drawInstanced(m_instances.data(), run);
+            stats.drawCalls++;
+            stats.instancedDrawCalls++;
+            stats.instances += run;
+        } else {
+            bindShader(0);
+            for (size_t i = begin; i < end; ++i) {
+                const RenderItem& item = itemAt(i);
+
+                if (!hasTransform || item.transform != boundTransform) {
+                    shader->setMat4("uModel", m_worldMatrices[item.transform]);
+                    shader->setMat3("uNormalMatrix", m_normalMatrices[item.transform]);
+                    if (m_tints[item.transform] != boundTint) {
+                        boundTint = m_tints[item.transform];
+                        shader->setVec4("uTint", boundTint);
+                    }
+                    boundTransform = item.transform;
+                    hasTransform = true;
+                    stats.transformChanges++;
+                }
+
+                bindMaterial(item.material);
+                bindMesh(item.mesh);
+
+                item.mesh->draw();
+                stats.drawCalls++;
+            }
+        }
+        begin = end;
+    }
+
+    bindShader(0);
+    if (boundTint != white) {
+        shader->setVec4("uTint", white);
+    }
+    stats.items += static_cast<uint32_t>(count);
+}
+
+} // namespace Pina
@@ -0,0 +1,184 @@
+#pragma once
+
+/// Pina Engine - Render Queue
+/// Sortable list of mesh draws, gathered from the scene and submitted in key order
+
+#include "../Core/Export.h"
+#include "../Math/Color.h"
+#include "InstanceData.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Pina {
+
+class Shader;
+class StaticMesh;
+class Material;
+class LightManager;
+
+/// Draw order bucket (the top bits of a sort key)
+enum class RenderBucket : uint8_t {
+    Opaque = 0,         // Sorted by state, then front to back
+    Transparent = 1     // Sorted back to front only
+};
+
+/// One mesh draw
+struct PINA_API RenderItem {
+    uint64_t key = 0;                   // Sort key (see RenderQueue::makeKey())
+    StaticMesh* mesh = nullptr;
+    const Material* material = nullptr; // nullptr = keep the bound material
+    uint32_t transform = 0;             // Index of the world/normal matrix in the queue
+    float depth = 0.0f;                 // View-space depth (distance along the view direction)
+};
+
+/// State changes made by RenderQueue::submit()
+struct PINA_API RenderQueueStats {
+    uint32_t items = 0;
+    uint32_t drawCalls = 0;             // Including instanced draws
+    uint32_t instancedDrawCalls = 0;    // StaticMesh::drawInstanced() calls
+    uint32_t instances = 0;             // Items drawn by instanced draws
+    uint32_t shaderChanges = 0;         // Switches between Blinn-Phong and PBR material uploads
+    uint32_t materialChanges = 0;       // Material uploads
+    uint32_t meshChanges = 0;           // Draws of a different mesh than the previous one
+    uint32_t transformChanges = 0;      // uModel/uNormalMatrix uploads (non-instanced draws)
+
+    RenderQueueStats& operator+=(const RenderQueueStats& other);
+};
+
+/// Render queue with 64-bit sort keys
+///
+/// The gather phase fills transforms and items (in place after resize(), so
+/// chunks can be filled on worker threads), sort() orders them with an LSD
+/// radix sort on the keys, and submit() draws them, uploading a matrix,
+/// material or shading model only when it differs from the previous draw.
+///
+/// Opaque key, most significant bits first:
+///   bucket (2) | shader (6) | material (16) | mesh (16) | depth (24)
+/// Transparent key:
+///   bucket (2) | inverted depth (24) | zero (38)
+///
+/// Material and mesh fields are hashes, so a collision only costs a state
+/// change; submit() compares the materials and meshes themselves.
+/// Transparent draws at the same quantized depth keep their gather order,
+/// as blending depends on it.
+///
+/// Given an instanced shader, submit() draws each run of at least
+/// MinInstances consecutive items with the same mesh and an equal material
+/// as one instanced draw (see StaticMesh::drawInstanced()), passing each
+/// item's matrices and tint as instance attributes. Sorting makes every
+/// opaque draw of a mesh and material consecutive; transparent runs only
+/// form where the back to front order allows, and instances keep it.
+class PINA_API RenderQueue {
+public:
+    static constexpr uint32_t BucketBits = 2;
+    static constexpr uint32_t ShaderBits = 6;
+    static constexpr uint32_t MaterialBits = 16;
+    static constexpr uint32_t MeshBits = 16;
+    static constexpr uint32_t DepthBits = 24;
+
+    /// Shortest run of items drawn as one instanced draw
+    static constexpr uint32_t MinInstances = 2;
+
+    RenderQueue() = default;
+
+    // ========================================================================
+    // Keys
+    // ========================================================================
+
+    /// Build the sort key of a draw
+    /// @param material Material drawn with (nullptr = none)
+    /// @param depth Quantized depth (see quantizeDepth())
+    static uint64_t makeKey(RenderBucket bucket, const Material* material, const StaticMesh* mesh,
+                            uint32_t depth);
+
+    /// Get the bucket of a key
+    static RenderBucket getBucket(uint64_t key) {
+        return static_cast<RenderBucket>(key >> (64 - BucketBits));
+    }
+
+    /// Map a view depth in [nearPlane, farPlane] to DepthBits (clamped)
+    static uint32_t quantizeDepth(float depth, float nearPlane, float farPlane);
+
+    // ========================================================================
+    // Gather
+    // ========================================================================
+
+    /// Remove all transforms and items
+    void clear();
+
+    /// Size the queue for transforms and items filled in place with
+    /// setTransform() and getItem() (contents are unspecified until then)
+    void resize(size_t transformCount, size_t itemCount);
+
+    /// Append a world matrix, its normal matrix and a tint (see Node::setTint())
+    /// @return Index for RenderItem::transform
+    uint32_t addTransform(const glm::mat4& world, const glm::mat3& normal,
+                          const Color& tint = Color::white());
+
+    /// Set a transform reserved by resize()
+    void setTransform(uint32_t index, const glm::mat4& world, const glm::mat3& normal,
+                      const Color& tint = Color::white()) {
+        m_worldMatrices[index] = world;
+        m_normalMatrices[index] = normal;
+        m_tints[index] = tint;
+    }
+
+    /// Append an item
+    void add(const RenderItem& item) {
+        m_items.push_back(item);
+        m_sorted = false;
+    }
+
+    RenderItem& getItem(size_t index) { return m_items[index]; }
+    const RenderItem& getItem(size_t index) const { return m_items[index]; }
+    const std::vector<RenderItem>& getItems() const { return m_items; }
+
+    size_t size() const { return m_items.size(); }
+    bool empty() const { return m_items.empty(); }
+
+    const glm::mat4& getWorldMatrix(uint32_t transform) const { return m_worldMatrices[transform]; }
+
+    // ========================================================================
+    // Sort and Submit
+    // ========================================================================
+
+    /// Order the items by key (stable: equal keys keep their gather order)
+    void sort();
+
+    /// Check if the items were sorted since they last changed
+    bool isSorted() const { return m_sorted; }
+
+    /// Item indices in key order (valid while isSorted())
+    const std::vector<uint32_t>& getOrder() const { return m_order; }
+
+    /// Draw the items with a bound shader, in key order if sorted and in
+    /// gather order otherwise
+    /// Tints other than white are uploaded as uTint and reset afterwards.
+    /// @param lightManager Uploads materials (nullptr = draw without materials)
+    /// @param stats Receives the draws and state changes (added to)
+    /// @param instancedShader Shader for instanced runs, with the camera and
+    ///        light uniforms of shader (nullptr = no instancing); shader is
+    ///        bound again on return
+    void submit(Shader* shader, LightManager* lightManager, RenderQueueStats& stats,
+                Shader* instancedShader = nullptr);
+
+private:
+    std::vector<glm::mat4> m_worldMatrices;
+    std::vector<glm::mat3> m_normalMatrices;
+    std::vector<Color> m_tints;
+    std::vector<RenderItem> m_items;
+    std::vector<uint32_t> m_order;
+    bool m_sorted = false;
+
+    // Radix sort scratch
+    std::vector<uint64_t> m_keys;
+    std::vector<uint64_t> m_keysScratch;
+    std::vector<uint32_t> m_orderScratch;
+
+    // Instance attributes of the current instanced run
+    std::vector<InstanceData> m_instances;
+};
+
+} // namespace Pina
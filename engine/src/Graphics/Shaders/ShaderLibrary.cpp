@@ -118,6 +118,7 @@ uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProjection;
 uniform mat3 uNormalMatrix;  // transpose(inverse(mat3(uModel)))
+uniform vec4 uTint = vec4(1.0);  // Node tint (diffuse and alpha multiplier)
 
 // Shadow mapping
 uniform mat4 uLightSpaceMatrix;
@@ -127,6 +128,7 @@ out vec3 vWorldPos;
 out vec3 vNormal;
 out vec2 vTexCoord;
 out vec4 vLightSpacePos;
+out vec4 vTint;
 
 void main() {
     // Transform vertex to world space
@@ -136,8 +138,9 @@ void main() {
     // Transform normal to world space (handles non-uniform scaling)
     vNormal = uNormalMatrix * aNormal;
 
-    // Pass through texture coordinates
+    // Pass through texture coordinates and tint
     vTexCoord = aTexCoord;
+    vTint = uTint;
 
     // Calculate position in light space for shadow mapping
     vLightSpacePos = uLightSpaceMatrix * worldPos;
@@ -214,6 +217,7 @@ in vec3 vWorldPos;
 in vec3 vNormal;
 in vec2 vTexCoord;
 in vec4 vLightSpacePos;
+in vec4 vTint;
 
 // ============================================================================
 // Output
@@ -353,6 +357,8 @@ void main() {
         diffuseColor *= texColor.rgb;
         alpha = texColor.a;
     }
+    diffuseColor *= vTint.rgb;
+    alpha *= vTint.a;
 
     // Sample specular color (texture or material)
     vec3 specularColor = uMaterial.specular;
@@ -446,6 +452,7 @@ uniform mat4 uModel;
 uniform mat4 uView;
 uniform mat4 uProjection;
 uniform mat3 uNormalMatrix;
+uniform vec4 uTint = vec4(1.0);
 
 // Shadow mapping
 uniform mat4 uLightSpaceMatrix;
@@ -455,12 +462,101 @@ out vec3 vWorldPos;
 out vec3 vNormal;
 out vec2 vTexCoord;
 out vec4 vLightSpacePos;
+out vec4 vTint;
 
 void main() {
     vec4 worldPos = uModel * vec4(aPosition, 1.0);
     vWorldPos = worldPos.xyz;
     vNormal = uNormalMatrix * aNormal;
     vTexCoord = aTexCoord;
+    vTint = uTint;
+    vLightSpacePos = uLightSpaceMatrix * worldPos;
+    gl_Position = uProjection * uView * worldPos;
+}
+)";
+}
+
+// ============================================================================
+// Instanced Vertex Shaders (per-instance attributes replace uModel/uNormalMatrix/uTint)
+// ============================================================================
+
+const char* ShaderLibrary::getStandardInstancedVertexShader() {
+    return R"(
+#version 410 core
+
+// Vertex attributes
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+
+// Instance attributes (see InstanceData)
+layout (location = 3) in mat4 aInstanceModel;    // Locations 3-6
+layout (location = 7) in mat3 aInstanceNormal;   // Locations 7-9
+layout (location = 10) in vec4 aInstanceColor;
+
+// Transformation matrices
+uniform mat4 uView;
+uniform mat4 uProjection;
+
+// Shadow mapping
+uniform mat4 uLightSpaceMatrix;
+
+// Output to fragment shader
+out vec3 vWorldPos;
+out vec3 vNormal;
+out vec2 vTexCoord;
+out vec4 vLightSpacePos;
+out vec4 vTint;
+
+void main() {
+    // Transform vertex to world space with this instance's matrices
+    vec4 worldPos = aInstanceModel * vec4(aPosition, 1.0);
+    vWorldPos = worldPos.xyz;
+    vNormal = aInstanceNormal * aNormal;
+
+    vTexCoord = aTexCoord;
+    vTint = aInstanceColor;
+
+    vLightSpacePos = uLightSpaceMatrix * worldPos;
+    gl_Position = uProjection * uView * worldPos;
+}
+)";
+}
+
+const char* ShaderLibrary::getPBRInstancedVertexShader() {
+    return R"(
+#version 410 core
+
+// Vertex attributes
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTexCoord;
+
+// Instance attributes (see InstanceData)
+layout (location = 3) in mat4 aInstanceModel;
+layout (location = 7) in mat3 aInstanceNormal;
+layout (location = 10) in vec4 aInstanceColor;
+
+// Transformation matrices
+uniform mat4 uView;
+uniform mat4 uProjection;
+
+// Shadow mapping
+uniform mat4 uLightSpaceMatrix;
+
+// Output to fragment shader
+out vec3 vWorldPos;
+out vec3 vNormal;
+out vec2 vTexCoord;
+out vec4 vLightSpacePos;
+out vec4 vTint;
+
+void main() {
+    vec4 worldPos = aInstanceModel * vec4(aPosition, 1.0);
+    vWorldPos = worldPos.xyz;
+    vNormal = aInstanceNormal * aNormal;
+    vTexCoord = aTexCoord;
+    vTint = aInstanceColor;
     vLightSpacePos = uLightSpaceMatrix * worldPos;
     gl_Position = uProjection * uView * worldPos;
 }
@@ -550,6 +646,7 @@ in vec3 vWorldPos;
 in vec3 vNormal;
 in vec2 vTexCoord;
 in vec4 vLightSpacePos;
+in vec4 vTint;
 
 // ============================================================================
 // Output
@@ -741,6 +838,8 @@ void main() {
         albedo *= pow(albedoSample.rgb, vec3(2.2)); // sRGB to linear
         alpha *= albedoSample.a;  // Use texture alpha for transparency
     }
+    albedo *= vTint.rgb;
+    alpha *= vTint.a;
 
     float metallic = uMetallic;
     float roughness = uRoughness;
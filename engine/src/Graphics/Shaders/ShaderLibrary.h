@@ -17,7 +17,7 @@ public:
 
     /// Standard lit vertex shader
     /// Requires: aPosition (vec3), aNormal (vec3), aTexCoord (vec2)
-    /// Uniforms: uModel, uView, uProjection, uNormalMatrix
+    /// Uniforms: uModel, uView, uProjection, uNormalMatrix, uTint (default white)
     static const char* getStandardVertexShader();
 
     /// Standard lit fragment shader with Blinn-Phong lighting
@@ -38,6 +38,21 @@ public:
     /// Supports metallic-roughness workflow
     static const char* getPBRFragmentShader();
 
+    // ========================================================================
+    // Instanced Shaders (pair with the standard/PBR fragment shaders)
+    // ========================================================================
+
+    /// Standard vertex shader for StaticMesh::drawInstanced()
+    /// Requires: the standard attributes plus aInstanceModel (mat4),
+    /// aInstanceNormal (mat3) and aInstanceColor (vec4) at locations 3-10
+    /// (see InstanceData)
+    /// Uniforms: uView, uProjection, uLightSpaceMatrix
+    static const char* getStandardInstancedVertexShader();
+
+    /// PBR vertex shader for StaticMesh::drawInstanced() (same layout as
+    /// the standard instanced shader)
+    static const char* getPBRInstancedVertexShader();
+
     // ========================================================================
     // Shader Components (for custom shaders)
     // ========================================================================
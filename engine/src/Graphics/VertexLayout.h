@@ -99,6 +99,10 @@ public:
     /// Get the attributes
     const std::vector<VertexAttribute>& getAttributes() const { return m_attributes; }
 
+    /// Advance the attributes once per instance instead of once per vertex
+    void setInstanced(bool instanced) { m_instanced = instanced; }
+    bool isInstanced() const { return m_instanced; }
+
     /// Iterator support
     std::vector<VertexAttribute>::iterator begin() { return m_attributes.begin(); }
     std::vector<VertexAttribute>::iterator end() { return m_attributes.end(); }
@@ -118,6 +122,7 @@ private:
 
     std::vector<VertexAttribute> m_attributes;
     uint32_t m_stride = 0;
+    bool m_instanced = false;
 };
 
 } // namespace Pina
@@ -18,6 +18,11 @@ class PINA_API Input : public Subsystem {
 public:
     ~Input() override = default;
 
+    /// Input only derives per-frame state from its own data, before gameplay updates
+    void declareDependencies(SubsystemDependencies& deps) const override {
+        deps.phase(SubsystemPhase::PreUpdate);
+    }
+
     // ========================================================================
     // Keyboard State
     // ========================================================================
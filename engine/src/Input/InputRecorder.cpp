@@ -0,0 +1,212 @@
+/// Pina Engine - Input Recorder Implementation
+
+#include "InputRecorder.h"
+#include "InputEvents.h"
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+namespace Pina {
+
+namespace {
+
+const char* s_typeNames[] = {
+    "key_down", "key_up", "mouse_down", "mouse_up", "mouse_move", "scroll", "focus"
+};
+
+constexpr const char* s_fileHeader = "pina-input";
+constexpr int s_fileVersion = 1;
+
+bool parseType(const std::string& name, RecordedInputType& type) {
+    for (size_t i = 0; i < sizeof(s_typeNames) / sizeof(s_typeNames[0]); ++i) {
+        if (name == s_typeNames[i]) {
+            type = static_cast<RecordedInputType>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// ============================================================================
+// InputRecording
+// ============================================================================
+
+bool InputRecording::save(const std::string& path) const {
+    std::ofstream file(path);
+    if (!file) {
+        std::cerr << "InputRecording::save - Failed to open " << path << std::endl;
+        return false;
+    }
+
+    // Round-trip precision so replays see identical values
+    file.precision(std::numeric_limits<float>::max_digits10);
+
+    file << s_fileHeader << " " << s_fileVersion << "\n";
+    file << "frames " << frameCount << "\n";
+    file << "events " << events.size() << "\n";
+
+    for (const RecordedInputEvent& e : events) {
+        file << e.frame << " ";
+        file.precision(std::numeric_limits<double>::max_digits10);
+        file << e.time << " ";
+        file.precision(std::numeric_limits<float>::max_digits10);
+        file << s_typeNames[static_cast<size_t>(e.type)] << " "
+             << static_cast<uint32_t>(e.key) << " "
+             << static_cast<uint32_t>(e.button) << " "
+             << static_cast<uint32_t>(e.modifiers) << " "
+             << (e.flag ? 1 : 0) << " "
+             << e.position.x << " " << e.position.y << " "
+             << e.delta.x << " " << e.delta.y << "\n";
+    }
+
+    return static_cast<bool>(file);
+}
+
+bool InputRecording::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "InputRecording::load - Failed to open " << path << std::endl;
+        return false;
+    }
+
+    std::string header;
+    int version = 0;
+    std::string label;
+    uint64_t frames = 0;
+    size_t count = 0;
+    file >> header >> version;
+    if (header != s_fileHeader || version != s_fileVersion) {
+        std::cerr << "InputRecording::load - Unsupported file " << path << std::endl;
+        return false;
+    }
+    file >> label >> frames;
+    if (label != "frames") {
+        std::cerr << "InputRecording::load - Missing frame count in " << path << std::endl;
+        return false;
+    }
+    file >> label >> count;
+    if (label != "events") {
+        std::cerr << "InputRecording::load - Missing event count in " << path << std::endl;
+        return false;
+    }
+
+    std::vector<RecordedInputEvent> loaded;
+    loaded.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        RecordedInputEvent e;
+        std::string typeName;
+        uint32_t key = 0, button = 0, modifiers = 0, flag = 0;
+        file >> e.frame >> e.time >> typeName >> key >> button >> modifiers >> flag
+             >> e.position.x >> e.position.y >> e.delta.x >> e.delta.y;
+
+        if (!file || !parseType(typeName, e.type)) {
+            std::cerr << "InputRecording::load - Malformed event " << i << " in " << path << std::endl;
+            return false;
+        }
+
+        e.key = static_cast<Key>(key);
+        e.button = static_cast<MouseButton>(button);
+        e.modifiers = static_cast<KeyModifier>(modifiers);
+        e.flag = flag != 0;
+        loaded.push_back(e);
+    }
+
+    events = std::move(loaded);
+    frameCount = frames;
+    return true;
+}
+
+// ============================================================================
+// InputRecorder
+// ============================================================================
+
+InputRecorder::~InputRecorder() {
+    stop();
+}
+
+void InputRecorder::start(EventDispatcher* dispatcher) {
+    stop();
+    if (!dispatcher) {
+        std::cerr << "InputRecorder::start - No event dispatcher" << std::endl;
+        return;
+    }
+
+    m_dispatcher = dispatcher;
+    m_recording = InputRecording();
+    m_startTime = std::chrono::steady_clock::now();
+
+    listen<KeyPressedEvent>();
+    listen<KeyReleasedEvent>();
+    listen<MouseButtonPressedEvent>();
+    listen<MouseButtonReleasedEvent>();
+    listen<MouseMovedEvent>();
+    listen<MouseScrolledEvent>();
+    listen<WindowFocusEvent>();
+}
+
+void InputRecorder::stop() {
+    if (!m_dispatcher) return;
+
+    for (EventHandle handle : m_handles) {
+        m_dispatcher->unsubscribe(handle);
+    }
+    m_handles.clear();
+    m_dispatcher = nullptr;
+}
+
+void InputRecorder::endFrame() {
+    if (m_dispatcher) {
+        m_recording.frameCount++;
+    }
+}
+
+RecordedInputEvent& InputRecorder::record(RecordedInputType type) {
+    RecordedInputEvent e;
+    e.frame = m_recording.frameCount;
+    e.time = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_startTime).count();
+    e.type = type;
+    m_recording.events.push_back(e);
+    return m_recording.events.back();
+}
+
+template<typename EventType>
+void InputRecorder::listen() {
+    m_handles.push_back(m_dispatcher->subscribe<EventType>([this](EventType& event) {
+        if constexpr (std::is_same<EventType, KeyPressedEvent>::value) {
+            RecordedInputEvent& e = record(RecordedInputType::KeyDown);
+            e.key = event.key;
+            e.modifiers = event.modifiers;
+            e.flag = event.isRepeat;
+        } else if constexpr (std::is_same<EventType, KeyReleasedEvent>::value) {
+            RecordedInputEvent& e = record(RecordedInputType::KeyUp);
+            e.key = event.key;
+            e.modifiers = event.modifiers;
+        } else if constexpr (std::is_same<EventType, MouseButtonPressedEvent>::value) {
+            RecordedInputEvent& e = record(RecordedInputType::MouseDown);
+            e.button = event.button;
+            e.position = event.position;
+            e.modifiers = event.modifiers;
+        } else if constexpr (std::is_same<EventType, MouseButtonReleasedEvent>::value) {
+            RecordedInputEvent& e = record(RecordedInputType::MouseUp);
+            e.button = event.button;
+            e.position = event.position;
+            e.modifiers = event.modifiers;
+        } else if constexpr (std::is_same<EventType, MouseMovedEvent>::value) {
+            RecordedInputEvent& e = record(RecordedInputType::MouseMove);
+            e.position = event.position;
+            e.delta = event.delta;
+        } else if constexpr (std::is_same<EventType, MouseScrolledEvent>::value) {
+            RecordedInputEvent& e = record(RecordedInputType::Scroll);
+            e.delta = event.delta;
+            e.position = event.position;
+        } else if constexpr (std::is_same<EventType, WindowFocusEvent>::value) {
+            RecordedInputEvent& e = record(RecordedInputType::Focus);
+            e.flag = event.hasFocus;
+        }
+    }, EventPriority::Highest));
+}
+
+} // namespace Pina
@@ -0,0 +1,107 @@
+#pragma once
+
+/// Pina Engine - Input Recorder
+/// Records the input event stream for deterministic replay
+
+#include "../Core/Export.h"
+#include "../Core/EventDispatcher.h"
+#include "KeyCodes.h"
+#include <glm/vec2.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pina {
+
+// ============================================================================
+// Recorded Events
+// ============================================================================
+
+/// Kind of recorded input event (one per InputEvents.h input type)
+enum class RecordedInputType : uint8_t {
+    KeyDown,        // KeyPressedEvent
+    KeyUp,          // KeyReleasedEvent
+    MouseDown,      // MouseButtonPressedEvent
+    MouseUp,        // MouseButtonReleasedEvent
+    MouseMove,      // MouseMovedEvent
+    Scroll,         // MouseScrolledEvent
+    Focus           // WindowFocusEvent
+};
+
+/// One input event with the frame it arrived in
+struct PINA_API RecordedInputEvent {
+    uint64_t frame = 0;                     // Frame index the event arrived in
+    double time = 0.0;                      // Seconds since recording started
+    RecordedInputType type = RecordedInputType::KeyDown;
+    Key key = Key::Unknown;
+    MouseButton button = MouseButton::Left;
+    KeyModifier modifiers = KeyModifier::None;
+    bool flag = false;                      // Key repeat, or focus gained
+    glm::vec2 position{0.0f};               // Mouse position (move, buttons, scroll)
+    glm::vec2 delta{0.0f};                  // Mouse move or scroll delta
+};
+
+/// A recorded input session
+/// Saved as a line-based text file; floats are written with enough digits
+/// to read back bit-exact.
+struct PINA_API InputRecording {
+    std::vector<RecordedInputEvent> events;     // Ordered by frame
+    uint64_t frameCount = 0;                    // Frames the session lasted
+
+    /// Write to a file
+    bool save(const std::string& path) const;
+
+    /// Read from a file (replaces current contents)
+    bool load(const std::string& path);
+};
+
+// ============================================================================
+// Input Recorder
+// ============================================================================
+
+/// Records input events flowing through an EventDispatcher
+/// Subscribes at Highest priority so events are captured before any handler
+/// consumes them. Call endFrame() once per frame to advance the frame index
+/// (Application does this when ApplicationConfig::inputRecordPath is set).
+class PINA_API InputRecorder {
+public:
+    InputRecorder() = default;
+    ~InputRecorder();
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    /// Start recording a new session from a dispatcher
+    void start(EventDispatcher* dispatcher);
+
+    /// Stop recording (keeps the recorded session)
+    void stop();
+
+    bool isRecording() const { return m_dispatcher != nullptr; }
+
+    /// Advance to the next frame
+    void endFrame();
+
+    /// Current frame index
+    uint64_t getFrame() const { return m_recording.frameCount; }
+
+    /// Recorded session so far
+    const InputRecording& getRecording() const { return m_recording; }
+
+    /// Write the recorded session to a file
+    bool save(const std::string& path) const { return m_recording.save(path); }
+
+private:
+    template<typename EventType>
+    void listen();
+
+    RecordedInputEvent& record(RecordedInputType type);
+
+    EventDispatcher* m_dispatcher = nullptr;
+    std::vector<EventHandle> m_handles;
+    InputRecording m_recording;
+    std::chrono::steady_clock::time_point m_startTime;
+};
+
+} // namespace Pina
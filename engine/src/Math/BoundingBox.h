@@ -0,0 +1,111 @@
+#pragma once
+
+/// Pina Engine - Bounding Box
+/// Axis-aligned bounding box
+
+#include "../Core/Export.h"
+#include <glm/glm.hpp>
+#include <limits>
+
+namespace Pina {
+
+/// Axis-aligned bounding box
+struct PINA_API BoundingBox {
+    glm::vec3 min{std::numeric_limits<float>::max()};
+    glm::vec3 max{std::numeric_limits<float>::lowest()};
+
+    /// Expand the bounding box to include a point
+    void expand(const glm::vec3& point) {
+        min = glm::min(min, point);
+        max = glm::max(max, point);
+    }
+
+    /// Get center of the bounding box
+    glm::vec3 getCenter() const {
+        return (min + max) * 0.5f;
+    }
+
+    /// Get size (extent) of the bounding box
+    glm::vec3 getSize() const {
+        return max - min;
+    }
+
+    /// Get the maximum dimension (largest of width, height, depth)
+    float getMaxDimension() const {
+        glm::vec3 size = getSize();
+        return glm::max(glm::max(size.x, size.y), size.z);
+    }
+
+    /// Check if bounding box is valid (has been expanded at least once)
+    bool isValid() const {
+        return min.x <= max.x && min.y <= max.y && min.z <= max.z;
+    }
+
+    /// Expand the bounding box to include another box
+    void expand(const BoundingBox& box) {
+        min = glm::min(min, box.min);
+        max = glm::max(max, box.max);
+    }
+
+    /// Get the surface area (the cost metric of bounding volume trees)
+    float getSurfaceArea() const {
+        glm::vec3 size = getSize();
+        return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+    }
+
+    /// Check if two boxes overlap (touching counts)
+    bool intersects(const BoundingBox& other) const {
+        return min.x <= other.max.x && max.x >= other.min.x &&
+               min.y <= other.max.y && max.y >= other.min.y &&
+               min.z <= other.max.z && max.z >= other.min.z;
+    }
+
+    /// Check if another box lies entirely inside this one
+    bool contains(const BoundingBox& other) const {
+        return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+               max.x >= other.max.x && max.y >= other.max.y && max.z >= other.max.z;
+    }
+
+    /// Squared distance from a point to the box (0 inside)
+    float distanceSquared(const glm::vec3& point) const {
+        glm::vec3 d = glm::max(glm::max(min - point, point - max), glm::vec3(0.0f));
+        return glm::dot(d, d);
+    }
+
+    /// Ray-box slab test
+    /// @param origin Ray origin
+    /// @param invDirection 1 / ray direction per component
+    /// @param maxDistance Ignore hits beyond this ray distance
+    /// @param entry Set to the entry distance (0 if the origin is inside)
+    bool intersectsRay(const glm::vec3& origin, const glm::vec3& invDirection, float maxDistance,
+                       float& entry) const {
+        glm::vec3 t0 = (min - origin) * invDirection;
+        glm::vec3 t1 = (max - origin) * invDirection;
+        glm::vec3 tNear = glm::min(t0, t1);
+        glm::vec3 tFar = glm::max(t0, t1);
+        float enter = glm::max(glm::max(tNear.x, tNear.y), glm::max(tNear.z, 0.0f));
+        float exit = glm::min(glm::min(tFar.x, tFar.y), glm::min(tFar.z, maxDistance));
+        if (enter > exit) return false;
+        entry = enter;
+        return true;
+    }
+
+    /// Get the box enclosing this box after an affine transform
+    /// Transforms center and half extents rather than all eight corners.
+    BoundingBox transformed(const glm::mat4& matrix) const {
+        if (!isValid()) return *this;
+
+        glm::vec3 center = glm::vec3(matrix * glm::vec4(getCenter(), 1.0f));
+        glm::vec3 half = getSize() * 0.5f;
+        glm::vec3 extent = glm::abs(glm::vec3(matrix[0])) * half.x +
+                           glm::abs(glm::vec3(matrix[1])) * half.y +
+                           glm::abs(glm::vec3(matrix[2])) * half.z;
+
+        BoundingBox result;
+        result.min = center - extent;
+        result.max = center + extent;
+        return result;
+    }
+};
+
+} // namespace Pina
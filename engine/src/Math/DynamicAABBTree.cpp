@@ -0,0 +1,335 @@
+#include "DynamicAABBTree.h"
+
+namespace Pina {
+
+namespace {
+
+BoundingBox combine(const BoundingBox& a, const BoundingBox& b) {
+    BoundingBox result = a;
+    result.expand(b);
+    return result;
+}
+
+} // namespace
+
+DynamicAABBTree::DynamicAABBTree(float margin)
+    : m_margin(margin)
+{
+}
+
+// ============================================================================
+// Proxies
+// ============================================================================
+
+DynamicAABBTree::ProxyID DynamicAABBTree::createProxy(const BoundingBox& bounds, uint32_t userData) {
+    ProxyID id = allocateNode();
+    TreeNode& node = m_nodes[id];
+    node.bounds.min = bounds.min - glm::vec3(m_margin);
+    node.bounds.max = bounds.max + glm::vec3(m_margin);
+    node.userData = userData;
+
+    insertLeaf(id);
+    m_proxyCount++;
+    return id;
+}
+
+void DynamicAABBTree::destroyProxy(ProxyID proxy) {
+    removeLeaf(proxy);
+    freeNode(proxy);
+    m_proxyCount--;
+}
+
+bool DynamicAABBTree::moveProxy(ProxyID proxy, const BoundingBox& bounds) {
+    BoundingBox fat;
+    fat.min = bounds.min - glm::vec3(m_margin);
+    fat.max = bounds.max + glm::vec3(m_margin);
+
+    // Still inside the fat bounds, and they are not grossly oversized
+    // (a proxy that shrank a lot would otherwise keep its old box)
+    const BoundingBox& current = m_nodes[proxy].bounds;
+    if (current.contains(bounds) && current.getSurfaceArea() <= 4.0f * fat.getSurfaceArea()) {
+        return false;
+    }
+
+    removeLeaf(proxy);
+    m_nodes[proxy].bounds = fat;
+    insertLeaf(proxy);
+    return true;
+}
+
+void DynamicAABBTree::clear() {
+    m_nodes.clear();
+    m_root = NullProxy;
+    m_freeList = NullProxy;
+    m_proxyCount = 0;
+}
+
+// ============================================================================
+// Info
+// ============================================================================
+
+float DynamicAABBTree::getAreaRatio() const {
+    if (m_root == NullProxy) return 0.0f;
+
+    float rootArea = m_nodes[m_root].bounds.getSurfaceArea();
+    if (rootArea <= 0.0f) return 0.0f;
+
+    float total = 0.0f;
+    for (const TreeNode& node : m_nodes) {
+        if (node.height > 0) {
+            total += node.bounds.getSurfaceArea();
+        }
+    }
+    return total / rootArea;
+}
+
+bool DynamicAABBTree::validate() const {
+    if (m_root == NullProxy) return m_proxyCount == 0;
+    if (m_nodes[m_root].parent != NullProxy) return false;
+
+    size_t leaves = 0;
+    size_t reached = 0;
+    Stack stack;
+    stack.push(m_root);
+    while (!stack.empty()) {
+        ProxyID id = stack.pop();
+        const TreeNode& node = m_nodes[id];
+        reached++;
+
+        if (node.isLeaf()) {
+            if (node.child2 != NullProxy || node.height != 0) return false;
+            leaves++;
+            continue;
+        }
+
+        const TreeNode& child1 = m_nodes[node.child1];
+        const TreeNode& child2 = m_nodes[node.child2];
+        if (child1.parent != id || child2.parent != id) return false;
+        if (node.height != 1 + std::max(child1.height, child2.height)) return false;
+
+        BoundingBox bounds = combine(child1.bounds, child2.bounds);
+        if (node.bounds.min != bounds.min || node.bounds.max != bounds.max) return false;
+
+        stack.push(node.child1);
+        stack.push(node.child2);
+    }
+
+    size_t free = 0;
+    for (ProxyID id = m_freeList; id != NullProxy; id = m_nodes[id].parent) {
+        free++;
+    }
+    return leaves == m_proxyCount && reached + free == m_nodes.size();
+}
+
+// ============================================================================
+// Internal
+// ============================================================================
+
+DynamicAABBTree::ProxyID DynamicAABBTree::allocateNode() {
+    ProxyID id;
+    if (m_freeList != NullProxy) {
+        id = m_freeList;
+        m_freeList = m_nodes[id].parent;
+        m_nodes[id] = TreeNode();
+    } else {
+        id = static_cast<ProxyID>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+    m_nodes[id].height = 0;
+    return id;
+}
+
+void DynamicAABBTree::freeNode(ProxyID id) {
+    m_nodes[id].parent = m_freeList;
+    m_nodes[id].height = -1;
+    m_freeList = id;
+}
+
+void DynamicAABBTree::insertLeaf(ProxyID leaf) {
+    if (m_root == NullProxy) {
+        m_root = leaf;
+        m_nodes[leaf].parent = NullProxy;
+        return;
+    }
+
+    // Descend to the sibling with the lowest surface-area cost
+    BoundingBox leafBounds = m_nodes[leaf].bounds;
+    ProxyID index = m_root;
+    while (!m_nodes[index].isLeaf()) {
+        const TreeNode& node = m_nodes[index];
+        float area = node.bounds.getSurfaceArea();
+        float combinedArea = combine(node.bounds, leafBounds).getSurfaceArea();
+
+        // Pairing the leaf with this node, versus the area every node below
+        // would inherit on the way down
+        float cost = 2.0f * combinedArea;
+        float inheritance = 2.0f * (combinedArea - area);
+
+        float childCosts[2];
+        ProxyID children[2] = {node.child1, node.child2};
+        for (int i = 0; i < 2; ++i) {
+            const TreeNode& child = m_nodes[children[i]];
+            float enlarged = combine(child.bounds, leafBounds).getSurfaceArea();
+            childCosts[i] = inheritance + (child.isLeaf() ? enlarged : enlarged - child.bounds.getSurfaceArea());
+        }
+
+        if (cost < childCosts[0] && cost < childCosts[1]) break;
+        index = (childCosts[0] < childCosts[1]) ? children[0] : children[1];
+    }
+
+    // New parent for the sibling and the leaf
+    ProxyID sibling = index;
+    ProxyID oldParent = m_nodes[sibling].parent;
+    ProxyID newParent = allocateNode();
+    TreeNode& parent = m_nodes[newParent];
+    parent.parent = oldParent;
+    parent.bounds = combine(leafBounds, m_nodes[sibling].bounds);
+    parent.height = m_nodes[sibling].height + 1;
+    parent.child1 = sibling;
+    parent.child2 = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent != NullProxy) {
+        TreeNode& old = m_nodes[oldParent];
+        if (old.child1 == sibling) {
+            old.child1 = newParent;
+        } else {
+            old.child2 = newParent;
+        }
+    } else {
+        m_root = newParent;
+    }
+
+    refitUpward(newParent);
+}
+
+void DynamicAABBTree::removeLeaf(ProxyID leaf) {
+    if (leaf == m_root) {
+        m_root = NullProxy;
+        return;
+    }
+
+    ProxyID parent = m_nodes[leaf].parent;
+    ProxyID grandParent = m_nodes[parent].parent;
+    ProxyID sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    // The sibling takes the parent's place
+    m_nodes[sibling].parent = grandParent;
+    freeNode(parent);
+
+    if (grandParent != NullProxy) {
+        TreeNode& grand = m_nodes[grandParent];
+        if (grand.child1 == parent) {
+            grand.child1 = sibling;
+        } else {
+            grand.child2 = sibling;
+        }
+        refitUpward(grandParent);
+    } else {
+        m_root = sibling;
+    }
+}
+
+void DynamicAABBTree::refitUpward(ProxyID id) {
+    while (id != NullProxy) {
+        id = balance(id);
+
+        TreeNode& node = m_nodes[id];
+        const TreeNode& child1 = m_nodes[node.child1];
+        const TreeNode& child2 = m_nodes[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.bounds = combine(child1.bounds, child2.bounds);
+
+        id = node.parent;
+    }
+}
+
+DynamicAABBTree::ProxyID DynamicAABBTree::balance(ProxyID iA) {
+    TreeNode& a = m_nodes[iA];
+    if (a.isLeaf() || a.height < 2) return iA;
+
+    ProxyID iB = a.child1;
+    ProxyID iC = a.child2;
+    TreeNode& b = m_nodes[iB];
+    TreeNode& c = m_nodes[iC];
+    int32_t difference = c.height - b.height;
+
+    // Rotate the taller child up into A's place; A takes the taller
+    // grandchild's sibling
+    auto replaceInParent = [this, iA](ProxyID parentID, ProxyID replacement) {
+        if (parentID == NullProxy) {
+            m_root = replacement;
+        } else if (m_nodes[parentID].child1 == iA) {
+            m_nodes[parentID].child1 = replacement;
+        } else {
+            m_nodes[parentID].child2 = replacement;
+        }
+    };
+
+    if (difference > 1) {
+        ProxyID iF = c.child1;
+        ProxyID iG = c.child2;
+        TreeNode& f = m_nodes[iF];
+        TreeNode& g = m_nodes[iG];
+
+        c.child1 = iA;
+        c.parent = a.parent;
+        a.parent = iC;
+        replaceInParent(c.parent, iC);
+
+        if (f.height > g.height) {
+            c.child2 = iF;
+            a.child2 = iG;
+            g.parent = iA;
+            a.bounds = combine(b.bounds, g.bounds);
+            c.bounds = combine(a.bounds, f.bounds);
+            a.height = 1 + std::max(b.height, g.height);
+            c.height = 1 + std::max(a.height, f.height);
+        } else {
+            c.child2 = iG;
+            a.child2 = iF;
+            f.parent = iA;
+            a.bounds = combine(b.bounds, f.bounds);
+            c.bounds = combine(a.bounds, g.bounds);
+            a.height = 1 + std::max(b.height, f.height);
+            c.height = 1 + std::max(a.height, g.height);
+        }
+        return iC;
+    }
+
+    if (difference < -1) {
+        ProxyID iD = b.child1;
+        ProxyID iE = b.child2;
+        TreeNode& d = m_nodes[iD];
+        TreeNode& e = m_nodes[iE];
+
+        b.child1 = iA;
+        b.parent = a.parent;
+        a.parent = iB;
+        replaceInParent(b.parent, iB);
+
+        if (d.height > e.height) {
+            b.child2 = iD;
+            a.child1 = iE;
+            e.parent = iA;
+            a.bounds = combine(c.bounds, e.bounds);
+            b.bounds = combine(a.bounds, d.bounds);
+            a.height = 1 + std::max(c.height, e.height);
+            b.height = 1 + std::max(a.height, d.height);
+        } else {
+            b.child2 = iE;
+            a.child1 = iD;
+            d.parent = iA;
+            a.bounds = combine(c.bounds, d.bounds);
+            b.bounds = combine(a.bounds, e.bounds);
+            a.height = 1 + std::max(c.height, d.height);
+            b.height = 1 + std::max(a.height, e.height);
+        }
+        return iB;
+    }
+
+    return iA;
+}
+
+} // namespace Pina
@@ -0,0 +1,299 @@
+#pragma once
+
+/// Pina Engine - Dynamic AABB Tree
+/// Incrementally updated bounding volume hierarchy of axis-aligned boxes
+
+#include "../Core/Export.h"
+#include "BoundingBox.h"
+#include "Frustum.h"
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace Pina {
+
+/// Dynamic bounding volume hierarchy over proxies (boxes with user data)
+///
+/// Leaves store "fat" bounds: the proxy's bounds grown by a margin, so small
+/// movements stay inside them and moveProxy() is a no-op. When a proxy
+/// leaves its fat bounds it is removed and reinserted, choosing the sibling
+/// by surface-area cost; tree rotations on the way up keep it balanced.
+///
+/// Queries test fat bounds, so they report a superset of the proxies whose
+/// exact bounds match; callers that need exact results test again (see
+/// SpatialIndex). Queries never allocate except for trees deeper than
+/// StackCapacity levels.
+class PINA_API DynamicAABBTree {
+public:
+    using ProxyID = int32_t;
+    static constexpr ProxyID NullProxy = -1;
+
+    /// Traversal stack entries kept inline (balanced trees stay far below)
+    static constexpr int StackCapacity = 128;
+
+    /// @param margin Distance the fat bounds extend past the proxy bounds
+    explicit DynamicAABBTree(float margin = 0.1f);
+
+    // ========================================================================
+    // Proxies
+    // ========================================================================
+
+    /// Insert a proxy
+    ProxyID createProxy(const BoundingBox& bounds, uint32_t userData);
+
+    /// Remove a proxy
+    void destroyProxy(ProxyID proxy);
+
+    /// Update a proxy's bounds
+    /// @return true if the bounds left the fat bounds and the proxy was reinserted
+    bool moveProxy(ProxyID proxy, const BoundingBox& bounds);
+
+    /// Get the value passed to createProxy()
+    uint32_t getUserData(ProxyID proxy) const { return m_nodes[proxy].userData; }
+
+    /// Get the fat bounds stored for a proxy
+    const BoundingBox& getFatBounds(ProxyID proxy) const { return m_nodes[proxy].bounds; }
+
+    /// Remove every proxy
+    void clear();
+
+    // ========================================================================
+    // Info
+    // ========================================================================
+
+    /// Number of proxies
+    size_t getProxyCount() const { return m_proxyCount; }
+
+    /// Height of the tree (0 = empty or a single leaf)
+    int getHeight() const { return m_root != NullProxy ? m_nodes[m_root].height : 0; }
+
+    /// Sum of internal node surface areas over the root's (lower is better)
+    float getAreaRatio() const;
+
+    /// Check parent links, heights and enclosing bounds (for tests)
+    bool validate() const;
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+    // Callbacks take the ProxyID and return true to continue, false to stop.
+
+    /// Proxies whose fat bounds overlap a box
+    template<typename Callback>
+    void query(const BoundingBox& box, Callback&& callback) const {
+        Stack stack;
+        stack.push(m_root);
+        while (!stack.empty()) {
+            ProxyID id = stack.pop();
+            if (id == NullProxy) continue;
+
+            const TreeNode& node = m_nodes[id];
+            if (!node.bounds.intersects(box)) continue;
+
+            if (node.isLeaf()) {
+                if (!callback(id)) return;
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+    }
+
+    /// Proxies whose fat bounds are at least partly inside a frustum
+    /// Subtrees fully inside are reported without further plane tests.
+    template<typename Callback>
+    void query(const Frustum& frustum, Callback&& callback) const {
+        Stack stack;
+        stack.push(m_root);
+        while (!stack.empty()) {
+            ProxyID id = stack.pop();
+            if (id == NullProxy) continue;
+
+            const TreeNode& node = m_nodes[id];
+            Frustum::Containment containment = frustum.classify(node.bounds);
+            if (containment == Frustum::Containment::Outside) continue;
+
+            if (containment == Frustum::Containment::Inside) {
+                if (!reportAll(id, callback)) return;
+            } else if (node.isLeaf()) {
+                if (!callback(id)) return;
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+    }
+
+    /// Proxies whose fat bounds overlap a sphere
+    template<typename Callback>
+    void querySphere(const glm::vec3& center, float radius, Callback&& callback) const {
+        float radiusSquared = radius * radius;
+        Stack stack;
+        stack.push(m_root);
+        while (!stack.empty()) {
+            ProxyID id = stack.pop();
+            if (id == NullProxy) continue;
+
+            const TreeNode& node = m_nodes[id];
+            if (node.bounds.distanceSquared(center) > radiusSquared) continue;
+
+            if (node.isLeaf()) {
+                if (!callback(id)) return;
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+    }
+
+    /// Proxies whose fat bounds a ray enters within maxDistance
+    /// The callback takes (ProxyID, entryDistance) and returns the new
+    /// maximum distance: maxDistance to continue, a smaller value to clip
+    /// the ray (e.g. at a confirmed hit), or a negative value to stop.
+    template<typename Callback>
+    void raycast(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                 Callback&& callback) const {
+        glm::vec3 invDirection = glm::vec3(1.0f) / direction;
+        Stack stack;
+        stack.push(m_root);
+        while (!stack.empty()) {
+            ProxyID id = stack.pop();
+            if (id == NullProxy) continue;
+
+            const TreeNode& node = m_nodes[id];
+            float entry;
+            if (!node.bounds.intersectsRay(origin, invDirection, maxDistance, entry)) continue;
+
+            if (node.isLeaf()) {
+                float result = callback(id, entry);
+                if (result < 0.0f) return;
+                maxDistance = result;
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+    }
+
+    /// Find the k proxies nearest to a point
+    /// @param distanceSquared Exact squared distance of a proxy, called with a
+    ///        ProxyID; must not be less than the fat bounds' distance
+    /// @param out Receives (squared distance, proxy) pairs, nearest first
+    template<typename Distance>
+    void findNearest(const glm::vec3& point, size_t k, Distance&& distanceSquared,
+                     std::vector<std::pair<float, ProxyID>>& out) const {
+        out.clear();
+        if (k == 0 || m_root == NullProxy) return;
+
+        // Best-first: expand the closest subtree until it can't beat the k-th hit
+        using Entry = std::pair<float, ProxyID>;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        open.push({m_nodes[m_root].bounds.distanceSquared(point), m_root});
+
+        while (!open.empty()) {
+            Entry top = open.top();
+            if (out.size() == k && top.first >= out.front().first) break;
+            open.pop();
+
+            const TreeNode& node = m_nodes[top.second];
+            if (node.isLeaf()) {
+                float d = distanceSquared(top.second);
+                if (out.size() < k) {
+                    out.push_back({d, top.second});
+                    std::push_heap(out.begin(), out.end());
+                } else if (d < out.front().first) {
+                    std::pop_heap(out.begin(), out.end());
+                    out.back() = {d, top.second};
+                    std::push_heap(out.begin(), out.end());
+                }
+            } else {
+                open.push({m_nodes[node.child1].bounds.distanceSquared(point), node.child1});
+                open.push({m_nodes[node.child2].bounds.distanceSquared(point), node.child2});
+            }
+        }
+        std::sort_heap(out.begin(), out.end());
+    }
+
+private:
+    struct TreeNode {
+        BoundingBox bounds;
+        ProxyID parent = NullProxy;     // Next free node while on the free list
+        ProxyID child1 = NullProxy;
+        ProxyID child2 = NullProxy;
+        int32_t height = -1;            // 0 = leaf, -1 = free
+        uint32_t userData = 0;
+
+        bool isLeaf() const { return child1 == NullProxy; }
+    };
+
+    /// Traversal stack with inline storage
+    class Stack {
+    public:
+        void push(ProxyID id) {
+            if (m_count < StackCapacity) {
+                m_items[m_count] = id;
+            } else {
+                m_overflow.push_back(id);
+            }
+            m_count++;
+        }
+
+        ProxyID pop() {
+            m_count--;
+            if (m_count < StackCapacity) return m_items[m_count];
+            ProxyID id = m_overflow.back();
+            m_overflow.pop_back();
+            return id;
+        }
+
+        bool empty() const { return m_count == 0; }
+
+    private:
+        ProxyID m_items[StackCapacity];
+        std::vector<ProxyID> m_overflow;
+        int m_count = 0;
+    };
+
+    /// Report every leaf below a node
+    template<typename Callback>
+    bool reportAll(ProxyID root, Callback& callback) const {
+        Stack stack;
+        stack.push(root);
+        while (!stack.empty()) {
+            ProxyID id = stack.pop();
+            const TreeNode& node = m_nodes[id];
+            if (node.isLeaf()) {
+                if (!callback(id)) return false;
+            } else {
+                stack.push(node.child1);
+                stack.push(node.child2);
+            }
+        }
+        return true;
+    }
+
+    ProxyID allocateNode();
+    void freeNode(ProxyID id);
+
+    void insertLeaf(ProxyID leaf);
+    void removeLeaf(ProxyID leaf);
+
+    /// Rotate around a node if its children's heights differ by more than one
+    /// @return The node now at this position
+    ProxyID balance(ProxyID a);
+
+    /// Refit bounds and heights from a node up to the root, balancing
+    void refitUpward(ProxyID id);
+
+    std::vector<TreeNode> m_nodes;
+    ProxyID m_root = NullProxy;
+    ProxyID m_freeList = NullProxy;
+    size_t m_proxyCount = 0;
+    float m_margin;
+};
+
+} // namespace Pina
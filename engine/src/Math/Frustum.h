@@ -0,0 +1,99 @@
+#pragma once
+
+/// Pina Engine - Frustum
+/// View frustum planes for culling bounding boxes and spheres
+
+#include "../Core/Export.h"
+#include "BoundingBox.h"
+#include <glm/glm.hpp>
+
+namespace Pina {
+
+/// View frustum as six inward-facing planes
+/// Planes are stored as (normal, distance) with unit normals, so
+/// dot(normal, p) + distance is the signed distance of p (positive inside).
+struct PINA_API Frustum {
+    enum Side { Left, Right, Bottom, Top, Near, Far, SideCount };
+
+    /// Result of classifying a volume against the frustum
+    enum class Containment { Outside, Intersects, Inside };
+
+    glm::vec4 planes[SideCount];
+
+    /// Frustum containing everything
+    Frustum() {
+        for (glm::vec4& plane : planes) {
+            plane = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        }
+    }
+
+    /// Extract the planes of a view-projection matrix (OpenGL clip space)
+    explicit Frustum(const glm::mat4& viewProjection) {
+        glm::vec4 rows[4];
+        for (int i = 0; i < 4; ++i) {
+            rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i],
+                                viewProjection[2][i], viewProjection[3][i]);
+        }
+        planes[Left] = rows[3] + rows[0];
+        planes[Right] = rows[3] - rows[0];
+        planes[Bottom] = rows[3] + rows[1];
+        planes[Top] = rows[3] - rows[1];
+        planes[Near] = rows[3] + rows[2];
+        planes[Far] = rows[3] - rows[2];
+
+        for (glm::vec4& plane : planes) {
+            float length = glm::length(glm::vec3(plane));
+            if (length > 0.0f) {
+                plane /= length;
+            }
+        }
+    }
+
+    /// Check if a point is inside
+    bool contains(const glm::vec3& point) const {
+        for (const glm::vec4& plane : planes) {
+            if (glm::dot(glm::vec3(plane), point) + plane.w < 0.0f) return false;
+        }
+        return true;
+    }
+
+    /// Check if a box is at least partly inside (conservative near corners)
+    bool intersects(const BoundingBox& box) const {
+        for (const glm::vec4& plane : planes) {
+            // Corner furthest along the plane normal
+            glm::vec3 positive(plane.x >= 0.0f ? box.max.x : box.min.x,
+                               plane.y >= 0.0f ? box.max.y : box.min.y,
+                               plane.z >= 0.0f ? box.max.z : box.min.z);
+            if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) return false;
+        }
+        return true;
+    }
+
+    /// Check if a sphere is at least partly inside
+    bool intersects(const glm::vec3& center, float radius) const {
+        for (const glm::vec4& plane : planes) {
+            if (glm::dot(glm::vec3(plane), center) + plane.w < -radius) return false;
+        }
+        return true;
+    }
+
+    /// Classify a box as outside, crossing the boundary, or fully inside
+    Containment classify(const BoundingBox& box) const {
+        Containment result = Containment::Inside;
+        for (const glm::vec4& plane : planes) {
+            glm::vec3 normal(plane);
+            glm::vec3 positive(plane.x >= 0.0f ? box.max.x : box.min.x,
+                               plane.y >= 0.0f ? box.max.y : box.min.y,
+                               plane.z >= 0.0f ? box.max.z : box.min.z);
+            if (glm::dot(normal, positive) + plane.w < 0.0f) return Containment::Outside;
+
+            glm::vec3 negative(plane.x >= 0.0f ? box.min.x : box.max.x,
+                               plane.y >= 0.0f ? box.min.y : box.max.y,
+                               plane.z >= 0.0f ? box.min.z : box.max.z);
+            if (glm::dot(normal, negative) + plane.w < 0.0f) result = Containment::Intersects;
+        }
+        return result;
+    }
+};
+
+} // namespace Pina
@@ -0,0 +1,444 @@
+#include "MeshBVH.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Pina {
+
+namespace {
+
+/// Triangles per job chunk in parallel build passes
+constexpr size_t ChunkSize = 4096;
+
+/// Relative cost of visiting a node (one triangle test = 1)
+constexpr float TraversalCost = 1.0f;
+
+size_t chunkCount(size_t begin, size_t end, JobSystem* jobs) {
+    if (!jobs || end - begin < MeshBVH::ParallelThreshold) return 1;
+    return (end - begin + ChunkSize - 1) / ChunkSize;
+}
+
+/// Call fn(chunk, chunkBegin, chunkEnd) for each chunk of [begin, end),
+/// on the job system if there is more than one
+template<typename Fn>
+void forEachChunk(size_t begin, size_t end, size_t chunks, JobSystem* jobs, Fn&& fn) {
+    if (chunks == 1) {
+        fn(size_t(0), begin, end);
+        return;
+    }
+    jobs->parallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+        for (size_t chunk = first; chunk < last; ++chunk) {
+            size_t chunkBegin = begin + chunk * ChunkSize;
+            fn(chunk, chunkBegin, std::min(chunkBegin + ChunkSize, end));
+        }
+    });
+}
+
+/// Bin of a centroid coordinate (the build and the partition must agree)
+uint32_t binIndex(float centroid, float min, float scale) {
+    int bin = static_cast<int>((centroid - min) * scale);
+    return static_cast<uint32_t>(std::min(std::max(bin, 0), static_cast<int>(MeshBVH::BinCount) - 1));
+}
+
+/// Surface area that is 0 (not negative) for invalid boxes
+float area(const BoundingBox& box) {
+    return box.isValid() ? box.getSurfaceArea() : 0.0f;
+}
+
+} // namespace
+
+// ============================================================================
+// Build
+// ============================================================================
+
+void MeshBVH::build(const glm::vec3* positions, const uint32_t* indices, size_t triangleCount,
+                    JobSystem* jobs) {
+    PINA_PROFILE_FUNCTION();
+
+    clear();
+    if (triangleCount == 0) return;
+
+    // Per-triangle bounds and centroids
+    m_triangleBounds.resize(triangleCount);
+    m_centroids.resize(triangleCount);
+    m_order.resize(triangleCount);
+    forEachChunk(0, triangleCount, chunkCount(0, triangleCount, jobs), jobs,
+                 [&](size_t, size_t begin, size_t end) {
+        for (size_t t = begin; t < end; ++t) {
+            BoundingBox bounds;
+            bounds.expand(positions[indices[t * 3]]);
+            bounds.expand(positions[indices[t * 3 + 1]]);
+            bounds.expand(positions[indices[t * 3 + 2]]);
+            m_triangleBounds[t] = bounds;
+            m_centroids[t] = bounds.getCenter();
+            m_order[t] = static_cast<uint32_t>(t);
+        }
+    });
+
+    // Split the top of the tree, leaving nodes below ParallelThreshold as subtrees
+    std::vector<BuildTask> subtrees;
+    m_nodes.reserve(triangleCount / 2 + 1);
+    m_nodes.emplace_back();
+    m_depth = buildNodes(m_nodes, {0, 0, static_cast<uint32_t>(triangleCount), 0}, jobs, &subtrees);
+
+    // Build the subtrees independently, then append them in order, so the
+    // layout does not depend on which worker finished first
+    std::vector<std::vector<Node>> subtreeNodes(subtrees.size());
+    std::vector<uint32_t> subtreeDepths(subtrees.size());
+    auto buildSubtrees = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            BuildTask task = subtrees[i];
+            task.node = 0;
+            subtreeNodes[i].emplace_back();
+            subtreeDepths[i] = buildNodes(subtreeNodes[i], task, nullptr, nullptr);
+        }
+    };
+    if (jobs) {
+        jobs->parallelFor(0, subtrees.size(), 1, buildSubtrees);
+    } else {
+        buildSubtrees(0, subtrees.size());
+    }
+
+    for (size_t i = 0; i < subtrees.size(); ++i) {
+        // Local node k > 0 goes to offset + k - 1; the local root replaces the placeholder
+        const std::vector<Node>& nodes = subtreeNodes[i];
+        const uint32_t offset = static_cast<uint32_t>(m_nodes.size());
+        auto relocate = [offset](Node node) {
+            if (!node.isLeaf()) node.first = offset + node.first - 1;
+            return node;
+        };
+        m_nodes[subtrees[i].node] = relocate(nodes[0]);
+        for (size_t k = 1; k < nodes.size(); ++k) {
+            m_nodes.push_back(relocate(nodes[k]));
+        }
+        m_depth = std::max(m_depth, subtreeDepths[i]);
+    }
+
+    m_nodes.shrink_to_fit();
+    m_triangleBounds.clear();
+    m_triangleBounds.shrink_to_fit();
+    m_centroids.clear();
+    m_centroids.shrink_to_fit();
+}
+
+uint32_t MeshBVH::buildNodes(std::vector<Node>& nodes, const BuildTask& root, JobSystem* jobs,
+                             std::vector<BuildTask>* subtrees) {
+    uint32_t depth = 0;
+    std::vector<BuildTask> tasks = {root};
+    while (!tasks.empty()) {
+        BuildTask task = tasks.back();
+        tasks.pop_back();
+
+        const uint32_t count = task.end - task.begin;
+        if (subtrees && count < ParallelThreshold) {
+            subtrees->push_back(task);
+            continue;
+        }
+
+        BoundingBox bounds, centroidBounds;
+        computeBounds(task.begin, task.end, bounds, centroidBounds, jobs);
+        nodes[task.node].bounds = bounds;
+        depth = std::max(depth, task.depth);
+
+        auto makeLeaf = [&]() {
+            nodes[task.node].first = task.begin;
+            nodes[task.node].count = count;
+        };
+        if (count == 1 || task.depth >= MaxDepth) {
+            makeLeaf();
+            continue;
+        }
+
+        // Lowest SAH cost over the bin boundaries of every axis
+        Binning binning;
+        computeBins(task.begin, task.end, centroidBounds, binning, jobs);
+        glm::vec3 extent = centroidBounds.getSize();
+
+        int bestAxis = -1;
+        uint32_t bestSplit = 0;
+        float bestCost = 0.0f;
+        for (int axis = 0; axis < 3; ++axis) {
+            if (!(extent[axis] > 0.0f)) continue;
+
+            // Right side areas and counts, sweeping from the last bin
+            const Bin* bins = binning.bins[axis];
+            float rightArea[BinCount];
+            uint32_t rightCount[BinCount];
+            BoundingBox right;
+            uint32_t rightSum = 0;
+            for (uint32_t i = BinCount - 1; i > 0; --i) {
+                right.expand(bins[i].bounds);
+                rightSum += bins[i].count;
+                rightArea[i] = area(right);
+                rightCount[i] = rightSum;
+            }
+
+            // Split after bin i: [0, i] on the left, [i + 1, BinCount) on the right
+            BoundingBox left;
+            uint32_t leftSum = 0;
+            for (uint32_t i = 0; i + 1 < BinCount; ++i) {
+                left.expand(bins[i].bounds);
+                leftSum += bins[i].count;
+                if (leftSum == 0 || rightCount[i + 1] == 0) continue;
+                float cost = area(left) * leftSum + rightArea[i + 1] * rightCount[i + 1];
+                if (bestAxis < 0 || cost < bestCost) {
+                    bestAxis = axis;
+                    bestSplit = i;
+                    bestCost = cost;
+                }
+            }
+        }
+
+        uint32_t* order = m_order.data();
+        uint32_t middle;
+        float nodeArea = area(bounds);
+        bool splitCheaper = bestAxis >= 0 && nodeArea > 0.0f &&
+                            TraversalCost + bestCost / nodeArea < static_cast<float>(count);
+        if (bestAxis >= 0 && (splitCheaper || count > MaxLeafSize)) {
+            float min = centroidBounds.min[bestAxis];
+            float scale = BinCount / extent[bestAxis];
+            const int axis = bestAxis;
+            middle = static_cast<uint32_t>(
+                std::partition(order + task.begin, order + task.end, [&](uint32_t t) {
+                    return binIndex(m_centroids[t][axis], min, scale) <= bestSplit;
+                }) - order);
+        } else if (count > MaxLeafSize) {
+            // Every centroid in one spot: no bin separates them, split the range in half
+            middle = task.begin + count / 2;
+        } else {
+            makeLeaf();
+            continue;
+        }
+
+        uint32_t left = static_cast<uint32_t>(nodes.size());
+        nodes.emplace_back();
+        nodes.emplace_back();
+        nodes[task.node].first = left;
+        nodes[task.node].count = 0;
+
+        // Left first, so children are laid out depth-first
+        tasks.push_back({left + 1, middle, task.end, task.depth + 1});
+        tasks.push_back({left, task.begin, middle, task.depth + 1});
+    }
+    return depth;
+}
+
+void MeshBVH::clear() {
+    m_nodes.clear();
+    m_order.clear();
+    m_depth = 0;
+}
+
+void MeshBVH::computeBounds(size_t begin, size_t end, BoundingBox& bounds, BoundingBox& centroidBounds,
+                            JobSystem* jobs) const {
+    struct Partial {
+        BoundingBox bounds;
+        BoundingBox centroids;
+    };
+    auto accumulate = [this](Partial& partial, size_t chunkBegin, size_t chunkEnd) {
+        for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+            uint32_t t = m_order[i];
+            partial.bounds.expand(m_triangleBounds[t]);
+            partial.centroids.expand(m_centroids[t]);
+        }
+    };
+
+    Partial total;
+    size_t chunks = chunkCount(begin, end, jobs);
+    if (chunks == 1) {
+        accumulate(total, begin, end);
+    } else {
+        std::vector<Partial> partials(chunks);
+        forEachChunk(begin, end, chunks, jobs, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+            accumulate(partials[chunk], chunkBegin, chunkEnd);
+        });
+        for (const Partial& partial : partials) {
+            total.bounds.expand(partial.bounds);
+            total.centroids.expand(partial.centroids);
+        }
+    }
+    bounds = total.bounds;
+    centroidBounds = total.centroids;
+}
+
+void MeshBVH::computeBins(size_t begin, size_t end, const BoundingBox& centroidBounds, Binning& binning,
+                          JobSystem* jobs) const {
+    glm::vec3 extent = centroidBounds.getSize();
+    glm::vec3 scale;
+    for (int axis = 0; axis < 3; ++axis) {
+        scale[axis] = extent[axis] > 0.0f ? BinCount / extent[axis] : 0.0f;
+    }
+    auto accumulate = [&](Binning& partial, size_t chunkBegin, size_t chunkEnd) {
+        for (size_t i = chunkBegin; i < chunkEnd; ++i) {
+            uint32_t t = m_order[i];
+            for (int axis = 0; axis < 3; ++axis) {
+                Bin& bin = partial.bins[axis][binIndex(m_centroids[t][axis], centroidBounds.min[axis], scale[axis])];
+                bin.bounds.expand(m_triangleBounds[t]);
+                bin.count++;
+            }
+        }
+    };
+
+    binning = Binning();
+    size_t chunks = chunkCount(begin, end, jobs);
+    if (chunks == 1) {
+        accumulate(binning, begin, end);
+        return;
+    }
+
+    std::vector<Binning> partials(chunks);
+    forEachChunk(begin, end, chunks, jobs, [&](size_t chunk, size_t chunkBegin, size_t chunkEnd) {
+        accumulate(partials[chunk], chunkBegin, chunkEnd);
+    });
+    for (const Binning& partial : partials) {
+        for (int axis = 0; axis < 3; ++axis) {
+            for (uint32_t i = 0; i < BinCount; ++i) {
+                binning.bins[axis][i].bounds.expand(partial.bins[axis][i].bounds);
+                binning.bins[axis][i].count += partial.bins[axis][i].count;
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+bool MeshBVH::raycast(const glm::vec3* positions, const uint32_t* indices, const glm::vec3& origin,
+                      const glm::vec3& direction, float maxDistance, TriangleHit& hit) const {
+    if (m_nodes.empty()) return false;
+
+    glm::vec3 invDirection = glm::vec3(1.0f) / direction;
+    float closest = maxDistance;
+    bool found = false;
+
+    // Nodes to visit with their entry distances; one pending sibling per level at most
+    struct Entry {
+        uint32_t node;
+        float entry;
+    };
+    Entry stack[MaxDepth + 2];
+    int size = 0;
+
+    float entry;
+    if (!m_nodes[0].bounds.intersectsRay(origin, invDirection, closest, entry)) return false;
+    stack[size++] = {0, entry};
+
+    while (size > 0) {
+        Entry top = stack[--size];
+        if (top.entry > closest) continue;
+
+        const Node& node = m_nodes[top.node];
+        if (node.isLeaf()) {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                uint32_t t = m_order[i];
+                float distance, u, v;
+                if (intersectTriangle(origin, direction, positions[indices[t * 3]], positions[indices[t * 3 + 1]],
+                                      positions[indices[t * 3 + 2]], closest, distance, u, v) &&
+                    (!found || distance < closest)) {
+                    found = true;
+                    closest = distance;
+                    hit.triangle = t;
+                    hit.distance = distance;
+                    hit.u = u;
+                    hit.v = v;
+                }
+            }
+            continue;
+        }
+
+        // Visit the nearer child first
+        float leftEntry, rightEntry;
+        bool leftHit = m_nodes[node.first].bounds.intersectsRay(origin, invDirection, closest, leftEntry);
+        bool rightHit = m_nodes[node.first + 1].bounds.intersectsRay(origin, invDirection, closest, rightEntry);
+        if (leftHit && rightHit) {
+            if (leftEntry <= rightEntry) {
+                stack[size++] = {node.first + 1, rightEntry};
+                stack[size++] = {node.first, leftEntry};
+            } else {
+                stack[size++] = {node.first, leftEntry};
+                stack[size++] = {node.first + 1, rightEntry};
+            }
+        } else if (leftHit) {
+            stack[size++] = {node.first, leftEntry};
+        } else if (rightHit) {
+            stack[size++] = {node.first + 1, rightEntry};
+        }
+    }
+    return found;
+}
+
+bool MeshBVH::intersectTriangle(const glm::vec3& origin, const glm::vec3& direction,
+                                const glm::vec3& a, const glm::vec3& b, const glm::vec3& c,
+                                float maxDistance, float& distance, float& u, float& v) {
+    glm::vec3 edge1 = b - a;
+    glm::vec3 edge2 = c - a;
+    glm::vec3 p = glm::cross(direction, edge2);
+    float determinant = glm::dot(edge1, p);
+    if (determinant == 0.0f) return false;  // Parallel to the triangle's plane
+
+    float invDeterminant = 1.0f / determinant;
+    glm::vec3 s = origin - a;
+    u = glm::dot(s, p) * invDeterminant;
+    if (u < 0.0f || u > 1.0f) return false;
+
+    glm::vec3 q = glm::cross(s, edge1);
+    v = glm::dot(direction, q) * invDeterminant;
+    if (v < 0.0f || u + v > 1.0f) return false;
+
+    distance = glm::dot(edge2, q) * invDeterminant;
+    return distance >= 0.0f && distance <= maxDistance;
+}
+
+// ============================================================================
+// Info
+// ============================================================================
+
+float MeshBVH::getCost() const {
+    if (m_nodes.empty()) return 0.0f;
+    float rootArea = area(m_nodes[0].bounds);
+    if (rootArea <= 0.0f) return 0.0f;
+
+    float cost = 0.0f;
+    for (const Node& node : m_nodes) {
+        cost += area(node.bounds) * (node.isLeaf() ? static_cast<float>(node.count) : TraversalCost);
+    }
+    return cost / rootArea;
+}
+
+bool MeshBVH::validate(const glm::vec3* positions, const uint32_t* indices) const {
+    if (m_nodes.empty()) return m_order.empty();
+
+    std::vector<uint8_t> seen(m_order.size(), 0);
+    std::vector<uint32_t> stack = {0};
+    while (!stack.empty()) {
+        const Node& node = m_nodes[stack.back()];
+        stack.pop_back();
+
+        if (node.isLeaf()) {
+            if (static_cast<size_t>(node.first) + node.count > m_order.size()) return false;
+            for (uint32_t i = node.first; i < node.first + node.count; ++i) {
+                uint32_t t = m_order[i];
+                if (t >= seen.size() || seen[t]) return false;
+                seen[t] = 1;
+                BoundingBox triangle;
+                triangle.expand(positions[indices[t * 3]]);
+                triangle.expand(positions[indices[t * 3 + 1]]);
+                triangle.expand(positions[indices[t * 3 + 2]]);
+                if (!node.bounds.contains(triangle)) return false;
+            }
+        } else {
+            if (static_cast<size_t>(node.first) + 1 >= m_nodes.size()) return false;
+            if (!node.bounds.contains(m_nodes[node.first].bounds) ||
+                !node.bounds.contains(m_nodes[node.first + 1].bounds)) {
+                return false;
+            }
+            stack.push_back(node.first);
+            stack.push_back(node.first + 1);
+        }
+    }
+    return std::find(seen.begin(), seen.end(), 0) == seen.end();
+}
+
+} // namespace Pina
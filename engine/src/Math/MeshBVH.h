@@ -0,0 +1,167 @@
+#pragma once
+
+/// Pina Engine - Mesh BVH
+/// Static bounding volume hierarchy over the triangles of one mesh, for raycasts
+
+#include "../Core/Export.h"
+#include "BoundingBox.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Pina {
+
+class JobSystem;
+
+/// Nearest triangle found by MeshBVH::raycast()
+struct PINA_API TriangleHit {
+    uint32_t triangle = 0;      // Triangle index (indices 3 * triangle .. 3 * triangle + 2)
+    float distance = 0.0f;      // Ray parameter at the hit
+    float u = 0.0f;             // Barycentric weight of the triangle's second vertex
+    float v = 0.0f;             // Barycentric weight of the triangle's third vertex
+};
+
+/// Bounding volume hierarchy over indexed triangles, built once with the
+/// surface area heuristic (SAH)
+///
+/// Each node is split where BinCount centroid bins along the best axis give
+/// the lowest SAH cost, or becomes a leaf when no split is cheaper than
+/// testing its triangles (nodes above MaxLeafSize are always split). The
+/// tree only stores the triangle order; the positions and indices are
+/// passed back in for raycasts, so they must not change after build().
+///
+/// Nodes down to ParallelThreshold triangles are split first (binning them
+/// in parallel chunks with a JobSystem); the subtrees below are then built
+/// independently, one job each, and appended in a fixed order. Binning only
+/// takes minima, maxima and counts, so the tree is identical to a serial
+/// build.
+class PINA_API MeshBVH {
+public:
+    /// Centroid bins per axis when choosing a split
+    static constexpr uint32_t BinCount = 16;
+
+    /// Triangles a leaf may hold at most
+    static constexpr uint32_t MaxLeafSize = 8;
+
+    /// Deeper nodes are made leaves (bounds the traversal stack)
+    static constexpr uint32_t MaxDepth = 64;
+
+    /// Triangles in a node at which its build passes run on the job system
+    static constexpr size_t ParallelThreshold = 16384;
+
+    /// Tree node (32 bytes)
+    struct Node {
+        BoundingBox bounds;
+        uint32_t first = 0;     // Leaf: first entry in the triangle order; interior: left child (right = first + 1)
+        uint32_t count = 0;     // Triangles in a leaf (0 = interior node)
+
+        bool isLeaf() const { return count != 0; }
+    };
+
+    MeshBVH() = default;
+
+    // ========================================================================
+    // Build
+    // ========================================================================
+
+    /// Build the tree over triangleCount triangles
+    /// @param positions Vertex positions
+    /// @param indices Three vertex indices per triangle
+    /// @param jobs Job system for large builds (nullptr = serial)
+    void build(const glm::vec3* positions, const uint32_t* indices, size_t triangleCount,
+               JobSystem* jobs = nullptr);
+
+    /// Release the tree
+    void clear();
+
+    /// Check if the tree holds any triangles
+    bool isBuilt() const { return !m_nodes.empty(); }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /// Find the nearest triangle hit by origin + t * direction, 0 <= t <= maxDistance
+    /// The direction need not be normalized; distances are in units of t.
+    /// Triangles are hit from either side.
+    /// @param positions, indices The arrays the tree was built from
+    /// @return true if a triangle was hit (hit receives it)
+    bool raycast(const glm::vec3* positions, const uint32_t* indices, const glm::vec3& origin,
+                 const glm::vec3& direction, float maxDistance, TriangleHit& hit) const;
+
+    /// Intersect one triangle (Moller-Trumbore, both sides)
+    /// @return true if hit with 0 <= distance <= maxDistance
+    static bool intersectTriangle(const glm::vec3& origin, const glm::vec3& direction,
+                                  const glm::vec3& a, const glm::vec3& b, const glm::vec3& c,
+                                  float maxDistance, float& distance, float& u, float& v);
+
+    // ========================================================================
+    // Info
+    // ========================================================================
+
+    /// Bounds of every triangle
+    BoundingBox getBounds() const { return m_nodes.empty() ? BoundingBox() : m_nodes[0].bounds; }
+
+    size_t getNodeCount() const { return m_nodes.size(); }
+    size_t getTriangleCount() const { return m_order.size(); }
+    const std::vector<Node>& getNodes() const { return m_nodes; }
+
+    /// Triangle indices in leaf order (leaves refer to ranges of it)
+    const std::vector<uint32_t>& getTriangleOrder() const { return m_order; }
+
+    /// Depth of the deepest leaf (0 = the root is a leaf)
+    uint32_t getDepth() const { return m_depth; }
+
+    /// SAH cost of the tree relative to the root's area (lower is better)
+    float getCost() const;
+
+    /// Check that every triangle sits in exactly one leaf and that node
+    /// bounds enclose their children and triangles (for tests)
+    bool validate(const glm::vec3* positions, const uint32_t* indices) const;
+
+private:
+    /// Bounds and triangle count of a bin
+    struct Bin {
+        BoundingBox bounds;
+        uint32_t count = 0;
+    };
+
+    /// Bins along each axis
+    struct Binning {
+        Bin bins[3][BinCount];
+    };
+
+    /// Node range still to be split
+    struct BuildTask {
+        uint32_t node;          // Index in the node array being built
+        uint32_t begin;         // Range of m_order
+        uint32_t end;
+        uint32_t depth;
+    };
+
+    /// Split nodes starting at root until every leaf is final, or, with
+    /// subtrees set, until the remaining ranges are below ParallelThreshold
+    /// (those are appended to subtrees unsplit)
+    /// @return Depth of the deepest node processed
+    uint32_t buildNodes(std::vector<Node>& nodes, const BuildTask& root, JobSystem* jobs,
+                        std::vector<BuildTask>* subtrees);
+
+    /// Bounds of the triangles and of their centroids in m_order[begin, end)
+    void computeBounds(size_t begin, size_t end, BoundingBox& bounds, BoundingBox& centroidBounds,
+                       JobSystem* jobs) const;
+
+    /// Bin the centroids of m_order[begin, end)
+    void computeBins(size_t begin, size_t end, const BoundingBox& centroidBounds, Binning& binning,
+                     JobSystem* jobs) const;
+
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_order;
+    uint32_t m_depth = 0;
+
+    // Build scratch (released after build())
+    std::vector<BoundingBox> m_triangleBounds;
+    std::vector<glm::vec3> m_centroids;
+};
+
+} // namespace Pina
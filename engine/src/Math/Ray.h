@@ -4,6 +4,7 @@
 /// Represents a ray with origin and direction
 
 #include "../Core/Export.h"
+#include "Vector2.h"
 #include "Vector3.h"
 #include <glm/vec3.hpp>
 
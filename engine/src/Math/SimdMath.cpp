@@ -0,0 +1,202 @@
+#include "SimdMath.h"
+
+namespace Pina {
+
+#ifdef PINA_SIMD_SSE
+using namespace SimdDetail;
+
+namespace {
+
+/// Load four packed vec3s (12 floats) as x, y and z lanes
+inline void loadSoA(const float* p, __m128& x, __m128& y, __m128& z) {
+    __m128 a = load4(p);        // x0 y0 z0 x1
+    __m128 b = load4(p + 4);    // y1 z1 x2 y2
+    __m128 c = load4(p + 8);    // z2 x3 y3 z3
+
+    __m128 t = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+    x = _mm_shuffle_ps(a, t, _MM_SHUFFLE(2, 0, 3, 0));
+    t = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+    __m128 u = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+    y = _mm_shuffle_ps(t, u, _MM_SHUFFLE(2, 0, 2, 0));
+    t = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+    z = _mm_shuffle_ps(t, c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+/// Store x, y and z lanes as four packed vec3s
+inline void storeSoA(float* p, __m128 x, __m128 y, __m128 z) {
+    __m128 t = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 u = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+    store4(p, _mm_shuffle_ps(t, u, _MM_SHUFFLE(2, 0, 2, 0)));
+    t = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+    u = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+    store4(p + 4, _mm_shuffle_ps(t, u, _MM_SHUFFLE(2, 0, 2, 0)));
+    t = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+    u = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+    store4(p + 8, _mm_shuffle_ps(t, u, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+} // namespace
+#endif
+
+// ============================================================================
+// Matrix Arrays
+// ============================================================================
+
+void SimdMath::composeTRS(const glm::vec3* positions, const glm::quat* rotations, const glm::vec3* scales,
+                          glm::mat4* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = composeTRS(positions[i], rotations[i], scales[i]);
+    }
+}
+
+void SimdMath::multiplyAffine(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = multiplyAffine(a[i], b[i]);
+    }
+}
+
+void SimdMath::inverseAffine(const glm::mat4* matrices, glm::mat4* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = inverseAffine(matrices[i]);
+    }
+}
+
+void SimdMath::normalMatrix(const glm::mat4* matrices, glm::mat3* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = normalMatrix(matrices[i]);
+    }
+}
+
+// ============================================================================
+// Point and Normal Arrays
+// ============================================================================
+
+void SimdMath::transformPoints(const glm::mat4& m, const glm::vec3* points, glm::vec3* out, size_t count) {
+    size_t i = 0;
+#ifdef PINA_SIMD_SSE
+    // Four points per iteration, with the matrix splatted once
+    const __m128 m00 = _mm_set1_ps(m[0][0]), m01 = _mm_set1_ps(m[0][1]), m02 = _mm_set1_ps(m[0][2]);
+    const __m128 m10 = _mm_set1_ps(m[1][0]), m11 = _mm_set1_ps(m[1][1]), m12 = _mm_set1_ps(m[1][2]);
+    const __m128 m20 = _mm_set1_ps(m[2][0]), m21 = _mm_set1_ps(m[2][1]), m22 = _mm_set1_ps(m[2][2]);
+    const __m128 m30 = _mm_set1_ps(m[3][0]), m31 = _mm_set1_ps(m[3][1]), m32 = _mm_set1_ps(m[3][2]);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        loadSoA(&points[i].x, x, y, z);
+        __m128 rx = madd(m20, z, madd(m10, y, madd(m00, x, m30)));
+        __m128 ry = madd(m21, z, madd(m11, y, madd(m01, x, m31)));
+        __m128 rz = madd(m22, z, madd(m12, y, madd(m02, x, m32)));
+        storeSoA(&out[i].x, rx, ry, rz);
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i] = glm::vec3(m * glm::vec4(points[i], 1.0f));
+    }
+}
+
+void SimdMath::transformNormals(const glm::mat3& n, const glm::vec3* normals, glm::vec3* out,
+                                size_t count, bool normalize) {
+    size_t i = 0;
+#ifdef PINA_SIMD_SSE
+    const __m128 n00 = _mm_set1_ps(n[0][0]), n01 = _mm_set1_ps(n[0][1]), n02 = _mm_set1_ps(n[0][2]);
+    const __m128 n10 = _mm_set1_ps(n[1][0]), n11 = _mm_set1_ps(n[1][1]), n12 = _mm_set1_ps(n[1][2]);
+    const __m128 n20 = _mm_set1_ps(n[2][0]), n21 = _mm_set1_ps(n[2][1]), n22 = _mm_set1_ps(n[2][2]);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 x, y, z;
+        loadSoA(&normals[i].x, x, y, z);
+        __m128 rx = madd(n20, z, madd(n10, y, _mm_mul_ps(n00, x)));
+        __m128 ry = madd(n21, z, madd(n11, y, _mm_mul_ps(n01, x)));
+        __m128 rz = madd(n22, z, madd(n12, y, _mm_mul_ps(n02, x)));
+        if (normalize) {
+            __m128 length = _mm_sqrt_ps(madd(rz, rz, madd(ry, ry, _mm_mul_ps(rx, rx))));
+            rx = _mm_div_ps(rx, length);
+            ry = _mm_div_ps(ry, length);
+            rz = _mm_div_ps(rz, length);
+        }
+        storeSoA(&out[i].x, rx, ry, rz);
+    }
+#endif
+    for (; i < count; ++i) {
+        glm::vec3 v = n * normals[i];
+        out[i] = normalize ? glm::normalize(v) : v;
+    }
+}
+
+// ============================================================================
+// Box Arrays
+// ============================================================================
+
+void SimdMath::transformBoxes(const glm::mat4* matrices, const BoundingBox* boxes, BoundingBox* out,
+                              size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = transformBox(matrices[i], boxes[i]);
+    }
+}
+
+void SimdMath::expandBox(BoundingBox& box, const glm::vec3* points, size_t count) {
+    size_t i = 0;
+#ifdef PINA_SIMD_SSE
+    if (count >= 4) {
+        __m128 minX = _mm_set1_ps(box.min.x), minY = _mm_set1_ps(box.min.y), minZ = _mm_set1_ps(box.min.z);
+        __m128 maxX = _mm_set1_ps(box.max.x), maxY = _mm_set1_ps(box.max.y), maxZ = _mm_set1_ps(box.max.z);
+        for (; i + 4 <= count; i += 4) {
+            __m128 x, y, z;
+            loadSoA(&points[i].x, x, y, z);
+            minX = _mm_min_ps(minX, x);
+            minY = _mm_min_ps(minY, y);
+            minZ = _mm_min_ps(minZ, z);
+            maxX = _mm_max_ps(maxX, x);
+            maxY = _mm_max_ps(maxY, y);
+            maxZ = _mm_max_ps(maxZ, z);
+        }
+
+        // Reduce the four lanes
+        alignas(16) float lanes[6][4];
+        _mm_store_ps(lanes[0], minX);
+        _mm_store_ps(lanes[1], minY);
+        _mm_store_ps(lanes[2], minZ);
+        _mm_store_ps(lanes[3], maxX);
+        _mm_store_ps(lanes[4], maxY);
+        _mm_store_ps(lanes[5], maxZ);
+        for (int lane = 0; lane < 4; ++lane) {
+            box.expand(glm::vec3(lanes[0][lane], lanes[1][lane], lanes[2][lane]));
+            box.expand(glm::vec3(lanes[3][lane], lanes[4][lane], lanes[5][lane]));
+        }
+    }
+#endif
+    for (; i < count; ++i) {
+        box.expand(points[i]);
+    }
+}
+
+// ============================================================================
+// Frustum Tests
+// ============================================================================
+
+SimdMath::FrustumPlanes SimdMath::preparePlanes(const Frustum& frustum) {
+    FrustumPlanes planes;
+    for (int i = 0; i < 8; ++i) {
+        const glm::vec4& plane = frustum.planes[i < Frustum::SideCount ? i : 0];
+        planes.x[i] = plane.x;
+        planes.y[i] = plane.y;
+        planes.z[i] = plane.z;
+        planes.w[i] = plane.w;
+    }
+    return planes;
+}
+
+void SimdMath::cullBoxes(const FrustumPlanes& planes, const BoundingBox* boxes, uint8_t* visible, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        visible[i] = intersects(planes, boxes[i]) ? 1 : 0;
+    }
+}
+
+void SimdMath::cullSpheres(const FrustumPlanes& planes, const glm::vec4* spheres, uint8_t* visible,
+                           size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        visible[i] = intersects(planes, glm::vec3(spheres[i]), spheres[i].w) ? 1 : 0;
+    }
+}
+
+} // namespace Pina
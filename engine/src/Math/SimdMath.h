@@ -0,0 +1,381 @@
+#pragma once
+
+/// Pina Engine - SIMD Math
+/// SSE kernels (with scalar fallback) for affine transforms, batches of points and boxes, and frustum tests
+
+#include "../Core/Export.h"
+#include "BoundingBox.h"
+#include "Frustum.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// SSE2 is part of every x86-64 target; other targets use the scalar paths.
+// Define PINA_SIMD_DISABLE to force the scalar paths everywhere.
+#if !defined(PINA_SIMD_DISABLE) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define PINA_SIMD_SSE 1
+    #include <emmintrin.h>
+    #if defined(__FMA__) || defined(__AVX2__)
+        #include <immintrin.h>
+        #define PINA_SIMD_FMA 1
+    #endif
+#endif
+
+namespace Pina {
+
+/// SIMD kernels for affine matrices (bottom row 0, 0, 0, 1)
+///
+/// Single-item kernels are inline for use in tight loops; the array versions
+/// process whole batches (points and normals four at a time). Array kernels
+/// accept out == in.
+class PINA_API SimdMath {
+public:
+    /// True when the SSE paths are compiled in
+    static constexpr bool isAccelerated() {
+#ifdef PINA_SIMD_SSE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    // ========================================================================
+    // Single Matrices
+    // ========================================================================
+
+    /// Translation * Rotation * Scale, without building three matrices
+    static glm::mat4 composeTRS(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+
+    /// a * b for affine a and b
+    static glm::mat4 multiplyAffine(const glm::mat4& a, const glm::mat4& b);
+
+    /// Inverse of an affine matrix
+    static glm::mat4 inverseAffine(const glm::mat4& m);
+
+    /// Inverse transpose of the upper 3x3 (for transforming normals)
+    static glm::mat3 normalMatrix(const glm::mat4& m);
+
+    /// Normal matrix when the upper 3x3 is a rotation times uniformScale
+    static glm::mat3 normalMatrix(const glm::mat4& m, float uniformScale);
+
+    /// Box enclosing an affine-transformed box (invalid boxes pass through)
+    static BoundingBox transformBox(const glm::mat4& m, const BoundingBox& box);
+
+    // ========================================================================
+    // Arrays
+    // ========================================================================
+
+    static void composeTRS(const glm::vec3* positions, const glm::quat* rotations, const glm::vec3* scales,
+                           glm::mat4* out, size_t count);
+
+    /// out[i] = a[i] * b[i]
+    static void multiplyAffine(const glm::mat4* a, const glm::mat4* b, glm::mat4* out, size_t count);
+
+    static void inverseAffine(const glm::mat4* matrices, glm::mat4* out, size_t count);
+
+    static void normalMatrix(const glm::mat4* matrices, glm::mat3* out, size_t count);
+
+    /// out[i] = m * (points[i], 1)
+    static void transformPoints(const glm::mat4& m, const glm::vec3* points, glm::vec3* out, size_t count);
+
+    /// out[i] = normalMatrix * normals[i], optionally normalized
+    static void transformNormals(const glm::mat3& normalMatrix, const glm::vec3* normals, glm::vec3* out,
+                                 size_t count, bool normalize = true);
+
+    /// out[i] = transformBox(matrices[i], boxes[i])
+    static void transformBoxes(const glm::mat4* matrices, const BoundingBox* boxes, BoundingBox* out,
+                               size_t count);
+
+    /// Expand a box to enclose a batch of points
+    static void expandBox(BoundingBox& box, const glm::vec3* points, size_t count);
+
+    // ========================================================================
+    // Frustum Tests
+    // ========================================================================
+
+    /// Frustum planes transposed so a volume is tested against four planes
+    /// per instruction (planes 6 and 7 repeat plane 0)
+    struct FrustumPlanes {
+        alignas(16) float x[8];
+        alignas(16) float y[8];
+        alignas(16) float z[8];
+        alignas(16) float w[8];
+    };
+
+    static FrustumPlanes preparePlanes(const Frustum& frustum);
+
+    /// Check if a box is at least partly inside (same result as Frustum::intersects())
+    static bool intersects(const FrustumPlanes& planes, const BoundingBox& box);
+
+    /// Check if a sphere is at least partly inside
+    static bool intersects(const FrustumPlanes& planes, const glm::vec3& center, float radius);
+
+    /// visible[i] = intersects(planes, boxes[i])
+    static void cullBoxes(const FrustumPlanes& planes, const BoundingBox* boxes, uint8_t* visible, size_t count);
+
+    /// visible[i] = intersects(planes, center, radius) for spheres packed as (center, radius)
+    static void cullSpheres(const FrustumPlanes& planes, const glm::vec4* spheres, uint8_t* visible,
+                            size_t count);
+};
+
+// ============================================================================
+// Inline Implementations
+// ============================================================================
+
+#ifdef PINA_SIMD_SSE
+namespace SimdDetail {
+
+inline __m128 load4(const float* p) { return _mm_loadu_ps(p); }
+inline void store4(float* p, __m128 v) { _mm_storeu_ps(p, v); }
+
+/// Load three floats without reading past them (lane 3 = 0)
+inline __m128 load3(const float* p) {
+    __m128 xy = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64*>(p));
+    return _mm_movelh_ps(xy, _mm_load_ss(p + 2));
+}
+
+/// Store three floats without writing past them
+inline void store3(float* p, __m128 v) {
+    _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+    _mm_store_ss(p + 2, _mm_movehl_ps(v, v));
+}
+
+inline __m128 madd(__m128 a, __m128 b, __m128 c) {
+#ifdef PINA_SIMD_FMA
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+}
+
+template<int Lane>
+inline __m128 splat(__m128 v) {
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+}
+
+inline __m128 abs(__m128 v) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+}
+
+/// (a.y*b.z - a.z*b.y, a.z*b.x - a.x*b.z, a.x*b.y - a.y*b.x, 0)
+inline __m128 cross(__m128 a, __m128 b) {
+    __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 c = _mm_sub_ps(_mm_mul_ps(a, bYZX), _mm_mul_ps(aYZX, b));
+    return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+/// Sum of the first three lanes, in every lane
+inline __m128 dot3(__m128 a, __m128 b) {
+    __m128 m = _mm_mul_ps(a, b);
+    __m128 y = splat<1>(m);
+    __m128 z = splat<2>(m);
+    return _mm_add_ps(_mm_add_ps(splat<0>(m), y), z);
+}
+
+} // namespace SimdDetail
+#endif
+
+inline glm::mat4 SimdMath::composeTRS(const glm::vec3& position, const glm::quat& rotation,
+                                      const glm::vec3& scale) {
+    const float x = rotation.x, y = rotation.y, z = rotation.z, w = rotation.w;
+    const float xx = x * x, yy = y * y, zz = z * z;
+    const float xy = x * y, xz = x * z, yz = y * z;
+    const float wx = w * x, wy = w * y, wz = w * z;
+
+    glm::mat4 m;
+#ifdef PINA_SIMD_SSE
+    using namespace SimdDetail;
+    store4(&m[0][0], _mm_mul_ps(_mm_set_ps(0.0f, 2.0f * (xz - wy), 2.0f * (xy + wz), 1.0f - 2.0f * (yy + zz)),
+                                _mm_set1_ps(scale.x)));
+    store4(&m[1][0], _mm_mul_ps(_mm_set_ps(0.0f, 2.0f * (yz + wx), 1.0f - 2.0f * (xx + zz), 2.0f * (xy - wz)),
+                                _mm_set1_ps(scale.y)));
+    store4(&m[2][0], _mm_mul_ps(_mm_set_ps(0.0f, 1.0f - 2.0f * (xx + yy), 2.0f * (yz - wx), 2.0f * (xz + wy)),
+                                _mm_set1_ps(scale.z)));
+    store4(&m[3][0], _mm_set_ps(1.0f, position.z, position.y, position.x));
+#else
+    m[0] = glm::vec4(1.0f - 2.0f * (yy + zz), 2.0f * (xy + wz), 2.0f * (xz - wy), 0.0f) * scale.x;
+    m[1] = glm::vec4(2.0f * (xy - wz), 1.0f - 2.0f * (xx + zz), 2.0f * (yz + wx), 0.0f) * scale.y;
+    m[2] = glm::vec4(2.0f * (xz + wy), 2.0f * (yz - wx), 1.0f - 2.0f * (xx + yy), 0.0f) * scale.z;
+    m[3] = glm::vec4(position, 1.0f);
+#endif
+    return m;
+}
+
+inline glm::mat4 SimdMath::multiplyAffine(const glm::mat4& a, const glm::mat4& b) {
+    glm::mat4 m;
+#ifdef PINA_SIMD_SSE
+    using namespace SimdDetail;
+    __m128 a0 = load4(&a[0][0]);
+    __m128 a1 = load4(&a[1][0]);
+    __m128 a2 = load4(&a[2][0]);
+    __m128 a3 = load4(&a[3][0]);
+    for (int c = 0; c < 3; ++c) {
+        __m128 bc = load4(&b[c][0]);
+        __m128 r = _mm_mul_ps(a0, splat<0>(bc));
+        r = madd(a1, splat<1>(bc), r);
+        r = madd(a2, splat<2>(bc), r);
+        store4(&m[c][0], r);
+    }
+    __m128 b3 = load4(&b[3][0]);
+    __m128 r = madd(a0, splat<0>(b3), a3);
+    r = madd(a1, splat<1>(b3), r);
+    r = madd(a2, splat<2>(b3), r);
+    store4(&m[3][0], r);
+#else
+    for (int c = 0; c < 3; ++c) {
+        m[c] = a[0] * b[c].x + a[1] * b[c].y + a[2] * b[c].z;
+    }
+    m[3] = a[0] * b[3].x + a[1] * b[3].y + a[2] * b[3].z + a[3];
+#endif
+    return m;
+}
+
+inline glm::mat3 SimdMath::normalMatrix(const glm::mat4& m) {
+    // Columns of the inverse transpose are the cofactor cross products / det
+    glm::mat3 n;
+#ifdef PINA_SIMD_SSE
+    using namespace SimdDetail;
+    __m128 x = load4(&m[0][0]);
+    __m128 y = load4(&m[1][0]);
+    __m128 z = load4(&m[2][0]);
+    __m128 cx = cross(y, z);
+    __m128 cy = cross(z, x);
+    __m128 cz = cross(x, y);
+    __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), dot3(x, cx));
+    store3(&n[0][0], _mm_mul_ps(cx, invDet));
+    store3(&n[1][0], _mm_mul_ps(cy, invDet));
+    store3(&n[2][0], _mm_mul_ps(cz, invDet));
+#else
+    glm::vec3 x(m[0]), y(m[1]), z(m[2]);
+    glm::vec3 cx = glm::cross(y, z);
+    glm::vec3 cy = glm::cross(z, x);
+    glm::vec3 cz = glm::cross(x, y);
+    float invDet = 1.0f / glm::dot(x, cx);
+    n = glm::mat3(cx * invDet, cy * invDet, cz * invDet);
+#endif
+    return n;
+}
+
+inline glm::mat3 SimdMath::normalMatrix(const glm::mat4& m, float uniformScale) {
+    // (s * R)^-T = R / s = (s * R) / s^2
+    float k = 1.0f / (uniformScale * uniformScale);
+    glm::mat3 n;
+#ifdef PINA_SIMD_SSE
+    using namespace SimdDetail;
+    __m128 scale = _mm_set1_ps(k);
+    store3(&n[0][0], _mm_mul_ps(load4(&m[0][0]), scale));
+    store3(&n[1][0], _mm_mul_ps(load4(&m[1][0]), scale));
+    store3(&n[2][0], _mm_mul_ps(load4(&m[2][0]), scale));
+#else
+    n = glm::mat3(glm::vec3(m[0]) * k, glm::vec3(m[1]) * k, glm::vec3(m[2]) * k);
+#endif
+    return n;
+}
+
+inline glm::mat4 SimdMath::inverseAffine(const glm::mat4& m) {
+    // The 3x3 inverse is the transposed normal matrix
+    glm::mat3 n = normalMatrix(m);
+    glm::mat4 inv(glm::transpose(n));
+    glm::vec3 t(m[3]);
+    inv[3] = glm::vec4(-(inv[0].x * t.x + inv[1].x * t.y + inv[2].x * t.z),
+                       -(inv[0].y * t.x + inv[1].y * t.y + inv[2].y * t.z),
+                       -(inv[0].z * t.x + inv[1].z * t.y + inv[2].z * t.z), 1.0f);
+    return inv;
+}
+
+inline BoundingBox SimdMath::transformBox(const glm::mat4& m, const BoundingBox& box) {
+    if (!box.isValid()) return box;
+
+    BoundingBox result;
+#ifdef PINA_SIMD_SSE
+    using namespace SimdDetail;
+    __m128 half = _mm_set1_ps(0.5f);
+    __m128 bmin = load3(&box.min.x);
+    __m128 bmax = load3(&box.max.x);
+    __m128 center = _mm_mul_ps(_mm_add_ps(bmin, bmax), half);
+    __m128 extent = _mm_mul_ps(_mm_sub_ps(bmax, bmin), half);
+
+    __m128 c0 = load4(&m[0][0]);
+    __m128 c1 = load4(&m[1][0]);
+    __m128 c2 = load4(&m[2][0]);
+    __m128 newCenter = madd(c0, splat<0>(center), load4(&m[3][0]));
+    newCenter = madd(c1, splat<1>(center), newCenter);
+    newCenter = madd(c2, splat<2>(center), newCenter);
+    __m128 newExtent = _mm_mul_ps(abs(c0), splat<0>(extent));
+    newExtent = madd(abs(c1), splat<1>(extent), newExtent);
+    newExtent = madd(abs(c2), splat<2>(extent), newExtent);
+
+    store3(&result.min.x, _mm_sub_ps(newCenter, newExtent));
+    store3(&result.max.x, _mm_add_ps(newCenter, newExtent));
+#else
+    glm::vec3 center = (box.min + box.max) * 0.5f;
+    glm::vec3 extent = (box.max - box.min) * 0.5f;
+    glm::vec3 newCenter = glm::vec3(m * glm::vec4(center, 1.0f));
+    glm::vec3 newExtent = glm::abs(glm::vec3(m[0])) * extent.x +
+                          glm::abs(glm::vec3(m[1])) * extent.y +
+                          glm::abs(glm::vec3(m[2])) * extent.z;
+    result.min = newCenter - newExtent;
+    result.max = newCenter + newExtent;
+#endif
+    return result;
+}
+
+inline bool SimdMath::intersects(const FrustumPlanes& planes, const BoundingBox& box) {
+    // Outside if the corner furthest along any plane normal is behind it.
+    // Plain multiplies and adds (no FMA) keep results identical to the
+    // scalar Frustum test.
+#ifdef PINA_SIMD_SSE
+    __m128 minX = _mm_set1_ps(box.min.x), minY = _mm_set1_ps(box.min.y), minZ = _mm_set1_ps(box.min.z);
+    __m128 maxX = _mm_set1_ps(box.max.x), maxY = _mm_set1_ps(box.max.y), maxZ = _mm_set1_ps(box.max.z);
+    __m128 zero = _mm_setzero_ps();
+    for (int group = 0; group < 8; group += 4) {
+        __m128 nx = _mm_load_ps(planes.x + group);
+        __m128 ny = _mm_load_ps(planes.y + group);
+        __m128 nz = _mm_load_ps(planes.z + group);
+        __m128 signX = _mm_cmpge_ps(nx, zero);
+        __m128 signY = _mm_cmpge_ps(ny, zero);
+        __m128 signZ = _mm_cmpge_ps(nz, zero);
+        __m128 px = _mm_or_ps(_mm_and_ps(signX, maxX), _mm_andnot_ps(signX, minX));
+        __m128 py = _mm_or_ps(_mm_and_ps(signY, maxY), _mm_andnot_ps(signY, minY));
+        __m128 pz = _mm_or_ps(_mm_and_ps(signZ, maxZ), _mm_andnot_ps(signZ, minZ));
+        __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, px), _mm_mul_ps(ny, py)), _mm_mul_ps(nz, pz));
+        d = _mm_add_ps(d, _mm_load_ps(planes.w + group));
+        if (_mm_movemask_ps(_mm_cmplt_ps(d, zero)) != 0) return false;
+    }
+    return true;
+#else
+    for (int i = 0; i < Frustum::SideCount; ++i) {
+        float px = planes.x[i] >= 0.0f ? box.max.x : box.min.x;
+        float py = planes.y[i] >= 0.0f ? box.max.y : box.min.y;
+        float pz = planes.z[i] >= 0.0f ? box.max.z : box.min.z;
+        if (planes.x[i] * px + planes.y[i] * py + planes.z[i] * pz + planes.w[i] < 0.0f) return false;
+    }
+    return true;
+#endif
+}
+
+inline bool SimdMath::intersects(const FrustumPlanes& planes, const glm::vec3& center, float radius) {
+#ifdef PINA_SIMD_SSE
+    __m128 cx = _mm_set1_ps(center.x), cy = _mm_set1_ps(center.y), cz = _mm_set1_ps(center.z);
+    __m128 negRadius = _mm_set1_ps(-radius);
+    for (int group = 0; group < 8; group += 4) {
+        __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_load_ps(planes.x + group), cx),
+                                         _mm_mul_ps(_mm_load_ps(planes.y + group), cy)),
+                              _mm_mul_ps(_mm_load_ps(planes.z + group), cz));
+        d = _mm_add_ps(d, _mm_load_ps(planes.w + group));
+        if (_mm_movemask_ps(_mm_cmplt_ps(d, negRadius)) != 0) return false;
+    }
+    return true;
+#else
+    for (int i = 0; i < Frustum::SideCount; ++i) {
+        float d = planes.x[i] * center.x + planes.y[i] * center.y + planes.z[i] * center.z + planes.w[i];
+        if (d < -radius) return false;
+    }
+    return true;
+#endif
+}
+
+} // namespace Pina
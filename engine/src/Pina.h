@@ -10,23 +10,34 @@
 
 // Core
 #include "Core/Memory.h"
+#include "Core/MemoryTracker.h"
 #include "Core/Subsystem.h"
 #include "Core/Context.h"
 #include "Core/Application.h"
 #include "Core/Event.h"
+#include "Core/EventQueue.h"
 #include "Core/EventDispatcher.h"
+#include "Core/JobSystem.h"
+#include "Core/Profiler.h"
+#include "Core/Name.h"
 
 // Platform
 #include "Platform/Window.h"
 #include "Platform/Graphics.h"
+#include "Platform/Headless/HeadlessWindow.h"
+#include "Platform/Headless/HeadlessGraphics.h"
+#include "Platform/Headless/HeadlessInput.h"
+#include "Platform/Headless/ReplayInput.h"
 
 // Input
 #include "Input/KeyCodes.h"
 #include "Input/Input.h"
 #include "Input/InputEvents.h"
+#include "Input/InputRecorder.h"
 
 // Graphics
 #include "Graphics/GraphicsDevice.h"
+#include "Graphics/GPUMemory.h"
 #include "Graphics/Shader.h"
 #include "Graphics/Buffer.h"
 #include "Graphics/VertexLayout.h"
@@ -42,12 +53,16 @@
 #include "Graphics/Model.h"
 #include "Graphics/Primitives/StaticMesh.h"
 #include "Graphics/Framebuffer.h"
+#include "Graphics/Recording/RecordingDevice.h"
+#include "Graphics/Recording/RecordingResources.h"
 
 // Render Pipeline
 #include "Graphics/RenderPass.h"
 #include "Graphics/RenderContext.h"
 #include "Graphics/RenderCompositor.h"
 #include "Graphics/RenderPipeline.h"
+#include "Graphics/RenderQueue.h"
+#include "Graphics/InstanceData.h"
 #include "Graphics/Passes/ClearPass.h"
 #include "Graphics/Passes/ScenePass.h"
 #include "Graphics/Passes/ShadowPass.h"
@@ -74,20 +89,32 @@
 #include "Math/Mathf.h"
 #include "Math/Ray.h"
 #include "Math/Plane.h"
+#include "Math/BoundingBox.h"
+#include "Math/Frustum.h"
+#include "Math/DynamicAABBTree.h"
+#include "Math/MeshBVH.h"
+#include "Math/SimdMath.h"
 #include "Math/Geometry.h"
 
 // UI
 #include "UI/UI.h"
 #include "UI/UITypes.h"
 #include "UI/UIWidgets.h"
+#include "UI/Headless/HeadlessUI.h"
 
 // IO (TODO)
 // #include "IO/Log.h"
 // #include "IO/File.h"
 
 // Scene
+#include "Scene/TransformSystem.h"
 #include "Scene/Transform.h"
+#include "Scene/NodeHandle.h"
 #include "Scene/Node.h"
+#include "Scene/NodePool.h"
+#include "Scene/NodeIterator.h"
+#include "Scene/SpatialIndex.h"
+#include "Scene/OcclusionCuller.h"
 #include "Scene/Scene.h"
 #include "Scene/SceneRenderer.h"
 
@@ -26,7 +26,8 @@ enum class GraphicsBackend {
     OpenGL,
     Metal,      // Future
     Vulkan,     // Future
-    DirectX12   // Future (Windows only)
+    DirectX12,  // Future (Windows only)
+    Null        // Headless (no GPU, commands are recorded)
 };
 
 /// Abstract graphics subsystem interface
@@ -36,6 +37,9 @@ class PINA_API Graphics : public Subsystem {
 public:
     ~Graphics() override = default;
 
+    /// GPU contexts are bound to the main thread
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.mainThread(); }
+
     // ========================================================================
     // Context Management
     // ========================================================================
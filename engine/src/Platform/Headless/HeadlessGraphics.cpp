@@ -0,0 +1,34 @@
+/// Pina Engine - Headless Graphics Implementation
+
+#include "HeadlessGraphics.h"
+
+namespace Pina {
+
+HeadlessGraphics::HeadlessGraphics(GraphicsBackend backend)
+    : m_backend(backend)
+{
+}
+
+HeadlessGraphics::~HeadlessGraphics() {
+    destroy();
+}
+
+bool HeadlessGraphics::create(Window* window, const GraphicsConfig& config) {
+    m_window = window;
+    m_config = config;
+    m_swapCount = 0;
+    return true;
+}
+
+void HeadlessGraphics::destroy() {
+    m_window = nullptr;
+}
+
+#ifndef __APPLE__
+// Factory implementation (platforms without a native context backend)
+Graphics* Graphics::createDefault(GraphicsBackend backend) {
+    return new HeadlessGraphics(backend);
+}
+#endif
+
+} // namespace Pina
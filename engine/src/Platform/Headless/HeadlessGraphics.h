@@ -0,0 +1,38 @@
+#pragma once
+
+/// Pina Engine - Headless Graphics Implementation
+/// Graphics context without a GPU; pairs with RecordingDevice
+
+#include "../Graphics.h"
+#include <cstdint>
+
+namespace Pina {
+
+/// Headless graphics context - all context operations are no-ops
+class PINA_API HeadlessGraphics : public Graphics {
+public:
+    /// @param backend Backend reported by getBackend()
+    explicit HeadlessGraphics(GraphicsBackend backend = GraphicsBackend::Null);
+    ~HeadlessGraphics() override;
+
+    bool create(Window* window, const GraphicsConfig& config) override;
+    void destroy() override;
+    void makeCurrent() override {}
+    void swapBuffers() override { m_swapCount++; }
+    void setVSync(bool enabled) override { m_config.vsync = enabled; }
+    void updateContext() override {}
+    GraphicsBackend getBackend() const override { return m_backend; }
+
+    /// Number of swapBuffers() calls
+    uint64_t getSwapCount() const { return m_swapCount; }
+
+    const GraphicsConfig& getConfig() const { return m_config; }
+
+private:
+    GraphicsBackend m_backend;
+    GraphicsConfig m_config;
+    Window* m_window = nullptr;
+    uint64_t m_swapCount = 0;
+};
+
+} // namespace Pina
@@ -0,0 +1,238 @@
+/// Pina Engine - Headless Input Implementation
+
+#include "HeadlessInput.h"
+#include "../../Core/EventDispatcher.h"
+#include "../../Input/InputEvents.h"
+
+namespace Pina {
+
+HeadlessInput::HeadlessInput(Window* window) {
+    // No native handles to resolve
+    (void)window;
+}
+
+HeadlessInput::~HeadlessInput() = default;
+
+void HeadlessInput::initialize() {
+    // Initial state already zeroed by array initialization
+}
+
+void HeadlessInput::update(float deltaTime) {
+    (void)deltaTime;
+
+    // Calculate mouse delta from position change
+    m_mouseDelta = m_mousePosition - m_mousePreviousPosition;
+    m_mousePreviousPosition = m_mousePosition;
+}
+
+void HeadlessInput::shutdown() {
+    // Nothing to restore - no OS cursor
+}
+
+void HeadlessInput::endFrame() {
+    // Copy current state to previous for edge detection
+    m_keyPreviousState = m_keyCurrentState;
+    m_mousePreviousState = m_mouseCurrentState;
+
+    // Reset per-frame deltas
+    m_scrollDelta = glm::vec2(0.0f);
+}
+
+// ============================================================================
+// Keyboard
+// ============================================================================
+
+bool HeadlessInput::isKeyDown(Key key) const {
+    size_t index = static_cast<size_t>(key);
+    if (index >= KEY_COUNT) return false;
+    return m_keyCurrentState[index];
+}
+
+bool HeadlessInput::isKeyPressed(Key key) const {
+    size_t index = static_cast<size_t>(key);
+    if (index >= KEY_COUNT) return false;
+    return m_keyCurrentState[index] && !m_keyPreviousState[index];
+}
+
+bool HeadlessInput::isKeyReleased(Key key) const {
+    size_t index = static_cast<size_t>(key);
+    if (index >= KEY_COUNT) return false;
+    return !m_keyCurrentState[index] && m_keyPreviousState[index];
+}
+
+KeyModifier HeadlessInput::getModifiers() const {
+    return m_modifiers;
+}
+
+// ============================================================================
+// Mouse Buttons
+// ============================================================================
+
+bool HeadlessInput::isMouseButtonDown(MouseButton button) const {
+    size_t index = static_cast<size_t>(button);
+    if (index >= BUTTON_COUNT) return false;
+    return m_mouseCurrentState[index];
+}
+
+bool HeadlessInput::isMouseButtonPressed(MouseButton button) const {
+    size_t index = static_cast<size_t>(button);
+    if (index >= BUTTON_COUNT) return false;
+    return m_mouseCurrentState[index] && !m_mousePreviousState[index];
+}
+
+bool HeadlessInput::isMouseButtonReleased(MouseButton button) const {
+    size_t index = static_cast<size_t>(button);
+    if (index >= BUTTON_COUNT) return false;
+    return !m_mouseCurrentState[index] && m_mousePreviousState[index];
+}
+
+// ============================================================================
+// Mouse Position
+// ============================================================================
+
+glm::vec2 HeadlessInput::getMousePosition() const {
+    return m_mousePosition;
+}
+
+glm::vec2 HeadlessInput::getMouseDelta() const {
+    return m_mouseDelta;
+}
+
+glm::vec2 HeadlessInput::getScrollDelta() const {
+    return m_scrollDelta;
+}
+
+// ============================================================================
+// Mouse Capture
+// ============================================================================
+
+void HeadlessInput::setMouseCaptured(bool captured) {
+    m_mouseCaptured = captured;
+}
+
+bool HeadlessInput::isMouseCaptured() const {
+    return m_mouseCaptured;
+}
+
+void HeadlessInput::setMouseVisible(bool visible) {
+    m_mouseVisible = visible;
+}
+
+bool HeadlessInput::isMouseVisible() const {
+    return m_mouseVisible;
+}
+
+// ============================================================================
+// Focus
+// ============================================================================
+
+bool HeadlessInput::hasFocus() const {
+    return m_hasFocus;
+}
+
+// ============================================================================
+// Event Injection
+// ============================================================================
+
+void HeadlessInput::processKeyDown(Key key) {
+    size_t index = static_cast<size_t>(key);
+    if (index < KEY_COUNT) {
+        bool wasDown = m_keyCurrentState[index];
+        m_keyCurrentState[index] = true;
+
+        // Emit key pressed event
+        if (m_eventDispatcher) {
+            KeyPressedEvent event(key, m_modifiers, wasDown);
+            m_eventDispatcher->dispatch(event);
+        }
+    }
+}
+
+void HeadlessInput::processKeyUp(Key key) {
+    size_t index = static_cast<size_t>(key);
+    if (index < KEY_COUNT) {
+        m_keyCurrentState[index] = false;
+
+        // Emit key released event
+        if (m_eventDispatcher) {
+            KeyReleasedEvent event(key, m_modifiers);
+            m_eventDispatcher->dispatch(event);
+        }
+    }
+}
+
+void HeadlessInput::processModifiersChanged(KeyModifier modifiers) {
+    m_modifiers = modifiers;
+}
+
+void HeadlessInput::processMouseDown(MouseButton button) {
+    size_t index = static_cast<size_t>(button);
+    if (index < BUTTON_COUNT) {
+        m_mouseCurrentState[index] = true;
+
+        // Emit mouse button pressed event
+        if (m_eventDispatcher) {
+            MouseButtonPressedEvent event(button, m_mousePosition, m_modifiers);
+            m_eventDispatcher->dispatch(event);
+        }
+    }
+}
+
+void HeadlessInput::processMouseUp(MouseButton button) {
+    size_t index = static_cast<size_t>(button);
+    if (index < BUTTON_COUNT) {
+        m_mouseCurrentState[index] = false;
+
+        // Emit mouse button released event
+        if (m_eventDispatcher) {
+            MouseButtonReleasedEvent event(button, m_mousePosition, m_modifiers);
+            m_eventDispatcher->dispatch(event);
+        }
+    }
+}
+
+void HeadlessInput::processMouseMove(float x, float y) {
+    glm::vec2 oldPosition = m_mousePosition;
+    m_mousePosition.x = x;
+    m_mousePosition.y = y;
+    glm::vec2 delta = m_mousePosition - oldPosition;
+
+    // Emit mouse moved event
+    if (m_eventDispatcher) {
+        MouseMovedEvent event(m_mousePosition, delta);
+        m_eventDispatcher->dispatch(event);
+    }
+}
+
+void HeadlessInput::processScroll(float deltaX, float deltaY) {
+    m_scrollDelta.x += deltaX;
+    m_scrollDelta.y += deltaY;
+
+    // Emit mouse scrolled event
+    if (m_eventDispatcher) {
+        MouseScrolledEvent event(glm::vec2(deltaX, deltaY), m_mousePosition);
+        m_eventDispatcher->dispatch(event);
+    }
+}
+
+void HeadlessInput::processFocusChange(bool focus) {
+    m_hasFocus = focus;
+
+    // Emit window focus event
+    if (m_eventDispatcher) {
+        WindowFocusEvent event(focus);
+        m_eventDispatcher->dispatch(event);
+    }
+}
+
+#ifndef __APPLE__
+// ============================================================================
+// Factory (platforms without a native input backend)
+// ============================================================================
+
+Input* Input::createDefault(Window* window) {
+    return new HeadlessInput(window);
+}
+#endif
+
+} // namespace Pina
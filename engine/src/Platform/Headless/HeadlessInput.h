@@ -0,0 +1,121 @@
+#pragma once
+
+/// Pina Engine - Headless Input Implementation
+/// Input subsystem driven by injected events instead of an OS event loop
+
+#include "../../Input/Input.h"
+#include <array>
+
+namespace Pina {
+
+class Window;
+class EventDispatcher;
+
+/// Headless input implementation
+/// State is fed through the process*() methods (tests, replays, bots)
+class PINA_API HeadlessInput : public Input {
+public:
+    explicit HeadlessInput(Window* window = nullptr);
+    ~HeadlessInput() override;
+
+    // Subsystem lifecycle
+    void initialize() override;
+    void update(float deltaTime) override;
+    void shutdown() override;
+
+    // ========================================================================
+    // Keyboard
+    // ========================================================================
+
+    bool isKeyDown(Key key) const override;
+    bool isKeyPressed(Key key) const override;
+    bool isKeyReleased(Key key) const override;
+    KeyModifier getModifiers() const override;
+
+    // ========================================================================
+    // Mouse Buttons
+    // ========================================================================
+
+    bool isMouseButtonDown(MouseButton button) const override;
+    bool isMouseButtonPressed(MouseButton button) const override;
+    bool isMouseButtonReleased(MouseButton button) const override;
+
+    // ========================================================================
+    // Mouse Position
+    // ========================================================================
+
+    glm::vec2 getMousePosition() const override;
+    glm::vec2 getMouseDelta() const override;
+    glm::vec2 getScrollDelta() const override;
+
+    // ========================================================================
+    // Mouse Capture
+    // ========================================================================
+
+    void setMouseCaptured(bool captured) override;
+    bool isMouseCaptured() const override;
+    void setMouseVisible(bool visible) override;
+    bool isMouseVisible() const override;
+
+    // ========================================================================
+    // Focus
+    // ========================================================================
+
+    bool hasFocus() const override;
+
+    // ========================================================================
+    // Event Injection
+    // ========================================================================
+
+    void processKeyDown(Key key);
+    void processKeyUp(Key key);
+    void processModifiersChanged(KeyModifier modifiers);
+    void processMouseDown(MouseButton button);
+    void processMouseUp(MouseButton button);
+    void processMouseMove(float x, float y);
+    void processScroll(float deltaX, float deltaY);
+    void processFocusChange(bool hasFocus);
+
+    /// Advance per-frame state (same as the end of an Application frame)
+    void advanceFrame() { endFrame(); }
+
+    // ========================================================================
+    // Event System Integration
+    // ========================================================================
+
+    /// Set the event dispatcher for emitting input events
+    void setEventDispatcher(EventDispatcher* dispatcher) { m_eventDispatcher = dispatcher; }
+
+protected:
+    void endFrame() override;
+
+private:
+    // Keyboard state
+    static constexpr size_t KEY_COUNT = static_cast<size_t>(Key::MaxKey);
+    std::array<bool, KEY_COUNT> m_keyCurrentState{};
+    std::array<bool, KEY_COUNT> m_keyPreviousState{};
+    KeyModifier m_modifiers = KeyModifier::None;
+
+    // Mouse button state
+    static constexpr size_t BUTTON_COUNT = static_cast<size_t>(MouseButton::MaxButton);
+    std::array<bool, BUTTON_COUNT> m_mouseCurrentState{};
+    std::array<bool, BUTTON_COUNT> m_mousePreviousState{};
+
+    // Mouse position
+    glm::vec2 m_mousePosition{0.0f, 0.0f};
+    glm::vec2 m_mousePreviousPosition{0.0f, 0.0f};
+    glm::vec2 m_mouseDelta{0.0f, 0.0f};
+    glm::vec2 m_scrollDelta{0.0f, 0.0f};
+
+    // Mouse capture state
+    bool m_mouseCaptured = false;
+    bool m_mouseVisible = true;
+
+    // Focus state
+    bool m_hasFocus = true;
+
+    // Event dispatcher for emitting events
+    EventDispatcher* m_eventDispatcher = nullptr;
+};
+
+} // namespace Pina
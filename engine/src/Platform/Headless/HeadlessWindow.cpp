@@ -0,0 +1,65 @@
+/// Pina Engine - Headless Window Implementation
+
+#include "HeadlessWindow.h"
+
+namespace Pina {
+
+HeadlessWindow::HeadlessWindow() = default;
+
+HeadlessWindow::~HeadlessWindow() {
+    destroy();
+}
+
+bool HeadlessWindow::create(const WindowConfig& config) {
+    m_title = config.title;
+    m_width = config.width;
+    m_height = config.height;
+    m_created = true;
+    m_shouldClose = false;
+    m_frameCount = 0;
+    return true;
+}
+
+void HeadlessWindow::destroy() {
+    m_created = false;
+}
+
+void HeadlessWindow::pollEvents() {
+    m_frameCount++;
+
+    if (m_frameLimit > 0 && m_frameCount >= m_frameLimit) {
+        requestClose();
+    }
+}
+
+bool HeadlessWindow::shouldClose() const {
+    return m_shouldClose;
+}
+
+void HeadlessWindow::requestClose() {
+    if (m_shouldClose) return;
+    m_shouldClose = true;
+
+    if (m_closeCallback) {
+        m_closeCallback();
+    }
+}
+
+void HeadlessWindow::resize(int width, int height) {
+    if (width == m_width && height == m_height) return;
+    m_width = width;
+    m_height = height;
+
+    if (m_resizeCallback) {
+        m_resizeCallback(width, height);
+    }
+}
+
+#ifndef __APPLE__
+// Factory implementation (platforms without a native window backend)
+Window* Window::createDefault() {
+    return new HeadlessWindow();
+}
+#endif
+
+} // namespace Pina
@@ -0,0 +1,56 @@
+#pragma once
+
+/// Pina Engine - Headless Window Implementation
+/// Window without a display server (CI, benchmarks, tests)
+
+#include "../Window.h"
+#include <cstdint>
+
+namespace Pina {
+
+/// Headless window - keeps size/title state and simulates close/resize
+class PINA_API HeadlessWindow : public Window {
+public:
+    HeadlessWindow();
+    ~HeadlessWindow() override;
+
+    bool create(const WindowConfig& config) override;
+    void destroy() override;
+    void pollEvents() override;
+    bool shouldClose() const override;
+    void* getNativeHandle() const override { return nullptr; }
+    void* getNativeView() const override { return nullptr; }
+    int getWidth() const override { return m_width; }
+    int getHeight() const override { return m_height; }
+    void setTitle(const std::string& title) override { m_title = title; }
+
+    // ========================================================================
+    // Simulation
+    // ========================================================================
+
+    /// Simulate the user closing the window
+    void requestClose();
+
+    /// Simulate a window resize (fires the resize callback)
+    void resize(int width, int height);
+
+    /// Close automatically after this many pollEvents() calls (0 = never)
+    void setFrameLimit(uint64_t frames) { m_frameLimit = frames; }
+
+    /// Number of pollEvents() calls since create()
+    uint64_t getFrameCount() const { return m_frameCount; }
+
+    bool isCreated() const { return m_created; }
+    const std::string& getTitle() const { return m_title; }
+
+private:
+    std::string m_title;
+    int m_width = 0;
+    int m_height = 0;
+    bool m_created = false;
+    bool m_shouldClose = false;
+    uint64_t m_frameLimit = 0;
+    uint64_t m_frameCount = 0;
+};
+
+} // namespace Pina
@@ -0,0 +1,64 @@
+/// Pina Engine - Replay Input Implementation
+
+#include "ReplayInput.h"
+#include <utility>
+
+namespace Pina {
+
+ReplayInput::ReplayInput(InputRecording recording, Window* window)
+    : HeadlessInput(window)
+    , m_recording(std::move(recording))
+{
+}
+
+void ReplayInput::update(float deltaTime) {
+    m_replayMouseDelta = glm::vec2(0.0f);
+
+    const auto& events = m_recording.events;
+    while (m_nextEvent < events.size() && events[m_nextEvent].frame <= m_frame) {
+        apply(events[m_nextEvent]);
+        m_nextEvent++;
+    }
+    m_frame++;
+
+    HeadlessInput::update(deltaTime);
+}
+
+void ReplayInput::apply(const RecordedInputEvent& event) {
+    switch (event.type) {
+        case RecordedInputType::KeyDown:
+            processModifiersChanged(event.modifiers);
+            processKeyDown(event.key);
+            break;
+
+        case RecordedInputType::KeyUp:
+            processModifiersChanged(event.modifiers);
+            processKeyUp(event.key);
+            break;
+
+        case RecordedInputType::MouseDown:
+            processModifiersChanged(event.modifiers);
+            processMouseDown(event.button);
+            break;
+
+        case RecordedInputType::MouseUp:
+            processModifiersChanged(event.modifiers);
+            processMouseUp(event.button);
+            break;
+
+        case RecordedInputType::MouseMove:
+            processMouseMove(event.position.x, event.position.y);
+            m_replayMouseDelta += event.delta;
+            break;
+
+        case RecordedInputType::Scroll:
+            processScroll(event.delta.x, event.delta.y);
+            break;
+
+        case RecordedInputType::Focus:
+            processFocusChange(event.flag);
+            break;
+    }
+}
+
+} // namespace Pina
@@ -0,0 +1,50 @@
+#pragma once
+
+/// Pina Engine - Replay Input Implementation
+/// Input subsystem that plays back a recorded input session frame by frame
+
+#include "HeadlessInput.h"
+#include "../../Input/InputRecorder.h"
+
+namespace Pina {
+
+/// Replay input implementation
+/// Each update() applies the events recorded for the current frame through
+/// the HeadlessInput injection path, so state queries and dispatched events
+/// match the recorded session. Pair with a fixed delta time
+/// (ApplicationConfig::fixedDeltaTime) for repeatable runs.
+class PINA_API ReplayInput : public HeadlessInput {
+public:
+    explicit ReplayInput(InputRecording recording, Window* window = nullptr);
+    ~ReplayInput() override = default;
+
+    /// Unlike live input, update() dispatches the replayed events to
+    /// arbitrary handlers, so run alone on the main thread (like EventDispatcher)
+    void declareDependencies(SubsystemDependencies& deps) const override {
+        deps.phase(SubsystemPhase::PreUpdate).exclusive();
+    }
+
+    void update(float deltaTime) override;
+
+    /// Recorded mouse movement this frame (also correct while captured,
+    /// when the position does not change)
+    glm::vec2 getMouseDelta() const override { return m_replayMouseDelta; }
+
+    /// Index of the next frame to replay
+    uint64_t getFrame() const { return m_frame; }
+
+    /// Check if every recorded frame has been replayed
+    bool isFinished() const { return m_frame >= m_recording.frameCount; }
+
+    const InputRecording& getRecording() const { return m_recording; }
+
+private:
+    void apply(const RecordedInputEvent& event);
+
+    InputRecording m_recording;
+    size_t m_nextEvent = 0;
+    uint64_t m_frame = 0;
+    glm::vec2 m_replayMouseDelta{0.0f};
+};
+
+} // namespace Pina
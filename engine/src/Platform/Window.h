@@ -30,6 +30,9 @@ class PINA_API Window : public Subsystem {
 public:
     ~Window() override = default;
 
+    /// OS windowing must stay on the main thread
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.mainThread(); }
+
     // ========================================================================
     // Window Management
     // ========================================================================
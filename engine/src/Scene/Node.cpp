@@ -1,27 +1,77 @@
 #include "Node.h"
+#include "NodeIterator.h"
 #include "Scene.h"
-#include <algorithm>
+#include "../Graphics/Model.h"
+#include "../Graphics/Primitives/StaticMesh.h"
+#include <iostream>
 
 namespace Pina {
 
-uint64_t Node::s_nextID = 1;
-
 Node::Node(const std::string& name)
-    : m_id(s_nextID++)
-    , m_name(name)
+    : m_name(name)
+{
+    m_transform.setOwner(this);
+}
+
+Node::Node(const std::string& name, TransformSystem& transforms)
+    : m_name(name)
+    , m_transform(transforms)
 {
     m_transform.setOwner(this);
 }
 
 Node::~Node() = default;
 
+// ============================================================================
+// Identity
+// ============================================================================
+
+void Node::setName(const std::string& name) {
+    Name newName(name);
+    if (newName == m_name) return;
+
+    if (m_scene) m_scene->unindexName(this);
+    m_name = newName;
+    if (m_scene) m_scene->indexName(this);
+}
+
+// ============================================================================
+// Tags
+// ============================================================================
+
+void Node::addTag(const Name& tag) {
+    if (hasTag(tag)) return;
+
+    m_tags.push_back({tag, 0});
+    if (m_scene) m_scene->indexTag(this, m_tags.size() - 1);
+}
+
+bool Node::removeTag(const Name& tag) {
+    for (size_t i = 0; i < m_tags.size(); ++i) {
+        if (m_tags[i].tag == tag) {
+            if (m_scene) m_scene->unindexTag(this, i);
+            m_tags.erase(m_tags.begin() + static_cast<std::ptrdiff_t>(i));
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Node::hasTag(const Name& tag) const {
+    for (const TagEntry& entry : m_tags) {
+        if (entry.tag == tag) return true;
+    }
+    return false;
+}
+
 // ============================================================================
 // Enable State
 // ============================================================================
 
 bool Node::isEnabledInHierarchy() const {
-    if (!m_enabled) return false;
-    if (m_parent) return m_parent->isEnabledInHierarchy();
+    for (const Node* node = this; node; node = node->getParent()) {
+        if (!node->m_enabled) return false;
+    }
     return true;
 }
 
@@ -29,141 +79,156 @@ bool Node::isEnabledInHierarchy() const {
 // Hierarchy
 // ============================================================================
 
-void Node::setParent(Node* newParent) {
-    if (m_parent == newParent) return;
+Node* Node::getParent() const {
+    return m_scene ? nodeAt(m_scene->m_nodes.getLinks(m_handle.index).parent) : nullptr;
+}
 
-    // Prevent circular reference
-    if (newParent) {
-        Node* check = newParent;
-        while (check) {
-            if (check == this) return;  // Would create cycle
-            check = check->m_parent;
-        }
-    }
+size_t Node::getChildCount() const {
+    return m_scene ? m_scene->m_nodes.getLinks(m_handle.index).childCount : 0;
+}
 
-    // Remove from old parent
-    if (m_parent) {
-        auto& siblings = m_parent->m_children;
-        for (auto it = siblings.begin(); it != siblings.end(); ++it) {
-            if (it->get() == this) {
-                it->release();  // Release ownership without deleting
-                siblings.erase(it);
-                break;
-            }
-        }
+Node* Node::getFirstChild() const {
+    return m_scene ? nodeAt(m_scene->m_nodes.getLinks(m_handle.index).firstChild) : nullptr;
+}
+
+Node* Node::getNextSibling() const {
+    return m_scene ? nodeAt(m_scene->m_nodes.getLinks(m_handle.index).nextSibling) : nullptr;
+}
+
+void Node::setParent(Node* newParent) {
+    if (!m_scene) {
+        std::cerr << "Node::setParent - Node '" << m_name.str() << "' is not in a scene" << std::endl;
+        return;
     }
 
-    m_parent = newParent;
+    Node* root = m_scene->getRoot();
+    if (this == root) return;
+    if (!newParent) newParent = root;
+
+    if (newParent->m_scene != m_scene) {
+        std::cerr << "Node::setParent - Parent '" << newParent->m_name.str() << "' is in another scene" << std::endl;
+        return;
+    }
+    if (m_scene->m_nodes.getLinks(m_handle.index).parent == newParent->m_handle.index) return;
 
-    // Add to new parent
-    if (newParent) {
-        newParent->m_children.push_back(UNIQUE<Node>(this));
-        setScene(newParent->m_scene);
+    // Prevent circular reference
+    for (const Node* check = newParent; check; check = check->getParent()) {
+        if (check == this) return;  // Would create cycle
     }
 
-    // Mark transform dirty since parent changed
-    m_transform.markDirty();
+    detach();
+    attach(newParent);
 }
 
 Node* Node::getChild(size_t index) {
-    if (index >= m_children.size()) return nullptr;
-    return m_children[index].get();
+    if (index >= getChildCount()) return nullptr;
+
+    Node* child = getFirstChild();
+    for (size_t i = 0; i < index; ++i) {
+        child = child->getNextSibling();
+    }
+    return child;
 }
 
 const Node* Node::getChild(size_t index) const {
-    if (index >= m_children.size()) return nullptr;
-    return m_children[index].get();
+    return const_cast<Node*>(this)->getChild(index);
 }
 
 Node* Node::addChild(const std::string& name) {
-    auto child = MAKE_UNIQUE<Node>(name);
-    child->m_parent = this;
-    child->setScene(m_scene);
-    child->m_transform.setOwner(child.get());
-    Node* ptr = child.get();
-    m_children.push_back(std::move(child));
-    return ptr;
-}
-
-Node* Node::addChild(UNIQUE<Node> child) {
-    if (!child) return nullptr;
-
-    // Remove from old parent if any
-    if (child->m_parent) {
-        auto& siblings = child->m_parent->m_children;
-        for (auto it = siblings.begin(); it != siblings.end(); ++it) {
-            if (it->get() == child.get()) {
-                it->release();  // Release without deleting
-                siblings.erase(it);
-                break;
-            }
-        }
+    if (!m_scene) {
+        std::cerr << "Node::addChild - Node '" << m_name.str() << "' is not in a scene" << std::endl;
+        return nullptr;
     }
-
-    child->m_parent = this;
-    child->setScene(m_scene);
-    child->m_transform.markDirty();
-    Node* ptr = child.get();
-    m_children.push_back(std::move(child));
-    return ptr;
+    return m_scene->createNode(name, this);
 }
 
-UNIQUE<Node> Node::removeChild(Node* child) {
-    for (auto it = m_children.begin(); it != m_children.end(); ++it) {
-        if (it->get() == child) {
-            UNIQUE<Node> removed = std::move(*it);
-            m_children.erase(it);
-            removed->m_parent = nullptr;
-            removed->setScene(nullptr);
-            return removed;
-        }
-    }
-    return nullptr;
+bool Node::removeChild(Node* child) {
+    if (!child || !m_scene || child->m_scene != m_scene) return false;
+    if (m_scene->m_nodes.getLinks(child->m_handle.index).parent != m_handle.index) return false;
+    return m_scene->destroyNode(child);
 }
 
-UNIQUE<Node> Node::removeChild(size_t index) {
-    if (index >= m_children.size()) return nullptr;
-
-    auto it = m_children.begin() + static_cast<ptrdiff_t>(index);
-    UNIQUE<Node> removed = std::move(*it);
-    m_children.erase(it);
-    removed->m_parent = nullptr;
-    removed->setScene(nullptr);
-    return removed;
+bool Node::removeChild(size_t index) {
+    return removeChild(getChild(index));
 }
 
 void Node::removeAllChildren() {
-    for (auto& child : m_children) {
-        child->m_parent = nullptr;
-        child->setScene(nullptr);
+    while (Node* child = getFirstChild()) {
+        m_scene->destroyNode(child);
     }
-    m_children.clear();
 }
 
 Node* Node::findChild(const std::string& name) const {
-    for (const auto& child : m_children) {
-        if (child->m_name == name) {
-            return child.get();
+    Name key;
+    if (!Name::find(name, key)) return nullptr;
+
+    for (Node* child = getFirstChild(); child; child = child->getNextSibling()) {
+        if (child->m_name == key) {
+            return child;
         }
     }
     return nullptr;
 }
 
 Node* Node::findDescendant(const std::string& name) const {
-    // Check direct children first
-    for (const auto& child : m_children) {
-        if (child->m_name == name) {
-            return child.get();
+    Name key;
+    if (!Name::find(name, key)) return nullptr;
+
+    // Children first, then their subtrees: every node's children are checked
+    // in the order the nodes themselves are reached in pre-order
+    for (NodeIterator it(this); it; ++it) {
+        for (Node* child = it->getFirstChild(); child; child = child->getNextSibling()) {
+            if (child->m_name == key) {
+                return child;
+            }
         }
     }
+    return nullptr;
+}
+
+Node* Node::findByPath(const std::string& path) const {
+    std::vector<Name> names;
+    if (!parsePath(path, names) || names.empty()) return nullptr;
 
-    // Recurse into children
-    for (const auto& child : m_children) {
-        Node* found = child->findDescendant(name);
-        if (found) return found;
+    const Node* node = this;
+    for (const Name& name : names) {
+        Node* child = node->getFirstChild();
+        while (child && child->m_name != name) {
+            child = child->getNextSibling();
+        }
+        if (!child) return nullptr;
+        node = child;
     }
+    return const_cast<Node*>(node);
+}
 
-    return nullptr;
+// ============================================================================
+// Model Attachment
+// ============================================================================
+
+void Node::setModel(Model* model) {
+    m_model = model;
+    onGeometryChanged();
+}
+
+void Node::setMesh(StaticMesh* mesh) {
+    m_mesh = mesh;
+    onGeometryChanged();
+}
+
+void Node::onGeometryChanged() {
+    BoundingBox bounds;
+    if (m_model) {
+        bounds.expand(m_model->getBoundingBox());
+    }
+    if (m_mesh) {
+        bounds.expand(m_mesh->getBoundingBox());
+    }
+    m_transform.setLocalBounds(bounds);
+
+    if (m_scene) {
+        m_scene->updateSpatialTracking(this);
+    }
 }
 
 // ============================================================================
@@ -171,25 +236,20 @@ Node* Node::findDescendant(const std::string& name) const {
 // ============================================================================
 
 void Node::traverse(const std::function<void(Node*)>& callback) {
-    callback(this);
-    for (auto& child : m_children) {
-        child->traverse(callback);
+    for (NodeIterator it(this); it; ++it) {
+        callback(*it);
     }
 }
 
 void Node::traverse(const std::function<void(const Node*)>& callback) const {
-    callback(this);
-    for (const auto& child : m_children) {
-        const Node* childPtr = child.get();
-        childPtr->traverse(callback);
+    for (NodeIterator it(this); it; ++it) {
+        callback(*it);
     }
 }
 
 void Node::traverseEnabled(const std::function<void(Node*)>& callback) {
-    if (!m_enabled) return;
-    callback(this);
-    for (auto& child : m_children) {
-        child->traverseEnabled(callback);
+    for (NodeIterator it(this, true); it; ++it) {
+        callback(*it);
     }
 }
 
@@ -197,31 +257,70 @@ void Node::traverseEnabled(const std::function<void(Node*)>& callback) {
 // Internal
 // ============================================================================
 
-void Node::markChildrenWorldDirty() {
-    for (auto& child : m_children) {
-        child->m_transform.markDirty();
+bool Node::parsePath(const std::string& path, std::vector<Name>& names) {
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos) end = path.size();
+
+        if (end > start) {
+            Name name;
+            if (!Name::find(path.substr(start, end - start), name)) return false;
+            names.push_back(name);
+        }
+        start = end + 1;
     }
+    return true;
 }
 
-void Node::setScene(Scene* scene) {
-    if (m_scene == scene) return;
+Node* Node::nodeAt(uint32_t index) const {
+    return (index != InvalidIndex) ? m_scene->m_nodes.slot(index) : nullptr;
+}
 
-    // Unregister from old scene
-    if (m_scene) {
-        m_scene->unregisterNode(this);
+void Node::attach(Node* parent) {
+    NodePool& pool = m_scene->m_nodes;
+    const uint32_t index = m_handle.index;
+    const uint32_t parentIndex = parent->m_handle.index;
+    NodePool::Links& links = pool.getLinks(index);
+    NodePool::Links& parentLinks = pool.getLinks(parentIndex);
+
+    links.parent = parentIndex;
+    links.prevSibling = parentLinks.lastChild;
+    links.nextSibling = InvalidIndex;
+
+    if (parentLinks.lastChild != InvalidIndex) {
+        pool.getLinks(parentLinks.lastChild).nextSibling = index;
+    } else {
+        parentLinks.firstChild = index;
     }
+    parentLinks.lastChild = index;
+    parentLinks.childCount++;
 
-    m_scene = scene;
+    // World matrix now follows the new parent
+    m_transform.setParent(&parent->m_transform);
+}
 
-    // Register with new scene
-    if (m_scene) {
-        m_scene->registerNode(this);
-    }
+void Node::detach() {
+    NodePool& pool = m_scene->m_nodes;
+    NodePool::Links& links = pool.getLinks(m_handle.index);
+    if (links.parent == InvalidIndex) return;
 
-    // Propagate to children
-    for (auto& child : m_children) {
-        child->setScene(scene);
+    NodePool::Links& parentLinks = pool.getLinks(links.parent);
+    if (links.prevSibling != InvalidIndex) {
+        pool.getLinks(links.prevSibling).nextSibling = links.nextSibling;
+    } else {
+        parentLinks.firstChild = links.nextSibling;
     }
+    if (links.nextSibling != InvalidIndex) {
+        pool.getLinks(links.nextSibling).prevSibling = links.prevSibling;
+    } else {
+        parentLinks.lastChild = links.prevSibling;
+    }
+    parentLinks.childCount--;
+
+    links.parent = InvalidIndex;
+    links.prevSibling = InvalidIndex;
+    links.nextSibling = InvalidIndex;
 }
 
 } // namespace Pina
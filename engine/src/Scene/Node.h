@@ -5,12 +5,14 @@
 
 #include "../Core/Export.h"
 #include "../Core/Memory.h"
+#include "../Core/Name.h"
 #include "../Graphics/Material.h"
+#include "NodeHandle.h"
 #include "Transform.h"
 #include <string>
-#include <vector>
 #include <functional>
 #include <cstdint>
+#include <vector>
 
 namespace Pina {
 
@@ -18,31 +20,80 @@ class Model;
 class Scene;
 class StaticMesh;
 
+/// Returned by a traversal visitor to steer the walk
+enum class VisitResult {
+    Continue,       // Visit this node's children next
+    SkipChildren,   // Skip this node's descendants
+    Stop            // End the traversal
+};
+
 /// Scene node representing an object in the scene hierarchy
-class PINA_API Node {
+///
+/// Nodes live in their Scene's NodePool and are created with
+/// Scene::createNode() or addChild(). The hierarchy is stored in the pool as
+/// slot indices (parent, first/last child, previous/next sibling), so
+/// adding, removing and reparenting are O(1) and never move or re-own a node.
+class PINA_API Node : public TrackedObject<MemoryTag::Scene> {
 public:
-    /// Create a node with a name
+    /// Create a detached node (no scene, cannot have children)
+    /// Scene nodes are constructed by the scene's NodePool. The transform
+    /// lives in the detached store (see Transform()), so detached nodes are
+    /// main thread only.
     explicit Node(const std::string& name = "Node");
+
+    /// Create a node whose transform lives in a scene's system (used by NodePool)
+    Node(const std::string& name, TransformSystem& transforms);
+
     ~Node();
 
-    // Non-copyable, moveable
+    // Non-copyable, non-movable (pool slots and handles refer to this address)
     Node(const Node&) = delete;
     Node& operator=(const Node&) = delete;
-    Node(Node&&) = default;
-    Node& operator=(Node&&) = default;
+    Node(Node&&) = delete;
+    Node& operator=(Node&&) = delete;
 
     // ========================================================================
     // Identity
     // ========================================================================
 
-    /// Get unique node ID
-    uint64_t getID() const { return m_id; }
+    /// Get the node's ID (its handle packed into 64 bits)
+    /// IDs are unique only among a scene's live nodes: a destroyed node's
+    /// slot is reused, so its index comes back with a new generation, and
+    /// nodes of different scenes can share an ID. Every detached node
+    /// returns the same invalid-handle ID.
+    uint64_t getID() const { return m_handle.toID(); }
+
+    /// Get the handle for this node (see Scene::getNode())
+    NodeHandle getHandle() const { return m_handle; }
 
     /// Get node name
-    const std::string& getName() const { return m_name; }
+    const std::string& getName() const { return m_name.str(); }
+
+    /// Get node name as an interned Name
+    Name getInternedName() const { return m_name; }
 
-    /// Set node name
-    void setName(const std::string& name) { m_name = name; }
+    /// Set node name (keeps the scene's name index current)
+    void setName(const std::string& name);
+
+    // ========================================================================
+    // Tags
+    // ========================================================================
+
+    /// Add a tag (ignored if already present)
+    void addTag(const Name& tag);
+
+    /// Remove a tag
+    /// @return true if the node had the tag
+    bool removeTag(const Name& tag);
+
+    /// Check if the node has a tag
+    bool hasTag(const Name& tag) const;
+
+    /// Get tag count
+    size_t getTagCount() const { return m_tags.size(); }
+
+    /// Get tag by index
+    Name getTag(size_t index) const { return m_tags[index].tag; }
 
     // ========================================================================
     // Enable State
@@ -70,46 +121,53 @@ public:
     // ========================================================================
 
     /// Get parent node (nullptr if root)
-    Node* getParent() const { return m_parent; }
+    Node* getParent() const;
 
-    /// Set parent node (removes from old parent, adds to new)
+    /// Move under a new parent as its last child (nullptr = scene root)
+    /// Ignored if it would create a cycle or the parent is in another scene.
     void setParent(Node* newParent);
 
     /// Get child count
-    size_t getChildCount() const { return m_children.size(); }
+    size_t getChildCount() const;
+
+    /// Get the first child (nullptr if none)
+    Node* getFirstChild() const;
 
-    /// Get child by index
+    /// Get the next child of this node's parent (nullptr if last)
+    Node* getNextSibling() const;
+
+    /// Get child by index (walks the sibling list; prefer getFirstChild()
+    /// and getNextSibling() in loops)
     Node* getChild(size_t index);
     const Node* getChild(size_t index) const;
 
-    /// Get all children
-    const std::vector<UNIQUE<Node>>& getChildren() const { return m_children; }
-
     /// Add a new child with name
-    /// @return Pointer to the newly created child
+    /// @return Pointer to the newly created child (nullptr if not in a scene)
     Node* addChild(const std::string& name = "Node");
 
-    /// Add an existing node as child (takes ownership)
-    /// @return Pointer to the added child
-    Node* addChild(UNIQUE<Node> child);
+    /// Destroy a child and its descendants
+    /// @return true if child was a child of this node
+    bool removeChild(Node* child);
 
-    /// Remove a child by pointer
-    /// @return The removed child (transfers ownership)
-    UNIQUE<Node> removeChild(Node* child);
+    /// Destroy the child at an index and its descendants
+    /// @return true if the index was valid
+    bool removeChild(size_t index);
 
-    /// Remove a child by index
-    /// @return The removed child (transfers ownership)
-    UNIQUE<Node> removeChild(size_t index);
-
-    /// Remove all children
+    /// Destroy all children and their descendants
     void removeAllChildren();
 
     /// Find a child by name (direct children only)
     Node* findChild(const std::string& name) const;
 
-    /// Find a descendant by name (recursive)
+    /// Find a descendant by name (first match)
+    /// A node's direct children are checked before its grandchildren, then
+    /// each child's subtree is searched in turn.
     Node* findDescendant(const std::string& name) const;
 
+    /// Find a descendant by a relative path of child names ("body/wheel_fl")
+    /// Each segment takes the first child with that name.
+    Node* findByPath(const std::string& path) const;
+
     // ========================================================================
     // Traversal
     // ========================================================================
@@ -124,12 +182,28 @@ public:
     /// Traverse only enabled nodes
     void traverseEnabled(const std::function<void(Node*)>& callback);
 
+    /// Visit this node and all descendants in pre-order without recursion
+    /// or std::function (defined in NodeIterator.h)
+    /// @param visitor Called with each node; may return VisitResult to skip
+    ///                a subtree or stop
+    template<typename Visitor>
+    void visit(Visitor&& visitor);
+
+    /// Visit this node and all descendants (const version)
+    template<typename Visitor>
+    void visit(Visitor&& visitor) const;
+
+    /// Visit only enabled nodes (a disabled node's subtree is skipped)
+    template<typename Visitor>
+    void visitEnabled(Visitor&& visitor);
+
     // ========================================================================
     // Model Attachment
     // ========================================================================
 
     /// Attach a model to this node (does NOT take ownership)
-    void setModel(Model* model) { m_model = model; }
+    /// Also sets the transform's local bounds from the model's bounding box.
+    void setModel(Model* model);
 
     /// Get attached model (may be nullptr)
     Model* getModel() const { return m_model; }
@@ -142,7 +216,8 @@ public:
     // ========================================================================
 
     /// Attach a static mesh to this node (does NOT take ownership)
-    void setMesh(StaticMesh* mesh) { m_mesh = mesh; }
+    /// Also sets the transform's local bounds from the mesh's bounding box.
+    void setMesh(StaticMesh* mesh);
 
     /// Get attached mesh (may be nullptr)
     StaticMesh* getMesh() const { return m_mesh; }
@@ -164,6 +239,14 @@ public:
     /// Check if node has a material set
     bool hasMaterial() const { return m_hasMaterial; }
 
+    /// Set a color multiplied into the diffuse color and alpha of the node's
+    /// model and mesh (white = unchanged)
+    /// Unlike a material change, a tint keeps the node in instanced batches.
+    void setTint(const Color& tint) { m_tint = tint; }
+
+    /// Get the tint color
+    const Color& getTint() const { return m_tint; }
+
     // ========================================================================
     // Shadow Configuration
     // ========================================================================
@@ -181,40 +264,68 @@ public:
     bool getReceivesShadow() const { return m_receivesShadow; }
 
     // ========================================================================
-    // Scene
+    // Occlusion
     // ========================================================================
 
-    /// Get the owning scene (may be nullptr if not added to scene)
-    Scene* getScene() const { return m_scene; }
+    /// Set whether this node's mesh hides what is behind it during occlusion
+    /// culling (needs a mesh with CPU geometry; see SceneRenderer)
+    void setOccluder(bool occluder) { m_occluder = occluder; }
+
+    /// Check if this node is a designated occluder
+    bool isOccluder() const { return m_occluder; }
 
     // ========================================================================
-    // Internal
+    // Scene
     // ========================================================================
 
-    /// Mark world transforms of all children as dirty
-    void markChildrenWorldDirty();
+    /// Get the owning scene (may be nullptr if not added to scene)
+    Scene* getScene() const { return m_scene; }
 
 private:
     friend class Scene;
+    friend class NodePool;
+
+    static constexpr uint32_t InvalidIndex = NodeHandle::InvalidIndex;
+
+    /// Node in a slot of this node's scene (InvalidIndex = nullptr)
+    Node* nodeAt(uint32_t index) const;
+
+    /// Set the transform's local bounds to enclose the model and mesh, and
+    /// update the scene's spatial tracking
+    void onGeometryChanged();
+
+    /// Append to a parent's child list
+    void attach(Node* parent);
+
+    /// Unlink from the parent's child list
+    void detach();
 
-    void setScene(Scene* scene);
+    /// Split a '/'-separated path into names (empty segments are skipped)
+    /// @return false if a segment was never interned (so nothing can match)
+    static bool parsePath(const std::string& path, std::vector<Name>& names);
 
-    static uint64_t s_nextID;
+    /// A tag and its position in the scene's tag index
+    struct TagEntry {
+        Name tag;
+        uint32_t position = 0;
+    };
 
-    uint64_t m_id;
-    std::string m_name;
+    NodeHandle m_handle;
+    Name m_name;
+    uint32_t m_namePosition = 0;    // Position in the scene's name index
+    std::vector<TagEntry> m_tags;
     bool m_enabled = true;
 
     Transform m_transform;
-    Node* m_parent = nullptr;
-    std::vector<UNIQUE<Node>> m_children;
 
     Model* m_model = nullptr;       // Non-owning pointer
     StaticMesh* m_mesh = nullptr;   // Non-owning pointer (for simple geometry)
     Material m_material;            // Material for mesh rendering
     bool m_hasMaterial = false;     // Whether material has been set
+    Color m_tint = Color::white();  // Diffuse/alpha multiplier (see setTint())
     bool m_castsShadow = true;      // Whether this node casts shadows
     bool m_receivesShadow = true;   // Whether this node receives shadows
+    bool m_occluder = false;        // Whether this node is a designated occluder
     Scene* m_scene = nullptr;       // Owning scene
 };
 
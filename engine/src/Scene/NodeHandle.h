@@ -0,0 +1,40 @@
+#pragma once
+
+/// Pina Engine - Node Handle
+/// Generational reference to a node in a Scene's node pool
+
+#include <cstdint>
+
+namespace Pina {
+
+/// Handle to a node slot in a Scene
+/// A handle stays safe to hold after its node is destroyed: the slot's
+/// generation changes, so Scene::getNode() returns nullptr instead of
+/// whichever node reuses the slot.
+struct NodeHandle {
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    uint32_t index = InvalidIndex;
+    uint32_t generation = 0;
+
+    /// Check if the handle was ever assigned (not whether the node is alive)
+    bool isValid() const { return index != InvalidIndex; }
+
+    /// Pack into a 64-bit ID (used by Node::getID())
+    uint64_t toID() const { return (static_cast<uint64_t>(generation) << 32) | index; }
+
+    /// Unpack an ID made by toID()
+    static NodeHandle fromID(uint64_t id) {
+        NodeHandle handle;
+        handle.index = static_cast<uint32_t>(id & 0xFFFFFFFFu);
+        handle.generation = static_cast<uint32_t>(id >> 32);
+        return handle;
+    }
+
+    bool operator==(const NodeHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const NodeHandle& other) const { return !(*this == other); }
+};
+
+} // namespace Pina
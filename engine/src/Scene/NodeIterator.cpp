@@ -0,0 +1,19 @@
+#include "NodeIterator.h"
+#include "Scene.h"
+
+namespace Pina {
+
+NodeIterator::NodeIterator(const Node* root, bool enabledOnly)
+    : m_enabledOnly(enabledOnly)
+{
+    if (!root || (enabledOnly && !root->isEnabled())) return;
+
+    m_current = const_cast<Node*>(root);
+    if (Scene* scene = root->getScene()) {
+        m_pool = &scene->getNodePool();
+        m_root = root->getHandle().index;
+        m_index = m_root;
+    }
+}
+
+} // namespace Pina
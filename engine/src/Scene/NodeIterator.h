@@ -0,0 +1,116 @@
+#pragma once
+
+/// Pina Engine - Node Iterator
+/// Allocation-free, non-recursive pre-order walks over a node's subtree
+
+#include "../Core/Export.h"
+#include "Node.h"
+#include "NodePool.h"
+#include <cstdint>
+#include <type_traits>
+
+namespace Pina {
+
+/// Pre-order iterator over a node and its descendants
+///
+/// The walk follows the scene pool's parent and sibling links, so it needs
+/// no stack, never allocates and handles hierarchies of any depth. The tree
+/// must not be modified while iterating (reading and changing node data is
+/// fine).
+///
+/// Usage:
+///   for (NodeIterator it(root); it; ++it) {
+///       if (!wanted(*it)) it.skipChildren();
+///   }
+class PINA_API NodeIterator {
+public:
+    /// End iterator
+    NodeIterator() = default;
+
+    /// Start at root
+    /// @param enabledOnly Skip disabled nodes together with their descendants
+    explicit NodeIterator(const Node* root, bool enabledOnly = false);
+
+    /// Current node (nullptr at the end)
+    Node* operator*() const { return m_current; }
+    Node* operator->() const { return m_current; }
+
+    /// Check if the walk has a current node
+    explicit operator bool() const { return m_current != nullptr; }
+
+    /// Depth of the current node below the start node (start node = 0)
+    uint32_t getDepth() const { return m_depth; }
+
+    /// Don't descend into the current node's children on the next step
+    void skipChildren() { m_skipChildren = true; }
+
+    /// Advance to the next node in pre-order
+    NodeIterator& operator++() {
+        if (!m_pool) {
+            m_current = nullptr;    // Detached start node has no descendants
+            return *this;
+        }
+
+        uint32_t index = m_pool->nextInSubtree(m_index, m_root, !m_skipChildren, m_depth);
+        while (m_enabledOnly && index != NodePool::InvalidIndex && !m_pool->slot(index)->isEnabled()) {
+            index = m_pool->nextInSubtree(index, m_root, false, m_depth);
+        }
+
+        m_skipChildren = false;
+        m_index = index;
+        m_current = (index != NodePool::InvalidIndex) ? m_pool->slot(index) : nullptr;
+        return *this;
+    }
+
+    bool operator==(const NodeIterator& other) const { return m_current == other.m_current; }
+    bool operator!=(const NodeIterator& other) const { return m_current != other.m_current; }
+
+private:
+    const NodePool* m_pool = nullptr;
+    Node* m_current = nullptr;
+    uint32_t m_root = NodePool::InvalidIndex;
+    uint32_t m_index = NodePool::InvalidIndex;
+    uint32_t m_depth = 0;
+    bool m_enabledOnly = false;
+    bool m_skipChildren = false;
+};
+
+// ============================================================================
+// Visitors (declared in Node)
+// ============================================================================
+
+namespace NodeVisit {
+
+/// Run a visitor over an iterator's walk, honoring VisitResult if returned
+template<typename NodePtr, typename Visitor>
+void run(NodeIterator it, Visitor& visitor) {
+    for (; it; ++it) {
+        NodePtr node = *it;
+        if constexpr (std::is_void<decltype(visitor(node))>::value) {
+            visitor(node);
+        } else {
+            VisitResult result = visitor(node);
+            if (result == VisitResult::Stop) return;
+            if (result == VisitResult::SkipChildren) it.skipChildren();
+        }
+    }
+}
+
+} // namespace NodeVisit
+
+template<typename Visitor>
+void Node::visit(Visitor&& visitor) {
+    NodeVisit::run<Node*>(NodeIterator(this), visitor);
+}
+
+template<typename Visitor>
+void Node::visit(Visitor&& visitor) const {
+    NodeVisit::run<const Node*>(NodeIterator(this), visitor);
+}
+
+template<typename Visitor>
+void Node::visitEnabled(Visitor&& visitor) {
+    NodeVisit::run<Node*>(NodeIterator(this, true), visitor);
+}
+
+} // namespace Pina
@@ -0,0 +1,62 @@
+#include "NodePool.h"
+#include "../Core/MemoryTracker.h"
+#include <new>
+
+namespace Pina {
+
+NodePool::NodePool(Scene* scene, TransformSystem& transforms)
+    : m_scene(scene)
+    , m_transforms(transforms)
+{
+}
+
+NodePool::~NodePool() {
+    // Scene destroys its hierarchy first; this only catches leftovers
+    for (uint32_t i = static_cast<uint32_t>(m_generations.size()); i > 0; --i) {
+        if (m_generations[i - 1] & 1u) {
+            slot(i - 1)->~Node();
+        }
+    }
+    for (Slot* chunk : m_chunks) {
+        MemoryTracker::deallocate(chunk, sizeof(Slot) * ChunkSize, MemoryTag::Scene);
+    }
+}
+
+Node* NodePool::create(const std::string& name) {
+    uint32_t index;
+    if (!m_freeIndices.empty()) {
+        index = m_freeIndices.back();
+        m_freeIndices.pop_back();
+    } else {
+        index = static_cast<uint32_t>(m_generations.size());
+        if (index % ChunkSize == 0) {
+            static_assert(alignof(Slot) <= alignof(std::max_align_t),
+                          "NodePool does not support over-aligned nodes");
+            m_chunks.push_back(static_cast<Slot*>(
+                MemoryTracker::allocate(sizeof(Slot) * ChunkSize, MemoryTag::Scene)));
+        }
+        m_generations.push_back(0);
+        m_links.emplace_back();
+    }
+    m_links[index] = Links();
+
+    Node* node = ::new (m_chunks[index / ChunkSize][index % ChunkSize].storage) Node(name, m_transforms);
+    m_generations[index]++;     // Now odd: in use
+    node->m_handle.index = index;
+    node->m_handle.generation = m_generations[index];
+    node->m_scene = m_scene;
+    m_count++;
+    return node;
+}
+
+void NodePool::destroy(Node* node) {
+    if (!node) return;
+
+    uint32_t index = node->m_handle.index;
+    node->~Node();
+    m_generations[index]++;     // Now even: free, and old handles no longer match
+    m_freeIndices.push_back(index);
+    m_count--;
+}
+
+} // namespace Pina
@@ -0,0 +1,137 @@
+#pragma once
+
+/// Pina Engine - Node Pool
+/// Chunked storage for a Scene's nodes with generational handles
+
+#include "../Core/Export.h"
+#include "Node.h"
+#include "NodeHandle.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Pina {
+
+/// Owns every node of a Scene
+///
+/// Nodes are constructed in place in fixed-size chunks, so a Node* stays
+/// valid for the node's lifetime and all nodes sit in a few large blocks.
+/// Each slot carries a generation that is odd while the slot is in use;
+/// handles compare it to reject nodes that were destroyed (and slots that
+/// were reused since). Freed slots are reused first, keeping the pool dense.
+///
+/// Hierarchy links are kept per slot in their own dense array rather than
+/// in the (large) Node objects, so walking the tree reads a few bytes per
+/// node from one sequential block. Scene and Node maintain the links; the
+/// pool only resets them when a slot is handed out.
+class PINA_API NodePool {
+public:
+    /// Slots per chunk (power of two)
+    static constexpr uint32_t ChunkSize = 1024;
+
+    static constexpr uint32_t InvalidIndex = NodeHandle::InvalidIndex;
+
+    /// Hierarchy links of one slot (slot indices, InvalidIndex = none)
+    struct Links {
+        uint32_t parent = InvalidIndex;
+        uint32_t firstChild = InvalidIndex;
+        uint32_t lastChild = InvalidIndex;
+        uint32_t prevSibling = InvalidIndex;
+        uint32_t nextSibling = InvalidIndex;
+        uint32_t childCount = 0;
+    };
+
+    /// @param transforms System the nodes' transforms are created in
+    NodePool(Scene* scene, TransformSystem& transforms);
+    ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    /// Construct a node in a free slot
+    Node* create(const std::string& name);
+
+    /// Destroy a node and free its slot
+    void destroy(Node* node);
+
+    /// Node for a handle (nullptr if destroyed or never created)
+    Node* get(NodeHandle handle) const {
+        if (handle.index >= m_generations.size() || m_generations[handle.index] != handle.generation) {
+            return nullptr;
+        }
+        return slot(handle.index);
+    }
+
+    /// Node in a slot (nullptr if the slot is free)
+    Node* at(uint32_t index) const {
+        if (index >= m_generations.size() || !(m_generations[index] & 1u)) {
+            return nullptr;
+        }
+        return slot(index);
+    }
+
+    /// Links of a live slot
+    Links& getLinks(uint32_t index) { return m_links[index]; }
+    const Links& getLinks(uint32_t index) const { return m_links[index]; }
+
+    /// Next slot in a pre-order walk of the subtree at subtreeRoot
+    /// @param enterChildren false to skip index's descendants
+    /// @param depth Depth of index below subtreeRoot, updated to the result's
+    /// @return InvalidIndex when the walk is done
+    uint32_t nextInSubtree(uint32_t index, uint32_t subtreeRoot, bool enterChildren, uint32_t& depth) const {
+        if (enterChildren && m_links[index].firstChild != InvalidIndex) {
+            depth++;
+            return m_links[index].firstChild;
+        }
+
+        // Climb until a slot has a next sibling, stopping at the subtree root
+        for (uint32_t i = index; i != subtreeRoot; i = m_links[i].parent, depth--) {
+            if (m_links[i].nextSibling != InvalidIndex) {
+                return m_links[i].nextSibling;
+            }
+        }
+        return InvalidIndex;
+    }
+
+    uint32_t nextInSubtree(uint32_t index, uint32_t subtreeRoot, bool enterChildren) const {
+        uint32_t depth = 0;
+        return nextInSubtree(index, subtreeRoot, enterChildren, depth);
+    }
+
+    /// Call a function for every live node, in slot order
+    template<typename F>
+    void forEach(F&& callback) const {
+        const uint32_t count = static_cast<uint32_t>(m_generations.size());
+        for (uint32_t i = 0; i < count; ++i) {
+            if (m_generations[i] & 1u) {
+                callback(slot(i));
+            }
+        }
+    }
+
+    /// Number of live nodes
+    size_t getCount() const { return m_count; }
+
+    /// Number of slots across all chunks
+    size_t getCapacity() const { return m_chunks.size() * ChunkSize; }
+
+    /// Node in a slot known to be live (no checks)
+    Node* slot(uint32_t index) const {
+        return reinterpret_cast<Node*>(m_chunks[index / ChunkSize][index % ChunkSize].storage);
+    }
+
+private:
+    struct Slot {
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    Scene* m_scene = nullptr;
+    TransformSystem& m_transforms;
+    std::vector<Slot*> m_chunks;
+    std::vector<uint32_t> m_generations;    // Odd while the slot holds a node
+    std::vector<Links> m_links;
+    std::vector<uint32_t> m_freeIndices;
+    size_t m_count = 0;
+};
+
+} // namespace Pina
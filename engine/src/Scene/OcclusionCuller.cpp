@@ -0,0 +1,495 @@
+#include "OcclusionCuller.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
+#include "../Math/SimdMath.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Pina {
+
+namespace {
+
+/// Depth of pixels no occluder covers
+constexpr float EmptyDepth = std::numeric_limits<float>::infinity();
+
+constexpr uint32_t TilePixels = OcclusionCuller::TileSize * OcclusionCuller::TileSize;
+
+/// Triangles per setup job
+constexpr size_t SetupGrainSize = 1024;
+
+/// Boxes per test job
+constexpr size_t TestGrainSize = 256;
+
+} // namespace
+
+OcclusionCuller::OcclusionCuller(const OcclusionCullerConfig& config)
+    : m_config(config)
+{
+    m_tilesX = std::max(1u, (config.width + TileSize - 1) / TileSize);
+    m_tilesY = std::max(1u, (config.height + TileSize - 1) / TileSize);
+    m_width = m_tilesX * TileSize;
+    m_height = m_tilesY * TileSize;
+
+    m_depth.assign(static_cast<size_t>(m_width) * m_height, EmptyDepth);
+    m_tileMaxDepths.assign(static_cast<size_t>(m_tilesX) * m_tilesY, EmptyDepth);
+    m_bins.resize(m_tileMaxDepths.size());
+}
+
+template<typename Fn>
+void OcclusionCuller::forEachChunk(size_t count, size_t grainSize, Fn&& fn) const {
+    if (m_jobSystem) {
+        m_jobSystem->parallelFor(0, count, grainSize, fn);
+    } else if (count > 0) {
+        fn(size_t(0), count);
+    }
+}
+
+// ============================================================================
+// Frame
+// ============================================================================
+
+void OcclusionCuller::beginFrame(const glm::mat4& viewProjection) {
+    m_viewProjection = viewProjection;
+    std::fill(m_depth.begin(), m_depth.end(), EmptyDepth);
+    std::fill(m_tileMaxDepths.begin(), m_tileMaxDepths.end(), EmptyDepth);
+    m_occluders.clear();
+    m_triangleCount = 0;
+    m_rasterizedCount = 0;
+}
+
+bool OcclusionCuller::addOccluder(const glm::mat4& world, const glm::vec3* positions, size_t vertexCount,
+                                  const uint32_t* indices, size_t indexCount) {
+    size_t triangleCount = indexCount / 3;
+    if (triangleCount == 0 || vertexCount == 0) return true;
+    if (m_triangleCount + triangleCount > m_config.maxOccluderTriangles) return false;
+
+    m_occluders.push_back({m_viewProjection * world, positions, vertexCount, indices,
+                           m_triangleCount, triangleCount});
+    m_triangleCount += triangleCount;
+    return true;
+}
+
+void OcclusionCuller::rasterize() {
+    PINA_PROFILE_SCOPE("OcclusionCuller::rasterize");
+
+    // Clip-space vertices, one occluder per job
+    m_clipOffsets.resize(m_occluders.size());
+    size_t vertexCount = 0;
+    for (size_t i = 0; i < m_occluders.size(); ++i) {
+        m_clipOffsets[i] = vertexCount;
+        vertexCount += m_occluders[i].vertexCount;
+    }
+    m_clipVertices.resize(vertexCount);
+
+    forEachChunk(m_occluders.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const Occluder& occluder = m_occluders[i];
+            glm::vec4* clip = m_clipVertices.data() + m_clipOffsets[i];
+            for (size_t v = 0; v < occluder.vertexCount; ++v) {
+                clip[v] = occluder.clipMatrix * glm::vec4(occluder.positions[v], 1.0f);
+            }
+        }
+    });
+
+    // Screen-space setup over all triangles
+    m_triangles.resize(m_triangleCount);
+    forEachChunk(m_triangleCount, SetupGrainSize, [this](size_t begin, size_t end) {
+        // Occluder holding the chunk's first triangle
+        size_t o = static_cast<size_t>(std::upper_bound(m_occluders.begin(), m_occluders.end(), begin,
+            [](size_t triangle, const Occluder& occluder) { return triangle < occluder.firstTriangle; })
+            - m_occluders.begin()) - 1;
+
+        for (size_t t = begin; t < end; ++t) {
+            while (t >= m_occluders[o].firstTriangle + m_occluders[o].triangleCount) {
+                o++;
+            }
+            const Occluder& occluder = m_occluders[o];
+            setupTriangle(occluder, t - occluder.firstTriangle, m_clipVertices.data() + m_clipOffsets[o]);
+        }
+    });
+
+    // Bin into tiles in triangle order, so results do not depend on threading
+    for (std::vector<uint32_t>& bin : m_bins) {
+        bin.clear();
+    }
+    m_rasterizedCount = 0;
+    for (size_t t = 0; t < m_triangleCount; ++t) {
+        const Triangle& triangle = m_triangles[t];
+        if (triangle.minX > triangle.maxX) continue;
+
+        m_rasterizedCount++;
+        uint32_t tileMaxX = static_cast<uint32_t>(triangle.maxX) / TileSize;
+        uint32_t tileMaxY = static_cast<uint32_t>(triangle.maxY) / TileSize;
+        for (uint32_t ty = static_cast<uint32_t>(triangle.minY) / TileSize; ty <= tileMaxY; ++ty) {
+            for (uint32_t tx = static_cast<uint32_t>(triangle.minX) / TileSize; tx <= tileMaxX; ++tx) {
+                m_bins[ty * m_tilesX + tx].push_back(static_cast<uint32_t>(t));
+            }
+        }
+    }
+
+    // Each tile's pixels belong to one job
+    forEachChunk(m_bins.size(), 1, [this](size_t begin, size_t end) {
+        for (size_t tile = begin; tile < end; ++tile) {
+            rasterizeTile(static_cast<uint32_t>(tile));
+        }
+    });
+}
+
+bool OcclusionCuller::projectTriangle(const Occluder& occluder, size_t triangle, const glm::vec4* clip,
+                                      glm::vec3* screen, uint32_t* vertices) const {
+    const uint32_t* indices = occluder.indices + triangle * 3;
+    for (int k = 0; k < 3; ++k) {
+        if (indices[k] >= occluder.vertexCount) return false;
+        const glm::vec4& c = clip[indices[k]];
+
+        // The GPU clips geometry in front of the near plane, so it hides nothing
+        if (c.w <= 0.0f || c.z < -c.w) return false;
+        if (std::abs(c.x) > GuardBand * c.w || std::abs(c.y) > GuardBand * c.w) return false;
+
+        float invW = 1.0f / c.w;
+        screen[k] = glm::vec3((c.x * invW * 0.5f + 0.5f) * static_cast<float>(m_width),
+                              (c.y * invW * 0.5f + 0.5f) * static_cast<float>(m_height),
+                              c.z * invW);
+        vertices[k] = indices[k];
+    }
+
+    // Counter-clockwise on screen, so the inside of every edge is positive
+    float det = (screen[1].x - screen[0].x) * (screen[2].y - screen[0].y) -
+                (screen[2].x - screen[0].x) * (screen[1].y - screen[0].y);
+    if (std::abs(det) < 1e-8f) return false;
+    if (det < 0.0f) {
+        std::swap(screen[1], screen[2]);
+        std::swap(vertices[1], vertices[2]);
+    }
+    return true;
+}
+
+bool OcclusionCuller::mergeQuad(const Occluder& occluder, size_t triangle, const glm::vec4* clip,
+                                glm::vec3* first, glm::vec3* second, glm::vec3* quad) const {
+    if (triangle + 1 >= occluder.triangleCount) return false;
+
+    uint32_t a[3], b[3];
+    if (!projectTriangle(occluder, triangle, clip, first, a) ||
+        !projectTriangle(occluder, triangle + 1, clip, second, b)) {
+        return false;
+    }
+
+    // Both run counter-clockwise, so lying on opposite sides of a shared
+    // edge they run it in opposite directions
+    for (int k = 0; k < 3; ++k) {
+        for (int m = 0; m < 3; ++m) {
+            if (a[k] != b[(m + 1) % 3] || a[(k + 1) % 3] != b[m]) continue;
+
+            quad[0] = first[k];
+            quad[1] = second[(m + 2) % 3];
+            quad[2] = first[(k + 1) % 3];
+            quad[3] = first[(k + 2) % 3];
+            for (int j = 0; j < 4; ++j) {
+                const glm::vec3& p0 = quad[j];
+                const glm::vec3& p1 = quad[(j + 1) % 4];
+                const glm::vec3& p2 = quad[(j + 2) % 4];
+                if ((p1.x - p0.x) * (p2.y - p1.y) - (p1.y - p0.y) * (p2.x - p1.x) <= 0.0f) return false;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void OcclusionCuller::setupTriangle(const Occluder& occluder, size_t triangle, const glm::vec4* clip) {
+    Triangle& out = m_triangles[occluder.firstTriangle + triangle];
+    out.minX = 1;
+    out.maxX = 0;
+
+    // Pairs of triangles forming a convex quad (as meshes usually list quads)
+    // are rasterized as one polygon, so pixels along the shared edge, which
+    // neither triangle covers alone, are still written. The pair's first
+    // triangle holds the quad and the second is skipped.
+    glm::vec3 first[3], second[3], quad[4];
+    uint32_t vertices[3];
+    const glm::vec3* corners = first;
+    int cornerCount = 3;
+    if (triangle % 2 == 1) {
+        if (mergeQuad(occluder, triangle - 1, clip, first, second, quad)) return;
+        if (!projectTriangle(occluder, triangle, clip, first, vertices)) return;
+        std::copy(first, first + 3, second);
+    } else if (mergeQuad(occluder, triangle, clip, first, second, quad)) {
+        corners = quad;
+        cornerCount = 4;
+    } else {
+        if (!projectTriangle(occluder, triangle, clip, first, vertices)) return;
+        std::copy(first, first + 3, second);
+    }
+
+    // Pixels lying wholly inside the screen bounds
+    float minX = corners[0].x, maxX = corners[0].x;
+    float minY = corners[0].y, maxY = corners[0].y;
+    for (int k = 1; k < cornerCount; ++k) {
+        minX = std::min(minX, corners[k].x);
+        maxX = std::max(maxX, corners[k].x);
+        minY = std::min(minY, corners[k].y);
+        maxY = std::max(maxY, corners[k].y);
+    }
+    int pixelMinX = std::max(0, static_cast<int>(std::ceil(minX)));
+    int pixelMaxX = std::min(static_cast<int>(m_width), static_cast<int>(std::floor(maxX))) - 1;
+    int pixelMinY = std::max(0, static_cast<int>(std::ceil(minY)));
+    int pixelMaxY = std::min(static_cast<int>(m_height), static_cast<int>(std::floor(maxY))) - 1;
+    if (pixelMinX > pixelMaxX || pixelMinY > pixelMaxY) return;
+
+    // Edges move inward by half a pixel along each axis, so a pixel center
+    // passes only if the whole pixel is inside (a triangle's fourth edge
+    // passes everywhere)
+    for (int k = 0; k < 4; ++k) {
+        if (k == cornerCount) {
+            out.edgeA[k] = out.edgeB[k] = out.edgeC[k] = 0.0f;
+            continue;
+        }
+        const glm::vec3& a = corners[k];
+        const glm::vec3& b = corners[(k + 1) % cornerCount];
+        out.edgeA[k] = a.y - b.y;
+        out.edgeB[k] = b.x - a.x;
+        out.edgeC[k] = -(out.edgeA[k] * a.x + out.edgeB[k] * a.y) -
+                       0.5f * (std::abs(out.edgeA[k]) + std::abs(out.edgeB[k]));
+    }
+
+    // Depth planes moved back by the same half pixel, so each covered pixel
+    // gets the farthest depth either plane has over it
+    const glm::vec3* planes[2] = {first, second};
+    for (int p = 0; p < 2; ++p) {
+        const glm::vec3* v = planes[p];
+        float det = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[2].x - v[0].x) * (v[1].y - v[0].y);
+        float dz1 = v[1].z - v[0].z;
+        float dz2 = v[2].z - v[0].z;
+        out.depthA[p] = (dz1 * (v[2].y - v[0].y) - dz2 * (v[1].y - v[0].y)) / det;
+        out.depthB[p] = (dz2 * (v[1].x - v[0].x) - dz1 * (v[2].x - v[0].x)) / det;
+        out.depthC[p] = v[0].z - out.depthA[p] * v[0].x - out.depthB[p] * v[0].y +
+                        0.5f * (std::abs(out.depthA[p]) + std::abs(out.depthB[p]));
+    }
+
+    out.minX = pixelMinX;
+    out.maxX = pixelMaxX;
+    out.minY = pixelMinY;
+    out.maxY = pixelMaxY;
+}
+
+void OcclusionCuller::rasterizeTile(uint32_t tile) {
+    const int tileX = static_cast<int>((tile % m_tilesX) * TileSize);
+    const int tileY = static_cast<int>((tile / m_tilesX) * TileSize);
+    float* depth = m_depth.data() + static_cast<size_t>(tile) * TilePixels;
+
+    for (uint32_t index : m_bins[tile]) {
+        const Triangle& triangle = m_triangles[index];
+        int rowBegin = std::max(triangle.minY, tileY) - tileY;
+        int rowEnd = std::min(triangle.maxY, tileY + static_cast<int>(TileSize) - 1) - tileY;
+
+#ifdef PINA_SIMD_SSE
+        // Edge and depth values along the row, eight pixel centers in two registers
+        const __m128 left = _mm_add_ps(_mm_set1_ps(static_cast<float>(tileX)), _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f));
+        const __m128 right = _mm_add_ps(left, _mm_set1_ps(4.0f));
+        __m128 edgeLeft[4], edgeRight[4], edgeB[4];
+        for (int k = 0; k < 4; ++k) {
+            __m128 a = _mm_set1_ps(triangle.edgeA[k]);
+            __m128 c = _mm_set1_ps(triangle.edgeC[k]);
+            edgeLeft[k] = _mm_add_ps(_mm_mul_ps(a, left), c);
+            edgeRight[k] = _mm_add_ps(_mm_mul_ps(a, right), c);
+            edgeB[k] = _mm_set1_ps(triangle.edgeB[k]);
+        }
+        __m128 depthLeft[2], depthRight[2], depthB[2];
+        for (int p = 0; p < 2; ++p) {
+            __m128 a = _mm_set1_ps(triangle.depthA[p]);
+            __m128 c = _mm_set1_ps(triangle.depthC[p]);
+            depthLeft[p] = _mm_add_ps(_mm_mul_ps(a, left), c);
+            depthRight[p] = _mm_add_ps(_mm_mul_ps(a, right), c);
+            depthB[p] = _mm_set1_ps(triangle.depthB[p]);
+        }
+        const __m128 zero = _mm_setzero_ps();
+
+        for (int row = rowBegin; row <= rowEnd; ++row) {
+            __m128 y = _mm_set1_ps(static_cast<float>(tileY + row) + 0.5f);
+            __m128 maskLeft = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            __m128 maskRight = maskLeft;
+            for (int k = 0; k < 4; ++k) {
+                __m128 by = _mm_mul_ps(edgeB[k], y);
+                maskLeft = _mm_and_ps(maskLeft, _mm_cmpge_ps(_mm_add_ps(edgeLeft[k], by), zero));
+                maskRight = _mm_and_ps(maskRight, _mm_cmpge_ps(_mm_add_ps(edgeRight[k], by), zero));
+            }
+            if (_mm_movemask_ps(_mm_or_ps(maskLeft, maskRight)) == 0) continue;
+
+            __m128 by0 = _mm_mul_ps(depthB[0], y);
+            __m128 by1 = _mm_mul_ps(depthB[1], y);
+            float* rowDepth = depth + row * TileSize;
+            __m128 current = _mm_loadu_ps(rowDepth);
+            __m128 z = _mm_max_ps(_mm_add_ps(depthLeft[0], by0), _mm_add_ps(depthLeft[1], by1));
+            z = _mm_min_ps(current, z);
+            _mm_storeu_ps(rowDepth, _mm_or_ps(_mm_and_ps(maskLeft, z), _mm_andnot_ps(maskLeft, current)));
+            current = _mm_loadu_ps(rowDepth + 4);
+            z = _mm_max_ps(_mm_add_ps(depthRight[0], by0), _mm_add_ps(depthRight[1], by1));
+            z = _mm_min_ps(current, z);
+            _mm_storeu_ps(rowDepth + 4, _mm_or_ps(_mm_and_ps(maskRight, z), _mm_andnot_ps(maskRight, current)));
+        }
+#else
+        for (int row = rowBegin; row <= rowEnd; ++row) {
+            float y = static_cast<float>(tileY + row) + 0.5f;
+            float* rowDepth = depth + row * TileSize;
+            for (uint32_t column = 0; column < TileSize; ++column) {
+                float x = static_cast<float>(tileX + static_cast<int>(column)) + 0.5f;
+                bool inside = true;
+                for (int k = 0; k < 4; ++k) {
+                    if (triangle.edgeA[k] * x + triangle.edgeC[k] + triangle.edgeB[k] * y < 0.0f) {
+                        inside = false;
+                    }
+                }
+                if (inside) {
+                    float z = std::max(triangle.depthA[0] * x + triangle.depthC[0] + triangle.depthB[0] * y,
+                                       triangle.depthA[1] * x + triangle.depthC[1] + triangle.depthB[1] * y);
+                    rowDepth[column] = std::min(rowDepth[column], z);
+                }
+            }
+        }
+#endif
+    }
+
+    float maxDepth = depth[0];
+    for (uint32_t i = 1; i < TilePixels; ++i) {
+        maxDepth = std::max(maxDepth, depth[i]);
+    }
+    m_tileMaxDepths[tile] = maxDepth;
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+OcclusionCuller::ScreenRect OcclusionCuller::project(const BoundingBox& box) const {
+    ScreenRect rect{0, 0, -1, -1, EmptyDepth, false, false};
+    if (!box.isValid()) {
+        rect.crossesNear = true;
+        return rect;
+    }
+
+    // Corners as the min corner plus combinations of the matrix columns
+    glm::vec4 base = m_viewProjection * glm::vec4(box.min, 1.0f);
+    glm::vec3 size = box.max - box.min;
+    glm::vec4 dx = m_viewProjection[0] * size.x;
+    glm::vec4 dy = m_viewProjection[1] * size.y;
+    glm::vec4 dz = m_viewProjection[2] * size.z;
+
+    float minX = std::numeric_limits<float>::max(), maxX = std::numeric_limits<float>::lowest();
+    float minY = minX, maxY = maxX;
+    for (int i = 0; i < 8; ++i) {
+        glm::vec4 c = base;
+        if (i & 1) c += dx;
+        if (i & 2) c += dy;
+        if (i & 4) c += dz;
+        if (c.w <= 0.0f || c.z < -c.w) {
+            rect.crossesNear = true;
+            return rect;
+        }
+
+        float invW = 1.0f / c.w;
+        float x = (c.x * invW * 0.5f + 0.5f) * static_cast<float>(m_width);
+        float y = (c.y * invW * 0.5f + 0.5f) * static_cast<float>(m_height);
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, y);
+        maxY = std::max(maxY, y);
+        rect.nearestDepth = std::min(rect.nearestDepth, c.z * invW);
+    }
+
+    const float width = static_cast<float>(m_width);
+    const float height = static_cast<float>(m_height);
+    if (maxX < 0.0f || maxY < 0.0f || minX >= width || minY >= height) {
+        rect.offscreen = true;
+        return rect;
+    }
+
+    // Every pixel the rectangle touches (clamped before converting)
+    rect.minX = static_cast<int>(std::floor(std::max(minX, 0.0f)));
+    rect.minY = static_cast<int>(std::floor(std::max(minY, 0.0f)));
+    rect.maxX = static_cast<int>(std::floor(std::min(maxX, width - 1.0f)));
+    rect.maxY = static_cast<int>(std::floor(std::min(maxY, height - 1.0f)));
+    return rect;
+}
+
+bool OcclusionCuller::isVisible(const BoundingBox& box) const {
+    ScreenRect rect = project(box);
+    if (rect.crossesNear || rect.offscreen) return true;
+
+    const int tileSize = static_cast<int>(TileSize);
+    for (int ty = rect.minY / tileSize; ty <= rect.maxY / tileSize; ++ty) {
+        for (int tx = rect.minX / tileSize; tx <= rect.maxX / tileSize; ++tx) {
+            uint32_t tile = static_cast<uint32_t>(ty) * m_tilesX + static_cast<uint32_t>(tx);
+
+            // Behind everything in this tile
+            if (rect.nearestDepth > m_tileMaxDepths[tile]) continue;
+
+            int rowBegin = std::max(rect.minY - ty * tileSize, 0);
+            int rowEnd = std::min(rect.maxY - ty * tileSize, tileSize - 1);
+            int columnBegin = std::max(rect.minX - tx * tileSize, 0);
+            int columnEnd = std::min(rect.maxX - tx * tileSize, tileSize - 1);
+            const float* depth = m_depth.data() + static_cast<size_t>(tile) * TilePixels;
+
+#ifdef PINA_SIMD_SSE
+            const int columns = ((1 << (columnEnd + 1)) - 1) & ~((1 << columnBegin) - 1);
+            const __m128 nearest = _mm_set1_ps(rect.nearestDepth);
+            for (int row = rowBegin; row <= rowEnd; ++row) {
+                const float* rowDepth = depth + row * tileSize;
+                int mask = _mm_movemask_ps(_mm_cmple_ps(nearest, _mm_loadu_ps(rowDepth))) |
+                           (_mm_movemask_ps(_mm_cmple_ps(nearest, _mm_loadu_ps(rowDepth + 4))) << 4);
+                if (mask & columns) return true;
+            }
+#else
+            for (int row = rowBegin; row <= rowEnd; ++row) {
+                const float* rowDepth = depth + row * tileSize;
+                for (int column = columnBegin; column <= columnEnd; ++column) {
+                    if (rect.nearestDepth <= rowDepth[column]) return true;
+                }
+            }
+#endif
+        }
+    }
+    return false;
+}
+
+void OcclusionCuller::testBoxes(const BoundingBox* boxes, uint8_t* visible, size_t count) const {
+    PINA_PROFILE_SCOPE("OcclusionCuller::testBoxes");
+
+    forEachChunk(count, TestGrainSize, [this, boxes, visible](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            visible[i] = isVisible(boxes[i]) ? 1 : 0;
+        }
+    });
+}
+
+bool OcclusionCuller::isVisibleReference(const BoundingBox& box) const {
+    ScreenRect rect = project(box);
+    if (rect.crossesNear || rect.offscreen) return true;
+
+    for (int y = rect.minY; y <= rect.maxY; ++y) {
+        for (int x = rect.minX; x <= rect.maxX; ++x) {
+            if (rect.nearestDepth <= getDepth(static_cast<uint32_t>(x), static_cast<uint32_t>(y))) return true;
+        }
+    }
+    return false;
+}
+
+float OcclusionCuller::getScreenArea(const BoundingBox& box) const {
+    ScreenRect rect = project(box);
+    if (rect.crossesNear) return 1.0f;
+    if (rect.offscreen) return 0.0f;
+
+    float pixels = static_cast<float>(rect.maxX - rect.minX + 1) * static_cast<float>(rect.maxY - rect.minY + 1);
+    return pixels / (static_cast<float>(m_width) * static_cast<float>(m_height));
+}
+
+// ============================================================================
+// Depth Buffer
+// ============================================================================
+
+float OcclusionCuller::getDepth(uint32_t x, uint32_t y) const {
+    uint32_t tile = (y / TileSize) * m_tilesX + x / TileSize;
+    return m_depth[static_cast<size_t>(tile) * TilePixels + (y % TileSize) * TileSize + x % TileSize];
+}
+
+} // namespace Pina
@@ -0,0 +1,194 @@
+#pragma once
+
+/// Pina Engine - Occlusion Culler
+/// Software depth rasterizer with a hierarchical depth buffer for CPU occlusion culling
+
+#include "../Core/Export.h"
+#include "../Math/BoundingBox.h"
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Pina {
+
+class JobSystem;
+
+/// Occlusion culler configuration
+struct PINA_API OcclusionCullerConfig {
+    uint32_t width = 256;                   // Depth buffer size (rounded up to whole tiles)
+    uint32_t height = 128;
+    float autoOccluderArea = 0.1f;          // Screen fraction at which meshes become occluders (0 = designated only)
+    size_t maxOccluderTriangles = 65536;    // Triangles rasterized per frame at most
+};
+
+/// Rasterizes occluder triangles into a low-resolution depth buffer and
+/// tests boxes against it
+///
+/// Depth is NDC z (OpenGL clip space, nearer is smaller), cleared to
+/// infinity. The buffer is split into TileSize x TileSize tiles that are
+/// stored contiguously; each tile also keeps the farthest depth it holds, so
+/// a box whose nearest depth lies beyond it is hidden in that tile without
+/// looking at pixels.
+///
+/// Results are conservative: occluder triangles crossing the near plane or
+/// far outside the view are skipped, boxes crossing the near plane are
+/// always visible, and a box is only hidden if its nearest depth is behind
+/// the occluders at every pixel its screen rectangle touches. A triangle
+/// only writes pixels it covers entirely, with the farthest depth it has
+/// over the pixel. Consecutive triangles forming a convex quad are
+/// rasterized together, so its diagonal leaves no gaps; pixels split between
+/// other triangles stay uncovered.
+///
+/// With a JobSystem, triangle setup, rasterization (one tile per job chunk)
+/// and batched box tests run on the workers.
+class PINA_API OcclusionCuller {
+public:
+    /// Pixels along each side of a tile (one row = two SSE registers)
+    static constexpr uint32_t TileSize = 8;
+
+    explicit OcclusionCuller(const OcclusionCullerConfig& config = {});
+
+    OcclusionCuller(const OcclusionCuller&) = delete;
+    OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+    /// Run large batches on a job system (nullptr = always serial)
+    void setJobSystem(JobSystem* jobs) { m_jobSystem = jobs; }
+    JobSystem* getJobSystem() const { return m_jobSystem; }
+
+    const OcclusionCullerConfig& getConfig() const { return m_config; }
+
+    // ========================================================================
+    // Frame
+    // ========================================================================
+
+    /// Start a frame: clear the depth buffer and the occluder list
+    void beginFrame(const glm::mat4& viewProjection);
+
+    /// Queue an occluder mesh (the arrays must stay alive until rasterize())
+    /// @return false if the triangle budget is used up (nothing queued)
+    bool addOccluder(const glm::mat4& world, const glm::vec3* positions, size_t vertexCount,
+                     const uint32_t* indices, size_t indexCount);
+
+    /// Rasterize the queued occluders and build the tile depths
+    void rasterize();
+
+    // ========================================================================
+    // Tests
+    // ========================================================================
+
+    /// Check if any part of a world-space box may be visible
+    bool isVisible(const BoundingBox& box) const;
+
+    /// visible[i] = isVisible(boxes[i])
+    void testBoxes(const BoundingBox* boxes, uint8_t* visible, size_t count) const;
+
+    /// Same as isVisible(), but compares against every pixel without using
+    /// the tile depths (reference for tests)
+    bool isVisibleReference(const BoundingBox& box) const;
+
+    /// Fraction of the screen covered by a box's projected rectangle
+    /// (1 if the box crosses the near plane)
+    float getScreenArea(const BoundingBox& box) const;
+
+    // ========================================================================
+    // Depth Buffer
+    // ========================================================================
+
+    uint32_t getWidth() const { return m_width; }
+    uint32_t getHeight() const { return m_height; }
+    uint32_t getTileCountX() const { return m_tilesX; }
+    uint32_t getTileCountY() const { return m_tilesY; }
+
+    /// Depth of a pixel (x right, y up from the bottom-left corner)
+    float getDepth(uint32_t x, uint32_t y) const;
+
+    /// Farthest depth in a tile
+    float getTileMaxDepth(uint32_t tileX, uint32_t tileY) const {
+        return m_tileMaxDepths[tileY * m_tilesX + tileX];
+    }
+
+    /// Number of occluder triangles queued this frame
+    size_t getOccluderTriangleCount() const { return m_triangleCount; }
+
+    /// Number of triangles written into the depth buffer by the last rasterize()
+    /// (a quad merged from two triangles counts once)
+    size_t getRasterizedTriangleCount() const { return m_rasterizedCount; }
+
+private:
+    /// Triangles the size of a few hundred screens would lose edge precision
+    static constexpr float GuardBand = 16.0f;
+
+    struct Occluder {
+        glm::mat4 clipMatrix;           // viewProjection * world
+        const glm::vec3* positions;
+        size_t vertexCount;
+        const uint32_t* indices;
+        size_t firstTriangle;           // Offset into m_triangles
+        size_t triangleCount;
+    };
+
+    /// Screen-space triangle, or convex quad merged from two triangles,
+    /// ready for rasterization
+    /// With x, y at a pixel center, the whole pixel is inside edge i when
+    /// edgeA[i] * x + edgeB[i] * y + edgeC[i] >= 0, and the larger of
+    /// depthA[p] * x + depthB[p] * y + depthC[p] over both planes is the
+    /// farthest depth over the pixel. Triangles repeat their plane.
+    struct Triangle {
+        float edgeA[4], edgeB[4], edgeC[4];
+        float depthA[2], depthB[2], depthC[2];
+        int minX, minY, maxX, maxY;     // Pixel bounds (minX > maxX = rejected)
+    };
+
+    /// Box projected to the screen
+    struct ScreenRect {
+        int minX, minY, maxX, maxY;     // Pixels touched (inclusive, clamped)
+        float nearestDepth;
+        bool crossesNear;               // Not testable (always visible)
+        bool offscreen;                 // No pixels touched
+    };
+
+    ScreenRect project(const BoundingBox& box) const;
+
+    /// Project one occluder triangle to the screen, counter-clockwise
+    /// @param vertices Receives the vertex indices in the same order
+    /// @return false if the triangle cannot occlude anything
+    bool projectTriangle(const Occluder& occluder, size_t triangle, const glm::vec4* clip,
+                         glm::vec3* screen, uint32_t* vertices) const;
+
+    /// Merge a triangle and the next one into a convex quad if they share an edge
+    /// @return false if they do not form one (first and second are then unspecified)
+    bool mergeQuad(const Occluder& occluder, size_t triangle, const glm::vec4* clip,
+                   glm::vec3* first, glm::vec3* second, glm::vec3* quad) const;
+
+    /// Build the screen-space polygon for one occluder triangle
+    void setupTriangle(const Occluder& occluder, size_t triangle, const glm::vec4* clip);
+
+    /// Rasterize the binned triangles of one tile and update its max depth
+    void rasterizeTile(uint32_t tile);
+
+    template<typename Fn>
+    void forEachChunk(size_t count, size_t grainSize, Fn&& fn) const;
+
+    OcclusionCullerConfig m_config;
+    JobSystem* m_jobSystem = nullptr;
+
+    uint32_t m_width = 0;
+    uint32_t m_height = 0;
+    uint32_t m_tilesX = 0;
+    uint32_t m_tilesY = 0;
+    glm::mat4 m_viewProjection = glm::mat4(1.0f);
+
+    std::vector<float> m_depth;             // Tile-major, rows of TileSize within a tile
+    std::vector<float> m_tileMaxDepths;
+
+    std::vector<Occluder> m_occluders;
+    std::vector<glm::vec4> m_clipVertices;  // Per occluder vertex, in occluder order
+    std::vector<size_t> m_clipOffsets;      // First clip vertex per occluder
+    std::vector<Triangle> m_triangles;
+    std::vector<std::vector<uint32_t>> m_bins;  // Triangle indices per tile
+    size_t m_triangleCount = 0;
+    size_t m_rasterizedCount = 0;
+};
+
+} // namespace Pina
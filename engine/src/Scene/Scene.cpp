@@ -3,45 +3,201 @@
 #include "../Graphics/Model.h"
 #include "../Graphics/GraphicsDevice.h"
 #include "../Graphics/Lighting/DirectionalLight.h"
+#include "../Core/Profiler.h"
 #include <cmath>
+#include <iostream>
 
 namespace Pina {
 
-Scene::Scene() {
+namespace {
+
+/// Job system of scenes without their own (see Scene::setDefaultJobSystem())
+JobSystem* s_defaultJobSystem = nullptr;
+
+} // namespace
+
+Scene::Scene()
+    : m_nodes(this, m_transforms)
+    , m_spatial(m_nodes, m_transforms)
+{
     // Create root node
-    m_root = MAKE_UNIQUE<Node>("Root");
-    m_root->setScene(this);
+    Node* root = m_nodes.create("Root");
+    indexName(root);
+    m_root = root->getHandle();
 }
 
-Scene::~Scene() = default;
+Scene::~Scene() {
+    // Children before parents, so each transform is a leaf when destroyed
+    Node* root = getRoot();
+    root->removeAllChildren();
+    m_nodes.destroy(root);
+}
 
 // ============================================================================
 // Node Creation
 // ============================================================================
 
 Node* Scene::createNode(const std::string& name) {
-    return createNode(name, m_root.get());
+    return createNode(name, getRoot());
 }
 
 Node* Scene::createNode(const std::string& name, Node* parent) {
-    Node* parentNode = parent ? parent : m_root.get();
-    return parentNode->addChild(name);
+    Node* parentNode = parent ? parent : getRoot();
+    if (parentNode->m_scene != this) {
+        std::cerr << "Scene::createNode - Parent '" << parentNode->getName() << "' is in another scene" << std::endl;
+        return nullptr;
+    }
+
+    Node* node = m_nodes.create(name);
+    indexName(node);
+    node->attach(parentNode);
+    return node;
+}
+
+bool Scene::destroyNode(Node* node) {
+    if (!node || node->m_scene != this || node->m_handle == m_root) return false;
+
+    node->detach();
+
+    // Reverse pre-order puts every node after its descendants
+    m_destroyScratch.clear();
+    const uint32_t root = node->m_handle.index;
+    for (uint32_t i = root; i != NodeHandle::InvalidIndex; i = m_nodes.nextInSubtree(i, root, true)) {
+        m_destroyScratch.push_back(m_nodes.slot(i));
+    }
+    for (auto it = m_destroyScratch.rbegin(); it != m_destroyScratch.rend(); ++it) {
+        Node* n = *it;
+        m_spatial.untrack(n);
+        unindexName(n);
+        for (size_t i = n->m_tags.size(); i > 0; --i) {
+            unindexTag(n, i - 1);
+        }
+        m_nodes.destroy(n);
+    }
+    m_destroyScratch.clear();
+    return true;
 }
 
 // ============================================================================
 // Node Lookup
 // ============================================================================
 
-Node* Scene::findNode(uint64_t id) const {
-    auto it = m_nodesByID.find(id);
-    if (it != m_nodesByID.end()) {
-        return it->second;
+Node* Scene::findNode(const std::string& name) const {
+    Name key;
+    if (!Name::find(name, key)) return nullptr;
+
+    auto it = m_nodesByName.find(key);
+    return (it != m_nodesByName.end()) ? m_nodes.slot(it->second.front()) : nullptr;
+}
+
+std::vector<Node*> Scene::findNodes(const std::string& name) const {
+    Name key;
+    if (!Name::find(name, key)) return {};
+    return collect(m_nodesByName, key);
+}
+
+Node* Scene::findNodeByPath(const std::string& path) const {
+    std::vector<Name> names;
+    if (!Node::parsePath(path, names) || names.empty()) return nullptr;
+    bool anchored = path[0] == '/';
+
+    // Start from every node with the last name and check its ancestors
+    auto it = m_nodesByName.find(names.back());
+    if (it == m_nodesByName.end()) return nullptr;
+
+    for (uint32_t slot : it->second) {
+        Node* candidate = m_nodes.slot(slot);
+        Node* ancestor = candidate;
+        size_t i = names.size() - 1;
+        while (i > 0) {
+            ancestor = ancestor->getParent();
+            if (!ancestor || ancestor->m_name != names[i - 1]) break;
+            --i;
+        }
+        if (i == 0 && (!anchored || ancestor->getParent() == getRoot())) {
+            return candidate;
+        }
     }
     return nullptr;
 }
 
-Node* Scene::findNode(const std::string& name) const {
-    return m_root->findDescendant(name);
+Node* Scene::findNodeWithTag(const Name& tag) const {
+    auto it = m_nodesByTag.find(tag);
+    return (it != m_nodesByTag.end()) ? m_nodes.slot(it->second.front()) : nullptr;
+}
+
+std::vector<Node*> Scene::findNodesWithTag(const Name& tag) const {
+    return collect(m_nodesByTag, tag);
+}
+
+std::vector<Node*> Scene::collect(const NameIndex& index, const Name& key) const {
+    std::vector<Node*> nodes;
+    auto it = index.find(key);
+    if (it != index.end()) {
+        nodes.reserve(it->second.size());
+        for (uint32_t slot : it->second) {
+            nodes.push_back(m_nodes.slot(slot));
+        }
+    }
+    return nodes;
+}
+
+// ============================================================================
+// Name and Tag Index
+// ============================================================================
+
+void Scene::indexName(Node* node) {
+    std::vector<uint32_t>& slots = m_nodesByName[node->m_name];
+    node->m_namePosition = static_cast<uint32_t>(slots.size());
+    slots.push_back(node->m_handle.index);
+}
+
+void Scene::unindexName(Node* node) {
+    auto it = m_nodesByName.find(node->m_name);
+    std::vector<uint32_t>& slots = it->second;
+
+    // Swap-remove, moving the last node into this node's position
+    uint32_t moved = slots.back();
+    slots[node->m_namePosition] = moved;
+    m_nodes.slot(moved)->m_namePosition = node->m_namePosition;
+    slots.pop_back();
+    if (slots.empty()) {
+        m_nodesByName.erase(it);
+    }
+}
+
+void Scene::indexTag(Node* node, size_t entry) {
+    Node::TagEntry& tagEntry = node->m_tags[entry];
+    std::vector<uint32_t>& slots = m_nodesByTag[tagEntry.tag];
+    tagEntry.position = static_cast<uint32_t>(slots.size());
+    slots.push_back(node->m_handle.index);
+}
+
+void Scene::unindexTag(Node* node, size_t entry) {
+    const Node::TagEntry& tagEntry = node->m_tags[entry];
+    auto it = m_nodesByTag.find(tagEntry.tag);
+    std::vector<uint32_t>& slots = it->second;
+
+    uint32_t moved = slots.back();
+    slots[tagEntry.position] = moved;
+    for (Node::TagEntry& movedEntry : m_nodes.slot(moved)->m_tags) {
+        if (movedEntry.tag == tagEntry.tag) {
+            movedEntry.position = tagEntry.position;
+            break;
+        }
+    }
+    slots.pop_back();
+    if (slots.empty()) {
+        m_nodesByTag.erase(it);
+    }
+}
+
+void Scene::updateSpatialTracking(Node* node) {
+    if (node->hasModel() || node->hasMesh()) {
+        m_spatial.track(node);
+    } else {
+        m_spatial.untrack(node);
+    }
 }
 
 // ============================================================================
@@ -49,16 +205,74 @@ Node* Scene::findNode(const std::string& name) const {
 // ============================================================================
 
 void Scene::traverse(const std::function<void(Node*)>& callback) {
-    m_root->traverse(callback);
+    getRoot()->traverse(callback);
 }
 
 void Scene::traverse(const std::function<void(const Node*)>& callback) const {
-    const Node* root = m_root.get();
-    root->traverse(callback);
+    getRoot()->traverse(callback);
 }
 
 void Scene::traverseEnabled(const std::function<void(Node*)>& callback) {
-    m_root->traverseEnabled(callback);
+    getRoot()->traverseEnabled(callback);
+}
+
+// ============================================================================
+// Spatial Queries
+// ============================================================================
+
+RaycastHit Scene::raycast(const Ray& ray, float maxDistance) const {
+    PINA_PROFILE_FUNCTION();
+
+    RaycastHit hit;
+    hit.distance = maxDistance;
+
+    // Candidates nearest first; stop once their bounds start past the closest hit
+    std::vector<std::pair<float, Node*>> candidates;
+    m_spatial.queryRay(ray, maxDistance, candidates);
+    glm::vec3 origin = ray.origin;
+    glm::vec3 direction = ray.direction;
+    for (const auto& candidate : candidates) {
+        if (candidate.first > hit.distance) break;
+
+        Node* node = candidate.second;
+        if (!node->isEnabledInHierarchy()) continue;
+
+        if (StaticMesh* mesh = node->getMesh()) {
+            raycastMesh(node, mesh, origin, direction, hit);
+        }
+        if (Model* model = node->getModel()) {
+            for (size_t i = 0; i < model->getMeshCount(); ++i) {
+                raycastMesh(node, model->getMesh(i), origin, direction, hit);
+            }
+        }
+    }
+
+    if (!hit.node) return RaycastHit();
+    hit.point = origin + direction * hit.distance;
+    return hit;
+}
+
+void Scene::raycastMesh(Node* node, StaticMesh* mesh, const glm::vec3& origin, const glm::vec3& direction,
+                        RaycastHit& hit) {
+    if (!mesh->hasCpuGeometry()) return;
+
+    // The local direction keeps the world length scaled by the matrix, so
+    // local ray parameters are world distances
+    // Current matrices are read without touching the TransformSystem
+    const Transform& transform = node->getTransform();
+    glm::mat4 toLocal = glm::inverse(transform.isCurrent() ? transform.getCachedWorldMatrix()
+                                                           : transform.getWorldMatrix());
+    glm::vec3 localOrigin = glm::vec3(toLocal * glm::vec4(origin, 1.0f));
+    glm::vec3 localDirection = glm::vec3(toLocal * glm::vec4(direction, 0.0f));
+
+    TriangleHit triangle;
+    if (mesh->raycast(localOrigin, localDirection, hit.distance, triangle) &&
+        (!hit.node || triangle.distance < hit.distance)) {
+        hit.node = node;
+        hit.mesh = mesh;
+        hit.triangle = triangle.triangle;
+        hit.distance = triangle.distance;
+    }
 }
 
 // ============================================================================
@@ -68,6 +282,13 @@ void Scene::traverseEnabled(const std::function<void(Node*)>& callback) {
 void Scene::update(float deltaTime) {
     (void)deltaTime;
 
+    // Bring every world matrix up to date in one pass
+    m_transforms.setJobSystem(getJobSystem());
+    m_transforms.update();
+
+    // Refit the bounds of nodes that moved
+    m_spatial.update();
+
     // Update light manager with camera position for specular calculations
     if (m_activeCamera) {
         m_lightManager.setViewPosition(m_activeCamera->getPosition());
@@ -77,6 +298,18 @@ void Scene::update(float deltaTime) {
     m_lightManager.update();
 }
 
+JobSystem* Scene::getJobSystem() const {
+    return m_jobSystem ? m_jobSystem : s_defaultJobSystem;
+}
+
+void Scene::setDefaultJobSystem(JobSystem* jobs) {
+    s_defaultJobSystem = jobs;
+}
+
+JobSystem* Scene::getDefaultJobSystem() {
+    return s_defaultJobSystem;
+}
+
 // ============================================================================
 // Camera Management
 // ============================================================================
@@ -180,8 +413,9 @@ Node* Scene::createCube(const std::string& name, float size) {
         20,21,22,20,22,23       // Left
     };
 
-    auto mesh = StaticMesh::create(m_device, vertices, indices);
+    auto mesh = StaticMesh::create(m_device, vertices, indices, true);
     if (!mesh) return nullptr;
+    mesh->buildBVH();
 
     Node* node = createNode(name);
     node->setMesh(mesh.get());
@@ -240,8 +474,9 @@ Node* Scene::createSphere(const std::string& name, float radius, int segments) {
         }
     }
 
-    auto mesh = StaticMesh::create(m_device, vertices, indices);
+    auto mesh = StaticMesh::create(m_device, vertices, indices, true);
     if (!mesh) return nullptr;
+    mesh->buildBVH();
 
     Node* node = createNode(name);
     node->setMesh(mesh.get());
@@ -264,8 +499,9 @@ Node* Scene::createPlane(const std::string& name, float width, float height) {
     };
     std::vector<uint32_t> indices = { 0, 1, 2, 0, 2, 3 };
 
-    auto mesh = StaticMesh::create(m_device, vertices, indices);
+    auto mesh = StaticMesh::create(m_device, vertices, indices, true);
     if (!mesh) return nullptr;
+    mesh->buildBVH();
 
     Node* node = createNode(name);
     node->setMesh(mesh.get());
@@ -273,10 +509,10 @@ Node* Scene::createPlane(const std::string& name, float width, float height) {
     return node;
 }
 
-Node* Scene::createModel(const std::string& path, const std::string& name) {
+Node* Scene::createModel(const std::string& path, const std::string& name, const ModelLoadOptions& options) {
     if (!m_device) return nullptr;
 
-    auto model = Model::load(m_device, path);
+    auto model = Model::load(m_device, path, options);
     if (!model) return nullptr;
 
     // Extract name from path if not provided
@@ -315,20 +551,4 @@ void Scene::setupDefaultLighting() {
     m_lightManager.setGlobalAmbient(Color(0.2f, 0.2f, 0.25f));
 }
 
-// ============================================================================
-// Node Registry
-// ============================================================================
-
-void Scene::registerNode(Node* node) {
-    if (node) {
-        m_nodesByID[node->getID()] = node;
-    }
-}
-
-void Scene::unregisterNode(Node* node) {
-    if (node) {
-        m_nodesByID.erase(node->getID());
-    }
-}
-
 } // namespace Pina
@@ -10,20 +10,41 @@
 #include "../Graphics/Lighting/PointLight.h"
 #include "../Graphics/Camera.h"
 #include "../Graphics/Primitives/StaticMesh.h"
+#include "../Graphics/Model.h"
 #include "Node.h"
+#include "NodePool.h"
+#include "NodeIterator.h"
+#include "SpatialIndex.h"
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <limits>
 #include <utility>
 
 namespace Pina {
 
 class Input;
 class GraphicsDevice;
-class Model;
+class JobSystem;
+
+/// Nearest triangle found by Scene::raycast()
+struct PINA_API RaycastHit {
+    Node* node = nullptr;               // Node whose mesh or model was hit (nullptr = no hit)
+    StaticMesh* mesh = nullptr;         // Mesh that was hit
+    uint32_t triangle = 0;              // Triangle index in the mesh
+    float distance = 0.0f;              // World-space distance along the ray
+    glm::vec3 point{0.0f};              // World-space hit point
+
+    explicit operator bool() const { return node != nullptr; }
+};
 
 /// Scene container for 3D objects, camera, and lights
-class PINA_API Scene {
+/// Owns every node through a NodePool; nodes are created with createNode()
+/// or Node::addChild() and destroyed with destroyNode() or Node::removeChild().
+/// Node names and tags are indexed, so lookups by either are O(1), and
+/// nodes with a model or mesh are kept in a SpatialIndex for bounds queries.
+/// The nodes' transforms live in the scene's own TransformSystem.
+class PINA_API Scene : public TrackedObject<MemoryTag::Scene> {
 public:
     Scene();
     ~Scene();
@@ -37,8 +58,8 @@ public:
     // ========================================================================
 
     /// Get the root node of the scene
-    Node* getRoot() { return m_root.get(); }
-    const Node* getRoot() const { return m_root.get(); }
+    Node* getRoot() { return m_nodes.get(m_root); }
+    const Node* getRoot() const { return m_nodes.get(m_root); }
 
     // ========================================================================
     // Node Creation
@@ -52,25 +73,59 @@ public:
     /// Create a new node as child of specified parent
     /// @param name Node name
     /// @param parent Parent node (nullptr = root)
-    /// @return Pointer to newly created node
+    /// @return Pointer to newly created node (nullptr if parent is in another scene)
     Node* createNode(const std::string& name, Node* parent);
 
+    /// Destroy a node and its descendants (the root cannot be destroyed)
+    /// Handles to destroyed nodes stop resolving; pointers to them dangle.
+    /// @return true if the node was destroyed
+    bool destroyNode(Node* node);
+
+    /// Destroy a node by handle
+    bool destroyNode(NodeHandle handle) { return destroyNode(getNode(handle)); }
+
     // ========================================================================
     // Node Lookup
     // ========================================================================
 
-    /// Find a node by ID
+    /// Get a node by handle
+    /// @return Node pointer or nullptr if the node was destroyed
+    Node* getNode(NodeHandle handle) const { return m_nodes.get(handle); }
+
+    /// Find a node by ID (O(1), see Node::getID())
     /// @param id Node ID
     /// @return Node pointer or nullptr if not found
-    Node* findNode(uint64_t id) const;
-
-    /// Find a node by name (first match)
+    Node* findNode(uint64_t id) const { return m_nodes.get(NodeHandle::fromID(id)); }
+
+    /// Find a node by name (O(1) through the name index)
+    /// If several nodes share the name, the first one in the index is
+    /// returned. That is the earliest named one until a node with the name is
+    /// destroyed or renamed, after which it is unspecified. Use findNodes()
+    /// to get all of them, or getRoot()->findDescendant() for the hierarchy
+    /// search order (direct children first).
     /// @param name Node name
     /// @return Node pointer or nullptr if not found
     Node* findNode(const std::string& name) const;
 
+    /// Find all nodes with a name (in no particular order)
+    std::vector<Node*> findNodes(const std::string& name) const;
+
+    /// Find a node by a path of names separated by '/'
+    /// "vehicle/wheel_fl" matches a wheel_fl whose parent is a vehicle
+    /// anywhere in the scene; a leading '/' anchors the path at the root's
+    /// children ("/vehicle/wheel_fl"). If several nodes match, the first one
+    /// found in the name index is returned (see findNode()).
+    /// @return Node pointer or nullptr if no node matches
+    Node* findNodeByPath(const std::string& path) const;
+
+    /// Find a node with a tag (one of them if several have it)
+    Node* findNodeWithTag(const Name& tag) const;
+
+    /// Find all nodes with a tag (in no particular order)
+    std::vector<Node*> findNodesWithTag(const Name& tag) const;
+
     /// Get total number of nodes in scene
-    size_t getNodeCount() const { return m_nodesByID.size(); }
+    size_t getNodeCount() const { return m_nodes.getCount(); }
 
     // ========================================================================
     // Traversal
@@ -85,6 +140,46 @@ public:
     /// Traverse only enabled nodes
     void traverseEnabled(const std::function<void(Node*)>& callback);
 
+    /// Visit all nodes in pre-order (see Node::visit())
+    template<typename Visitor>
+    void visit(Visitor&& visitor) { getRoot()->visit(std::forward<Visitor>(visitor)); }
+
+    template<typename Visitor>
+    void visit(Visitor&& visitor) const { getRoot()->visit(std::forward<Visitor>(visitor)); }
+
+    /// Visit only enabled nodes (see Node::visitEnabled())
+    template<typename Visitor>
+    void visitEnabled(Visitor&& visitor) { getRoot()->visitEnabled(std::forward<Visitor>(visitor)); }
+
+    /// Call a function for every node in pool order (no hierarchy order;
+    /// a linear pass over the pool, cheaper than traverse())
+    template<typename F>
+    void forEachNode(F&& callback) const { m_nodes.forEach(std::forward<F>(callback)); }
+
+    /// Get the node pool (read-only; used by NodeIterator)
+    const NodePool& getNodePool() const { return m_nodes; }
+
+    // ========================================================================
+    // Spatial Queries
+    // ========================================================================
+
+    /// Get the index of world bounds of every node with a model or mesh
+    /// (refit by update(); see SpatialIndex for the queries)
+    SpatialIndex& getSpatialIndex() { return m_spatial; }
+    const SpatialIndex& getSpatialIndex() const { return m_spatial; }
+
+    /// Find the nearest mesh triangle a ray hits
+    /// Candidates come from the spatial index (bounds as of the last
+    /// update()); each is tested in its local space through the inverse of
+    /// its world matrix. Only enabled nodes and meshes with CPU geometry are
+    /// hit; meshes with a BVH (see StaticMesh::buildBVH()) are fast to test,
+    /// others are tested triangle by triangle.
+    /// Several threads can raycast at once between update() and the next
+    /// change to the scene; otherwise call it from the scene's thread, as
+    /// stale world matrices are recomputed when read.
+    /// @param maxDistance Ignore hits farther along the ray
+    RaycastHit raycast(const Ray& ray, float maxDistance = std::numeric_limits<float>::max()) const;
+
     // ========================================================================
     // Camera Management
     // ========================================================================
@@ -148,6 +243,8 @@ public:
     // ========================================================================
     // Primitive Helpers
     // ========================================================================
+    // Primitive meshes keep their CPU geometry and a triangle BVH, so they
+    // can act as occluders and be hit by raycast().
 
     /// Create a cube node with a mesh
     /// @param name Node name
@@ -172,8 +269,10 @@ public:
     /// Create a node with a model loaded from file
     /// @param path Path to the model file
     /// @param name Node name (uses filename if empty)
+    /// @param options Load options (set buildBVH for models raycast() should hit)
     /// @return Pointer to the created node, or nullptr on failure
-    Node* createModel(const std::string& path, const std::string& name = "");
+    Node* createModel(const std::string& path, const std::string& name = "",
+                      const ModelLoadOptions& options = {});
 
     /// Setup default lighting (directional + ambient)
     void setupDefaultLighting();
@@ -201,27 +300,63 @@ public:
     // ========================================================================
 
     /// Update the scene (called each frame)
-    /// Updates light manager and other per-frame state
+    /// Updates world transforms, the spatial index, light manager and other
+    /// per-frame state. Call it after moving nodes and before rendering:
+    /// renderers and culling read the world transforms it computed.
     void update(float deltaTime);
 
-    // ========================================================================
-    // Node Registry (Internal)
-    // ========================================================================
+    /// Set the job system large transform updates are split across
+    /// (nullptr = the default job system, see setDefaultJobSystem())
+    void setJobSystem(JobSystem* jobs) { m_jobSystem = jobs; }
+
+    /// Get the job system update() uses (nullptr = serial updates)
+    JobSystem* getJobSystem() const;
 
-    /// Register a node with the scene (called by Node)
-    void registerNode(Node* node);
+    /// Set the job system of every scene without one of its own
+    /// Application::run() sets its JobSystem here for the lifetime of the
+    /// main loop. Set from the main thread only.
+    static void setDefaultJobSystem(JobSystem* jobs);
+    static JobSystem* getDefaultJobSystem();
 
-    /// Unregister a node from the scene (called by Node)
-    void unregisterNode(Node* node);
+    /// Get the system holding every node's transform
+    TransformSystem& getTransformSystem() { return m_transforms; }
+    const TransformSystem& getTransformSystem() const { return m_transforms; }
 
 private:
-    UNIQUE<Node> m_root;
+    friend class Node;
+
+    /// Slots of the nodes carrying each name or tag
+    using NameIndex = std::unordered_map<Name, std::vector<uint32_t>, Name::Hash>;
+
+    // Name and tag index upkeep (called by Node on renames and tag changes)
+    void indexName(Node* node);
+    void unindexName(Node* node);
+    void indexTag(Node* node, size_t entry);
+    void unindexTag(Node* node, size_t entry);
+
+    /// Track a node in the spatial index if it has a model or mesh, else untrack
+    void updateSpatialTracking(Node* node);
+
+    /// Nodes in an index entry as pointers
+    std::vector<Node*> collect(const NameIndex& index, const Name& key) const;
+
+    /// Raycast one mesh of a node in its local space, keeping the nearest hit
+    static void raycastMesh(Node* node, StaticMesh* mesh, const glm::vec3& origin, const glm::vec3& direction,
+                            RaycastHit& hit);
+
+    // Every node of the scene; m_root is the top of the hierarchy. The
+    // transforms are declared first so they outlive the nodes using them.
+    TransformSystem m_transforms;
+    NodePool m_nodes;
+    NodeHandle m_root;
+    SpatialIndex m_spatial;
+    std::vector<Node*> m_destroyScratch;
+    NameIndex m_nodesByName;
+    NameIndex m_nodesByTag;
     Camera* m_activeCamera = nullptr;
     LightManager m_lightManager;
     GraphicsDevice* m_device = nullptr;
-
-    // Node lookup by ID
-    std::unordered_map<uint64_t, Node*> m_nodesByID;
+    JobSystem* m_jobSystem = nullptr;
 
     // Camera storage (named cameras owned by scene)
     std::unordered_map<std::string, UNIQUE<Camera>> m_cameras;
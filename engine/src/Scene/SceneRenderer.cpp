@@ -1,16 +1,51 @@
 #include "SceneRenderer.h"
 #include "Scene.h"
 #include "Node.h"
+#include "NodeIterator.h"
+#include "OcclusionCuller.h"
 #include "../Graphics/GraphicsDevice.h"
 #include "../Graphics/Shader.h"
 #include "../Graphics/Camera.h"
 #include "../Graphics/Model.h"
+#include "../Graphics/Primitives/StaticMesh.h"
 #include "../Graphics/Lighting/LightManager.h"
+#include "../Math/Frustum.h"
+#include "../Math/SimdMath.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
+#include <algorithm>
 
 namespace Pina {
 
+namespace {
+
+/// Draw list entries per gather job
+constexpr size_t GatherGrain = 256;
+
+/// Call fn(mesh, material) for each of a node's draws in the selected buckets
+template<typename Fn>
+void forEachDraw(Node* node, bool opaque, bool transparent, Fn&& fn) {
+    if (Model* model = node->getModel()) {
+        for (size_t i = 0; i < model->getMeshCount(); ++i) {
+            const Material* material = model->getMeshMaterial(i);
+            if (material && material->isTransparent() ? transparent : opaque) {
+                fn(model->getMesh(i), material);
+            }
+        }
+    }
+    if (StaticMesh* mesh = node->getMesh()) {
+        const Material& material = node->getMaterial();
+        if (material.isTransparent() ? transparent : opaque) {
+            fn(mesh, &material);
+        }
+    }
+}
+
+} // namespace
+
 SceneRenderer::SceneRenderer(GraphicsDevice* device)
     : m_device(device)
+    , m_occlusionCuller(MAKE_UNIQUE<OcclusionCuller>())
 {
 }
 
@@ -19,48 +54,71 @@ SceneRenderer::~SceneRenderer() = default;
 void SceneRenderer::render(Scene* scene, Shader* shader) {
     if (!scene || !shader) return;
 
-    // Reset statistics
-    m_renderedNodeCount = 0;
-    m_drawCallCount = 0;
+    PINA_PROFILE_SCOPE("SceneRenderer::render");
+
+    resetStatistics();
 
     Camera* camera = scene->getActiveCamera();
     if (!camera) return;
 
-    // Upload camera matrices
-    shader->bind();
-    shader->setMat4("uView", camera->getViewMatrix());
-    shader->setMat4("uProjection", camera->getProjectionMatrix());
-    shader->setVec3("uViewPosition", camera->getPosition());
-
-    // Upload lights
+    // Upload camera matrices and lights (the shader passed in is left bound)
     LightManager& lightManager = scene->getLightManager();
-    lightManager.uploadToShader(shader);
+    if (m_instancedShader) {
+        setupShader(m_instancedShader, camera, &lightManager);
+    }
+    setupShader(shader, camera, &lightManager);
 
     // Render the scene starting from root
-    renderNodeRecursive(scene->getRoot(), shader, camera, &lightManager);
+    renderSubtree(scene->getRoot(), shader, &lightManager, RenderPass::All, camera);
 }
 
-void SceneRenderer::renderOpaque(Scene* scene, Shader* shader) {
+void SceneRenderer::renderOpaque(Scene* scene, Shader* shader, const Camera* camera) {
     if (!scene || !shader) return;
 
+    PINA_PROFILE_SCOPE("SceneRenderer::renderOpaque");
+
+    resetStatistics();
+
     LightManager& lightManager = scene->getLightManager();
-    renderNodeRecursivePass(scene->getRoot(), shader, &lightManager, RenderPass::OpaqueOnly);
+    renderSubtree(scene->getRoot(), shader, &lightManager, RenderPass::OpaqueOnly,
+                  camera ? camera : scene->getActiveCamera());
 }
 
-void SceneRenderer::renderTransparent(Scene* scene, Shader* shader) {
+void SceneRenderer::renderTransparent(Scene* scene, Shader* shader, const Camera* camera) {
     if (!scene || !shader) return;
 
+    PINA_PROFILE_SCOPE("SceneRenderer::renderTransparent");
+
     LightManager& lightManager = scene->getLightManager();
-    renderNodeRecursivePass(scene->getRoot(), shader, &lightManager, RenderPass::TransparentOnly);
+    renderSubtree(scene->getRoot(), shader, &lightManager, RenderPass::TransparentOnly,
+                  camera ? camera : scene->getActiveCamera());
 }
 
 void SceneRenderer::renderNode(Node* node, Shader* shader, Camera* camera, LightManager* lightManager) {
     if (!node || !shader || !camera) return;
 
-    // Reset statistics
+    resetStatistics();
+
+    if (m_instancedShader) {
+        setupShader(m_instancedShader, camera, lightManager);
+    }
+    setupShader(shader, camera, lightManager);
+
+    renderSubtree(node, shader, lightManager, RenderPass::All, camera);
+}
+
+void SceneRenderer::resetStatistics() {
     m_renderedNodeCount = 0;
     m_drawCallCount = 0;
+    m_visibleNodeCount = 0;
+    m_culledNodeCount = 0;
+    m_occludedNodeCount = 0;
+    m_occluderCount = 0;
+    m_queueStats = RenderQueueStats();
+    m_transparentDraws.clear();
+}
 
+void SceneRenderer::setupShader(Shader* shader, const Camera* camera, LightManager* lightManager) {
     // Upload camera matrices
     shader->bind();
     shader->setMat4("uView", camera->getViewMatrix());
@@ -71,81 +129,210 @@ void SceneRenderer::renderNode(Node* node, Shader* shader, Camera* camera, Light
     if (lightManager) {
         lightManager->uploadToShader(shader);
     }
+}
 
-    renderNodeRecursive(node, shader, camera, lightManager);
+void SceneRenderer::setJobSystem(JobSystem* jobs) {
+    m_jobs = jobs;
+    m_occlusionCuller->setJobSystem(jobs);
 }
 
-void SceneRenderer::renderNodeRecursive(Node* node, Shader* shader, Camera* camera, LightManager* lightManager) {
-    if (!node) return;
+void SceneRenderer::renderSubtree(Node* root, Shader* shader, LightManager* lightManager, RenderPass pass,
+                                  const Camera* camera) {
+    // Scene::update() normally left every world transform current; anything
+    // moved since is caught up here in one batched pass (a no-op otherwise),
+    // so everything below reads the cached values and never recomputes
+    root->getTransform().getSystem().update();
+
+    const bool culling = m_frustumCulling && camera;
+    SimdMath::FrustumPlanes planes;
+    if (culling) {
+        planes = SimdMath::preparePlanes(Frustum(camera->getViewProjectionMatrix()));
+    }
 
-    // Skip disabled nodes unless rendering disabled is enabled
-    if (!m_renderDisabled && !node->isEnabled()) return;
+    // The transparent pass repeats the opaque pass's visibility tests
+    const bool countVisibility = pass != RenderPass::TransparentOnly;
 
-    m_renderedNodeCount++;
+    // Gather drawable nodes inside the view
+    m_drawList.clear();
+    for (NodeIterator it(root, !m_renderDisabled); it; ++it) {
+        Node* node = *it;
+        m_renderedNodeCount++;
 
-    // Render this node's model if it has one
-    if (node->hasModel()) {
-        Model* model = node->getModel();
+        if (!node->hasModel() && !node->hasMesh()) continue;
 
-        // Get world transform
-        const glm::mat4& worldMatrix = node->getTransform().getWorldMatrix();
-        glm::mat3 normalMatrix = node->getTransform().getNormalMatrix();
+        const BoundingBox& bounds = node->getTransform().getCachedWorldBounds();
 
-        // Upload model matrix
-        shader->setMat4("uModel", worldMatrix);
-        shader->setMat3("uNormalMatrix", normalMatrix);
+        // Skip nodes outside the view (nodes without bounds are always drawn)
+        if (culling && bounds.isValid() && !SimdMath::intersects(planes, bounds)) {
+            if (countVisibility) m_culledNodeCount++;
+            continue;
+        }
+        m_drawList.push_back(node);
+    }
 
-        // Draw the model
-        model->draw(shader, lightManager);
-        m_drawCallCount += model->getMeshCount();
+    // Hide nodes behind the occluders before anything is submitted
+    const bool occlusion = m_occlusionCulling && camera;
+    if (occlusion) {
+        cullOccluded(camera, pass != RenderPass::TransparentOnly, countVisibility);
     }
 
-    // Recursively render children
-    for (size_t i = 0; i < node->getChildCount(); ++i) {
-        renderNodeRecursive(node->getChild(i), shader, camera, lightManager);
+    gatherItems(pass, camera, occlusion, countVisibility);
+    m_queue.sort();
+
+    // Record the blend order (transparent keys sort after every opaque one)
+    if (pass != RenderPass::OpaqueOnly) {
+        for (uint32_t index : m_queue.getOrder()) {
+            const RenderItem& item = m_queue.getItem(index);
+            if (RenderQueue::getBucket(item.key) != RenderBucket::Transparent) continue;
+            m_transparentDraws.push_back({m_drawList[item.transform], item.mesh, item.depth});
+        }
     }
+
+    RenderQueueStats stats;
+    m_queue.submit(shader, lightManager, stats, m_instancedShader);
+    m_drawCallCount += stats.drawCalls;
+    m_queueStats += stats;
 }
 
-void SceneRenderer::renderNodeRecursivePass(Node* node, Shader* shader, LightManager* lightManager, RenderPass pass) {
-    if (!node) return;
+void SceneRenderer::gatherItems(RenderPass pass, const Camera* camera, bool occlusion, bool countVisibility) {
+    PINA_PROFILE_SCOPE("SceneRenderer::gatherItems");
+
+    const bool opaque = pass != RenderPass::TransparentOnly;
+    const bool transparent = pass != RenderPass::OpaqueOnly;
+
+    // Count each node's draws so the jobs can write them in place
+    const size_t count = m_drawList.size();
+    m_itemOffsets.resize(count + 1);
+    uint32_t itemCount = 0;
+    for (size_t i = 0; i < count; ++i) {
+        m_itemOffsets[i] = itemCount;
+        if (occlusion && !m_occlusionVisible[i]) continue;
+        if (countVisibility) m_visibleNodeCount++;
+        forEachDraw(m_drawList[i], opaque, transparent,
+                    [&itemCount](StaticMesh*, const Material*) { itemCount++; });
+    }
+    m_itemOffsets[count] = itemCount;
+
+    // One transform per draw list entry, shared by the node's items
+    m_queue.resize(count, itemCount);
+
+    // Depth along the view direction is the negated view-space z (the view matrix's third row)
+    const glm::mat4 view = camera ? camera->getViewMatrix() : glm::mat4(1.0f);
+    const glm::vec4 depthRow(-view[0][2], -view[1][2], -view[2][2], -view[3][2]);
+    const float nearPlane = camera ? camera->getNearPlane() : 0.0f;
+    const float farPlane = camera ? camera->getFarPlane() : 1.0f;
+    const bool nodeGrouping = m_transparentNodeGrouping;
+
+    auto gather = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            uint32_t item = m_itemOffsets[i];
+            if (item == m_itemOffsets[i + 1]) continue;
+
+            const Node* node = m_drawList[i];
+            const Transform& transform = node->getTransform();
+            const glm::mat4& world = transform.getCachedWorldMatrix();
+            m_queue.setTransform(static_cast<uint32_t>(i), world, transform.getCachedNormalMatrix(),
+                                 node->getTint());
+
+            // Depth row carried back through the world matrix: local point -> view depth
+            glm::vec4 localRow;
+            for (int column = 0; column < 4; ++column) {
+                localRow[column] = glm::dot(depthRow, world[column]);
+            }
+
+            // Node grouping sorts transparent meshes by the node's bounds center
+            const BoundingBox& bounds = transform.getCachedWorldBounds();
+            glm::vec4 nodeCenter = bounds.isValid() ? glm::vec4(bounds.getCenter(), 1.0f) : world[3];
+            float nodeDepth = glm::dot(depthRow, nodeCenter);
+
+            forEachDraw(m_drawList[i], opaque, transparent, [&](StaticMesh* mesh, const Material* material) {
+                RenderBucket bucket = material && material->isTransparent() ? RenderBucket::Transparent
+                                                                            : RenderBucket::Opaque;
+                float depth = nodeDepth;
+                if (!nodeGrouping || bucket == RenderBucket::Opaque) {
+                    const BoundingBox& meshBounds = mesh->getBoundingBox();
+                    glm::vec3 centroid = meshBounds.isValid() ? meshBounds.getCenter() : glm::vec3(0.0f);
+                    depth = glm::dot(localRow, glm::vec4(centroid, 1.0f));
+                }
+
+                RenderItem& entry = m_queue.getItem(item++);
+                entry.key = RenderQueue::makeKey(bucket, material, mesh,
+                                                 RenderQueue::quantizeDepth(depth, nearPlane, farPlane));
+                entry.mesh = mesh;
+                entry.material = material;
+                entry.transform = static_cast<uint32_t>(i);
+                entry.depth = depth;
+            });
+        }
+    };
+    if (m_jobs && count > GatherGrain) {
+        m_jobs->parallelFor(0, count, GatherGrain, gather);
+    } else {
+        gather(0, count);
+    }
+}
 
-    // Skip disabled nodes unless rendering disabled is enabled
-    if (!m_renderDisabled && !node->isEnabled()) return;
+bool SceneRenderer::isOccluderCandidate(Node* node, float& area) const {
+    if (!node->hasMesh() || !node->getMesh()->hasCpuGeometry()) return false;
+    if (node->getMaterial().isTransparent()) return false;
 
-    m_renderedNodeCount++;
+    area = m_occlusionCuller->getScreenArea(node->getTransform().getCachedWorldBounds());
+    if (node->isOccluder()) return true;
 
-    // Render this node's model if it has one
-    if (node->hasModel()) {
-        Model* model = node->getModel();
+    float autoArea = m_occlusionCuller->getConfig().autoOccluderArea;
+    return autoArea > 0.0f && area >= autoArea;
+}
 
-        // Get world transform
-        const glm::mat4& worldMatrix = node->getTransform().getWorldMatrix();
-        glm::mat3 normalMatrix = node->getTransform().getNormalMatrix();
+void SceneRenderer::cullOccluded(const Camera* camera, bool rasterize, bool countVisibility) {
+    PINA_PROFILE_SCOPE("SceneRenderer::cullOccluded");
 
-        // Upload model matrix
-        shader->setMat4("uModel", worldMatrix);
-        shader->setMat3("uNormalMatrix", normalMatrix);
+    const size_t count = m_drawList.size();
+    m_occluderFlags.assign(count, 0);
 
-        // Draw based on pass type
-        switch (pass) {
-            case RenderPass::All:
-                model->draw(shader, lightManager);
-                m_drawCallCount += model->getMeshCount();
-                break;
-            case RenderPass::OpaqueOnly:
-                model->drawOpaque(shader, lightManager);
-                m_drawCallCount += model->getMeshCount();  // Approximate
-                break;
-            case RenderPass::TransparentOnly:
-                model->drawTransparent(shader, lightManager);
-                m_drawCallCount += model->getMeshCount();  // Approximate
+    if (rasterize) {
+        m_occlusionCuller->beginFrame(camera->getViewProjectionMatrix());
+
+        // Largest on screen first, so the triangle budget goes to the best occluders
+        m_occluderCandidates.clear();
+        for (size_t i = 0; i < count; ++i) {
+            float area = 0.0f;
+            if (isOccluderCandidate(m_drawList[i], area)) {
+                m_occluderCandidates.emplace_back(area, static_cast<uint32_t>(i));
+            }
+        }
+        std::sort(m_occluderCandidates.begin(), m_occluderCandidates.end(),
+                  [](const std::pair<float, uint32_t>& a, const std::pair<float, uint32_t>& b) {
+                      return a.first > b.first;
+                  });
+
+        m_occluderCount = 0;
+        for (const auto& candidate : m_occluderCandidates) {
+            Node* node = m_drawList[candidate.second];
+            const StaticMesh* mesh = node->getMesh();
+            if (!m_occlusionCuller->addOccluder(node->getTransform().getCachedWorldMatrix(),
+                                                mesh->getPositions().data(), mesh->getPositions().size(),
+                                                mesh->getIndices().data(), mesh->getIndices().size())) {
                 break;
+            }
+            m_occluderFlags[candidate.second] = 1;
+            m_occluderCount++;
         }
+        m_occlusionCuller->rasterize();
     }
 
-    // Recursively render children
-    for (size_t i = 0; i < node->getChildCount(); ++i) {
-        renderNodeRecursivePass(node->getChild(i), shader, lightManager, pass);
+    m_occlusionBoxes.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_occlusionBoxes[i] = m_drawList[i]->getTransform().getCachedWorldBounds();
+    }
+    m_occlusionVisible.resize(count);
+    m_occlusionCuller->testBoxes(m_occlusionBoxes.data(), m_occlusionVisible.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        // An occluder's own depth can round in front of its bounds
+        m_occlusionVisible[i] |= m_occluderFlags[i];
+        if (countVisibility && !m_occlusionVisible[i]) {
+            m_occludedNodeCount++;
+        }
     }
 }
 
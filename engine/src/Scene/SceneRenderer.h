@@ -5,7 +5,12 @@
 
 #include "../Core/Export.h"
 #include "../Core/Memory.h"
+#include "../Math/BoundingBox.h"
+#include "../Graphics/RenderQueue.h"
 #include <glm/glm.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace Pina {
 
@@ -15,8 +20,48 @@ class Shader;
 class Camera;
 class GraphicsDevice;
 class LightManager;
+class JobSystem;
+class OcclusionCuller;
+class StaticMesh;
+
+/// A transparent draw, as submitted
+struct PINA_API TransparentDraw {
+    const Node* node = nullptr;
+    const StaticMesh* mesh = nullptr;
+    float depth = 0.0f;     // View depth the draw was sorted by
+};
 
-/// Renders a scene by traversing nodes and drawing attached models
+/// Renders a scene by traversing nodes and drawing attached models and meshes
+///
+/// Each render call gathers one RenderItem per model mesh and node mesh
+/// into a RenderQueue (on the job system if set), sorts them by state and
+/// depth, and submits them, so matrices and materials are only uploaded
+/// when they change. Opaque draws are grouped by shading model, material
+/// and mesh, then ordered front to back.
+///
+/// Transparent draws are ordered back to front by the view depth of each
+/// mesh's world-space centroid, so the meshes of one model interleave with
+/// other nodes as needed. With node grouping, a node's transparent meshes
+/// are drawn together in model order at the depth of the node's bounds
+/// instead. Draws at equal quantized depth keep hierarchy order.
+///
+/// With an instanced shader set, runs of draws sharing a mesh and material
+/// (such as many nodes pointing at one StaticMesh) are submitted as one
+/// instanced draw each (see RenderQueue::submit()).
+///
+/// Nodes whose world bounds lie outside the camera's view frustum are
+/// skipped (nodes without bounds are always drawn).
+///
+/// World transforms are read as Scene::update() left them; each render call
+/// first runs TransformSystem::update() to catch up nodes moved since, which
+/// costs nothing when none were.
+///
+/// With occlusion culling enabled, the opaque meshes of designated occluder
+/// nodes (and of meshes covering at least OcclusionCullerConfig::
+/// autoOccluderArea of the screen) are rasterized on the CPU each frame,
+/// and nodes hidden behind them are skipped. Occluder meshes need CPU
+/// geometry (see StaticMesh::create()). renderTransparent() reuses the
+/// depth from the preceding renderOpaque().
 class PINA_API SceneRenderer {
 public:
     explicit SceneRenderer(GraphicsDevice* device);
@@ -31,15 +76,18 @@ public:
     /// @param shader Shader to use for rendering
     void render(Scene* scene, Shader* shader);
 
-    /// Render only opaque objects in the scene
+    /// Render only opaque objects in the scene (starts a frame's statistics)
     /// @param scene Scene to render
     /// @param shader Shader to use for rendering
-    void renderOpaque(Scene* scene, Shader* shader);
+    /// @param camera Camera to cull against (nullptr = scene's active camera)
+    void renderOpaque(Scene* scene, Shader* shader, const Camera* camera = nullptr);
 
-    /// Render only transparent objects in the scene
+    /// Render only transparent objects in the scene (adds to the statistics
+    /// of the preceding renderOpaque())
     /// @param scene Scene to render
     /// @param shader Shader to use for rendering
-    void renderTransparent(Scene* scene, Shader* shader);
+    /// @param camera Camera to cull against (nullptr = scene's active camera)
+    void renderTransparent(Scene* scene, Shader* shader, const Camera* camera = nullptr);
 
     /// Render a single node and its descendants
     /// @param node Node to render
@@ -60,6 +108,33 @@ public:
     void setWireframe(bool wireframe) { m_wireframe = wireframe; }
     bool getWireframe() const { return m_wireframe; }
 
+    /// Enable/disable view-frustum culling (enabled by default)
+    void setFrustumCulling(bool culling) { m_frustumCulling = culling; }
+    bool getFrustumCulling() const { return m_frustumCulling; }
+
+    /// Sort transparent draws per node instead of per mesh (disabled by default)
+    void setTransparentNodeGrouping(bool grouping) { m_transparentNodeGrouping = grouping; }
+    bool getTransparentNodeGrouping() const { return m_transparentNodeGrouping; }
+
+    /// Set the shader for instanced draws: the instanced variant of the
+    /// shader passed to the render calls (nullptr = no instancing, the
+    /// default). render() and renderNode() upload the camera and lights to
+    /// both; renderOpaque()/renderTransparent() callers set up both.
+    void setInstancedShader(Shader* shader) { m_instancedShader = shader; }
+    Shader* getInstancedShader() const { return m_instancedShader; }
+
+    /// Enable/disable CPU occlusion culling (disabled by default)
+    void setOcclusionCulling(bool culling) { m_occlusionCulling = culling; }
+    bool getOcclusionCulling() const { return m_occlusionCulling; }
+
+    /// Run the gather phase and occlusion culling on a job system
+    /// (nullptr = calling thread only)
+    void setJobSystem(JobSystem* jobs);
+
+    /// Get the occlusion culler (for its configuration and depth buffer)
+    OcclusionCuller& getOcclusionCuller() { return *m_occlusionCuller; }
+    const OcclusionCuller& getOcclusionCuller() const { return *m_occlusionCuller; }
+
     // ========================================================================
     // Statistics
     // ========================================================================
@@ -67,23 +142,86 @@ public:
     /// Get number of nodes rendered in last frame
     size_t getRenderedNodeCount() const { return m_renderedNodeCount; }
 
-    /// Get number of draw calls in last frame
+    /// Get number of draw calls in last frame (an instanced draw counts once)
     size_t getDrawCallCount() const { return m_drawCallCount; }
 
+    /// Get number of nodes with a model or mesh that passed culling in the
+    /// last frame (counted once per frame, not per opaque/transparent pass)
+    size_t getVisibleNodeCount() const { return m_visibleNodeCount; }
+
+    /// Get number of nodes with a model or mesh culled in the last frame
+    size_t getCulledNodeCount() const { return m_culledNodeCount; }
+
+    /// Get number of nodes inside the frustum but hidden by occluders in
+    /// the last frame
+    size_t getOccludedNodeCount() const { return m_occludedNodeCount; }
+
+    /// Get number of occluder meshes rasterized in the last frame
+    size_t getOccluderCount() const { return m_occluderCount; }
+
+    /// Get the draws and state changes submitted in the last frame
+    const RenderQueueStats& getQueueStats() const { return m_queueStats; }
+
+    /// Get the transparent draws of the last frame, back to front as submitted
+    const std::vector<TransparentDraw>& getTransparentDraws() const { return m_transparentDraws; }
+
+    /// Get the queue of the last render call (items and their sorted order)
+    const RenderQueue& getRenderQueue() const { return m_queue; }
+
 private:
     enum class RenderPass { All, OpaqueOnly, TransparentOnly };
 
-    void renderNodeRecursive(Node* node, Shader* shader, Camera* camera, LightManager* lightManager);
-    void renderNodeRecursivePass(Node* node, Shader* shader, LightManager* lightManager, RenderPass pass);
+    /// Clear the per-frame statistics
+    void resetStatistics();
+
+    /// Bind a shader and upload the camera and lights
+    void setupShader(Shader* shader, const Camera* camera, LightManager* lightManager);
+
+    /// Draw root and its descendants in pre-order (iterative, any depth)
+    /// @param camera Camera to cull against (nullptr = no culling)
+    void renderSubtree(Node* root, Shader* shader, LightManager* lightManager, RenderPass pass,
+                       const Camera* camera);
+
+    /// Check if a node can occlude, and get its screen area
+    bool isOccluderCandidate(Node* node, float& area) const;
+
+    /// Fill m_occlusionVisible for m_drawList
+    /// @param rasterize Rebuild the depth buffer (false = reuse the last one)
+    void cullOccluded(const Camera* camera, bool rasterize, bool countVisibility);
+
+    /// Fill m_queue with the pass's draws of the visible m_drawList entries
+    void gatherItems(RenderPass pass, const Camera* camera, bool occlusion, bool countVisibility);
 
     GraphicsDevice* m_device;
+    JobSystem* m_jobs = nullptr;
+    Shader* m_instancedShader = nullptr;
 
     bool m_renderDisabled = false;
     bool m_wireframe = false;
+    bool m_frustumCulling = true;
+    bool m_occlusionCulling = false;
+    bool m_transparentNodeGrouping = false;
+
+    UNIQUE<OcclusionCuller> m_occlusionCuller;
+    RenderQueue m_queue;
+
+    // Per-frame scratch
+    std::vector<Node*> m_drawList;                  // Nodes inside the frustum
+    std::vector<BoundingBox> m_occlusionBoxes;      // World bounds per m_drawList entry
+    std::vector<uint8_t> m_occlusionVisible;        // Per m_drawList entry
+    std::vector<uint8_t> m_occluderFlags;           // Per m_drawList entry
+    std::vector<std::pair<float, uint32_t>> m_occluderCandidates;   // (screen area, draw list index)
+    std::vector<uint32_t> m_itemOffsets;            // First queue item per m_drawList entry (+ end)
 
     // Per-frame statistics
     size_t m_renderedNodeCount = 0;
     size_t m_drawCallCount = 0;
+    size_t m_visibleNodeCount = 0;
+    size_t m_culledNodeCount = 0;
+    size_t m_occludedNodeCount = 0;
+    size_t m_occluderCount = 0;
+    RenderQueueStats m_queueStats;
+    std::vector<TransparentDraw> m_transparentDraws;
 };
 
 } // namespace Pina
@@ -0,0 +1,190 @@
+#include "SpatialIndex.h"
+#include "Node.h"
+#include "NodePool.h"
+#include <algorithm>
+
+namespace Pina {
+
+SpatialIndex::SpatialIndex(const NodePool& nodes, TransformSystem& transforms, float margin)
+    : m_nodes(nodes)
+    , m_transforms(transforms)
+    , m_tree(margin)
+{
+}
+
+// ============================================================================
+// Tracking
+// ============================================================================
+
+void SpatialIndex::track(Node* node) {
+    uint32_t slot = node->getHandle().index;
+    if (slot >= m_entries.size()) {
+        m_entries.resize(slot + 1);
+        m_bounds.resize(slot + 1);
+    }
+
+    Entry& entry = m_entries[slot];
+    if (entry.position != NotTracked) return;
+
+    TransformSystem::ID transform = node->getTransform().getID();
+    entry.position = static_cast<uint32_t>(m_tracked.size());
+    entry.version = m_transforms.getWorldVersion(transform);
+    m_tracked.push_back({slot, transform});
+
+    refit(slot, m_transforms.getWorldBounds(transform));
+}
+
+void SpatialIndex::untrack(Node* node) {
+    uint32_t slot = node->getHandle().index;
+    if (slot >= m_entries.size() || m_entries[slot].position == NotTracked) return;
+
+    Entry& entry = m_entries[slot];
+    if (entry.proxy != DynamicAABBTree::NullProxy) {
+        m_tree.destroyProxy(entry.proxy);
+    }
+
+    // Swap-remove from the dense list
+    Tracked last = m_tracked.back();
+    m_tracked[entry.position] = last;
+    m_entries[last.slot].position = entry.position;
+    m_tracked.pop_back();
+
+    entry = Entry();
+    m_bounds[slot] = BoundingBox();
+}
+
+bool SpatialIndex::isTracked(const Node* node) const {
+    uint32_t slot = node->getHandle().index;
+    return slot < m_entries.size() && m_entries[slot].position != NotTracked;
+}
+
+void SpatialIndex::update() {
+    m_lastRefitCount = 0;
+
+    for (const Tracked& tracked : m_tracked) {
+        uint32_t version = m_transforms.getWorldVersion(tracked.transform);
+        Entry& entry = m_entries[tracked.slot];
+        if (version == entry.version) continue;
+
+        entry.version = version;
+        refit(tracked.slot, m_transforms.getWorldBounds(tracked.transform));
+        m_lastRefitCount++;
+    }
+}
+
+void SpatialIndex::refit(uint32_t slot, const BoundingBox& bounds) {
+    Entry& entry = m_entries[slot];
+    m_bounds[slot] = bounds;
+
+    if (!bounds.isValid()) {
+        if (entry.proxy != DynamicAABBTree::NullProxy) {
+            m_tree.destroyProxy(entry.proxy);
+            entry.proxy = DynamicAABBTree::NullProxy;
+        }
+        return;
+    }
+
+    if (entry.proxy == DynamicAABBTree::NullProxy) {
+        entry.proxy = m_tree.createProxy(bounds, slot);
+    } else {
+        m_tree.moveProxy(entry.proxy, bounds);
+    }
+}
+
+Node* SpatialIndex::nodeAt(DynamicAABBTree::ProxyID proxy) const {
+    return m_nodes.slot(m_tree.getUserData(proxy));
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+void SpatialIndex::queryBox(const BoundingBox& box, std::vector<Node*>& out) const {
+    out.clear();
+    m_tree.query(box, [&](DynamicAABBTree::ProxyID proxy) {
+        if (m_bounds[m_tree.getUserData(proxy)].intersects(box)) {
+            out.push_back(nodeAt(proxy));
+        }
+        return true;
+    });
+}
+
+void SpatialIndex::queryFrustum(const Frustum& frustum, std::vector<Node*>& out) const {
+    out.clear();
+    m_tree.query(frustum, [&](DynamicAABBTree::ProxyID proxy) {
+        if (frustum.intersects(m_bounds[m_tree.getUserData(proxy)])) {
+            out.push_back(nodeAt(proxy));
+        }
+        return true;
+    });
+}
+
+void SpatialIndex::querySphere(const glm::vec3& center, float radius, std::vector<Node*>& out) const {
+    out.clear();
+    float radiusSquared = radius * radius;
+    m_tree.querySphere(center, radius, [&](DynamicAABBTree::ProxyID proxy) {
+        if (m_bounds[m_tree.getUserData(proxy)].distanceSquared(center) <= radiusSquared) {
+            out.push_back(nodeAt(proxy));
+        }
+        return true;
+    });
+}
+
+void SpatialIndex::queryRay(const Ray& ray, float maxDistance,
+                            std::vector<std::pair<float, Node*>>& out) const {
+    out.clear();
+    glm::vec3 origin = ray.origin;
+    glm::vec3 direction = ray.direction;
+    glm::vec3 invDirection = glm::vec3(1.0f) / direction;
+
+    m_tree.raycast(origin, direction, maxDistance, [&](DynamicAABBTree::ProxyID proxy, float) {
+        float entry;
+        if (m_bounds[m_tree.getUserData(proxy)].intersectsRay(origin, invDirection, maxDistance, entry)) {
+            out.push_back({entry, nodeAt(proxy)});
+        }
+        return maxDistance;
+    });
+
+    std::sort(out.begin(), out.end(), [](const std::pair<float, Node*>& a, const std::pair<float, Node*>& b) {
+        return a.first < b.first;
+    });
+}
+
+Node* SpatialIndex::raycastBounds(const Ray& ray, float maxDistance, float* distance) const {
+    glm::vec3 origin = ray.origin;
+    glm::vec3 direction = ray.direction;
+    glm::vec3 invDirection = glm::vec3(1.0f) / direction;
+
+    // Clip the ray at each hit so farther subtrees are skipped
+    Node* closest = nullptr;
+    float closestDistance = maxDistance;
+    m_tree.raycast(origin, direction, maxDistance, [&](DynamicAABBTree::ProxyID proxy, float) {
+        float entry;
+        if (m_bounds[m_tree.getUserData(proxy)].intersectsRay(origin, invDirection, closestDistance, entry)) {
+            if (!closest || entry < closestDistance) {
+                closest = nodeAt(proxy);
+                closestDistance = entry;
+            }
+        }
+        return closestDistance;
+    });
+
+    if (closest && distance) {
+        *distance = closestDistance;
+    }
+    return closest;
+}
+
+void SpatialIndex::findNearest(const glm::vec3& point, size_t k, std::vector<Node*>& out) const {
+    out.clear();
+    std::vector<std::pair<float, DynamicAABBTree::ProxyID>> hits;
+    m_tree.findNearest(point, k, [&](DynamicAABBTree::ProxyID proxy) {
+        return m_bounds[m_tree.getUserData(proxy)].distanceSquared(point);
+    }, hits);
+
+    for (const auto& hit : hits) {
+        out.push_back(nodeAt(hit.second));
+    }
+}
+
+} // namespace Pina
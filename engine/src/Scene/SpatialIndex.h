@@ -0,0 +1,127 @@
+#pragma once
+
+/// Pina Engine - Spatial Index
+/// Bounding volume hierarchy over the world bounds of a scene's renderable nodes
+
+#include "../Core/Export.h"
+#include "../Math/BoundingBox.h"
+#include "../Math/DynamicAABBTree.h"
+#include "../Math/Frustum.h"
+#include "../Math/Ray.h"
+#include "TransformSystem.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace Pina {
+
+class Node;
+class NodePool;
+
+/// Tracks the world bounds of nodes in a DynamicAABBTree
+///
+/// Scene tracks every node with a Model or StaticMesh. update() compares
+/// each tracked transform's world version with the one last seen and only
+/// refits nodes that moved (or whose local bounds changed); most refits stay
+/// inside the fat bounds and leave the tree untouched. Nodes without valid
+/// world bounds (e.g. a mesh whose bounds were never set) are tracked but
+/// stay out of the tree until they get some.
+///
+/// Queries test the exact world bounds as of the last update(), so results
+/// match a brute-force pass over the same bounds. Enabled state is not
+/// considered.
+class PINA_API SpatialIndex {
+public:
+    /// @param nodes Pool the tracked nodes live in
+    /// @param transforms System holding the tracked nodes' transforms
+    /// @param margin Fat bounds margin (see DynamicAABBTree)
+    SpatialIndex(const NodePool& nodes, TransformSystem& transforms, float margin = 0.1f);
+
+    SpatialIndex(const SpatialIndex&) = delete;
+    SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+    // ========================================================================
+    // Tracking
+    // ========================================================================
+
+    /// Start tracking a node (inserted with its current world bounds)
+    void track(Node* node);
+
+    /// Stop tracking a node
+    void untrack(Node* node);
+
+    /// Check if a node is tracked
+    bool isTracked(const Node* node) const;
+
+    /// Refit every tracked node whose world transform changed
+    void update();
+
+    /// Number of tracked nodes
+    size_t getTrackedCount() const { return m_tracked.size(); }
+
+    /// Number of nodes refit by the last update()
+    size_t getLastRefitCount() const { return m_lastRefitCount; }
+
+    /// Get the underlying tree (proxy user data is the node's pool slot)
+    const DynamicAABBTree& getTree() const { return m_tree; }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+    // Each query clears its output first; results are in no particular
+    // order unless noted.
+
+    /// Nodes whose world bounds overlap a box
+    void queryBox(const BoundingBox& box, std::vector<Node*>& out) const;
+
+    /// Nodes whose world bounds are at least partly inside a frustum
+    void queryFrustum(const Frustum& frustum, std::vector<Node*>& out) const;
+
+    /// Nodes whose world bounds overlap a sphere
+    void querySphere(const glm::vec3& center, float radius, std::vector<Node*>& out) const;
+
+    /// Nodes whose world bounds a ray enters within maxDistance
+    /// @param out Receives (entry distance, node) pairs, nearest first
+    void queryRay(const Ray& ray, float maxDistance, std::vector<std::pair<float, Node*>>& out) const;
+
+    /// Node whose world bounds a ray enters first
+    /// @param distance Receives the entry distance if not nullptr
+    /// @return nullptr if nothing is hit within maxDistance
+    Node* raycastBounds(const Ray& ray, float maxDistance, float* distance = nullptr) const;
+
+    /// The k nodes whose world bounds are nearest to a point
+    /// @param out Receives the nodes, nearest first
+    void findNearest(const glm::vec3& point, size_t k, std::vector<Node*>& out) const;
+
+private:
+    static constexpr uint32_t NotTracked = UINT32_MAX;
+
+    /// Per pool slot
+    struct Entry {
+        DynamicAABBTree::ProxyID proxy = DynamicAABBTree::NullProxy;
+        uint32_t version = 0;               // World version last refit to
+        uint32_t position = NotTracked;     // Index in m_tracked
+    };
+
+    /// Dense list entry, so update() never touches the nodes
+    struct Tracked {
+        uint32_t slot;
+        TransformSystem::ID transform;
+    };
+
+    /// Store new world bounds and move, insert or remove the proxy
+    void refit(uint32_t slot, const BoundingBox& bounds);
+
+    Node* nodeAt(DynamicAABBTree::ProxyID proxy) const;
+
+    const NodePool& m_nodes;
+    TransformSystem& m_transforms;
+    DynamicAABBTree m_tree;
+    std::vector<Entry> m_entries;
+    std::vector<BoundingBox> m_bounds;      // Exact world bounds per slot
+    std::vector<Tracked> m_tracked;
+    size_t m_lastRefitCount = 0;
+};
+
+} // namespace Pina
@@ -1,20 +1,80 @@
 #include "Transform.h"
-#include "Node.h"
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/euler_angles.hpp>
-#include <glm/gtx/matrix_decompose.hpp>
 
 namespace Pina {
 
-Transform::Transform() = default;
+namespace {
+
+/// Store for transforms created outside a scene
+/// Shared and unsynchronized, like a scene's store (main thread only)
+TransformSystem& getDetachedSystem() {
+    static TransformSystem s_system;
+    return s_system;
+}
+
+} // namespace
+
+Transform::Transform()
+    : Transform(getDetachedSystem())
+{
+}
+
+Transform::Transform(TransformSystem& system)
+    : m_system(&system)
+    , m_id(system.create())
+{
+}
+
+Transform::~Transform() {
+    if (m_id != TransformSystem::InvalidID) {
+        m_system->destroy(m_id);
+    }
+}
+
+Transform::Transform(const Transform& other)
+    : Transform(*other.m_system)
+{
+    *this = other;
+}
+
+Transform& Transform::operator=(const Transform& other) {
+    // Copies local values only; parent and owner stay as they are
+    if (this != &other) {
+        m_system->setLocalPosition(m_id, other.getLocalPosition());
+        m_system->setLocalRotation(m_id, other.getLocalRotation());
+        m_system->setLocalScale(m_id, other.getLocalScale());
+    }
+    return *this;
+}
+
+Transform::Transform(Transform&& other) noexcept
+    : m_system(other.m_system)
+    , m_id(other.m_id)
+    , m_owner(other.m_owner)
+{
+    other.m_id = TransformSystem::InvalidID;
+}
+
+Transform& Transform::operator=(Transform&& other) noexcept {
+    if (this != &other) {
+        if (m_id != TransformSystem::InvalidID) {
+            m_system->destroy(m_id);
+        }
+        m_system = other.m_system;
+        m_id = other.m_id;
+        m_owner = other.m_owner;
+        other.m_id = TransformSystem::InvalidID;
+    }
+    return *this;
+}
 
 // ============================================================================
 // Local Position
 // ============================================================================
 
 void Transform::setLocalPosition(const glm::vec3& position) {
-    m_localPosition = position;
-    markDirty();
+    m_system->setLocalPosition(m_id, position);
 }
 
 void Transform::setLocalPosition(float x, float y, float z) {
@@ -27,8 +87,7 @@ void Transform::setLocalPosition(float x, float y, float z) {
 
 void Transform::setLocalRotationEuler(const glm::vec3& eulerDegrees) {
     glm::vec3 radians = glm::radians(eulerDegrees);
-    m_localRotation = glm::quat(radians);
-    markDirty();
+    m_system->setLocalRotation(m_id, glm::quat(radians));
 }
 
 void Transform::setLocalRotationEuler(float pitch, float yaw, float roll) {
@@ -36,12 +95,11 @@ void Transform::setLocalRotationEuler(float pitch, float yaw, float roll) {
 }
 
 glm::vec3 Transform::getLocalRotationEuler() const {
-    return glm::degrees(glm::eulerAngles(m_localRotation));
+    return glm::degrees(glm::eulerAngles(getLocalRotation()));
 }
 
 void Transform::setLocalRotation(const glm::quat& rotation) {
-    m_localRotation = rotation;
-    markDirty();
+    m_system->setLocalRotation(m_id, rotation);
 }
 
 // ============================================================================
@@ -49,8 +107,7 @@ void Transform::setLocalRotation(const glm::quat& rotation) {
 // ============================================================================
 
 void Transform::setLocalScale(const glm::vec3& scale) {
-    m_localScale = scale;
-    markDirty();
+    m_system->setLocalScale(m_id, scale);
 }
 
 void Transform::setLocalScale(float uniformScale) {
@@ -66,8 +123,7 @@ void Transform::setLocalScale(float x, float y, float z) {
 // ============================================================================
 
 void Transform::translate(const glm::vec3& delta) {
-    m_localPosition += delta;
-    markDirty();
+    m_system->setLocalPosition(m_id, getLocalPosition() + delta);
 }
 
 void Transform::translate(float x, float y, float z) {
@@ -77,8 +133,7 @@ void Transform::translate(float x, float y, float z) {
 void Transform::rotate(const glm::vec3& eulerDegrees) {
     glm::vec3 radians = glm::radians(eulerDegrees);
     glm::quat rotation(radians);
-    m_localRotation = rotation * m_localRotation;
-    markDirty();
+    m_system->setLocalRotation(m_id, rotation * getLocalRotation());
 }
 
 void Transform::rotate(float pitch, float yaw, float roll) {
@@ -88,18 +143,15 @@ void Transform::rotate(float pitch, float yaw, float roll) {
 void Transform::rotateAround(const glm::vec3& axis, float angleDegrees) {
     float radians = glm::radians(angleDegrees);
     glm::quat rotation = glm::angleAxis(radians, glm::normalize(axis));
-    m_localRotation = rotation * m_localRotation;
-    markDirty();
+    m_system->setLocalRotation(m_id, rotation * getLocalRotation());
 }
 
 void Transform::scale(float factor) {
-    m_localScale *= factor;
-    markDirty();
+    m_system->setLocalScale(m_id, getLocalScale() * factor);
 }
 
 void Transform::scale(const glm::vec3& factors) {
-    m_localScale *= factors;
-    markDirty();
+    m_system->setLocalScale(m_id, getLocalScale() * factors);
 }
 
 // ============================================================================
@@ -107,23 +159,27 @@ void Transform::scale(const glm::vec3& factors) {
 // ============================================================================
 
 const glm::mat4& Transform::getLocalMatrix() const {
-    if (m_dirty) {
-        updateLocalMatrix();
-        m_dirty = false;
-    }
-    return m_localMatrix;
+    return m_system->getLocalMatrix(m_id);
 }
 
 const glm::mat4& Transform::getWorldMatrix() const {
-    if (m_worldDirty || m_dirty) {
-        updateWorldMatrix();
-        m_worldDirty = false;
-    }
-    return m_worldMatrix;
+    return m_system->getWorldMatrix(m_id);
 }
 
 glm::mat3 Transform::getNormalMatrix() const {
-    return glm::transpose(glm::inverse(glm::mat3(getWorldMatrix())));
+    return m_system->getNormalMatrix(m_id);
+}
+
+// ============================================================================
+// Bounds
+// ============================================================================
+
+void Transform::setLocalBounds(const BoundingBox& bounds) {
+    m_system->setLocalBounds(m_id, bounds);
+}
+
+const BoundingBox& Transform::getWorldBounds() const {
+    return m_system->getWorldBounds(m_id);
 }
 
 // ============================================================================
@@ -135,23 +191,11 @@ glm::vec3 Transform::getWorldPosition() const {
 }
 
 glm::quat Transform::getWorldRotation() const {
-    const glm::mat4& world = getWorldMatrix();
-    glm::vec3 scale;
-    glm::quat rotation;
-    glm::vec3 translation;
-    glm::vec3 skew;
-    glm::vec4 perspective;
-    glm::decompose(world, scale, rotation, translation, skew, perspective);
-    return rotation;
+    return m_system->getWorldRotation(m_id);
 }
 
 glm::vec3 Transform::getWorldScale() const {
-    const glm::mat4& world = getWorldMatrix();
-    return glm::vec3(
-        glm::length(glm::vec3(world[0])),
-        glm::length(glm::vec3(world[1])),
-        glm::length(glm::vec3(world[2]))
-    );
+    return m_system->getWorldScale(m_id);
 }
 
 // ============================================================================
@@ -159,59 +203,27 @@ glm::vec3 Transform::getWorldScale() const {
 // ============================================================================
 
 glm::vec3 Transform::getForward() const {
-    return glm::normalize(getWorldRotation() * glm::vec3(0.0f, 0.0f, -1.0f));
+    return m_system->getWorldRotation(m_id) * glm::vec3(0.0f, 0.0f, -1.0f);
 }
 
 glm::vec3 Transform::getRight() const {
-    return glm::normalize(getWorldRotation() * glm::vec3(1.0f, 0.0f, 0.0f));
+    return m_system->getWorldRotation(m_id) * glm::vec3(1.0f, 0.0f, 0.0f);
 }
 
 glm::vec3 Transform::getUp() const {
-    return glm::normalize(getWorldRotation() * glm::vec3(0.0f, 1.0f, 0.0f));
+    return m_system->getWorldRotation(m_id) * glm::vec3(0.0f, 1.0f, 0.0f);
 }
 
 // ============================================================================
-// Dirty Management
+// Parent/Dirty Management
 // ============================================================================
 
 void Transform::markDirty() {
-    m_dirty = true;
-    m_worldDirty = true;
-
-    // Propagate dirty flag to children
-    if (m_owner) {
-        m_owner->markChildrenWorldDirty();
-    }
+    m_system->markDirty(m_id);
 }
 
-// ============================================================================
-// Private Matrix Updates
-// ============================================================================
-
-void Transform::updateLocalMatrix() const {
-    // Build matrix: Translation * Rotation * Scale
-    glm::mat4 translation = glm::translate(glm::mat4(1.0f), m_localPosition);
-    glm::mat4 rotation = glm::mat4_cast(m_localRotation);
-    glm::mat4 scale = glm::scale(glm::mat4(1.0f), m_localScale);
-
-    m_localMatrix = translation * rotation * scale;
-}
-
-void Transform::updateWorldMatrix() const {
-    // Ensure local matrix is up to date
-    if (m_dirty) {
-        updateLocalMatrix();
-        m_dirty = false;
-    }
-
-    // Combine with parent world matrix if we have a parent
-    if (m_owner && m_owner->getParent()) {
-        const Transform& parentTransform = m_owner->getParent()->getTransform();
-        m_worldMatrix = parentTransform.getWorldMatrix() * m_localMatrix;
-    } else {
-        // No parent, world = local
-        m_worldMatrix = m_localMatrix;
-    }
+void Transform::setParent(const Transform* parent) {
+    m_system->setParent(m_id, parent ? parent->m_id : TransformSystem::InvalidID);
 }
 
 } // namespace Pina
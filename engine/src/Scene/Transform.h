@@ -5,6 +5,7 @@
 
 #include "../Core/Export.h"
 #include "../Core/Memory.h"
+#include "TransformSystem.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -14,11 +15,27 @@ namespace Pina {
 class Node;
 
 /// Transform component for scene nodes
-/// Stores local transform (relative to parent) and caches world transform
+/// Handle to local transform (relative to parent) and cached world transform
+/// data stored in a TransformSystem. Copies get their own entry in the same
+/// system with the same local values (and no parent).
 class PINA_API Transform {
 public:
+    /// Create a transform outside any scene
+    /// Detached transforms share one process-wide store nothing updates in
+    /// bulk; their world matrices are computed when read. The store is not
+    /// synchronized: create, copy, destroy and read detached transforms on
+    /// the main thread only.
     Transform();
-    ~Transform() = default;
+
+    /// Create a transform in a scene's system
+    explicit Transform(TransformSystem& system);
+
+    ~Transform();
+
+    Transform(const Transform& other);
+    Transform& operator=(const Transform& other);
+    Transform(Transform&& other) noexcept;
+    Transform& operator=(Transform&& other) noexcept;
 
     // ========================================================================
     // Local Transform (relative to parent)
@@ -29,7 +46,7 @@ public:
     void setLocalPosition(float x, float y, float z);
 
     /// Get local position
-    const glm::vec3& getLocalPosition() const { return m_localPosition; }
+    const glm::vec3& getLocalPosition() const { return m_system->getLocalPosition(m_id); }
 
     /// Set local rotation using Euler angles (in degrees)
     void setLocalRotationEuler(const glm::vec3& eulerDegrees);
@@ -42,7 +59,7 @@ public:
     void setLocalRotation(const glm::quat& rotation);
 
     /// Get local rotation as quaternion
-    const glm::quat& getLocalRotation() const { return m_localRotation; }
+    const glm::quat& getLocalRotation() const { return m_system->getLocalRotation(m_id); }
 
     /// Set local scale
     void setLocalScale(const glm::vec3& scale);
@@ -50,7 +67,7 @@ public:
     void setLocalScale(float x, float y, float z);
 
     /// Get local scale
-    const glm::vec3& getLocalScale() const { return m_localScale; }
+    const glm::vec3& getLocalScale() const { return m_system->getLocalScale(m_id); }
 
     // ========================================================================
     // Transform Operations
@@ -76,6 +93,8 @@ public:
     // ========================================================================
     // Matrix Access
     // ========================================================================
+    // Returned references stay valid until the next transform is created or
+    // destroyed, or the next TransformSystem::update().
 
     /// Get local transform matrix (lazy evaluation)
     const glm::mat4& getLocalMatrix() const;
@@ -86,6 +105,33 @@ public:
     /// Get the normal matrix for transforming normals (inverse transpose of 3x3 world matrix)
     glm::mat3 getNormalMatrix() const;
 
+    /// Check if the world values are up to date (the getCached*() getters
+    /// can be used)
+    bool isCurrent() const { return m_system->isCurrent(m_id); }
+
+    /// Get the world matrix as last computed, without updating it
+    /// (read-only, safe on worker threads; see TransformSystem)
+    const glm::mat4& getCachedWorldMatrix() const { return m_system->getCachedWorldMatrix(m_id); }
+
+    /// Get the normal matrix as last computed, without updating it
+    const glm::mat3& getCachedNormalMatrix() const { return m_system->getCachedNormalMatrix(m_id); }
+
+    // ========================================================================
+    // Bounds
+    // ========================================================================
+
+    /// Set bounds in local space (Node sets these from its model)
+    void setLocalBounds(const BoundingBox& bounds);
+
+    /// Get bounds in local space (invalid if unset)
+    const BoundingBox& getLocalBounds() const { return m_system->getLocalBounds(m_id); }
+
+    /// Get local bounds transformed to world space (invalid if unset)
+    const BoundingBox& getWorldBounds() const;
+
+    /// Get the world bounds as last computed, without updating them
+    const BoundingBox& getCachedWorldBounds() const { return m_system->getCachedWorldBounds(m_id); }
+
     // ========================================================================
     // World Space Getters
     // ========================================================================
@@ -93,10 +139,10 @@ public:
     /// Get world position
     glm::vec3 getWorldPosition() const;
 
-    /// Get world rotation
+    /// Get world rotation (decomposed once per world matrix change)
     glm::quat getWorldRotation() const;
 
-    /// Get world scale
+    /// Get world scale (decomposed once per world matrix change)
     glm::vec3 getWorldScale() const;
 
     // ========================================================================
@@ -117,32 +163,33 @@ public:
     // ========================================================================
 
     /// Mark transform as dirty (needs matrix recalculation)
+    /// Children pick up the change through the TransformSystem; nothing is
+    /// walked here.
     void markDirty();
 
-    /// Check if transform is dirty
-    bool isDirty() const { return m_dirty; }
+    /// Check if the local matrix needs recalculation
+    bool isDirty() const { return m_system->isLocalDirty(m_id); }
+
+    /// Set the parent transform (called by Node when the hierarchy changes)
+    void setParent(const Transform* parent);
 
-    /// Set the owning node (for parent transform access)
+    /// Set the owning node
     void setOwner(Node* node) { m_owner = node; }
 
-private:
-    void updateLocalMatrix() const;
-    void updateWorldMatrix() const;
+    /// Get the owning node (may be nullptr)
+    Node* getOwner() const { return m_owner; }
 
-    // Local transform components
-    glm::vec3 m_localPosition{0.0f, 0.0f, 0.0f};
-    glm::quat m_localRotation{1.0f, 0.0f, 0.0f, 0.0f};  // Identity quaternion (w, x, y, z)
-    glm::vec3 m_localScale{1.0f, 1.0f, 1.0f};
+    /// Get the system holding this transform
+    TransformSystem& getSystem() const { return *m_system; }
 
-    // Cached matrices
-    mutable glm::mat4 m_localMatrix{1.0f};
-    mutable glm::mat4 m_worldMatrix{1.0f};
+    /// Get the entry in the TransformSystem
+    TransformSystem::ID getID() const { return m_id; }
 
-    // Dirty flags
-    mutable bool m_dirty = true;
-    mutable bool m_worldDirty = true;
+private:
+    TransformSystem* m_system;
+    TransformSystem::ID m_id;
 
-    // Owner node (for parent access)
+    // Owner node
     Node* m_owner = nullptr;
 };
 
@@ -0,0 +1,492 @@
+#include "TransformSystem.h"
+#include "../Core/JobSystem.h"
+#include "../Math/SimdMath.h"
+#include <algorithm>
+#include <atomic>
+#include <type_traits>
+
+namespace Pina {
+
+// ============================================================================
+// Lifetime
+// ============================================================================
+
+TransformSystem::ID TransformSystem::create() {
+    ID id;
+    if (!m_freeIDs.empty()) {
+        id = m_freeIDs.back();
+        m_freeIDs.pop_back();
+    } else {
+        id = static_cast<ID>(m_indices.size());
+        m_indices.push_back(InvalidIndex);
+    }
+
+    // Appending never breaks parent-before-child order
+    uint32_t index = static_cast<uint32_t>(m_ids.size());
+    m_localPositions.emplace_back(0.0f);
+    m_localRotations.emplace_back(1.0f, 0.0f, 0.0f, 0.0f);
+    m_localScales.emplace_back(1.0f);
+    m_localMatrices.emplace_back(1.0f);
+    m_worldMatrices.emplace_back(1.0f);
+    m_normalMatrices.emplace_back(1.0f);
+    m_uniformScales.push_back(1.0f);
+    m_worldRotations.emplace_back(1.0f, 0.0f, 0.0f, 0.0f);
+    m_worldScales.emplace_back(1.0f);
+    m_localBounds.emplace_back();
+    m_worldBounds.emplace_back();
+    m_parents.push_back(InvalidIndex);
+    m_childCounts.push_back(0);
+    m_worldVersions.push_back(0);
+    m_parentVersions.push_back(0);
+    m_decomposedVersions.push_back(0);
+    m_currentEpochs.push_back(0);
+    m_flags.push_back(LocalDirty);
+    m_ids.push_back(id);
+
+    m_indices[id] = index;
+    m_levelsDirty = true;
+    touch();
+    return id;
+}
+
+void TransformSystem::destroy(ID id) {
+    uint32_t index = m_indices[id];
+
+    // Children normally go first (Node destroys its children before its
+    // transform); detach any that are left
+    if (m_childCounts[index] > 0) {
+        for (size_t i = 0; i < m_parents.size(); ++i) {
+            if (m_parents[i] == index) {
+                m_parents[i] = InvalidIndex;
+                m_flags[i] |= WorldDirty;
+            }
+        }
+    }
+
+    if (m_parents[index] != InvalidIndex) {
+        m_childCounts[m_parents[index]]--;
+    }
+
+    m_parents[index] = InvalidIndex;
+    m_childCounts[index] = 0;
+    m_flags[index] = Dead;
+    m_ids[index] = InvalidID;
+    m_indices[id] = InvalidIndex;
+    m_freeIDs.push_back(id);
+    m_deadCount++;
+    m_levelsDirty = true;
+    touch();
+
+    // Once every entry is dead, drop them now: a store nobody updates (such
+    // as the one detached transforms share) would otherwise never shrink
+    if (m_deadCount == m_ids.size()) {
+        compact();
+    }
+}
+
+void TransformSystem::setParent(ID id, ID parent) {
+    uint32_t index = m_indices[id];
+    uint32_t parentIndex = (parent != InvalidID) ? m_indices[parent] : InvalidIndex;
+    if (m_parents[index] == parentIndex) return;
+
+    if (m_parents[index] != InvalidIndex) {
+        m_childCounts[m_parents[index]]--;
+    }
+    m_parents[index] = parentIndex;
+
+    if (parentIndex != InvalidIndex) {
+        m_childCounts[parentIndex]++;
+
+        // The subtree now sits before its parent; update() re-sorts
+        if (parentIndex > index) {
+            m_orderDirty = true;
+        }
+    }
+
+    m_flags[index] |= WorldDirty;
+    m_levelsDirty = true;
+    touch();
+}
+
+TransformSystem::ID TransformSystem::getParent(ID id) const {
+    uint32_t parentIndex = m_parents[m_indices[id]];
+    return (parentIndex != InvalidIndex) ? m_ids[parentIndex] : InvalidID;
+}
+
+// ============================================================================
+// Local Transform
+// ============================================================================
+
+void TransformSystem::setLocalPosition(ID id, const glm::vec3& position) {
+    m_localPositions[m_indices[id]] = position;
+    markDirty(id);
+}
+
+void TransformSystem::setLocalRotation(ID id, const glm::quat& rotation) {
+    m_localRotations[m_indices[id]] = rotation;
+    markDirty(id);
+}
+
+void TransformSystem::setLocalScale(ID id, const glm::vec3& scale) {
+    m_localScales[m_indices[id]] = scale;
+    markDirty(id);
+}
+
+void TransformSystem::markDirty(ID id) {
+    m_flags[m_indices[id]] |= LocalDirty;
+    touch();
+}
+
+void TransformSystem::setLocalBounds(ID id, const BoundingBox& bounds) {
+    uint32_t index = m_indices[id];
+    m_localBounds[index] = bounds;
+    m_worldBounds[index] = BoundingBox();   // Recomputed if valid
+    m_flags[index] |= WorldDirty;
+    touch();
+}
+
+// ============================================================================
+// Matrices
+// ============================================================================
+
+const glm::mat4& TransformSystem::getLocalMatrix(ID id) {
+    uint32_t index = m_indices[id];
+    if (m_flags[index] & LocalDirty) {
+        m_localMatrices[index] = SimdMath::composeTRS(m_localPositions[index], m_localRotations[index],
+                                                      m_localScales[index]);
+        // The world matrix still has to pick up the new local matrix
+        m_flags[index] = static_cast<uint8_t>((m_flags[index] & ~LocalDirty) | WorldDirty);
+    }
+    return m_localMatrices[index];
+}
+
+const glm::mat4& TransformSystem::getWorldMatrix(ID id) {
+    uint32_t index = m_indices[id];
+    if (m_currentEpochs[index] == m_epoch) {
+        return m_worldMatrices[index];
+    }
+
+    // Walk up to the first ancestor known to be current, then update root-down
+    m_chain.clear();
+    for (uint32_t i = index; i != InvalidIndex && m_currentEpochs[i] != m_epoch; i = m_parents[i]) {
+        m_chain.push_back(i);
+    }
+    for (auto it = m_chain.rbegin(); it != m_chain.rend(); ++it) {
+        updateEntry(*it);
+        m_currentEpochs[*it] = m_epoch;
+    }
+
+    return m_worldMatrices[index];
+}
+
+const glm::mat3& TransformSystem::getNormalMatrix(ID id) {
+    getWorldMatrix(id);
+    return m_normalMatrices[m_indices[id]];
+}
+
+const BoundingBox& TransformSystem::getWorldBounds(ID id) {
+    getWorldMatrix(id);
+    return m_worldBounds[m_indices[id]];
+}
+
+const glm::quat& TransformSystem::getWorldRotation(ID id) {
+    getWorldMatrix(id);
+    uint32_t index = m_indices[id];
+    if (m_decomposedVersions[index] != m_worldVersions[index]) {
+        decompose(index);
+    }
+    return m_worldRotations[index];
+}
+
+const glm::vec3& TransformSystem::getWorldScale(ID id) {
+    getWorldMatrix(id);
+    uint32_t index = m_indices[id];
+    if (m_decomposedVersions[index] != m_worldVersions[index]) {
+        decompose(index);
+    }
+    return m_worldScales[index];
+}
+
+uint32_t TransformSystem::getWorldVersion(ID id) {
+    getWorldMatrix(id);
+    return m_worldVersions[m_indices[id]];
+}
+
+bool TransformSystem::updateEntry(uint32_t index) {
+    uint32_t parent = m_parents[index];
+    uint32_t parentVersion = (parent != InvalidIndex) ? m_worldVersions[parent] : 0;
+    uint8_t flags = m_flags[index];
+
+    if (!(flags & (LocalDirty | WorldDirty)) && parentVersion == m_parentVersions[index]) {
+        return false;
+    }
+
+    if (flags & LocalDirty) {
+        m_localMatrices[index] = SimdMath::composeTRS(m_localPositions[index], m_localRotations[index],
+                                                      m_localScales[index]);
+    }
+
+    if (parent != InvalidIndex) {
+        m_worldMatrices[index] = SimdMath::multiplyAffine(m_worldMatrices[parent], m_localMatrices[index]);
+    } else {
+        m_worldMatrices[index] = m_localMatrices[index];
+    }
+
+    // Uniform scale keeps the 3x3 a scaled rotation, which skips the inverse
+    const glm::vec3& scale = m_localScales[index];
+    float parentScale = (parent != InvalidIndex) ? m_uniformScales[parent] : 1.0f;
+    float uniformScale = (scale.x == scale.y && scale.y == scale.z) ? parentScale * scale.x : 0.0f;
+    m_uniformScales[index] = uniformScale;
+
+    const glm::mat4& world = m_worldMatrices[index];
+    if (uniformScale != 0.0f) {
+        m_normalMatrices[index] = SimdMath::normalMatrix(world, uniformScale);
+    } else {
+        m_normalMatrices[index] = SimdMath::normalMatrix(world);
+    }
+    if (m_localBounds[index].isValid()) {
+        m_worldBounds[index] = SimdMath::transformBox(world, m_localBounds[index]);
+    }
+
+    m_parentVersions[index] = parentVersion;
+    m_worldVersions[index]++;
+    m_flags[index] = 0;
+    return true;
+}
+
+void TransformSystem::decompose(uint32_t index) {
+    // Same result as glm::decompose for affine matrices, without the skew
+    // and perspective work
+    const glm::mat4& world = m_worldMatrices[index];
+    glm::vec3 x(world[0]), y(world[1]), z(world[2]);
+    glm::vec3 scale(glm::length(x), glm::length(y), glm::length(z));
+
+    glm::mat3 rotation(1.0f);
+    float uniformScale = m_uniformScales[index];
+    if (uniformScale != 0.0f) {
+        rotation = glm::mat3(world) * (1.0f / uniformScale);
+    } else if (scale.x > 0.0f && scale.y > 0.0f && scale.z > 0.0f) {
+        // Gram-Schmidt, then flip a reflection back into a rotation
+        x /= scale.x;
+        y = glm::normalize(y - x * glm::dot(x, y));
+        z = glm::normalize(z - x * glm::dot(x, z) - y * glm::dot(y, z));
+        if (glm::dot(x, glm::cross(y, z)) < 0.0f) {
+            x = -x;
+            y = -y;
+            z = -z;
+        }
+        rotation = glm::mat3(x, y, z);
+    }
+
+    m_worldRotations[index] = glm::normalize(glm::quat_cast(rotation));
+    m_worldScales[index] = scale;
+    m_decomposedVersions[index] = m_worldVersions[index];
+}
+
+// ============================================================================
+// Update
+// ============================================================================
+
+void TransformSystem::update() {
+    // Nothing created, changed or reparented since the last pass
+    if (m_updatedEpoch == m_epoch) {
+        m_lastUpdateCount = 0;
+        return;
+    }
+
+    if (m_orderDirty) {
+        reorder();
+    } else if (m_deadCount > 0 && m_deadCount * 4 >= m_ids.size()) {
+        compact();
+    }
+
+    bool parallel = m_jobSystem && m_jobSystem->isRunning() && m_jobSystem->getWorkerCount() > 0 &&
+                    m_ids.size() - m_deadCount >= ParallelThreshold;
+
+    m_lastUpdateCount = parallel ? updateParallel() : updateSerial();
+    m_updatedEpoch = m_epoch;
+}
+
+size_t TransformSystem::updateSerial() {
+    // Parents come first, so each entry sees its parent's final matrix
+    size_t updated = 0;
+    const size_t count = m_ids.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (m_flags[i] & Dead) continue;
+
+        uint32_t index = static_cast<uint32_t>(i);
+        if (updateEntry(index)) {
+            updated++;
+        }
+        m_currentEpochs[index] = m_epoch;
+    }
+    return updated;
+}
+
+size_t TransformSystem::updateParallel() {
+    if (m_levelsDirty) {
+        buildLevels();
+    }
+
+    // Entries in a level only read their parents, which the previous level
+    // finished, and only write themselves
+    std::atomic<size_t> updated{0};
+    const uint32_t epoch = m_epoch;
+    for (size_t level = 0; level + 1 < m_levelOffsets.size(); ++level) {
+        m_jobSystem->parallelFor(m_levelOffsets[level], m_levelOffsets[level + 1], ParallelGrainSize,
+            [this, &updated, epoch](size_t begin, size_t end) {
+                size_t count = 0;
+                for (size_t i = begin; i < end; ++i) {
+                    uint32_t index = m_levelEntries[i];
+                    if (updateEntry(index)) {
+                        count++;
+                    }
+                    m_currentEpochs[index] = epoch;
+                }
+                updated.fetch_add(count, std::memory_order_relaxed);
+            });
+    }
+    return updated.load(std::memory_order_relaxed);
+}
+
+void TransformSystem::buildLevels() {
+    // Parents come first, so one pass finds every depth
+    const size_t count = m_ids.size();
+    std::vector<uint32_t> depths(count, 0);
+    uint32_t maxDepth = 0;
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t parent = m_parents[i];
+        if (parent != InvalidIndex) {
+            depths[i] = depths[parent] + 1;
+            maxDepth = std::max(maxDepth, depths[i]);
+        }
+    }
+
+    // Counting sort keeps each level in memory order
+    m_levelOffsets.assign(maxDepth + 2, 0);
+    for (size_t i = 0; i < count; ++i) {
+        if (!(m_flags[i] & Dead)) {
+            m_levelOffsets[depths[i] + 1]++;
+        }
+    }
+    for (size_t d = 1; d < m_levelOffsets.size(); ++d) {
+        m_levelOffsets[d] += m_levelOffsets[d - 1];
+    }
+
+    m_levelEntries.resize(m_levelOffsets.back());
+    std::vector<uint32_t> cursor(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+    for (size_t i = 0; i < count; ++i) {
+        if (!(m_flags[i] & Dead)) {
+            m_levelEntries[cursor[depths[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    m_levelsDirty = false;
+}
+
+void TransformSystem::reorder() {
+    const size_t count = m_ids.size();
+
+    // Depth of every live entry (memoized walk up the parent chain)
+    std::vector<uint32_t> depths(count, UINT32_MAX);
+    uint32_t maxDepth = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if ((m_flags[i] & Dead) || depths[i] != UINT32_MAX) continue;
+
+        m_chain.clear();
+        uint32_t j = static_cast<uint32_t>(i);
+        while (j != InvalidIndex && depths[j] == UINT32_MAX) {
+            m_chain.push_back(j);
+            j = m_parents[j];
+        }
+        uint32_t depth = (j != InvalidIndex) ? depths[j] + 1 : 0;
+        for (auto it = m_chain.rbegin(); it != m_chain.rend(); ++it) {
+            depths[*it] = depth++;
+        }
+        maxDepth = std::max(maxDepth, depth - 1);
+    }
+
+    // Stable counting sort by depth keeps siblings in their current order
+    std::vector<uint32_t> offsets(maxDepth + 2, 0);
+    for (size_t i = 0; i < count; ++i) {
+        if (depths[i] != UINT32_MAX) {
+            offsets[depths[i] + 1]++;
+        }
+    }
+    for (size_t d = 1; d < offsets.size(); ++d) {
+        offsets[d] += offsets[d - 1];
+    }
+
+    std::vector<uint32_t> order(offsets.back());
+    for (size_t i = 0; i < count; ++i) {
+        if (depths[i] != UINT32_MAX) {
+            order[offsets[depths[i]]++] = static_cast<uint32_t>(i);
+        }
+    }
+
+    permute(order);
+    m_orderDirty = false;
+}
+
+void TransformSystem::compact() {
+    std::vector<uint32_t> order;
+    order.reserve(m_ids.size() - m_deadCount);
+    for (size_t i = 0; i < m_ids.size(); ++i) {
+        if (!(m_flags[i] & Dead)) {
+            order.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    permute(order);
+}
+
+void TransformSystem::permute(const std::vector<uint32_t>& order) {
+    const size_t oldCount = m_ids.size();
+
+    auto gather = [&order](auto& values) {
+        typename std::decay<decltype(values)>::type moved;
+        moved.reserve(order.size());
+        for (uint32_t from : order) {
+            moved.push_back(values[from]);
+        }
+        values.swap(moved);
+    };
+
+    gather(m_localPositions);
+    gather(m_localRotations);
+    gather(m_localScales);
+    gather(m_localMatrices);
+    gather(m_worldMatrices);
+    gather(m_normalMatrices);
+    gather(m_uniformScales);
+    gather(m_worldRotations);
+    gather(m_worldScales);
+    gather(m_localBounds);
+    gather(m_worldBounds);
+    gather(m_parents);
+    gather(m_childCounts);
+    gather(m_worldVersions);
+    gather(m_parentVersions);
+    gather(m_decomposedVersions);
+    gather(m_currentEpochs);
+    gather(m_flags);
+    gather(m_ids);
+
+    // Remap parents and handles to the new positions
+    std::vector<uint32_t> newIndices(oldCount, InvalidIndex);
+    for (size_t i = 0; i < order.size(); ++i) {
+        newIndices[order[i]] = static_cast<uint32_t>(i);
+    }
+    for (uint32_t& parent : m_parents) {
+        if (parent != InvalidIndex) {
+            parent = newIndices[parent];
+        }
+    }
+    for (size_t i = 0; i < m_ids.size(); ++i) {
+        m_indices[m_ids[i]] = static_cast<uint32_t>(i);
+    }
+
+    m_deadCount = 0;
+    m_levelsDirty = true;
+}
+
+} // namespace Pina
@@ -0,0 +1,246 @@
+#pragma once
+
+/// Pina Engine - Transform System
+/// Contiguous storage for every Transform, updated in one pass per frame
+
+#include "../Core/Export.h"
+#include "../Math/BoundingBox.h"
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace Pina {
+
+class JobSystem;
+
+/// Structure-of-arrays store for local TRS and world matrices
+///
+/// Each Scene owns one, and its nodes' Transforms are handles into it, so
+/// updating one scene never touches another's transforms. Entries are kept
+/// ordered parent-before-child, so update() refreshes every world matrix in
+/// a single linear pass: an entry is recomputed when its local values
+/// changed or its parent's world matrix changed since it was last computed
+/// (tracked with per-entry version counters, so setters never walk the
+/// subtree).
+///
+/// Each recomputed entry also gets its normal matrix and, when local bounds
+/// are set, its world bounds. World rotation and scale are decomposed on
+/// first read and cached until the world matrix changes again. With a
+/// JobSystem, large updates run one depth level at a time, each level split
+/// across the worker threads.
+///
+/// Reads between updates stay exact: getWorldMatrix() brings the ancestor
+/// chain up to date on demand (O(depth)), and is O(1) when nothing changed.
+/// Rendering and culling rely on update() having run first (Scene::update(),
+/// or SceneRenderer catching up), so they never recompute anything.
+///
+/// Not thread-safe; use from the thread that owns the scene.
+class PINA_API TransformSystem {
+public:
+    using ID = uint32_t;
+    static constexpr ID InvalidID = UINT32_MAX;
+
+    TransformSystem() = default;
+    ~TransformSystem() = default;
+
+    TransformSystem(const TransformSystem&) = delete;
+    TransformSystem& operator=(const TransformSystem&) = delete;
+
+    // ========================================================================
+    // Lifetime
+    // ========================================================================
+
+    /// Add an identity transform with no parent
+    ID create();
+
+    /// Remove a transform (its children become roots)
+    void destroy(ID id);
+
+    /// Attach to a parent (InvalidID = no parent)
+    void setParent(ID id, ID parent);
+
+    /// Get the parent (InvalidID = no parent)
+    ID getParent(ID id) const;
+
+    // ========================================================================
+    // Local Transform
+    // ========================================================================
+
+    const glm::vec3& getLocalPosition(ID id) const { return m_localPositions[m_indices[id]]; }
+    const glm::quat& getLocalRotation(ID id) const { return m_localRotations[m_indices[id]]; }
+    const glm::vec3& getLocalScale(ID id) const { return m_localScales[m_indices[id]]; }
+
+    void setLocalPosition(ID id, const glm::vec3& position);
+    void setLocalRotation(ID id, const glm::quat& rotation);
+    void setLocalScale(ID id, const glm::vec3& scale);
+
+    /// Flag local values as changed (recomputes local and world matrices)
+    void markDirty(ID id);
+
+    /// Check if local values changed since the local matrix was built
+    bool isLocalDirty(ID id) const { return (m_flags[m_indices[id]] & LocalDirty) != 0; }
+
+    /// Set bounds in local space (an invalid box disables world bounds)
+    void setLocalBounds(ID id, const BoundingBox& bounds);
+
+    const BoundingBox& getLocalBounds(ID id) const { return m_localBounds[m_indices[id]]; }
+
+    // ========================================================================
+    // Matrices
+    // ========================================================================
+    // Returned references stay valid until a transform is created or
+    // destroyed, or update() reorders the store.
+
+    /// Get the local matrix (rebuilt if local values changed)
+    const glm::mat4& getLocalMatrix(ID id);
+
+    /// Get the world matrix (brings ancestors up to date if needed)
+    const glm::mat4& getWorldMatrix(ID id);
+
+    /// Get the normal matrix (inverse transpose of the world matrix's 3x3)
+    const glm::mat3& getNormalMatrix(ID id);
+
+    /// Get the local bounds transformed to world space (invalid if unset)
+    const BoundingBox& getWorldBounds(ID id);
+
+    /// Get the rotation part of the world matrix (cached per world matrix)
+    const glm::quat& getWorldRotation(ID id);
+
+    /// Get the axis lengths of the world matrix (cached per world matrix)
+    const glm::vec3& getWorldScale(ID id);
+
+    /// Get a counter bumped whenever the world matrix or world bounds change
+    /// (brings ancestors up to date first; compare to detect movement)
+    uint32_t getWorldVersion(ID id);
+
+    // ========================================================================
+    // Cached Values
+    // ========================================================================
+    // Read as last computed, never recomputed, so several threads can read
+    // them at once while nothing changes the store. Only valid for current
+    // entries: after update(), until the next change.
+
+    /// Check if an entry's world values are up to date
+    bool isCurrent(ID id) const { return m_currentEpochs[m_indices[id]] == m_epoch; }
+
+    /// Check if update() ran since the last change to any entry
+    bool isUpToDate() const { return m_updatedEpoch == m_epoch; }
+
+    const glm::mat4& getCachedWorldMatrix(ID id) const {
+        assert(isCurrent(id));
+        return m_worldMatrices[m_indices[id]];
+    }
+
+    const glm::mat3& getCachedNormalMatrix(ID id) const {
+        assert(isCurrent(id));
+        return m_normalMatrices[m_indices[id]];
+    }
+
+    const BoundingBox& getCachedWorldBounds(ID id) const {
+        assert(isCurrent(id));
+        return m_worldBounds[m_indices[id]];
+    }
+
+    // ========================================================================
+    // Update
+    // ========================================================================
+
+    /// Restore parent-before-child order if needed, then recompute every
+    /// changed world matrix in one linear pass (called by Scene::update())
+    void update();
+
+    /// Run large updates on a job system (nullptr = always serial)
+    void setJobSystem(JobSystem* jobs) { m_jobSystem = jobs; }
+    JobSystem* getJobSystem() const { return m_jobSystem; }
+
+    /// Entries below which update() stays on the calling thread
+    static constexpr size_t ParallelThreshold = 8192;
+
+    /// Entries per job in a parallel update
+    static constexpr size_t ParallelGrainSize = 2048;
+
+    /// Number of live transforms
+    size_t getCount() const { return m_indices.size() - m_freeIDs.size(); }
+
+    /// Number of world matrices recomputed by the last update()
+    size_t getLastUpdateCount() const { return m_lastUpdateCount; }
+
+private:
+    static constexpr uint32_t InvalidIndex = UINT32_MAX;
+
+    enum Flags : uint8_t {
+        LocalDirty = 1 << 0,    // Local values changed
+        WorldDirty = 1 << 1,    // Parent changed (or local matrix rebuilt early)
+        Dead = 1 << 2           // Destroyed, removed on the next compaction
+    };
+
+    /// Recompute one entry whose parent is already current
+    /// @return true if the world matrix changed
+    bool updateEntry(uint32_t index);
+
+    /// Split a current world matrix into cached rotation and scale
+    void decompose(uint32_t index);
+
+    /// Invalidate every cached "current" mark
+    void touch() { m_epoch++; }
+
+    /// Serial pass over all entries in order
+    size_t updateSerial();
+
+    /// Level-by-level pass on the job system
+    size_t updateParallel();
+
+    /// Group live entries by depth into m_levelEntries
+    void buildLevels();
+
+    /// Order entries by depth (also drops dead entries)
+    void reorder();
+
+    /// Drop dead entries, keeping the existing order
+    void compact();
+
+    /// Move entries so new index i holds old index order[i]
+    void permute(const std::vector<uint32_t>& order);
+
+    // Per entry, ordered parent-before-child (unless m_orderDirty)
+    std::vector<glm::vec3> m_localPositions;
+    std::vector<glm::quat> m_localRotations;
+    std::vector<glm::vec3> m_localScales;
+    std::vector<glm::mat4> m_localMatrices;
+    std::vector<glm::mat4> m_worldMatrices;
+    std::vector<glm::mat3> m_normalMatrices;
+    std::vector<float> m_uniformScales;         // World scale if uniform, else 0
+    std::vector<glm::quat> m_worldRotations;
+    std::vector<glm::vec3> m_worldScales;
+    std::vector<BoundingBox> m_localBounds;
+    std::vector<BoundingBox> m_worldBounds;
+    std::vector<uint32_t> m_parents;            // Parent index or InvalidIndex
+    std::vector<uint32_t> m_childCounts;
+    std::vector<uint32_t> m_worldVersions;      // Bumped when the world matrix changes
+    std::vector<uint32_t> m_parentVersions;     // Parent's version when last computed
+    std::vector<uint32_t> m_decomposedVersions; // World version of the cached rotation/scale
+    std::vector<uint32_t> m_currentEpochs;      // m_epoch when last known current
+    std::vector<uint8_t> m_flags;
+    std::vector<ID> m_ids;                      // Index -> ID
+
+    // Stable handles
+    std::vector<uint32_t> m_indices;            // ID -> index
+    std::vector<ID> m_freeIDs;
+
+    // Entries grouped by depth for parallel updates
+    std::vector<uint32_t> m_levelEntries;
+    std::vector<uint32_t> m_levelOffsets;       // Level d is [offsets[d], offsets[d + 1])
+    bool m_levelsDirty = true;
+
+    std::vector<uint32_t> m_chain;              // Scratch for getWorldMatrix()
+    JobSystem* m_jobSystem = nullptr;
+    uint32_t m_epoch = 1;                       // Bumped by every change
+    uint32_t m_updatedEpoch = 0;                // m_epoch at the end of update()
+    size_t m_deadCount = 0;
+    size_t m_lastUpdateCount = 0;
+    bool m_orderDirty = false;
+};
+
+} // namespace Pina
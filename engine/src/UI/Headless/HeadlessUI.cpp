@@ -0,0 +1,50 @@
+/// Pina Engine - Headless UI Implementation
+
+#include "HeadlessUI.h"
+
+namespace Pina {
+
+HeadlessUI::HeadlessUI() = default;
+
+HeadlessUI::~HeadlessUI() {
+    destroy();
+}
+
+bool HeadlessUI::create(Window* window, Graphics* graphics, const UIConfig& config) {
+    (void)window;
+    (void)graphics;
+    (void)config;
+
+    m_initialized = true;
+    m_frameCount = 0;
+    return true;
+}
+
+void HeadlessUI::destroy() {
+    m_initialized = false;
+    m_inFrame = false;
+}
+
+void HeadlessUI::beginFrame() {
+    if (!m_initialized) return;
+    m_inFrame = true;
+}
+
+void HeadlessUI::endFrame() {
+    if (!m_inFrame) return;
+    m_inFrame = false;
+    m_frameCount++;
+}
+
+void HeadlessUI::shutdown() {
+    destroy();
+}
+
+#ifndef __APPLE__
+// Factory implementation (platforms without the ImGui backend)
+UISubsystem* UISubsystem::createDefault() {
+    return new HeadlessUI();
+}
+#endif
+
+} // namespace Pina
@@ -0,0 +1,43 @@
+#pragma once
+
+/// Pina Engine - Headless UI Implementation
+/// No-op UI subsystem for runs without a display or ImGui backend
+
+#include "../UI.h"
+#include <cstdint>
+
+namespace Pina {
+
+class Window;
+class Graphics;
+
+/// Headless UI - frames are counted, nothing is drawn
+class PINA_API HeadlessUI : public UISubsystem {
+public:
+    HeadlessUI();
+    ~HeadlessUI() override;
+
+    // UISubsystem interface
+    bool create(Window* window, Graphics* graphics, const UIConfig& config = {}) override;
+    void destroy() override;
+    void beginFrame() override;
+    void endFrame() override;
+    bool wantsCaptureKeyboard() const override { return false; }
+    bool wantsCaptureMouse() const override { return false; }
+    void showDemoWindow(bool* open = nullptr) override { (void)open; }
+
+    // Subsystem lifecycle
+    void initialize() override {}
+    void update(float deltaTime) override { (void)deltaTime; }
+    void shutdown() override;
+
+    /// Number of completed beginFrame()/endFrame() pairs
+    uint64_t getFrameCount() const { return m_frameCount; }
+
+private:
+    bool m_initialized = false;
+    bool m_inFrame = false;
+    uint64_t m_frameCount = 0;
+};
+
+} // namespace Pina
@@ -102,6 +102,14 @@ TreeNode::~TreeNode() {
     }
 }
 
+bool beginTreeNode(const char* label, UITreeNodeFlags flags) {
+    return ImGui::TreeNodeEx(label, toImGuiTreeNodeFlags(flags));
+}
+
+void treePop() {
+    ImGui::TreePop();
+}
+
 MenuBar::MenuBar() {
     m_visible = ImGui::BeginMenuBar();
 }
@@ -20,6 +20,9 @@ public:
     UISubsystem() = default;
     virtual ~UISubsystem() = default;
 
+    /// UI backends render through the main thread's GPU context
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.mainThread(); }
+
     /// Create and initialize the UI context
     /// @param window The window for input/rendering
     /// @param graphics The graphics context
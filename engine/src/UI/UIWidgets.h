@@ -84,6 +84,15 @@ private:
     bool m_open;
 };
 
+/// Begin a tree node without a scope, for trees walked iteratively
+/// Call treePop() after the node's children when this returns true.
+/// @param label Node label
+/// @param flags Tree node flags
+PINA_API bool beginTreeNode(const char* label, UITreeNodeFlags flags = UITreeNodeFlags::None);
+
+/// Close a tree node opened by beginTreeNode()
+PINA_API void treePop();
+
 /// Menu bar container
 class PINA_API MenuBar {
 public:
@@ -0,0 +1,212 @@
+/// Instancing Sample
+/// Stress test: a forest of 20,000 trees sharing two meshes and materials,
+/// drawn with one instanced draw per mesh instead of one draw per node
+
+#include <Pina.h>
+#include <iostream>
+#include <random>
+
+class InstancingSample : public Pina::Application {
+public:
+    InstancingSample() {
+        m_config.title = "Pina Engine - Instancing Sample";
+        m_config.windowWidth = 1280;
+        m_config.windowHeight = 720;
+        m_config.vsync = false;
+        m_config.resizable = true;
+        m_config.clearColor = Pina::Color(0.55f, 0.7f, 0.85f);
+    }
+
+protected:
+    void onInit() override {
+        getDevice()->setDepthTest(true);
+
+        m_scene.setDevice(getDevice());
+        m_scene.setupDefaultLighting();
+
+        // Ground
+        auto* ground = m_scene.createPlane("Ground", ForestSize * 1.2f, ForestSize * 1.2f);
+        ground->setMaterial(Pina::Material::createMatte(Pina::Color(0.25f, 0.35f, 0.15f)));
+
+        createForest();
+
+        auto* camera = m_scene.getOrCreateDefaultCamera(60.0f);
+        camera->setPerspective(60.0f, 1280.0f / 720.0f, 0.5f, ForestSize * 2.0f);
+
+        // One shader per drawing path; the renderer switches between them
+        m_shader = getDevice()->createShader();
+        m_shader->load(
+            Pina::ShaderLibrary::getStandardVertexShader(),
+            Pina::ShaderLibrary::getStandardFragmentShader()
+        );
+        m_instancedShader = getDevice()->createShader();
+        m_instancedShader->load(
+            Pina::ShaderLibrary::getStandardInstancedVertexShader(),
+            Pina::ShaderLibrary::getStandardFragmentShader()
+        );
+
+        m_renderer = Pina::MAKE_UNIQUE<Pina::SceneRenderer>(getDevice());
+        m_renderer->setInstancedShader(m_instancedShader.get());
+        m_renderer->setJobSystem(getJobSystem());
+
+        std::cout << "=== Instancing Sample ===" << std::endl;
+        std::cout << "Trees: " << TreeCount << " (" << TreeCount * 2 << " nodes)" << std::endl;
+        std::cout << "Controls:" << std::endl;
+        std::cout << "  I - Toggle instancing" << std::endl;
+        std::cout << "  F - Toggle frustum culling" << std::endl;
+        std::cout << "  Space - Pause camera" << std::endl;
+        std::cout << "  Escape - Quit" << std::endl;
+        std::cout << "=========================" << std::endl;
+    }
+
+    /// Trees with a trunk and a crown; every trunk shares the first trunk's
+    /// mesh and material (and likewise for crowns), so each set is one batch
+    void createForest() {
+        Pina::Material bark = Pina::Material::createMatte(Pina::Color(0.4f, 0.26f, 0.13f));
+        Pina::Material leaves = Pina::Material::createMatte(Pina::Color(0.2f, 0.55f, 0.2f));
+
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> position(-ForestSize * 0.5f, ForestSize * 0.5f);
+        std::uniform_real_distribution<float> height(1.5f, 4.0f);
+        std::uniform_real_distribution<float> shade(0.7f, 1.1f);
+
+        Pina::StaticMesh* trunkMesh = nullptr;
+        Pina::StaticMesh* crownMesh = nullptr;
+        for (int i = 0; i < TreeCount; ++i) {
+            Pina::Node* tree = m_scene.createNode("Tree");
+            float h = height(rng);
+            tree->getTransform().setLocalPosition(position(rng), 0.0f, position(rng));
+
+            Pina::Node* trunk = nullptr;
+            Pina::Node* crown = nullptr;
+            if (!trunkMesh) {
+                trunk = m_scene.createCube("Trunk", 1.0f);
+                crown = m_scene.createSphere("Crown", 0.5f, 12);
+                trunkMesh = trunk->getMesh();
+                crownMesh = crown->getMesh();
+                trunk->setParent(tree);
+                crown->setParent(tree);
+            } else {
+                trunk = m_scene.createNode("Trunk", tree);
+                crown = m_scene.createNode("Crown", tree);
+                trunk->setMesh(trunkMesh);
+                crown->setMesh(crownMesh);
+            }
+            trunk->setMaterial(bark);
+            trunk->getTransform().setLocalPosition(0.0f, h * 0.25f, 0.0f);
+            trunk->getTransform().setLocalScale(0.2f, h * 0.5f, 0.2f);
+
+            // Per-tree shade through the tint, so crowns stay one batch
+            crown->setMaterial(leaves);
+            crown->setTint(Pina::Color(shade(rng), shade(rng), shade(rng)));
+            crown->getTransform().setLocalPosition(0.0f, h * 0.65f, 0.0f);
+            crown->getTransform().setLocalScale(h * 0.6f, h * 0.7f, h * 0.6f);
+        }
+    }
+
+    void onUpdate(float deltaTime) override {
+        auto* input = getInput();
+        if (!input) return;
+
+        if (input->isKeyPressed(Pina::Key::Escape)) {
+            quit();
+            return;
+        }
+
+        if (input->isKeyPressed(Pina::Key::I)) {
+            bool enabled = m_renderer->getInstancedShader() == nullptr;
+            m_renderer->setInstancedShader(enabled ? m_instancedShader.get() : nullptr);
+            std::cout << "Instancing: " << (enabled ? "ON" : "OFF") << std::endl;
+        }
+        if (input->isKeyPressed(Pina::Key::F)) {
+            m_renderer->setFrustumCulling(!m_renderer->getFrustumCulling());
+            std::cout << "Frustum culling: " << (m_renderer->getFrustumCulling() ? "ON" : "OFF") << std::endl;
+        }
+        if (input->isKeyPressed(Pina::Key::Space)) {
+            m_paused = !m_paused;
+        }
+
+        // Circle over the forest, looking at its center
+        if (!m_paused) {
+            m_cameraAngle += deltaTime * 0.1f;
+        }
+        if (auto* camera = m_scene.getActiveCamera()) {
+            float radius = ForestSize * 0.6f;
+            glm::vec3 position(cos(m_cameraAngle) * radius, ForestSize * 0.15f, sin(m_cameraAngle) * radius);
+            camera->lookAt(position, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        }
+
+        m_frameTime = deltaTime;
+        m_scene.update(deltaTime);
+    }
+
+    void onRender() override {
+        getDevice()->beginFrame();
+        getDevice()->clear(
+            m_config.clearColor.r,
+            m_config.clearColor.g,
+            m_config.clearColor.b
+        );
+
+        m_renderer->render(&m_scene, m_shader.get());
+
+        getDevice()->endFrame();
+    }
+
+    void onRenderUI() override {
+        using namespace Pina::Widgets;
+
+        const Pina::RenderQueueStats& stats = m_renderer->getQueueStats();
+        bool instancing = m_renderer->getInstancedShader() != nullptr;
+
+        setNextWindowSize(Pina::Vector2(260, 0));
+        Window window("Instancing", nullptr, Pina::UIWindowFlags::AlwaysAutoResize);
+        if (window) {
+            char buf[128];
+            Text(instancing ? Pina::Color::green() : Pina::Color::gray(),
+                 instancing ? "[I] Instancing ON" : "[I] Instancing OFF");
+            Separator();
+
+            snprintf(buf, sizeof(buf), "Frame: %.2f ms", m_frameTime * 1000.0f);
+            Text{buf};
+            snprintf(buf, sizeof(buf), "Visible nodes: %zu", m_renderer->getVisibleNodeCount());
+            Text{buf};
+            snprintf(buf, sizeof(buf), "Draw calls: %u (%u instanced)", stats.drawCalls, stats.instancedDrawCalls);
+            Text{buf};
+            snprintf(buf, sizeof(buf), "Instances: %u of %u draws", stats.instances, stats.items);
+            Text{buf};
+            snprintf(buf, sizeof(buf), "Matrix uploads: %u", stats.transformChanges);
+            Text{buf};
+            snprintf(buf, sizeof(buf), "Material uploads: %u", stats.materialChanges);
+            Text{buf};
+        }
+    }
+
+    void onResize(int width, int height) override {
+        getDevice()->setViewport(0, 0, width, height);
+        if (auto* camera = m_scene.getActiveCamera()) {
+            camera->setAspectRatio(static_cast<float>(width) / static_cast<float>(height));
+        }
+    }
+
+    void onShutdown() override {
+        m_renderer.reset();
+        m_instancedShader.reset();
+        m_shader.reset();
+    }
+
+private:
+    static constexpr int TreeCount = 20000;
+    static constexpr float ForestSize = 400.0f;
+
+    Pina::Scene m_scene;
+    Pina::UNIQUE<Pina::Shader> m_shader;
+    Pina::UNIQUE<Pina::Shader> m_instancedShader;
+    Pina::UNIQUE<Pina::SceneRenderer> m_renderer;
+
+    float m_cameraAngle = 0.0f;
+    float m_frameTime = 0.0f;
+    bool m_paused = false;
+};
+
+PINA_APPLICATION(InstancingSample)
@@ -75,6 +75,7 @@ protected:
         m_pipeline->setClearColor(m_config.clearColor);
         m_pipeline->setShadowsEnabled(m_shadowsEnabled);
         m_pipeline->setPBREnabled(m_usePBR);
+        m_pipeline->setJobSystem(getJobSystem());
 
         std::cout << "=== Model Sample ===" << std::endl;
         std::cout << "Controls:" << std::endl;
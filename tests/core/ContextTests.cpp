@@ -0,0 +1,364 @@
+/// Context Tests
+/// Tests for Core/Context subsystem registry, type IDs, lifecycle order and scheduling
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+std::vector<std::string> s_lifecycleLog;
+
+class AlphaSubsystem : public Subsystem {
+public:
+    void initialize() override { s_lifecycleLog.push_back("init Alpha"); }
+    void update(float deltaTime) override { (void)deltaTime; s_lifecycleLog.push_back("update Alpha"); }
+    void shutdown() override { s_lifecycleLog.push_back("shutdown Alpha"); }
+};
+
+class BetaSubsystem : public Subsystem {
+public:
+    void initialize() override { s_lifecycleLog.push_back("init Beta"); }
+    void update(float deltaTime) override { (void)deltaTime; s_lifecycleLog.push_back("update Beta"); }
+    void shutdown() override { s_lifecycleLog.push_back("shutdown Beta"); }
+};
+
+class GammaSubsystem : public Subsystem {
+public:
+    virtual int getValue() const { return 1; }
+};
+
+class CustomGamma : public GammaSubsystem {
+public:
+    int getValue() const override { return 2; }
+};
+
+// Subsystems with declared dependencies (may run on job workers)
+std::mutex s_scheduleMutex;
+std::vector<std::string> s_scheduleLog;
+
+void logSchedule(const std::string& entry) {
+    std::lock_guard<std::mutex> lock(s_scheduleMutex);
+    s_scheduleLog.push_back(entry);
+}
+
+class SharedResource : public Subsystem {};
+
+template<int N>
+class IndependentSubsystem : public Subsystem {
+public:
+    void initialize() override {
+        auto* jobs = getSubsystem<JobSystem>();
+        jobsRunningAtInit = jobs && jobs->isRunning();
+        initCount++;
+    }
+    void update(float deltaTime) override { (void)deltaTime; updateCount++; }
+    void declareDependencies(SubsystemDependencies& deps) const override { (void)deps; }
+
+    std::atomic<int> initCount{0};
+    std::atomic<int> updateCount{0};
+    bool jobsRunningAtInit = false;
+};
+
+class PreSubsystem : public Subsystem {
+public:
+    void update(float deltaTime) override { (void)deltaTime; logSchedule("Pre"); }
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.phase(SubsystemPhase::PreUpdate); }
+};
+
+class MidSubsystem : public Subsystem {
+public:
+    void update(float deltaTime) override { (void)deltaTime; logSchedule("Mid"); }
+    void declareDependencies(SubsystemDependencies& deps) const override { (void)deps; }
+};
+
+class PostSubsystem : public Subsystem {
+public:
+    void update(float deltaTime) override { (void)deltaTime; logSchedule("Post"); }
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.phase(SubsystemPhase::PostUpdate); }
+};
+
+class ProducerSubsystem : public Subsystem {
+public:
+    void update(float deltaTime) override { (void)deltaTime; logSchedule("Producer"); }
+    void declareDependencies(SubsystemDependencies& deps) const override { (void)deps; }
+};
+
+class ConsumerSubsystem : public Subsystem {
+public:
+    void update(float deltaTime) override { (void)deltaTime; logSchedule("Consumer"); }
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.reads<ProducerSubsystem>(); }
+};
+
+template<int N>
+class SharedWriter : public Subsystem {
+public:
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.writes<SharedResource>(); }
+};
+
+class CycleB;
+
+class CycleA : public Subsystem {
+public:
+    void update(float deltaTime) override { (void)deltaTime; logSchedule("A"); }
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.reads<CycleB>(); }
+};
+
+class CycleB : public Subsystem {
+public:
+    void update(float deltaTime) override { (void)deltaTime; logSchedule("B"); }
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.reads<CycleA>(); }
+};
+
+class MainThreadSubsystem : public Subsystem {
+public:
+    void initialize() override { initThread = std::this_thread::get_id(); }
+    void update(float deltaTime) override { (void)deltaTime; updateThread = std::this_thread::get_id(); }
+    void declareDependencies(SubsystemDependencies& deps) const override { deps.mainThread(); }
+
+    std::thread::id initThread;
+    std::thread::id updateThread;
+};
+
+JobSystem* createJobSystem(Context& context, uint32_t workers) {
+    JobSystemConfig config;
+    config.workerCount = workers;
+    auto* jobs = new JobSystem(config);
+    context.registerSubsystem<JobSystem>(jobs);
+    return jobs;
+}
+
+} // namespace
+
+// Test type IDs are dense, stable and distinct
+TEST(ContextTest, SubsystemIDs) {
+    SubsystemID alpha = Context::getSubsystemID<AlphaSubsystem>();
+    SubsystemID beta = Context::getSubsystemID<BetaSubsystem>();
+
+    EXPECT_NE(alpha, beta);
+    EXPECT_EQ(Context::getSubsystemID<AlphaSubsystem>(), alpha);
+    EXPECT_LT(alpha, Context::getSubsystemTypeCount());
+    EXPECT_LT(beta, Context::getSubsystemTypeCount());
+}
+
+// Test lookup by type
+TEST(ContextTest, GetSubsystem) {
+    Context context;
+    EXPECT_EQ(context.getSubsystem<AlphaSubsystem>(), nullptr);
+
+    auto* alpha = context.createSubsystem<AlphaSubsystem>();
+    EXPECT_EQ(context.getSubsystem<AlphaSubsystem>(), alpha);
+    EXPECT_EQ(alpha->getContext(), &context);
+    EXPECT_TRUE(context.hasSubsystem<AlphaSubsystem>());
+    EXPECT_FALSE(context.hasSubsystem<BetaSubsystem>());
+    EXPECT_EQ(context.getSubsystemCount(), 1u);
+
+    // Subsystems can find each other
+    auto* beta = context.createSubsystem<BetaSubsystem>();
+    EXPECT_EQ(beta->getSubsystem<AlphaSubsystem>(), alpha);
+}
+
+// Test subsystems are named by their readable type name (profile scopes)
+TEST(ContextTest, SubsystemNames) {
+    Context context;
+    EXPECT_EQ(context.getSubsystemName<JobSystem>(), nullptr);
+
+    context.registerSubsystem<JobSystem>(new JobSystem());
+    context.registerSubsystem<AlphaSubsystem>(new AlphaSubsystem());
+    EXPECT_STREQ(context.getSubsystemName<JobSystem>(), "Pina::JobSystem");
+    EXPECT_EQ(context.getSubsystemName<JobSystem>(), Profiler::intern("Pina::JobSystem"));
+    EXPECT_NE(std::string(context.getSubsystemName<AlphaSubsystem>()).find("AlphaSubsystem"), std::string::npos);
+}
+
+// Test lifecycle runs in registration order and shutdown in reverse
+TEST(ContextTest, LifecycleOrder) {
+    s_lifecycleLog.clear();
+
+    {
+        Context context;
+        context.createSubsystem<BetaSubsystem>();
+        context.createSubsystem<AlphaSubsystem>();
+
+        context.initializeSubsystems();
+        context.updateSubsystems(0.016f);
+        context.shutdownSubsystems();
+        EXPECT_EQ(context.getSubsystemCount(), 0u);
+        EXPECT_EQ(context.getSubsystem<AlphaSubsystem>(), nullptr);
+    }
+
+    std::vector<std::string> expected = {
+        "init Beta", "init Alpha",
+        "update Beta", "update Alpha",
+        "shutdown Alpha", "shutdown Beta"
+    };
+    EXPECT_EQ(s_lifecycleLog, expected);
+}
+
+// Test removing a subsystem shuts it down and drops it from updates
+TEST(ContextTest, RemoveSubsystem) {
+    s_lifecycleLog.clear();
+
+    Context context;
+    context.createSubsystem<AlphaSubsystem>();
+    context.createSubsystem<BetaSubsystem>();
+
+    context.removeSubsystem<AlphaSubsystem>();
+    EXPECT_FALSE(context.hasSubsystem<AlphaSubsystem>());
+    EXPECT_EQ(context.getSubsystemCount(), 1u);
+
+    s_lifecycleLog.clear();
+    context.updateSubsystems(0.016f);
+    EXPECT_EQ(s_lifecycleLog, std::vector<std::string>{ "update Beta" });
+
+    // Removing again is a no-op
+    context.removeSubsystem<AlphaSubsystem>();
+    context.shutdownSubsystems();
+}
+
+// Test factory overrides still resolve to the interface slot
+TEST(ContextTest, FactoryOverride) {
+    Context::registerFactory<GammaSubsystem, CustomGamma>();
+    EXPECT_TRUE(Context::hasFactory<GammaSubsystem>());
+
+    Context context;
+    auto* gamma = context.createSubsystem<GammaSubsystem>();
+    EXPECT_EQ(gamma->getValue(), 2);
+    EXPECT_EQ(context.getSubsystem<GammaSubsystem>(), gamma);
+    EXPECT_EQ(context.getSubsystem<CustomGamma>(), nullptr);
+
+    Context::clearFactories();
+    EXPECT_FALSE(Context::hasFactory<GammaSubsystem>());
+}
+
+// Test re-registering a type replaces the instance in place
+TEST(ContextTest, ReplaceSubsystem) {
+    Context context;
+    context.createSubsystem<AlphaSubsystem>();
+    context.createSubsystem<BetaSubsystem>();
+
+    auto* replacement = new AlphaSubsystem();
+    context.registerSubsystem<AlphaSubsystem>(replacement);
+    EXPECT_EQ(context.getSubsystem<AlphaSubsystem>(), replacement);
+    EXPECT_EQ(context.getSubsystemCount(), 2u);
+
+    s_lifecycleLog.clear();
+    context.updateSubsystems(0.016f);
+    std::vector<std::string> expected = { "update Alpha", "update Beta" };
+    EXPECT_EQ(s_lifecycleLog, expected);
+}
+
+// Test phases run in order regardless of registration order
+TEST(ContextTest, PhaseOrder) {
+    s_scheduleLog.clear();
+
+    Context context;
+    context.createSubsystem<PostSubsystem>();
+    context.createSubsystem<MidSubsystem>();
+    context.createSubsystem<PreSubsystem>();
+    context.updateSubsystems(0.016f);
+
+    std::vector<std::string> expected = { "Pre", "Mid", "Post" };
+    EXPECT_EQ(s_scheduleLog, expected);
+}
+
+// Test readers update after what they read, even when registered first
+TEST(ContextTest, ReadsOrdering) {
+    s_scheduleLog.clear();
+
+    Context context;
+    createJobSystem(context, 2);
+    context.createSubsystem<ConsumerSubsystem>();
+    context.createSubsystem<ProducerSubsystem>();
+    context.initializeSubsystems();
+
+    EXPECT_EQ(context.getUpdateStepCount(SubsystemPhase::Update), 2u);
+    for (int frame = 0; frame < 10; ++frame) {
+        s_scheduleLog.clear();
+        context.updateSubsystems(0.016f);
+        std::vector<std::string> expected = { "Producer", "Consumer" };
+        ASSERT_EQ(s_scheduleLog, expected);
+    }
+}
+
+// Test independent subsystems share a step and update in parallel
+TEST(ContextTest, IndependentSubsystemsParallel) {
+    Context context;
+    createJobSystem(context, 2);
+    auto* a = context.createSubsystem<IndependentSubsystem<0>>();
+    auto* b = context.createSubsystem<IndependentSubsystem<1>>();
+    auto* c = context.createSubsystem<IndependentSubsystem<2>>();
+    auto* d = context.createSubsystem<IndependentSubsystem<3>>();
+
+    // Job system (main thread) and the four independent subsystems share one step
+    EXPECT_EQ(context.getUpdateStepCount(SubsystemPhase::Update), 1u);
+
+    context.initializeSubsystems();
+    EXPECT_EQ(a->initCount.load(), 1);
+    EXPECT_EQ(d->initCount.load(), 1);
+    EXPECT_TRUE(a->jobsRunningAtInit);
+    EXPECT_TRUE(d->jobsRunningAtInit);
+
+    for (int frame = 0; frame < 100; ++frame) {
+        context.updateSubsystems(0.016f);
+    }
+    EXPECT_EQ(a->updateCount.load(), 100);
+    EXPECT_EQ(b->updateCount.load(), 100);
+    EXPECT_EQ(c->updateCount.load(), 100);
+    EXPECT_EQ(d->updateCount.load(), 100);
+
+    context.shutdownSubsystems();
+}
+
+// Test subsystems writing the same data are serialized
+TEST(ContextTest, WriteConflicts) {
+    Context context;
+    context.createSubsystem<SharedWriter<0>>();
+    context.createSubsystem<SharedWriter<1>>();
+    context.createSubsystem<IndependentSubsystem<4>>();
+
+    EXPECT_EQ(context.getUpdateStepCount(SubsystemPhase::Update), 2u);
+
+    // Exclusive (undeclared) subsystems get a step of their own
+    context.createSubsystem<AlphaSubsystem>();
+    EXPECT_EQ(context.getUpdateStepCount(SubsystemPhase::Update), 3u);
+}
+
+// Test main-thread subsystems stay on the calling thread
+TEST(ContextTest, MainThreadSubsystems) {
+    Context context;
+    createJobSystem(context, 2);
+    context.createSubsystem<IndependentSubsystem<5>>();
+    context.createSubsystem<IndependentSubsystem<6>>();
+    auto* main = context.createSubsystem<MainThreadSubsystem>();
+
+    context.initializeSubsystems();
+    context.updateSubsystems(0.016f);
+
+    EXPECT_EQ(main->initThread, std::this_thread::get_id());
+    EXPECT_EQ(main->updateThread, std::this_thread::get_id());
+    context.shutdownSubsystems();
+}
+
+// Test dependency cycles fall back to registration order
+TEST(ContextTest, CycleFallsBack) {
+    s_scheduleLog.clear();
+
+    Context context;
+    context.createSubsystem<CycleA>();
+    context.createSubsystem<CycleB>();
+    context.updateSubsystems(0.016f);
+
+    std::vector<std::string> expected = { "A", "B" };
+    EXPECT_EQ(s_scheduleLog, expected);
+    EXPECT_EQ(context.getUpdateStepCount(SubsystemPhase::Update), 2u);
+}
+
+} // namespace Tests
+} // namespace Pina
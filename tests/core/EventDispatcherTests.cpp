@@ -0,0 +1,613 @@
+/// Event Dispatcher Tests
+/// Tests for Core/EventDispatcher queuing and Core/EventQueue in-place storage
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+/// Event larger than an inline slot (forces the heap fallback)
+class LargeTestEvent : public EventBase<LargeTestEvent> {
+public:
+    explicit LargeTestEvent(int v) : value(v) {}
+
+    int value;
+    char payload[EventQueue::SlotSize * 2] = {};
+
+    EventCategory getCategories() const override { return EventCategory::Application; }
+    const char* getName() const override { return "LargeTestEvent"; }
+};
+
+/// Event that counts live instances
+class CountedTestEvent : public EventBase<CountedTestEvent> {
+public:
+    CountedTestEvent() { s_live++; }
+    CountedTestEvent(const CountedTestEvent&) : EventBase<CountedTestEvent>() { s_live++; }
+    ~CountedTestEvent() override { s_live--; }
+
+    EventCategory getCategories() const override { return EventCategory::Application; }
+    const char* getName() const override { return "CountedTestEvent"; }
+
+    static inline int s_live = 0;
+};
+
+/// Event tagged with its producer thread and per-producer sequence number
+class ProducerTestEvent : public EventBase<ProducerTestEvent> {
+public:
+    ProducerTestEvent(uint32_t p, uint32_t s) : producer(p), sequence(s) {}
+
+    uint32_t producer;
+    uint32_t sequence;
+
+    EventCategory getCategories() const override { return EventCategory::Application; }
+    const char* getName() const override { return "ProducerTestEvent"; }
+};
+
+} // namespace
+
+// Test queued events are delivered in FIFO order by processQueue
+TEST(EventDispatcherTest, QueuePreservesOrder) {
+    EventDispatcher dispatcher;
+    std::vector<int> widths;
+    dispatcher.subscribe<WindowResizeEvent>([&](WindowResizeEvent& e) {
+        widths.push_back(e.width);
+    });
+
+    for (int i = 0; i < 10; ++i) {
+        dispatcher.queue(WindowResizeEvent(i, 0));
+    }
+    EXPECT_EQ(dispatcher.getQueueSize(), 10u);
+    EXPECT_TRUE(widths.empty());
+
+    dispatcher.processQueue();
+    ASSERT_EQ(widths.size(), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(widths[i], i);
+    }
+    EXPECT_EQ(dispatcher.getQueueSize(), 0u);
+}
+
+// Test mixed event types are dispatched to their own handlers
+TEST(EventDispatcherTest, QueueMixedTypes) {
+    EventDispatcher dispatcher;
+    std::vector<const char*> names;
+    dispatcher.subscribe<KeyPressedEvent>([&](KeyPressedEvent& e) { names.push_back(e.getName()); });
+    dispatcher.subscribe<MouseMovedEvent>([&](MouseMovedEvent& e) { names.push_back(e.getName()); });
+
+    dispatcher.queue(KeyPressedEvent(Key::A, KeyModifier::None));
+    dispatcher.queue(MouseMovedEvent(glm::vec2(1.0f), glm::vec2(0.0f)));
+    dispatcher.queue(KeyPressedEvent(Key::B, KeyModifier::None));
+    dispatcher.processQueue();
+
+    ASSERT_EQ(names.size(), 3u);
+    EXPECT_STREQ(names[0], "KeyPressedEvent");
+    EXPECT_STREQ(names[1], "MouseMovedEvent");
+    EXPECT_STREQ(names[2], "KeyPressedEvent");
+}
+
+// Test the oldest events are dropped once the max queue size is reached
+TEST(EventDispatcherTest, MaxQueueSizeDropsOldest) {
+    EventDispatcher dispatcher;
+    dispatcher.setMaxQueueSize(4);
+
+    std::vector<int> widths;
+    dispatcher.subscribe<WindowResizeEvent>([&](WindowResizeEvent& e) {
+        widths.push_back(e.width);
+    });
+
+    for (int i = 0; i < 10; ++i) {
+        dispatcher.queue(WindowResizeEvent(i, 0));
+    }
+    EXPECT_EQ(dispatcher.getQueueSize(), 4u);
+    EXPECT_EQ(dispatcher.getDroppedEventCount(), 6u);
+
+    dispatcher.processQueue();
+    EXPECT_EQ(widths, (std::vector<int>{6, 7, 8, 9}));
+}
+
+// Test shrinking the max queue size trims pending events
+TEST(EventDispatcherTest, ShrinkMaxQueueSize) {
+    EventDispatcher dispatcher;
+    std::vector<int> widths;
+    dispatcher.subscribe<WindowResizeEvent>([&](WindowResizeEvent& e) {
+        widths.push_back(e.width);
+    });
+
+    for (int i = 0; i < 8; ++i) {
+        dispatcher.queue(WindowResizeEvent(i, 0));
+    }
+    dispatcher.setMaxQueueSize(3);
+    EXPECT_EQ(dispatcher.getQueueSize(), 3u);
+
+    // Grows again once drained
+    dispatcher.processQueue();
+    dispatcher.setMaxQueueSize(16);
+    for (int i = 0; i < 16; ++i) {
+        dispatcher.queue(WindowResizeEvent(100 + i, 0));
+    }
+    EXPECT_EQ(dispatcher.getQueueSize(), 16u);
+
+    dispatcher.processQueue();
+    ASSERT_EQ(widths.size(), 19u);
+    EXPECT_EQ(widths[0], 5);
+    EXPECT_EQ(widths[3], 100);
+}
+
+// Test a zero max queue size drops every event
+TEST(EventDispatcherTest, ZeroMaxQueueSize) {
+    EventDispatcher dispatcher;
+    dispatcher.setMaxQueueSize(0);
+
+    int count = 0;
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { count++; });
+    dispatcher.queue(WindowCloseEvent());
+    dispatcher.processQueue();
+
+    EXPECT_EQ(count, 0);
+    EXPECT_EQ(dispatcher.getDroppedEventCount(), 1u);
+}
+
+// Test events queued from handlers are processed in the same call
+TEST(EventDispatcherTest, QueueFromHandler) {
+    EventDispatcher dispatcher;
+    std::vector<int> widths;
+    dispatcher.subscribe<WindowResizeEvent>([&](WindowResizeEvent& e) {
+        widths.push_back(e.width);
+        if (e.width < 3) {
+            dispatcher.queue(WindowResizeEvent(e.width + 1, 0));
+        }
+    });
+
+    dispatcher.queue(WindowResizeEvent(0, 0));
+    dispatcher.processQueue();
+
+    EXPECT_EQ(widths, (std::vector<int>{0, 1, 2, 3}));
+    EXPECT_EQ(dispatcher.getQueueSize(), 0u);
+}
+
+// Test a handler overflowing the queue does not invalidate the event being dispatched
+TEST(EventDispatcherTest, OverflowFromHandler) {
+    EventDispatcher dispatcher;
+    dispatcher.setMaxQueueSize(2);
+
+    std::vector<int> widths;
+    dispatcher.subscribe<WindowResizeEvent>([&](WindowResizeEvent& e) {
+        if (e.width == 0) {
+            for (int i = 1; i <= 5; ++i) {
+                dispatcher.queue(WindowResizeEvent(i, 0));
+            }
+        }
+        widths.push_back(e.width);
+    });
+
+    dispatcher.queue(WindowResizeEvent(0, 0));
+    dispatcher.processQueue();
+
+    EXPECT_EQ(widths, (std::vector<int>{0, 4, 5}));
+    EXPECT_EQ(dispatcher.getDroppedEventCount(), 3u);
+}
+
+// Test clearQueue from a handler discards the remaining events
+TEST(EventDispatcherTest, ClearQueueFromHandler) {
+    EventDispatcher dispatcher;
+    std::vector<int> widths;
+    dispatcher.subscribe<WindowResizeEvent>([&](WindowResizeEvent& e) {
+        widths.push_back(e.width);
+        if (e.width == 1) {
+            dispatcher.clearQueue();
+        }
+    });
+
+    for (int i = 0; i < 4; ++i) {
+        dispatcher.queue(WindowResizeEvent(i, 0));
+    }
+    dispatcher.processQueue();
+
+    EXPECT_EQ(widths, (std::vector<int>{0, 1}));
+    EXPECT_EQ(dispatcher.getQueueSize(), 0u);
+}
+
+// Test events larger than a slot fall back to the heap
+TEST(EventDispatcherTest, LargeEventFallback) {
+    static_assert(!EventQueue::storesInline<LargeTestEvent>(), "LargeTestEvent must not fit a slot");
+    static_assert(EventQueue::storesInline<MouseMovedEvent>(), "Input events must fit a slot");
+
+    EventDispatcher dispatcher;
+    std::vector<int> values;
+    dispatcher.subscribe<LargeTestEvent>([&](LargeTestEvent& e) { values.push_back(e.value); });
+
+    dispatcher.queue(LargeTestEvent(1));
+    dispatcher.queue(WindowCloseEvent());
+    dispatcher.queue(LargeTestEvent(2));
+    dispatcher.processQueue();
+
+    EXPECT_EQ(values, (std::vector<int>{1, 2}));
+}
+
+// Test queued events are destroyed when processed, dropped, cleared or destroyed
+TEST(EventDispatcherTest, QueuedEventsDestroyed) {
+    CountedTestEvent::s_live = 0;
+    {
+        CountedTestEvent event;
+        EventDispatcher dispatcher;
+        dispatcher.setMaxQueueSize(3);
+
+        dispatcher.queue(event);
+        dispatcher.queue(event);
+        EXPECT_EQ(CountedTestEvent::s_live, 3);
+        dispatcher.processQueue();
+        EXPECT_EQ(CountedTestEvent::s_live, 1);
+
+        for (int i = 0; i < 5; ++i) {
+            dispatcher.queue(event);
+        }
+        EXPECT_EQ(CountedTestEvent::s_live, 4);
+        dispatcher.clearQueue();
+        EXPECT_EQ(CountedTestEvent::s_live, 1);
+
+        dispatcher.queue(event);
+        dispatcher.queue(event);
+    }
+    EXPECT_EQ(CountedTestEvent::s_live, 0);
+}
+
+// Test steady-state queue and process does not allocate
+TEST(EventDispatcherTest, NoAllocationsAfterWarmUp) {
+    EventDispatcher dispatcher;
+    int count = 0;
+    dispatcher.subscribe<MouseMovedEvent>([&](MouseMovedEvent&) { count++; });
+
+    // First frame allocates the ring buffers
+    dispatcher.queue(MouseMovedEvent(glm::vec2(0.0f), glm::vec2(0.0f)));
+    dispatcher.processQueue();
+
+    uint64_t before = MemoryTracker::getStats(MemoryTag::Events).totalAllocations;
+    for (int frame = 0; frame < 10; ++frame) {
+        for (int i = 0; i < 500; ++i) {
+            dispatcher.queue(MouseMovedEvent(glm::vec2(float(i)), glm::vec2(1.0f)));
+        }
+        dispatcher.processQueue();
+    }
+
+    EXPECT_EQ(count, 5001);
+    EXPECT_EQ(MemoryTracker::getStats(MemoryTag::Events).totalAllocations, before);
+}
+
+// Test events posted from any thread are dispatched by processQueue
+TEST(EventDispatcherTest, QueueFromAnyThread) {
+    EventDispatcher dispatcher;
+    std::vector<uint32_t> sequences;
+    dispatcher.subscribe<ProducerTestEvent>([&](ProducerTestEvent& e) {
+        sequences.push_back(e.sequence);
+    });
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < 100; ++i) {
+            EXPECT_TRUE(dispatcher.queueFromAnyThread(ProducerTestEvent(0, i)));
+        }
+    });
+    producer.join();
+    EXPECT_TRUE(sequences.empty());
+    EXPECT_EQ(dispatcher.getQueueSize(), 100u);
+
+    dispatcher.update(0.016f);
+    ASSERT_EQ(sequences.size(), 100u);
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(sequences[i], i);
+    }
+    EXPECT_EQ(dispatcher.getQueueSize(), 0u);
+}
+
+// Test the concurrent queue is bounded and drops new events when full
+TEST(EventDispatcherTest, QueueFromAnyThreadBounded) {
+    EventDispatcher dispatcher(8);
+    int count = 0;
+    dispatcher.subscribe<ProducerTestEvent>([&](ProducerTestEvent&) { count++; });
+
+    int accepted = 0;
+    for (uint32_t i = 0; i < 20; ++i) {
+        if (dispatcher.queueFromAnyThread(ProducerTestEvent(0, i))) {
+            accepted++;
+        }
+    }
+    EXPECT_EQ(accepted, 8);
+    EXPECT_EQ(dispatcher.getDroppedEventCount(), 12u);
+
+    // Slots are reused after draining
+    dispatcher.processQueue();
+    EXPECT_EQ(count, 8);
+    EXPECT_TRUE(dispatcher.queueFromAnyThread(ProducerTestEvent(0, 20)));
+    dispatcher.processQueue();
+    EXPECT_EQ(count, 9);
+}
+
+// Test many producers with a draining main thread keep per-producer order
+TEST(EventDispatcherTest, QueueFromAnyThreadStress) {
+    constexpr uint32_t kProducers = 8;
+    constexpr uint32_t kEventsPerProducer = 20000;
+
+    EventDispatcher dispatcher(256);
+    std::vector<uint32_t> nextSequence(kProducers, 0);
+    uint32_t outOfOrder = 0;
+    uint32_t largeEvents = 0;
+    dispatcher.subscribe<ProducerTestEvent>([&](ProducerTestEvent& e) {
+        if (e.sequence != nextSequence[e.producer]) {
+            outOfOrder++;
+        }
+        nextSequence[e.producer] = e.sequence + 1;
+    });
+    dispatcher.subscribe<LargeTestEvent>([&](LargeTestEvent&) { largeEvents++; });
+
+    std::atomic<uint32_t> finished{0};
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < kEventsPerProducer; ++i) {
+                // Retry when full so every event is delivered
+                while (!dispatcher.queueFromAnyThread(ProducerTestEvent(p, i))) {
+                    std::this_thread::yield();
+                }
+                if (i % 1000 == 0) {
+                    while (!dispatcher.queueFromAnyThread(LargeTestEvent(static_cast<int>(i)))) {
+                        std::this_thread::yield();
+                    }
+                }
+            }
+            finished.fetch_add(1);
+        });
+    }
+
+    while (finished.load() < kProducers || dispatcher.getQueueSize() > 0) {
+        dispatcher.update(0.016f);
+        std::this_thread::yield();
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(outOfOrder, 0u);
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        EXPECT_EQ(nextSequence[p], kEventsPerProducer);
+    }
+    EXPECT_EQ(largeEvents, kProducers * (kEventsPerProducer / 1000));
+}
+
+// Test producers that never retry account for every event as dispatched or dropped
+TEST(EventDispatcherTest, QueueFromAnyThreadDropAccounting) {
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kEventsPerProducer = 10000;
+
+    EventDispatcher dispatcher(64);
+    uint64_t received = 0;
+    std::vector<int64_t> lastSequence(kProducers, -1);
+    uint32_t outOfOrder = 0;
+    dispatcher.subscribe<ProducerTestEvent>([&](ProducerTestEvent& e) {
+        // Drops leave gaps but never reorder a producer's events
+        if (static_cast<int64_t>(e.sequence) <= lastSequence[e.producer]) {
+            outOfOrder++;
+        }
+        lastSequence[e.producer] = e.sequence;
+        received++;
+    });
+
+    std::atomic<uint32_t> finished{0};
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&, p]() {
+            for (uint32_t i = 0; i < kEventsPerProducer; ++i) {
+                dispatcher.queueFromAnyThread(ProducerTestEvent(p, i));
+            }
+            finished.fetch_add(1);
+        });
+    }
+
+    while (finished.load() < kProducers) {
+        dispatcher.processQueue();
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    dispatcher.processQueue();
+
+    EXPECT_EQ(outOfOrder, 0u);
+    EXPECT_EQ(received + dispatcher.getDroppedEventCount(), kProducers * kEventsPerProducer);
+}
+
+// Test a handler reposting from the main thread cannot stall processQueue
+TEST(EventDispatcherTest, QueueFromAnyThreadRepostFromHandler) {
+    EventDispatcher dispatcher(16);
+    int count = 0;
+    dispatcher.subscribe<ProducerTestEvent>([&](ProducerTestEvent& e) {
+        count++;
+        dispatcher.queueFromAnyThread(ProducerTestEvent(0, e.sequence + 1));
+    });
+
+    dispatcher.queueFromAnyThread(ProducerTestEvent(0, 0));
+    dispatcher.processQueue();
+
+    EXPECT_LE(count, 16);
+    EXPECT_EQ(dispatcher.getQueueSize(), 1u);
+}
+
+// Test handlers run in priority order, ties in subscription order
+TEST(EventDispatcherTest, PriorityOrder) {
+    EventDispatcher dispatcher;
+    std::vector<int> calls;
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { calls.push_back(0); }, EventPriority::Low);
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { calls.push_back(1); }, EventPriority::High);
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { calls.push_back(2); });
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { calls.push_back(3); }, EventPriority::High);
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { calls.push_back(4); }, EventPriority::Highest);
+
+    WindowCloseEvent event;
+    EXPECT_FALSE(dispatcher.dispatch(event));
+    EXPECT_EQ(calls, (std::vector<int>{4, 1, 3, 2, 0}));
+}
+
+// Test a consuming handler stops lower priority handlers
+TEST(EventDispatcherTest, ConsumeStopsPropagation) {
+    EventDispatcher dispatcher;
+    int lowCalls = 0;
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { lowCalls++; }, EventPriority::Low);
+    dispatcher.subscribe<WindowCloseEvent>([](WindowCloseEvent& e) { e.consume(); }, EventPriority::High);
+
+    WindowCloseEvent event;
+    EXPECT_TRUE(dispatcher.dispatch(event));
+    EXPECT_EQ(lowCalls, 0);
+}
+
+// Test handles unsubscribe exactly once and go stale when their slot is reused
+TEST(EventDispatcherTest, UnsubscribeHandle) {
+    EventDispatcher dispatcher;
+    int firstCalls = 0;
+    int secondCalls = 0;
+
+    EventHandle first = dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { firstCalls++; });
+    EXPECT_NE(first, 0u);
+    EXPECT_TRUE(dispatcher.unsubscribe(first));
+    EXPECT_FALSE(dispatcher.unsubscribe(first));
+    EXPECT_EQ(dispatcher.getHandlerCount<WindowCloseEvent>(), 0u);
+
+    // The freed slot is reused with a new generation
+    EventHandle second = dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { secondCalls++; });
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(dispatcher.unsubscribe(first));
+    EXPECT_EQ(dispatcher.getHandlerCount<WindowCloseEvent>(), 1u);
+
+    WindowCloseEvent event;
+    dispatcher.dispatch(event);
+    EXPECT_EQ(firstCalls, 0);
+    EXPECT_EQ(secondCalls, 1);
+
+    EXPECT_FALSE(dispatcher.unsubscribe(0));
+    EXPECT_FALSE(dispatcher.unsubscribe(~0ull));
+}
+
+// Test handles of different event types never alias
+TEST(EventDispatcherTest, HandlesEncodeEventType) {
+    EventDispatcher dispatcher;
+    EventHandle close = dispatcher.subscribe<WindowCloseEvent>([](WindowCloseEvent&) {});
+    EventHandle focus = dispatcher.subscribe<WindowFocusEvent>([](WindowFocusEvent&) {});
+    EXPECT_NE(close, focus);
+
+    EXPECT_TRUE(dispatcher.unsubscribe(focus));
+    EXPECT_EQ(dispatcher.getHandlerCount<WindowCloseEvent>(), 1u);
+    EXPECT_EQ(dispatcher.getHandlerCount<WindowFocusEvent>(), 0u);
+}
+
+// Test handlers subscribed during dispatch see the next event, not the current one
+TEST(EventDispatcherTest, SubscribeDuringDispatch) {
+    EventDispatcher dispatcher;
+    int lateCalls = 0;
+    bool subscribed = false;
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) {
+        if (!subscribed) {
+            subscribed = true;
+            dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { lateCalls++; },
+                                                   EventPriority::Lowest);
+            dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { lateCalls++; },
+                                                   EventPriority::Highest);
+        }
+    });
+
+    WindowCloseEvent event;
+    dispatcher.dispatch(event);
+    EXPECT_EQ(lateCalls, 0);
+    EXPECT_EQ(dispatcher.getHandlerCount<WindowCloseEvent>(), 3u);
+
+    dispatcher.dispatch(event);
+    EXPECT_EQ(lateCalls, 2);
+}
+
+// Test handlers can unsubscribe themselves and others during dispatch
+TEST(EventDispatcherTest, UnsubscribeDuringDispatch) {
+    EventDispatcher dispatcher;
+    auto state = std::make_shared<int>(0);
+    std::weak_ptr<int> weakState = state;
+    int laterCalls = 0;
+
+    EventHandle self = 0;
+    EventHandle later = 0;
+    self = dispatcher.subscribe<WindowCloseEvent>([&, state](WindowCloseEvent&) {
+        (*state)++;
+        EXPECT_TRUE(dispatcher.unsubscribe(self));
+        EXPECT_TRUE(dispatcher.unsubscribe(later));
+        EXPECT_EQ(*state, 1);   // Captures stay alive until the handler returns
+    }, EventPriority::High);
+    later = dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { laterCalls++; });
+    state.reset();
+
+    WindowCloseEvent event;
+    dispatcher.dispatch(event);
+    dispatcher.dispatch(event);
+
+    EXPECT_EQ(laterCalls, 0);
+    EXPECT_EQ(dispatcher.getHandlerCount<WindowCloseEvent>(), 0u);
+    EXPECT_TRUE(weakState.expired());
+}
+
+// Test unsubscribeAll during a nested dispatch of the same type
+TEST(EventDispatcherTest, UnsubscribeAllDuringNestedDispatch) {
+    EventDispatcher dispatcher;
+    int depth = 0;
+    int calls = 0;
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent& e) {
+        calls++;
+        if (depth++ == 0) {
+            WindowCloseEvent nested;
+            dispatcher.dispatch(nested);
+            dispatcher.unsubscribeAll<WindowCloseEvent>();
+            dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { calls += 100; });
+        }
+        (void)e;
+    });
+    dispatcher.subscribe<WindowCloseEvent>([&](WindowCloseEvent&) { calls += 10; }, EventPriority::Low);
+
+    WindowCloseEvent event;
+    dispatcher.dispatch(event);
+    EXPECT_EQ(calls, 12);   // Outer and nested first handler, nested second handler
+
+    dispatcher.dispatch(event);
+    EXPECT_EQ(calls, 112);
+    EXPECT_EQ(dispatcher.getHandlerCount<WindowCloseEvent>(), 1u);
+}
+
+// Test heavy subscribe/unsubscribe churn keeps order and counts consistent
+TEST(EventDispatcherTest, SubscriptionChurn) {
+    EventDispatcher dispatcher;
+    std::vector<EventHandle> handles;
+    std::vector<int32_t> calls;
+    uint32_t seed = 12345;
+
+    for (int i = 0; i < 2000; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        if (!handles.empty() && (seed >> 16) % 3 == 0) {
+            size_t index = (seed >> 8) % handles.size();
+            EXPECT_TRUE(dispatcher.unsubscribe(handles[index]));
+            handles[index] = handles.back();
+            handles.pop_back();
+        } else {
+            int32_t priority = static_cast<int32_t>((seed >> 12) % 7) - 3;
+            handles.push_back(dispatcher.subscribe<WindowCloseEvent>(
+                [&calls, priority](WindowCloseEvent&) { calls.push_back(priority); },
+                static_cast<EventPriority>(priority)));
+        }
+    }
+    EXPECT_EQ(dispatcher.getHandlerCount<WindowCloseEvent>(), handles.size());
+
+    WindowCloseEvent event;
+    dispatcher.dispatch(event);
+    ASSERT_EQ(calls.size(), handles.size());
+    EXPECT_TRUE(std::is_sorted(calls.begin(), calls.end()));
+}
+
+} // namespace Tests
+} // namespace Pina
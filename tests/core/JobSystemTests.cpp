@@ -0,0 +1,290 @@
+/// Job System Tests
+/// Tests for Core/JobSystem scheduling, task groups, dependencies and parallelFor
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <atomic>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+// Helper to create a running job system with a fixed worker count
+static UNIQUE<JobSystem> createJobSystem(uint32_t workerCount) {
+    JobSystemConfig config;
+    config.workerCount = workerCount;
+    auto jobs = MAKE_UNIQUE<JobSystem>(config);
+    jobs->initialize();
+    return jobs;
+}
+
+// Test worker count and thread indices
+TEST(JobSystemTest, WorkerCount) {
+    auto jobs = createJobSystem(3);
+
+    EXPECT_TRUE(jobs->isRunning());
+    EXPECT_EQ(jobs->getWorkerCount(), 3u);
+    EXPECT_EQ(jobs->getThreadCount(), 4u);
+    EXPECT_EQ(jobs->getThreadIndex(), 0u);
+
+    jobs->shutdown();
+    EXPECT_FALSE(jobs->isRunning());
+    EXPECT_EQ(jobs->getWorkerCount(), 0u);
+}
+
+// Test that every job in a group runs exactly once
+TEST(JobSystemTest, SubmitAndWait) {
+    auto jobs = createJobSystem(4);
+
+    std::atomic<int> counter{0};
+    TaskGroup group;
+    for (int i = 0; i < 1000; ++i) {
+        jobs->submit([&counter]() { counter.fetch_add(1); }, &group);
+    }
+    jobs->wait(group);
+
+    EXPECT_TRUE(group.isDone());
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+// Test that jobs run on worker threads, not just the waiting thread
+TEST(JobSystemTest, JobsRunOnWorkers) {
+    auto jobs = createJobSystem(2);
+
+    std::atomic<bool> ranOnWorker{false};
+    std::atomic<bool> release{false};
+    TaskGroup group;
+
+    // Main thread does not help until wait(), so a worker must pick this up
+    jobs->submit([&]() {
+        if (jobs->getThreadIndex() != 0) {
+            ranOnWorker = true;
+        }
+        release = true;
+    }, &group);
+
+    while (!release.load()) {
+        std::this_thread::yield();
+    }
+    jobs->wait(group);
+
+    EXPECT_TRUE(ranOnWorker.load());
+}
+
+// Test that a job waits for its dependency groups
+TEST(JobSystemTest, Dependencies) {
+    auto jobs = createJobSystem(4);
+
+    std::atomic<int> first{0};
+    int observed = -1;
+
+    TaskGroup stageA;
+    TaskGroup stageB;
+    for (int i = 0; i < 64; ++i) {
+        jobs->submit([&first]() { first.fetch_add(1); }, &stageA);
+    }
+    jobs->submit([&]() { observed = first.load(); }, &stageB, {&stageA});
+    jobs->wait(stageB);
+
+    EXPECT_EQ(observed, 64);
+}
+
+// Test dependency chain across several groups
+TEST(JobSystemTest, DependencyChain) {
+    auto jobs = createJobSystem(3);
+
+    std::vector<int> order;
+    TaskGroup groups[4];
+
+    // Submit in reverse so only the dependency counters enforce ordering
+    for (int i = 3; i >= 1; --i) {
+        jobs->submit([&order, i]() { order.push_back(i); }, &groups[i], {&groups[i - 1]});
+    }
+
+    // Nothing can run until the root group finishes
+    EXPECT_EQ(groups[3].getPendingCount(), 1u);
+    jobs->submit([&order]() { order.push_back(0); }, &groups[0]);
+    jobs->wait(groups[3]);
+
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3}));
+}
+
+// Test dependency on an already finished group
+TEST(JobSystemTest, DependencyAlreadyDone) {
+    auto jobs = createJobSystem(2);
+
+    TaskGroup done;
+    TaskGroup group;
+    bool ran = false;
+    jobs->submit([&ran]() { ran = true; }, &group, {&done, nullptr});
+    jobs->wait(group);
+
+    EXPECT_TRUE(ran);
+}
+
+// Test jobs spawning nested jobs into the same group
+TEST(JobSystemTest, NestedSubmit) {
+    auto jobs = createJobSystem(4);
+
+    std::atomic<int> counter{0};
+    TaskGroup group;
+    for (int i = 0; i < 16; ++i) {
+        jobs->submit([&]() {
+            for (int j = 0; j < 16; ++j) {
+                jobs->submit([&counter]() { counter.fetch_add(1); }, &group);
+            }
+        }, &group);
+    }
+    jobs->wait(group);
+
+    EXPECT_EQ(counter.load(), 256);
+}
+
+// Test that overflowing a deque falls back to the shared queue
+TEST(JobSystemTest, QueueOverflow) {
+    JobSystemConfig config;
+    config.workerCount = 2;
+    config.queueCapacity = 8;
+    JobSystem jobs(config);
+    jobs.initialize();
+
+    std::atomic<int> counter{0};
+    TaskGroup group;
+    for (int i = 0; i < 500; ++i) {
+        jobs.submit([&counter]() { counter.fetch_add(1); }, &group);
+    }
+    jobs.wait(group);
+
+    EXPECT_EQ(counter.load(), 500);
+}
+
+// Test submission from a thread outside the job system
+TEST(JobSystemTest, ExternalThreadSubmit) {
+    auto jobs = createJobSystem(2);
+
+    std::atomic<int> counter{0};
+    TaskGroup group;
+    std::thread producer([&]() {
+        EXPECT_EQ(jobs->getThreadIndex(), ~0u);
+        for (int i = 0; i < 100; ++i) {
+            jobs->submit([&counter]() { counter.fetch_add(1); }, &group);
+        }
+    });
+    producer.join();
+    jobs->wait(group);
+
+    EXPECT_EQ(counter.load(), 100);
+}
+
+// Test parallelFor covers the whole range exactly once
+TEST(JobSystemTest, ParallelForCoversRange) {
+    auto jobs = createJobSystem(4);
+
+    std::vector<int> hits(10007, 0);
+    jobs->parallelFor(0, hits.size(), 64, [&hits](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            hits[i]++;
+        }
+    });
+
+    for (int hit : hits) {
+        ASSERT_EQ(hit, 1);
+    }
+}
+
+// Test parallelFor respects the grain size
+TEST(JobSystemTest, ParallelForGrainSize) {
+    auto jobs = createJobSystem(4);
+
+    std::atomic<int> chunks{0};
+    std::atomic<size_t> largest{0};
+    jobs->parallelFor(0, 1000, 100, [&](size_t begin, size_t end) {
+        chunks.fetch_add(1);
+        size_t size = end - begin;
+        size_t current = largest.load();
+        while (size > current && !largest.compare_exchange_weak(current, size)) {}
+    });
+
+    EXPECT_EQ(chunks.load(), 10);
+    EXPECT_EQ(largest.load(), 100u);
+}
+
+// Test parallelFor with automatic grain size and empty ranges
+TEST(JobSystemTest, ParallelForAutoGrainAndEmpty) {
+    auto jobs = createJobSystem(3);
+
+    std::atomic<size_t> sum{0};
+    jobs->parallelFor(0, 1000, 0, [&sum](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            sum.fetch_add(i);
+        }
+    });
+    EXPECT_EQ(sum.load(), 999u * 1000u / 2u);
+
+    bool called = false;
+    jobs->parallelFor(5, 5, 1, [&called](size_t, size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+// Test inline execution when not running, and the default worker count
+TEST(JobSystemTest, InlineWhenNotRunning) {
+    JobSystemConfig config;
+    config.workerCount = 0;
+    JobSystem jobs(config);
+
+    // Not initialized yet: still runs
+    bool before = false;
+    jobs.submit([&before]() { before = true; });
+    EXPECT_TRUE(before);
+
+    jobs.initialize();
+    uint32_t hardwareThreads = std::thread::hardware_concurrency();
+    EXPECT_EQ(jobs.getWorkerCount(), hardwareThreads > 1 ? hardwareThreads - 1 : 0);
+    jobs.shutdown();
+
+    config.workerCount = 1;
+    JobSystem single(config);
+    int total = 0;
+    single.parallelFor(0, 100, 10, [&total](size_t begin, size_t end) {
+        total += static_cast<int>(end - begin);
+    });
+    EXPECT_EQ(total, 100);
+}
+
+// Test that shutdown runs jobs that were still queued
+TEST(JobSystemTest, ShutdownDrainsQueue) {
+    auto jobs = createJobSystem(1);
+
+    std::atomic<int> counter{0};
+    TaskGroup group;
+    for (int i = 0; i < 100; ++i) {
+        jobs->submit([&counter]() { counter.fetch_add(1); }, &group);
+    }
+    jobs->shutdown();
+
+    EXPECT_TRUE(group.isDone());
+    EXPECT_EQ(counter.load(), 100);
+}
+
+// Test job system as a context subsystem
+TEST(JobSystemTest, RegisteredByContext) {
+    Context context;
+    auto* jobs = context.createSubsystem<JobSystem>(JobSystemConfig{2, 256});
+    context.initializeSubsystems();
+
+    ASSERT_NE(jobs, nullptr);
+    EXPECT_EQ(context.getSubsystem<JobSystem>(), jobs);
+    EXPECT_EQ(jobs->getWorkerCount(), 2u);
+
+    std::atomic<int> counter{0};
+    jobs->parallelFor(0, 256, 16, [&counter](size_t begin, size_t end) {
+        counter.fetch_add(static_cast<int>(end - begin));
+    });
+    EXPECT_EQ(counter.load(), 256);
+
+    context.shutdownSubsystems();
+    EXPECT_FALSE(context.hasSubsystem<JobSystem>());
+}
+
+} // namespace Tests
+} // namespace Pina
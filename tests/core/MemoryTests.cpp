@@ -1,8 +1,12 @@
 /// Memory Tests
-/// Tests for Core/Memory type aliases
+/// Tests for Core/Memory type aliases, arenas and pool allocator
 
 #include <gtest/gtest.h>
 #include <Pina.h>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <vector>
 
 namespace Pina {
 namespace Tests {
@@ -108,5 +112,191 @@ TEST(MemoryTest, MakeSharedDefaultConstructor) {
     EXPECT_EQ(TestObject::getInstanceCount(), 1);
 }
 
+// Helper to check pointer alignment
+static bool isAligned(const void* ptr, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+// Test linear arena honors requested alignment
+TEST(MemoryTest, LinearArenaAlignment) {
+    LinearArena arena(1024);
+
+    for (size_t alignment : {1u, 2u, 4u, 8u, 16u, 32u, 64u, 256u}) {
+        arena.allocate(1, 1);  // Misalign the bump pointer
+        void* ptr = arena.allocate(24, alignment);
+        EXPECT_TRUE(isAligned(ptr, alignment)) << "alignment " << alignment;
+    }
+
+    struct alignas(64) Aligned { float values[4]; };
+    Aligned* aligned = arena.create<Aligned>();
+    EXPECT_TRUE(isAligned(aligned, 64));
+}
+
+// Test linear arena allocations do not overlap and grow past one block
+TEST(MemoryTest, LinearArenaGrowth) {
+    LinearArena arena(256);
+
+    std::vector<int*> values;
+    for (int i = 0; i < 200; ++i) {
+        values.push_back(arena.create<int>(i));
+    }
+    for (int i = 0; i < 200; ++i) {
+        EXPECT_EQ(*values[i], i);
+    }
+    EXPECT_GT(arena.getBlockCount(), 1u);
+
+    // Oversized request gets its own block
+    void* large = arena.allocate(4096, 16);
+    EXPECT_NE(large, nullptr);
+    EXPECT_GE(arena.getCapacity(), 4096u);
+}
+
+// Test reset reuses memory and merges blocks
+TEST(MemoryTest, LinearArenaReset) {
+    LinearArena arena(128);
+
+    void* first = arena.allocate(16, 16);
+    for (int i = 0; i < 64; ++i) {
+        arena.allocate(32, 8);
+    }
+    size_t capacity = arena.getCapacity();
+    EXPECT_GT(arena.getBlockCount(), 1u);
+    EXPECT_GT(arena.getUsed(), 0u);
+
+    arena.reset();
+    EXPECT_EQ(arena.getUsed(), 0u);
+    EXPECT_EQ(arena.getBlockCount(), 1u);
+    EXPECT_EQ(arena.getCapacity(), capacity);
+    EXPECT_GE(arena.getPeakUsed(), 64u * 32u);
+
+    // Same workload now fits in the merged block
+    arena.allocate(16, 16);
+    for (int i = 0; i < 64; ++i) {
+        arena.allocate(32, 8);
+    }
+    EXPECT_EQ(arena.getBlockCount(), 1u);
+
+    // Single-block arena hands out the same address after reset
+    LinearArena single(1024);
+    first = single.allocate(16, 16);
+    single.reset();
+    EXPECT_EQ(single.allocate(16, 16), first);
+}
+
+// Test frame arena gives each thread its own sub-arena
+TEST(MemoryTest, FrameArenaPerThread) {
+    FrameArena arena(1024);
+
+    int* mainValue = arena.create<int>(1);
+    LinearArena* mainArena = &arena.getThreadArena();
+
+    LinearArena* workerArena = nullptr;
+    int* workerValue = nullptr;
+    std::thread worker([&]() {
+        workerValue = arena.create<int>(2);
+        workerArena = &arena.getThreadArena();
+    });
+    worker.join();
+
+    EXPECT_NE(mainArena, workerArena);
+    EXPECT_EQ(*mainValue, 1);
+    EXPECT_EQ(*workerValue, 2);
+    EXPECT_EQ(arena.getThreadArenaCount(), 2u);
+    EXPECT_EQ(arena.getUsed(), mainArena->getUsed() + workerArena->getUsed());
+
+    arena.reset();
+    EXPECT_EQ(arena.getUsed(), 0u);
+    EXPECT_EQ(arena.getThreadArenaCount(), 2u);
+}
+
+// Test separate frame arenas do not share thread caches
+TEST(MemoryTest, FrameArenaInstancesIndependent) {
+    FrameArena a;
+    FrameArena b;
+
+    a.allocate(100);
+    b.allocate(10);
+    a.allocate(100);
+
+    EXPECT_NE(&a.getThreadArena(), &b.getThreadArena());
+    EXPECT_GE(a.getUsed(), 200u);
+    EXPECT_LT(b.getUsed(), 100u);
+}
+
+// Test pool allocator reuses freed slots
+TEST(MemoryTest, PoolAllocatorReuse) {
+    PoolAllocator<TestObject> pool(4);
+    TestObject::resetInstanceCount();
+
+    TestObject* a = pool.create(1);
+    TestObject* b = pool.create(2);
+    EXPECT_EQ(pool.getAllocatedCount(), 2u);
+    EXPECT_EQ(pool.getCapacity(), 4u);
+    EXPECT_EQ(TestObject::getInstanceCount(), 2);
+
+    pool.destroy(a);
+    EXPECT_EQ(TestObject::getInstanceCount(), 1);
+    EXPECT_EQ(pool.getAllocatedCount(), 1u);
+
+    // Most recently freed slot is handed out first
+    TestObject* c = pool.create(3);
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(c->getValue(), 3);
+    EXPECT_EQ(b->getValue(), 2);
+
+    pool.destroy(b);
+    pool.destroy(c);
+    EXPECT_EQ(pool.getAllocatedCount(), 0u);
+    EXPECT_EQ(TestObject::getInstanceCount(), 0);
+}
+
+// Test pool allocator grows in chunks and keeps alignment
+TEST(MemoryTest, PoolAllocatorGrowth) {
+    struct alignas(16) Vec4 { float x, y, z, w; };
+    PoolAllocator<Vec4> pool(8);
+
+    std::vector<Vec4*> items;
+    for (int i = 0; i < 20; ++i) {
+        Vec4* item = pool.create(Vec4{static_cast<float>(i), 0.0f, 0.0f, 0.0f});
+        EXPECT_TRUE(isAligned(item, alignof(Vec4)));
+        items.push_back(item);
+    }
+    EXPECT_EQ(pool.getCapacity(), 24u);
+
+    for (int i = 0; i < 20; ++i) {
+        EXPECT_EQ(items[i]->x, static_cast<float>(i));
+    }
+    for (Vec4* item : items) {
+        pool.destroy(item);
+    }
+    EXPECT_EQ(pool.getAllocatedCount(), 0u);
+    EXPECT_EQ(pool.getCapacity(), 24u);
+}
+
+// Test STL containers backed by arenas
+TEST(MemoryTest, ArenaAllocatorContainers) {
+    LinearArena arena(4096);
+
+    std::vector<int, ArenaAllocator<int>> values{ArenaAllocator<int>(&arena)};
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(values[99], 99);
+    EXPECT_GT(arena.getUsed(), 100u * sizeof(int));
+
+    // Node-based containers rebind the allocator
+    using Pair = std::pair<const int, float>;
+    std::map<int, float, std::less<int>, ArenaAllocator<Pair>> map{ArenaAllocator<Pair>(&arena)};
+    map[3] = 1.5f;
+    map[1] = 0.5f;
+    EXPECT_EQ(map.begin()->first, 1);
+
+    FrameArena frame;
+    FrameVector<float> scratch{ArenaAllocator<float, FrameArena>(&frame)};
+    scratch.resize(64, 2.0f);
+    EXPECT_EQ(scratch[63], 2.0f);
+    EXPECT_GE(frame.getUsed(), 64u * sizeof(float));
+}
+
 } // namespace Tests
 } // namespace Pina
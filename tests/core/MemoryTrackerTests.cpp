@@ -0,0 +1,174 @@
+/// Memory Tracker Tests
+/// Tests for Core/MemoryTracker tagged accounting and Context memory reports
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+// Test heap-allocated nodes are tracked under the Scene tag
+TEST(MemoryTrackerTest, TrackedObjectRecordsSize) {
+    MemoryTagStats before = MemoryTracker::getStats(MemoryTag::Scene);
+
+    auto* node = new Node("Tracked");
+    MemoryTagStats during = MemoryTracker::getStats(MemoryTag::Scene);
+    EXPECT_EQ(during.liveBytes - before.liveBytes, sizeof(Node));
+    EXPECT_EQ(during.liveAllocations - before.liveAllocations, 1u);
+    EXPECT_EQ(during.totalAllocations - before.totalAllocations, 1u);
+    EXPECT_GE(during.peakBytes, during.liveBytes);
+
+    delete node;
+    MemoryTagStats after = MemoryTracker::getStats(MemoryTag::Scene);
+    EXPECT_EQ(after.liveBytes, before.liveBytes);
+    EXPECT_EQ(after.liveAllocations, before.liveAllocations);
+    EXPECT_EQ(after.totalAllocations - before.totalAllocations, 1u);
+}
+
+// Test polymorphic deletes free the derived size
+TEST(MemoryTrackerTest, PolymorphicEventSize) {
+    MemoryTagStats before = MemoryTracker::getStats(MemoryTag::Events);
+
+    UNIQUE<Event> event = MAKE_UNIQUE<MouseMovedEvent>(glm::vec2(1.0f), glm::vec2(2.0f));
+    EXPECT_EQ(MemoryTracker::getStats(MemoryTag::Events).liveBytes - before.liveBytes,
+              sizeof(MouseMovedEvent));
+
+    event.reset();
+    EXPECT_EQ(MemoryTracker::getStats(MemoryTag::Events).liveBytes, before.liveBytes);
+}
+
+// Test placement construction in pools bypasses per-object tracking
+TEST(MemoryTrackerTest, PoolChunksTrackedOnce) {
+    MemoryTagStats before = MemoryTracker::getStats(MemoryTag::Scene);
+
+    {
+        PoolAllocator<Node> pool(16, MemoryTag::Scene);
+        Node* a = pool.create("A");
+        Node* b = pool.create("B");
+
+        // One chunk allocation, no per-node allocations
+        MemoryTagStats during = MemoryTracker::getStats(MemoryTag::Scene);
+        EXPECT_EQ(during.liveAllocations - before.liveAllocations, 1u);
+        EXPECT_GE(during.liveBytes - before.liveBytes, 16u * sizeof(Node));
+
+        pool.destroy(a);
+        pool.destroy(b);
+    }
+
+    EXPECT_EQ(MemoryTracker::getStats(MemoryTag::Scene).liveBytes, before.liveBytes);
+}
+
+// Test STL containers with the tracked allocator
+TEST(MemoryTrackerTest, TrackedAllocator) {
+    MemoryTagStats before = MemoryTracker::getStats(MemoryTag::Assets);
+
+    {
+        std::vector<float, TrackedAllocator<float, MemoryTag::Assets>> data;
+        data.reserve(1000);
+        EXPECT_EQ(MemoryTracker::getStats(MemoryTag::Assets).liveBytes - before.liveBytes,
+                  1000u * sizeof(float));
+    }
+
+    EXPECT_EQ(MemoryTracker::getStats(MemoryTag::Assets).liveBytes, before.liveBytes);
+}
+
+// Test frame arena blocks are tracked under the Frame tag
+TEST(MemoryTrackerTest, FrameArenaTagged) {
+    MemoryTagStats before = MemoryTracker::getStats(MemoryTag::Frame);
+
+    {
+        FrameArena arena(4096);
+        arena.allocate(16);
+        EXPECT_EQ(MemoryTracker::getStats(MemoryTag::Frame).liveBytes - before.liveBytes, 4096u);
+    }
+
+    EXPECT_EQ(MemoryTracker::getStats(MemoryTag::Frame).liveBytes, before.liveBytes);
+}
+
+// Test peak tracking and reset
+TEST(MemoryTrackerTest, PeakBytes) {
+    MemoryTracker::resetPeaks();
+    MemoryTagStats before = MemoryTracker::getStats(MemoryTag::General);
+    EXPECT_EQ(before.peakBytes, before.liveBytes);
+
+    void* block = MemoryTracker::allocate(1 << 20, MemoryTag::General);
+    MemoryTracker::deallocate(block, 1 << 20, MemoryTag::General);
+
+    MemoryTagStats after = MemoryTracker::getStats(MemoryTag::General);
+    EXPECT_EQ(after.liveBytes, before.liveBytes);
+    EXPECT_GE(after.peakBytes, before.liveBytes + (1u << 20));
+
+    MemoryTracker::resetPeaks();
+    EXPECT_EQ(MemoryTracker::getStats(MemoryTag::General).peakBytes,
+              MemoryTracker::getStats(MemoryTag::General).liveBytes);
+}
+
+// Test counters stay consistent under concurrent allocation
+TEST(MemoryTrackerTest, ThreadSafe) {
+    MemoryTagStats before = MemoryTracker::getStats(MemoryTag::Render);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < 1000; ++i) {
+                void* ptr = MemoryTracker::allocate(64, MemoryTag::Render);
+                MemoryTracker::deallocate(ptr, 64, MemoryTag::Render);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    MemoryTagStats after = MemoryTracker::getStats(MemoryTag::Render);
+    EXPECT_EQ(after.liveBytes, before.liveBytes);
+    EXPECT_EQ(after.liveAllocations, before.liveAllocations);
+    EXPECT_EQ(after.totalAllocations - before.totalAllocations, 4000u);
+}
+
+// Test JSON report through Context
+TEST(MemoryTrackerTest, ContextJSONReport) {
+    Context context;
+
+    std::string cpuOnly = context.dumpMemoryStats();
+    EXPECT_NE(cpuOnly.find("\"cpu\""), std::string::npos);
+    EXPECT_NE(cpuOnly.find("\"Scene\""), std::string::npos);
+    EXPECT_NE(cpuOnly.find("\"Events\""), std::string::npos);
+    EXPECT_EQ(cpuOnly.find("\"gpu\""), std::string::npos);
+
+    auto device = GraphicsDevice::create(GraphicsBackend::Null);
+    context.setGPUMemoryTracker(device->getGPUMemoryTracker());
+    auto buffer = device->createVertexBuffer(nullptr, 4096);
+
+    std::string report = context.dumpMemoryStats();
+    EXPECT_NE(report.find("\"gpu\""), std::string::npos);
+    EXPECT_NE(report.find("\"VertexBuffer\": {\"liveCount\": 1, \"liveBytes\": 4096"), std::string::npos);
+    EXPECT_EQ(context.getMemoryStats(MemoryTag::Scene).liveBytes,
+              MemoryTracker::getStats(MemoryTag::Scene).liveBytes);
+
+    // Balanced braces
+    int depth = 0;
+    for (char c : report) {
+        if (c == '{') depth++;
+        if (c == '}') depth--;
+        ASSERT_GE(depth, 0);
+    }
+    EXPECT_EQ(depth, 0);
+
+    // File dump
+    std::string path = ::testing::TempDir() + "pina_memory_report.json";
+    ASSERT_TRUE(context.dumpMemoryStats(path));
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_NE(contents.str().find("\"gpu\""), std::string::npos);
+    std::remove(path.c_str());
+}
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,66 @@
+/// Name Tests
+/// Tests for Core/Name string interning
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+// Test that equal strings intern to the same Name
+TEST(NameTest, Interning) {
+    Name a("NameTest_Wheel");
+    Name b(std::string("NameTest_") + "Wheel");
+    Name c("NameTest_Body");
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_EQ(&a.str(), &b.str());
+    EXPECT_EQ(a.str(), "NameTest_Wheel");
+    EXPECT_EQ(Name::Hash()(a), Name::Hash()(b));
+
+    Name empty;
+    EXPECT_TRUE(empty.isEmpty());
+    EXPECT_EQ(empty, Name(""));
+    EXPECT_FALSE(a.isEmpty());
+}
+
+// Test that find() never adds strings
+TEST(NameTest, FindDoesNotIntern) {
+    size_t before = Name::getInternedCount();
+    Name out;
+    EXPECT_FALSE(Name::find("NameTest_NeverInterned", out));
+    EXPECT_TRUE(out.isEmpty());
+    EXPECT_EQ(Name::getInternedCount(), before);
+
+    Name interned("NameTest_Interned");
+    EXPECT_TRUE(Name::find("NameTest_Interned", out));
+    EXPECT_EQ(out, interned);
+}
+
+// Test interning the same strings from several threads
+TEST(NameTest, ConcurrentInterning) {
+    constexpr int kThreads = 4;
+    std::vector<std::vector<Name>> results(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&results, t]() {
+            for (int i = 0; i < 1000; ++i) {
+                results[t].push_back(Name("NameTest_Concurrent" + std::to_string(i)));
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (int t = 1; t < kThreads; ++t) {
+        EXPECT_EQ(results[t], results[0]);
+    }
+}
+
+} // namespace Tests
+} // namespace Pina
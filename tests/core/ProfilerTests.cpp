@@ -0,0 +1,224 @@
+/// Profiler Tests
+/// Tests for Core/Profiler scoped markers and Chrome trace export
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+/// Enables a clean profiler for one test
+struct ProfilerSession {
+    ProfilerSession() {
+        Profiler::clear();
+        Profiler::setEnabled(true);
+    }
+
+    ~ProfilerSession() {
+        Profiler::setEnabled(false);
+        Profiler::clear();
+    }
+};
+
+size_t countEvents(const std::vector<ProfileEvent>& events, const char* name) {
+    size_t count = 0;
+    for (const auto& event : events) {
+        if (event.name && std::strcmp(event.name, name) == 0) {
+            count++;
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+// Test nothing is recorded while disabled
+TEST(ProfilerTest, DisabledRecordsNothing) {
+    Profiler::clear();
+    Profiler::setEnabled(false);
+
+    {
+        ProfileScope scope("Disabled");
+    }
+
+    EXPECT_EQ(countEvents(Profiler::getEvents(), "Disabled"), 0u);
+}
+
+// Test nested scopes record depth and containment
+TEST(ProfilerTest, NestedScopes) {
+    ProfilerSession session;
+
+    {
+        ProfileScope outer("Outer");
+        {
+            ProfileScope inner("Inner");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    auto events = Profiler::getEvents();
+    ASSERT_EQ(events.size(), 2u);
+
+    // Sorted by start: outer first
+    const ProfileEvent& outer = events[0];
+    const ProfileEvent& inner = events[1];
+    EXPECT_STREQ(outer.name, "Outer");
+    EXPECT_STREQ(inner.name, "Inner");
+    EXPECT_EQ(outer.depth, 0u);
+    EXPECT_EQ(inner.depth, 1u);
+    EXPECT_EQ(outer.threadID, inner.threadID);
+    EXPECT_GE(inner.durationNs, 1000000u);
+    EXPECT_LE(outer.startNs, inner.startNs);
+    EXPECT_GE(outer.startNs + outer.durationNs, inner.startNs + inner.durationNs);
+}
+
+// Test dynamic names are interned and outlive their source
+TEST(ProfilerTest, DynamicNames) {
+    ProfilerSession session;
+
+    {
+        std::string name = "Pass";
+        name += "42";
+        ProfileScope scope(name);
+    }
+
+    auto events = Profiler::getEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_STREQ(events[0].name, "Pass42");
+    EXPECT_EQ(Profiler::intern("Pass42"), events[0].name);
+}
+
+// Test pass names are interned once and again only after a rename
+TEST(ProfilerTest, RenderPassProfileName) {
+    struct NamedPass : RenderPass {
+        void execute(RenderContext&) override {}
+    } pass;
+
+    pass.name = "Bloom";
+    const char* name = pass.getProfileName();
+    EXPECT_STREQ(name, "Bloom");
+    EXPECT_EQ(pass.getProfileName(), name);
+    EXPECT_EQ(Profiler::intern("Bloom"), name);
+
+    pass.name = "Blur";
+    EXPECT_STREQ(pass.getProfileName(), "Blur");
+}
+
+// Test each thread records into its own buffer
+TEST(ProfilerTest, MultipleThreads) {
+    ProfilerSession session;
+
+    constexpr int kThreads = 4;
+    constexpr int kScopes = 100;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([]() {
+            for (int i = 0; i < kScopes; ++i) {
+                ProfileScope scope("Worker");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto events = Profiler::getEvents();
+    EXPECT_EQ(countEvents(events, "Worker"), static_cast<size_t>(kThreads * kScopes));
+    EXPECT_EQ(Profiler::getDroppedCount(), 0u);
+    for (size_t i = 1; i < events.size(); ++i) {
+        EXPECT_LE(events[i - 1].startNs, events[i].startNs);
+    }
+}
+
+// Test full buffers drop and count events instead of growing
+TEST(ProfilerTest, DropsWhenFull) {
+    ProfilerSession session;
+
+    // Fresh thread so the buffer starts empty regardless of earlier tests
+    std::thread thread([]() {
+        for (size_t i = 0; i < Profiler::EventsPerThread + 10; ++i) {
+            ProfileScope scope("Flood");
+        }
+    });
+    thread.join();
+
+    EXPECT_EQ(countEvents(Profiler::getEvents(), "Flood"), Profiler::EventsPerThread);
+    EXPECT_EQ(Profiler::getDroppedCount(), 10u);
+}
+
+// Test Chrome trace output
+TEST(ProfilerTest, ChromeTrace) {
+    ProfilerSession session;
+
+    std::thread thread([]() {
+        Profiler::setThreadName("Loader \"A\"");
+        ProfileScope scope("Load");
+    });
+    thread.join();
+
+    std::string trace = Profiler::toChromeTrace();
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("{\"name\": \"Load\", \"cat\": \"pina\", \"ph\": \"X\""), std::string::npos);
+    EXPECT_NE(trace.find("\"thread_name\""), std::string::npos);
+    EXPECT_NE(trace.find("Loader \\\"A\\\""), std::string::npos);
+
+    std::string path = ::testing::TempDir() + "pina_trace.json";
+    ASSERT_TRUE(Profiler::exportChromeTrace(path));
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_EQ(contents.str(), trace);
+    std::remove(path.c_str());
+}
+
+#if defined(PINA_ENABLE_PROFILING)
+
+class ProfiledApplication : public Application {
+public:
+    explicit ProfiledApplication(const std::string& tracePath) {
+        m_config.headless = true;
+        m_config.maxFrames = 3;
+        m_config.jobWorkerCount = 1;
+        m_config.profileTracePath = tracePath;
+    }
+};
+
+// Test the main loop is instrumented and the trace is written on exit
+TEST(ProfilerTest, ApplicationTrace) {
+    Profiler::clear();
+
+    std::string path = ::testing::TempDir() + "pina_app_trace.json";
+    ProfiledApplication app(path);
+    EXPECT_EQ(app.run(), 0);
+    EXPECT_FALSE(Profiler::isEnabled());
+
+    auto events = Profiler::getEvents();
+    EXPECT_EQ(countEvents(events, "Frame"), 3u);
+    EXPECT_EQ(countEvents(events, "Context::updateSubsystems"), 3u);
+    EXPECT_EQ(countEvents(events, "Application::onRender"), 3u);
+
+    std::ifstream file(path);
+    ASSERT_TRUE(file.good());
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_NE(contents.str().find("\"Main\""), std::string::npos);
+    EXPECT_NE(contents.str().find("\"Frame\""), std::string::npos);
+    std::remove(path.c_str());
+
+    Profiler::clear();
+}
+
+#endif
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,204 @@
+/// Recording Device Tests
+/// Tests for Graphics/Recording command log and stats
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+
+namespace Pina {
+namespace Tests {
+
+// Test backend factory returns a recording device for the null backend
+TEST(RecordingDeviceTest, FactoryCreatesNullBackend) {
+    auto device = GraphicsDevice::create(GraphicsBackend::Null);
+    ASSERT_NE(device, nullptr);
+    EXPECT_NE(dynamic_cast<RecordingDevice*>(device.get()), nullptr);
+}
+
+// Test resources get unique non-zero IDs
+TEST(RecordingDeviceTest, ResourceIDs) {
+    RecordingDevice device;
+
+    auto shader = device.createShader();
+    auto vao = device.createVertexArray();
+    float vertices[9] = {};
+    auto vbo = device.createVertexBuffer(vertices, sizeof(vertices));
+
+    EXPECT_NE(shader->getID(), 0u);
+    EXPECT_NE(vao->getID(), 0u);
+    EXPECT_NE(vbo->getID(), 0u);
+    EXPECT_NE(shader->getID(), vao->getID());
+    EXPECT_NE(vao->getID(), vbo->getID());
+}
+
+// Test draw calls are recorded with their counts
+TEST(RecordingDeviceTest, RecordsDrawCalls) {
+    RecordingDevice device;
+
+    uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+    auto vao = device.createVertexArray();
+    auto ibo = device.createIndexBuffer(indices, 6);
+    vao->setIndexBuffer(ibo.get());
+
+    device.draw(vao.get(), 3);
+    device.drawIndexed(vao.get());
+
+    EXPECT_EQ(device.countCommands(RecordedCommandType::Draw), 1u);
+    EXPECT_EQ(device.countCommands(RecordedCommandType::DrawIndexed), 1u);
+    EXPECT_EQ(device.getStats().drawCalls, 2u);
+    EXPECT_EQ(device.getStats().verticesSubmitted, 3u);
+    EXPECT_EQ(device.getStats().indicesSubmitted, 6u);
+    EXPECT_EQ(device.getBoundVertexArray(), vao->getID());
+}
+
+// Test state changes and redundant state changes are counted
+TEST(RecordingDeviceTest, TracksStateChanges) {
+    RecordingDevice device;
+
+    device.setBlending(true);
+    device.setBlending(true);
+    device.setDepthTest(false);
+
+    EXPECT_TRUE(device.isBlendingEnabled());
+    EXPECT_FALSE(device.isDepthTestEnabled());
+    EXPECT_EQ(device.getStats().stateChanges, 3u);
+    EXPECT_EQ(device.getStats().redundantStateChanges, 1u);
+}
+
+// Test uniform uploads are logged and values are kept on the shader
+TEST(RecordingDeviceTest, RecordsUniforms) {
+    RecordingDevice device;
+    auto shader = device.createShader();
+
+    shader->bind();
+    shader->setInt("uUseTexture", 1);
+    shader->setVec3("uColor", glm::vec3(1.0f, 0.5f, 0.25f));
+
+    auto* recording = static_cast<RecordingShader*>(shader.get());
+    const RecordedUniform* color = recording->getUniform("uColor");
+    ASSERT_NE(color, nullptr);
+    EXPECT_EQ(std::get<glm::vec3>(*color), glm::vec3(1.0f, 0.5f, 0.25f));
+    EXPECT_EQ(recording->getUniform("uMissing"), nullptr);
+
+    auto names = device.getUploadedUniforms();
+    ASSERT_EQ(names.size(), 2u);
+    EXPECT_EQ(names[0], "uUseTexture");
+    EXPECT_EQ(names[1], "uColor");
+    EXPECT_EQ(device.getBoundShader(), shader->getID());
+}
+
+// Test disabling recording keeps stats but not the log
+TEST(RecordingDeviceTest, NullModeKeepsStats) {
+    RecordingDevice device;
+    device.setRecording(false);
+
+    auto vao = device.createVertexArray();
+    device.draw(vao.get(), 36);
+
+    EXPECT_TRUE(device.getCommands().empty());
+    EXPECT_EQ(device.getStats().drawCalls, 1u);
+
+    device.reset();
+    EXPECT_EQ(device.getStats().drawCalls, 0u);
+}
+
+// Test framebuffers go through the device and record binds
+TEST(RecordingDeviceTest, Framebuffers) {
+    RecordingDevice device;
+
+    FramebufferSpec spec;
+    spec.width = 256;
+    spec.height = 128;
+    auto fb = Framebuffer::create(&device, spec);
+    ASSERT_NE(fb, nullptr);
+    EXPECT_NE(fb->getColorAttachmentID(), 0u);
+    EXPECT_NE(fb->getDepthAttachmentID(), 0u);
+
+    fb->bind();
+    EXPECT_EQ(device.getStats().framebufferBinds, 1u);
+    EXPECT_EQ(device.getViewport(), glm::ivec4(0, 0, 256, 128));
+
+    fb->resize(512, 256);
+    EXPECT_EQ(fb->getWidth(), 512);
+    EXPECT_EQ(device.countCommands(RecordedCommandType::ResizeFramebuffer), 1u);
+}
+
+// Test GPU memory accounting for device resources
+TEST(RecordingDeviceTest, GPUMemoryAccounting) {
+    RecordingDevice device;
+    const GPUMemoryTracker& memory = device.getGPUMemory();
+
+    float vertices[64] = {};
+    uint32_t indices[6] = { 0, 1, 2, 2, 3, 0 };
+    auto vbo = device.createVertexBuffer(vertices, sizeof(vertices));
+    auto ibo = device.createIndexBuffer(indices, 6);
+    auto texture = device.createTexture(nullptr, 16, 16, 4);
+
+    EXPECT_EQ(memory.getStats(GPUResourceType::VertexBuffer).liveBytes, sizeof(vertices));
+    EXPECT_EQ(memory.getStats(GPUResourceType::IndexBuffer).liveBytes, sizeof(indices));
+    EXPECT_EQ(memory.getStats(GPUResourceType::Texture).liveBytes, computeTextureBytes(16, 16, 4, true));
+
+    // Re-upload with a different size
+    vbo->setData(vertices, 32);
+    EXPECT_EQ(memory.getStats(GPUResourceType::VertexBuffer).liveBytes, 32u);
+    EXPECT_EQ(memory.getStats(GPUResourceType::VertexBuffer).peakBytes, sizeof(vertices));
+
+    // Framebuffer resize updates its size
+    FramebufferSpec spec;
+    spec.width = 64;
+    spec.height = 32;
+    auto fb = device.createFramebuffer(spec);
+    EXPECT_EQ(memory.getStats(GPUResourceType::Framebuffer).liveBytes, 64u * 32u * (4u + 4u));
+    fb->resize(128, 64);
+    EXPECT_EQ(memory.getStats(GPUResourceType::Framebuffer).liveBytes, 128u * 64u * (4u + 4u));
+
+    vbo.reset();
+    ibo.reset();
+    texture.reset();
+    fb.reset();
+    EXPECT_EQ(memory.getTotalLiveBytes(), 0u);
+    EXPECT_EQ(memory.getStats(GPUResourceType::Texture).liveCount, 0u);
+    EXPECT_EQ(memory.getStats(GPUResourceType::Texture).totalCreated, 1u);
+    EXPECT_GE(memory.getPeakBytes(), 128u * 64u * 8u);
+}
+
+// Test resources may outlive their device
+TEST(RecordingDeviceTest, GPUMemoryOutlivesDevice) {
+    auto device = MAKE_UNIQUE<RecordingDevice>();
+    SHARED<GPUMemoryTracker> tracker = device->getGPUMemoryTracker();
+    auto texture = device->createTexture(nullptr, 8, 8, 3);
+    device.reset();
+
+    EXPECT_EQ(tracker->getStats(GPUResourceType::Texture).liveCount, 1u);
+    texture.reset();
+    EXPECT_EQ(tracker->getTotalLiveBytes(), 0u);
+}
+
+// Test the full render pipeline runs against the recording device
+TEST(RecordingDeviceTest, RenderPipeline) {
+    RecordingDevice device;
+    RenderPipeline pipeline(&device);
+    pipeline.resize(320, 240);
+    pipeline.setToneMappingEnabled(true);
+
+    Scene scene;
+    scene.setDevice(&device);
+    scene.createCube("Cube");
+    Camera* camera = scene.getOrCreateDefaultCamera();
+
+    device.reset();
+    pipeline.render(&scene, camera, 0.016f);
+
+    // One draw for the cube, one fullscreen quad for tone mapping
+    EXPECT_EQ(device.getStats().drawCalls, 2u);
+    EXPECT_GT(device.getStats().shaderBinds, 0u);
+    EXPECT_GT(device.getStats().clears, 0u);
+
+    // Scene pass uploads the camera matrices to the standard shader
+    auto* shader = static_cast<RecordingShader*>(pipeline.getStandardShader());
+    const RecordedUniform* view = shader->getUniform("uView");
+    ASSERT_NE(view, nullptr);
+    EXPECT_EQ(std::get<glm::mat4>(*view), camera->getViewMatrix());
+}
+
+} // namespace Tests
+} // namespace Pina
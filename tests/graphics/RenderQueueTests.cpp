@@ -0,0 +1,207 @@
+/// Render Queue Tests
+/// Tests for Graphics/RenderQueue sort keys, radix sort and state-change tracking on submit
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+/// Single-triangle mesh on a recording device
+UNIQUE<StaticMesh> createTriangle(RecordingDevice& device) {
+    std::vector<float> vertices(3 * 8, 0.0f);
+    return StaticMesh::create(&device, vertices, {0, 1, 2});
+}
+
+} // namespace
+
+// Test the radix sort against a stable sort of the same keys
+TEST(RenderQueueTest, SortMatchesStableSort) {
+    std::mt19937_64 rng(5);
+    RenderQueue queue;
+    for (int i = 0; i < 5000; ++i) {
+        RenderItem item;
+        // Few distinct high fields and many duplicates, like real keys
+        item.key = (rng() % 4) << 60 | (rng() % 8) << 40 | (rng() % 64);
+        queue.add(item);
+    }
+    EXPECT_FALSE(queue.isSorted());
+    queue.sort();
+    ASSERT_TRUE(queue.isSorted());
+
+    std::vector<uint32_t> expected(queue.size());
+    std::iota(expected.begin(), expected.end(), 0u);
+    std::stable_sort(expected.begin(), expected.end(), [&queue](uint32_t a, uint32_t b) {
+        return queue.getItem(a).key < queue.getItem(b).key;
+    });
+    EXPECT_EQ(queue.getOrder(), expected);
+
+    // Adding an item invalidates the order
+    queue.add(RenderItem());
+    EXPECT_FALSE(queue.isSorted());
+}
+
+// Test the bucket, state and depth fields of the key
+TEST(RenderQueueTest, KeyOrder) {
+    RecordingDevice device;
+    auto meshA = createTriangle(device);
+    auto meshB = createTriangle(device);
+    Material red = Material::createPlastic(Color::red());
+    Material blue = Material::createPlastic(Color::blue());
+    Material red2 = Material::createPlastic(Color::red());
+
+    const uint32_t near = RenderQueue::quantizeDepth(1.0f, 0.1f, 100.0f);
+    const uint32_t far = RenderQueue::quantizeDepth(50.0f, 0.1f, 100.0f);
+    EXPECT_LT(near, far);
+    EXPECT_EQ(RenderQueue::quantizeDepth(-5.0f, 0.1f, 100.0f), 0u);
+    EXPECT_EQ(RenderQueue::quantizeDepth(500.0f, 0.1f, 100.0f), (1u << RenderQueue::DepthBits) - 1);
+
+    auto opaque = [](const Material& material, const StaticMesh* mesh, uint32_t depth) {
+        return RenderQueue::makeKey(RenderBucket::Opaque, &material, mesh, depth);
+    };
+    auto transparent = [](const Material& material, const StaticMesh* mesh, uint32_t depth) {
+        return RenderQueue::makeKey(RenderBucket::Transparent, &material, mesh, depth);
+    };
+
+    // Opaque: equal state sorts front to back, equal materials share their field
+    EXPECT_LT(opaque(red, meshA.get(), near), opaque(red, meshA.get(), far));
+    EXPECT_EQ(opaque(red, meshA.get(), near), opaque(red2, meshA.get(), near));
+    EXPECT_NE(opaque(red, meshA.get(), near) >> RenderQueue::DepthBits,
+              opaque(blue, meshA.get(), near) >> RenderQueue::DepthBits);
+
+    // State outranks depth, so one material's draws stay together
+    bool redFirst = opaque(red, meshA.get(), far) < opaque(blue, meshA.get(), near);
+    EXPECT_EQ(opaque(red, meshB.get(), near) < opaque(blue, meshB.get(), far), redFirst);
+
+    // Transparent: after every opaque draw, back to front
+    EXPECT_LT(opaque(blue, meshB.get(), far), transparent(red, meshA.get(), far));
+    EXPECT_LT(transparent(red, meshA.get(), far), transparent(red, meshA.get(), near));
+    EXPECT_LT(transparent(blue, meshB.get(), far), transparent(red, meshA.get(), near));
+
+    // Equal transparent depths tie whatever the state, so gather order decides
+    EXPECT_EQ(transparent(blue, meshB.get(), near), transparent(red, meshA.get(), near));
+    EXPECT_EQ(RenderQueue::getBucket(transparent(red, meshA.get(), near)), RenderBucket::Transparent);
+    EXPECT_EQ(RenderQueue::getBucket(opaque(red, meshA.get(), near)), RenderBucket::Opaque);
+}
+
+// Test submit only uploads matrices and materials when they change
+TEST(RenderQueueTest, SubmitStateChanges) {
+    RecordingDevice device;
+    auto shader = device.createShader();
+    LightManager lights;
+    auto meshA = createTriangle(device);
+    auto meshB = createTriangle(device);
+    Material red = Material::createPlastic(Color::red());
+    Material red2 = Material::createPlastic(Color::red());
+    Material metal = Material::createPBRMetal(Color::white());
+
+    // Four transforms; each draws both meshes, alternating materials
+    RenderQueue queue;
+    const Material* materials[] = {&red, &metal, &red2, &metal};
+    for (uint32_t t = 0; t < 4; ++t) {
+        uint32_t transform = queue.addTransform(glm::mat4(1.0f), glm::mat3(1.0f));
+        for (StaticMesh* mesh : {meshA.get(), meshB.get()}) {
+            RenderItem item;
+            item.key = RenderQueue::makeKey(RenderBucket::Opaque, materials[t], mesh, t);
+            item.mesh = mesh;
+            item.material = materials[t];
+            item.transform = transform;
+            queue.add(item);
+        }
+    }
+
+    // Gather order: every transform, material and mesh switch is a change
+    RenderQueueStats unsorted;
+    queue.submit(shader.get(), &lights, unsorted);
+    EXPECT_EQ(unsorted.drawCalls, 8u);
+    EXPECT_EQ(unsorted.transformChanges, 4u);
+    EXPECT_EQ(unsorted.materialChanges, 4u);
+    EXPECT_EQ(unsorted.shaderChanges, 4u);
+    EXPECT_EQ(unsorted.meshChanges, 8u);
+
+    // Sorted: red and red2 are one material; each group draws meshA then meshB
+    device.reset();
+    queue.sort();
+    RenderQueueStats sorted;
+    queue.submit(shader.get(), &lights, sorted);
+    EXPECT_EQ(sorted.items, 8u);
+    EXPECT_EQ(sorted.drawCalls, 8u);
+    EXPECT_EQ(sorted.materialChanges, 2u);
+    EXPECT_EQ(sorted.shaderChanges, 2u);
+    EXPECT_EQ(sorted.meshChanges, 4u);
+    EXPECT_EQ(sorted.transformChanges, 8u);
+    EXPECT_EQ(device.getStats().drawCalls, 8u);
+
+    auto uniforms = device.getUploadedUniforms();
+    EXPECT_EQ(std::count(uniforms.begin(), uniforms.end(), "uModel"), 8);
+
+    // Without a light manager nothing but matrices is uploaded
+    device.reset();
+    RenderQueueStats unlit;
+    queue.submit(shader.get(), nullptr, unlit);
+    EXPECT_EQ(device.getStats().uniformUploads, 2 * unlit.transformChanges);
+}
+
+// Test runs of one mesh and material are drawn instanced with the instanced shader
+TEST(RenderQueueTest, SubmitInstanced) {
+    RecordingDevice device;
+    auto shader = device.createShader();
+    auto instancedShader = device.createShader();
+    LightManager lights;
+    auto meshA = createTriangle(device);
+    auto meshB = createTriangle(device);
+    Material red = Material::createPlastic(Color::red());
+    Material red2 = Material::createPlastic(Color::red());
+    Material blue = Material::createPlastic(Color::blue());
+
+    // Gather order: A red x3 (one a separate but equal material), B red, A blue x2
+    RenderQueue queue;
+    struct Draw { StaticMesh* mesh; const Material* material; };
+    const Draw draws[] = {{meshA.get(), &red}, {meshA.get(), &red2}, {meshA.get(), &red},
+                          {meshB.get(), &red}, {meshA.get(), &blue}, {meshA.get(), &blue}};
+    for (const Draw& draw : draws) {
+        RenderItem item;
+        item.mesh = draw.mesh;
+        item.material = draw.material;
+        item.transform = queue.addTransform(glm::mat4(1.0f), glm::mat3(1.0f), Color::green());
+        queue.add(item);
+    }
+
+    shader->bind();
+    RenderQueueStats stats;
+    queue.submit(shader.get(), &lights, stats, instancedShader.get());
+    EXPECT_EQ(stats.items, 6u);
+    EXPECT_EQ(stats.drawCalls, 3u);
+    EXPECT_EQ(stats.instancedDrawCalls, 2u);
+    EXPECT_EQ(stats.instances, 5u);
+    EXPECT_EQ(stats.transformChanges, 1u);
+    EXPECT_EQ(stats.meshChanges, 3u);
+    EXPECT_EQ(device.countCommands(RecordedCommandType::DrawIndexedInstanced), 2u);
+    EXPECT_EQ(device.countCommands(RecordedCommandType::DrawIndexed), 1u);
+    EXPECT_EQ(device.getStats().instancesSubmitted, 5u);
+    EXPECT_EQ(device.getStats().indicesSubmitted, 3u * 6u);
+
+    // Red is uploaded to each shader; the single draw's tint is reset afterwards
+    EXPECT_EQ(stats.materialChanges, 3u);
+    auto uniforms = device.getUploadedUniforms();
+    EXPECT_EQ(std::count(uniforms.begin(), uniforms.end(), "uTint"), 2);
+    EXPECT_EQ(std::count(uniforms.begin(), uniforms.end(), "uModel"), 1);
+    EXPECT_EQ(device.getBoundShader(), shader->getID());
+
+    // Without an instanced shader every item is its own draw
+    device.reset();
+    RenderQueueStats plain;
+    queue.submit(shader.get(), &lights, plain);
+    EXPECT_EQ(plain.drawCalls, 6u);
+    EXPECT_EQ(plain.instancedDrawCalls, 0u);
+    EXPECT_EQ(device.getStats().instancedDrawCalls, 0u);
+}
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,255 @@
+/// Dynamic AABB Tree Tests
+/// Tests for Math/DynamicAABBTree queries against brute force over the same boxes
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+using ProxyID = DynamicAABBTree::ProxyID;
+
+struct RandomBoxes {
+    std::mt19937 rng{11};
+    std::uniform_real_distribution<float> position{-50.0f, 50.0f};
+    std::uniform_real_distribution<float> extent{0.1f, 2.0f};
+    std::uniform_real_distribution<float> step{-1.5f, 1.5f};
+
+    glm::vec3 point() { return glm::vec3(position(rng), position(rng), position(rng)); }
+
+    BoundingBox box() { return boxAt(point()); }
+
+    BoundingBox boxAt(const glm::vec3& center) {
+        glm::vec3 half(extent(rng), extent(rng), extent(rng));
+        BoundingBox result;
+        result.min = center - half;
+        result.max = center + half;
+        return result;
+    }
+
+    glm::vec3 offset() { return glm::vec3(step(rng), step(rng), step(rng)); }
+};
+
+/// Tree plus the live proxies, for brute-force comparisons
+struct TreeFixture {
+    DynamicAABBTree tree;
+    std::vector<ProxyID> proxies;
+    RandomBoxes random;
+
+    void populate(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            proxies.push_back(tree.createProxy(random.box(), static_cast<uint32_t>(i)));
+        }
+    }
+
+    template<typename Predicate>
+    std::vector<ProxyID> bruteForce(Predicate&& predicate) const {
+        std::vector<ProxyID> result;
+        for (ProxyID proxy : proxies) {
+            if (predicate(tree.getFatBounds(proxy))) {
+                result.push_back(proxy);
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+};
+
+std::vector<ProxyID> sorted(std::vector<ProxyID> ids) {
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+} // namespace
+
+// Test inserting, moving and removing keeps the tree valid and balanced
+TEST(DynamicAABBTreeTest, InsertMoveRemove) {
+    TreeFixture f;
+    EXPECT_TRUE(f.tree.validate());
+    EXPECT_EQ(f.tree.getHeight(), 0);
+
+    f.populate(1000);
+    EXPECT_EQ(f.tree.getProxyCount(), 1000u);
+    EXPECT_TRUE(f.tree.validate());
+    EXPECT_LE(f.tree.getHeight(), 24);
+
+    for (int round = 0; round < 5; ++round) {
+        for (ProxyID proxy : f.proxies) {
+            glm::vec3 center = f.tree.getFatBounds(proxy).getCenter() + f.random.offset();
+            f.tree.moveProxy(proxy, f.random.boxAt(center));
+        }
+        EXPECT_TRUE(f.tree.validate());
+    }
+
+    for (size_t i = 0; i < f.proxies.size(); i += 2) {
+        f.tree.destroyProxy(f.proxies[i]);
+    }
+    std::vector<ProxyID> kept;
+    for (size_t i = 1; i < f.proxies.size(); i += 2) {
+        kept.push_back(f.proxies[i]);
+    }
+    f.proxies = kept;
+    EXPECT_EQ(f.tree.getProxyCount(), 500u);
+    EXPECT_TRUE(f.tree.validate());
+
+    // Freed nodes are reused
+    f.populate(100);
+    EXPECT_TRUE(f.tree.validate());
+    for (ProxyID proxy : f.proxies) {
+        EXPECT_TRUE(f.tree.getFatBounds(proxy).isValid());
+    }
+
+    f.tree.clear();
+    EXPECT_EQ(f.tree.getProxyCount(), 0u);
+    EXPECT_TRUE(f.tree.validate());
+}
+
+// Test small movements stay inside the fat bounds
+TEST(DynamicAABBTreeTest, FatBounds) {
+    DynamicAABBTree tree(0.5f);
+    BoundingBox box;
+    box.min = glm::vec3(0.0f);
+    box.max = glm::vec3(1.0f);
+    ProxyID proxy = tree.createProxy(box, 7);
+    EXPECT_EQ(tree.getUserData(proxy), 7u);
+    EXPECT_TRUE(tree.getFatBounds(proxy).contains(box));
+
+    BoundingBox nudged = box;
+    nudged.min += glm::vec3(0.25f);
+    nudged.max += glm::vec3(0.25f);
+    EXPECT_FALSE(tree.moveProxy(proxy, nudged));
+
+    BoundingBox moved = box;
+    moved.min += glm::vec3(5.0f);
+    moved.max += glm::vec3(5.0f);
+    EXPECT_TRUE(tree.moveProxy(proxy, moved));
+    EXPECT_TRUE(tree.getFatBounds(proxy).contains(moved));
+    EXPECT_TRUE(tree.validate());
+}
+
+// Test box, sphere and frustum queries against brute force
+TEST(DynamicAABBTreeTest, QueriesMatchBruteForce) {
+    TreeFixture f;
+    f.populate(2000);
+
+    for (int i = 0; i < 50; ++i) {
+        BoundingBox region = f.random.box();
+        region.min -= glm::vec3(5.0f);
+        region.max += glm::vec3(5.0f);
+        std::vector<ProxyID> found;
+        f.tree.query(region, [&](ProxyID id) { found.push_back(id); return true; });
+        EXPECT_EQ(sorted(found), f.bruteForce([&](const BoundingBox& b) { return b.intersects(region); }));
+
+        glm::vec3 center = f.random.point();
+        float radius = 8.0f;
+        found.clear();
+        f.tree.querySphere(center, radius, [&](ProxyID id) { found.push_back(id); return true; });
+        EXPECT_EQ(sorted(found), f.bruteForce([&](const BoundingBox& b) {
+            return b.distanceSquared(center) <= radius * radius;
+        }));
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        glm::vec3 eye = f.random.point();
+        glm::mat4 view = glm::lookAt(eye, f.random.point(), glm::vec3(0.0f, 1.0f, 0.0f));
+        glm::mat4 projection = glm::perspective(glm::radians(60.0f), 1.5f, 0.1f, 40.0f);
+        Frustum frustum(projection * view);
+
+        std::vector<ProxyID> found;
+        f.tree.query(frustum, [&](ProxyID id) { found.push_back(id); return true; });
+        EXPECT_EQ(sorted(found), f.bruteForce([&](const BoundingBox& b) { return frustum.intersects(b); }));
+    }
+
+    // Returning false stops the query
+    size_t calls = 0;
+    BoundingBox everything;
+    everything.min = glm::vec3(-100.0f);
+    everything.max = glm::vec3(100.0f);
+    f.tree.query(everything, [&](ProxyID) { return ++calls < 3; });
+    EXPECT_EQ(calls, 3u);
+}
+
+// Test raycasts against brute force, including clipping at the first hit
+TEST(DynamicAABBTreeTest, RaycastMatchesBruteForce) {
+    TreeFixture f;
+    f.populate(2000);
+
+    for (int i = 0; i < 50; ++i) {
+        glm::vec3 origin = f.random.point();
+        glm::vec3 direction = glm::normalize(f.random.point() - origin);
+        glm::vec3 invDirection = glm::vec3(1.0f) / direction;
+        const float maxDistance = 60.0f;
+
+        std::vector<ProxyID> found;
+        f.tree.raycast(origin, direction, maxDistance, [&](ProxyID id, float) {
+            found.push_back(id);
+            return maxDistance;
+        });
+        EXPECT_EQ(sorted(found), f.bruteForce([&](const BoundingBox& b) {
+            float entry;
+            return b.intersectsRay(origin, invDirection, maxDistance, entry);
+        }));
+
+        // Nearest hit by clipping
+        float nearest = maxDistance;
+        bool hit = false;
+        f.tree.raycast(origin, direction, maxDistance, [&](ProxyID, float entry) {
+            hit = true;
+            nearest = std::min(nearest, entry);
+            return nearest;
+        });
+
+        float expected = maxDistance;
+        bool expectedHit = false;
+        for (ProxyID proxy : f.proxies) {
+            float entry;
+            if (f.tree.getFatBounds(proxy).intersectsRay(origin, invDirection, maxDistance, entry)) {
+                expectedHit = true;
+                expected = std::min(expected, entry);
+            }
+        }
+        EXPECT_EQ(hit, expectedHit);
+        EXPECT_FLOAT_EQ(nearest, expected);
+    }
+}
+
+// Test k-nearest against brute force
+TEST(DynamicAABBTreeTest, FindNearestMatchesBruteForce) {
+    TreeFixture f;
+    f.populate(2000);
+
+    std::vector<std::pair<float, ProxyID>> nearest;
+    for (int i = 0; i < 50; ++i) {
+        glm::vec3 point = f.random.point();
+        auto distance = [&](ProxyID id) { return f.tree.getFatBounds(id).distanceSquared(point); };
+        f.tree.findNearest(point, 10, distance, nearest);
+
+        std::vector<float> expected;
+        for (ProxyID proxy : f.proxies) {
+            expected.push_back(distance(proxy));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        ASSERT_EQ(nearest.size(), 10u);
+        for (size_t k = 0; k < nearest.size(); ++k) {
+            EXPECT_FLOAT_EQ(nearest[k].first, expected[k]);
+            EXPECT_FLOAT_EQ(nearest[k].first, distance(nearest[k].second));
+        }
+    }
+
+    // Fewer proxies than requested
+    DynamicAABBTree small;
+    small.createProxy(f.random.box(), 0);
+    small.findNearest(glm::vec3(0.0f), 5, [](ProxyID) { return 0.0f; }, nearest);
+    EXPECT_EQ(nearest.size(), 1u);
+}
+
+} // namespace Tests
+} // namespace Pina
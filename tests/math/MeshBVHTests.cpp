@@ -0,0 +1,200 @@
+/// Mesh BVH Tests
+/// Tests for Math/MeshBVH structure and raycasts against brute force over the same triangles
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <random>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+/// Unconnected random triangles in a cube
+struct TriangleSoup {
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> indices;
+
+    TriangleSoup(size_t count, uint32_t seed, float extent = 1.0f) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> position(-20.0f, 20.0f);
+        std::uniform_real_distribution<float> offset(-extent, extent);
+        for (size_t t = 0; t < count; ++t) {
+            glm::vec3 center(position(rng), position(rng), position(rng));
+            for (int k = 0; k < 3; ++k) {
+                indices.push_back(static_cast<uint32_t>(positions.size()));
+                positions.push_back(center + glm::vec3(offset(rng), offset(rng), offset(rng)));
+            }
+        }
+    }
+
+    size_t triangleCount() const { return indices.size() / 3; }
+
+    bool bruteForce(const glm::vec3& origin, const glm::vec3& direction, float maxDistance,
+                    TriangleHit& hit) const {
+        bool found = false;
+        for (size_t t = 0; t < triangleCount(); ++t) {
+            float distance, u, v;
+            if (MeshBVH::intersectTriangle(origin, direction, positions[indices[t * 3]],
+                                           positions[indices[t * 3 + 1]], positions[indices[t * 3 + 2]],
+                                           maxDistance, distance, u, v) &&
+                (!found || distance < hit.distance)) {
+                found = true;
+                hit.triangle = static_cast<uint32_t>(t);
+                hit.distance = distance;
+            }
+        }
+        return found;
+    }
+};
+
+struct RandomRays {
+    std::mt19937 rng{23};
+    std::uniform_real_distribution<float> position{-30.0f, 30.0f};
+
+    void next(glm::vec3& origin, glm::vec3& direction) {
+        origin = glm::vec3(position(rng), position(rng), position(rng));
+        glm::vec3 target(position(rng) * 0.5f, position(rng) * 0.5f, position(rng) * 0.5f);
+        direction = glm::normalize(target - origin);
+    }
+};
+
+} // namespace
+
+// Test an empty build
+TEST(MeshBVHTest, Empty) {
+    MeshBVH bvh;
+    bvh.build(nullptr, nullptr, 0);
+    EXPECT_FALSE(bvh.isBuilt());
+    EXPECT_TRUE(bvh.validate(nullptr, nullptr));
+
+    TriangleHit hit;
+    EXPECT_FALSE(bvh.raycast(nullptr, nullptr, glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), 100.0f, hit));
+}
+
+// Test the tree structure and its SAH cost
+TEST(MeshBVHTest, Structure) {
+    TriangleSoup soup(5000, 3);
+    MeshBVH bvh;
+    bvh.build(soup.positions.data(), soup.indices.data(), soup.triangleCount());
+
+    EXPECT_TRUE(bvh.isBuilt());
+    EXPECT_EQ(bvh.getTriangleCount(), soup.triangleCount());
+    EXPECT_TRUE(bvh.validate(soup.positions.data(), soup.indices.data()));
+    EXPECT_LE(bvh.getDepth(), MeshBVH::MaxDepth);
+    for (const MeshBVH::Node& node : bvh.getNodes()) {
+        EXPECT_LE(node.count, MeshBVH::MaxLeafSize);
+    }
+
+    // A good tree costs far less than testing every triangle
+    EXPECT_LT(bvh.getCost(), soup.triangleCount() * 0.02f);
+}
+
+// Test raycasts against a test of every triangle
+TEST(MeshBVHTest, RaycastMatchesBruteForce) {
+    TriangleSoup soup(3000, 7);
+    MeshBVH bvh;
+    bvh.build(soup.positions.data(), soup.indices.data(), soup.triangleCount());
+
+    RandomRays rays;
+    size_t hits = 0;
+    for (int i = 0; i < 2000; ++i) {
+        glm::vec3 origin, direction;
+        rays.next(origin, direction);
+        float maxDistance = i % 4 == 0 ? 15.0f : 1000.0f;
+
+        TriangleHit expected, actual;
+        bool expectedFound = soup.bruteForce(origin, direction, maxDistance, expected);
+        bool found = bvh.raycast(soup.positions.data(), soup.indices.data(), origin, direction, maxDistance, actual);
+        ASSERT_EQ(found, expectedFound) << "ray " << i;
+        if (found) {
+            EXPECT_EQ(actual.triangle, expected.triangle) << "ray " << i;
+            EXPECT_FLOAT_EQ(actual.distance, expected.distance) << "ray " << i;
+            hits++;
+        }
+    }
+    EXPECT_GT(hits, 100u);
+    EXPECT_LT(hits, 2000u);
+}
+
+// Test a hit's distance and barycentrics on a single triangle
+TEST(MeshBVHTest, TriangleHit) {
+    std::vector<glm::vec3> positions = {{0.0f, 0.0f, -5.0f}, {4.0f, 0.0f, -5.0f}, {0.0f, 4.0f, -5.0f}};
+    std::vector<uint32_t> indices = {0, 1, 2};
+    MeshBVH bvh;
+    bvh.build(positions.data(), indices.data(), 1);
+
+    TriangleHit hit;
+    ASSERT_TRUE(bvh.raycast(positions.data(), indices.data(), glm::vec3(1.0f, 2.0f, 0.0f),
+                            glm::vec3(0.0f, 0.0f, -2.0f), 100.0f, hit));
+    EXPECT_EQ(hit.triangle, 0u);
+    EXPECT_FLOAT_EQ(hit.distance, 2.5f);  // In units of the (unnormalized) direction
+    EXPECT_FLOAT_EQ(hit.u, 0.25f);
+    EXPECT_FLOAT_EQ(hit.v, 0.5f);
+
+    // Back side, out of reach, and beside the triangle
+    EXPECT_TRUE(bvh.raycast(positions.data(), indices.data(), glm::vec3(1.0f, 1.0f, -10.0f),
+                            glm::vec3(0.0f, 0.0f, 1.0f), 100.0f, hit));
+    EXPECT_FALSE(bvh.raycast(positions.data(), indices.data(), glm::vec3(1.0f, 1.0f, 0.0f),
+                             glm::vec3(0.0f, 0.0f, -1.0f), 4.0f, hit));
+    EXPECT_FALSE(bvh.raycast(positions.data(), indices.data(), glm::vec3(3.0f, 3.0f, 0.0f),
+                             glm::vec3(0.0f, 0.0f, -1.0f), 100.0f, hit));
+}
+
+// Test triangles that share one centroid (no bin can separate them)
+TEST(MeshBVHTest, CoincidentCentroids) {
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> indices;
+    for (int t = 0; t < 100; ++t) {
+        float size = 1.0f + t * 0.01f;
+        indices.insert(indices.end(), {static_cast<uint32_t>(positions.size()),
+                                       static_cast<uint32_t>(positions.size() + 1),
+                                       static_cast<uint32_t>(positions.size() + 2)});
+        positions.emplace_back(-size, -size, 0.0f);
+        positions.emplace_back(2.0f * size, -size, 0.0f);
+        positions.emplace_back(-size, 2.0f * size, 0.0f);
+    }
+
+    MeshBVH bvh;
+    bvh.build(positions.data(), indices.data(), 100);
+    EXPECT_TRUE(bvh.validate(positions.data(), indices.data()));
+    for (const MeshBVH::Node& node : bvh.getNodes()) {
+        EXPECT_LE(node.count, MeshBVH::MaxLeafSize);
+    }
+
+    TriangleHit hit;
+    EXPECT_TRUE(bvh.raycast(positions.data(), indices.data(), glm::vec3(0.0f, 0.0f, 3.0f),
+                            glm::vec3(0.0f, 0.0f, -1.0f), 100.0f, hit));
+    EXPECT_FLOAT_EQ(hit.distance, 3.0f);
+}
+
+// Test that a build on the job system matches a serial build exactly
+TEST(MeshBVHTest, JobSystem) {
+    JobSystemConfig jobConfig;
+    jobConfig.workerCount = 3;
+    JobSystem jobs(jobConfig);
+    jobs.initialize();
+
+    TriangleSoup soup(MeshBVH::ParallelThreshold * 4, 13, 0.2f);
+    MeshBVH serial, parallel;
+    serial.build(soup.positions.data(), soup.indices.data(), soup.triangleCount());
+    parallel.build(soup.positions.data(), soup.indices.data(), soup.triangleCount(), &jobs);
+
+    EXPECT_TRUE(parallel.validate(soup.positions.data(), soup.indices.data()));
+    EXPECT_EQ(parallel.getTriangleOrder(), serial.getTriangleOrder());
+    ASSERT_EQ(parallel.getNodeCount(), serial.getNodeCount());
+    for (size_t i = 0; i < serial.getNodeCount(); ++i) {
+        const MeshBVH::Node& a = serial.getNodes()[i];
+        const MeshBVH::Node& b = parallel.getNodes()[i];
+        EXPECT_EQ(a.first, b.first);
+        EXPECT_EQ(a.count, b.count);
+        EXPECT_EQ(a.bounds.min, b.bounds.min);
+        EXPECT_EQ(a.bounds.max, b.bounds.max);
+    }
+
+    jobs.shutdown();
+}
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,258 @@
+/// SIMD Math Tests
+/// Tests for Math/SimdMath kernels against the equivalent glm math
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+constexpr float kTolerance = 1e-4f;
+
+void expectNear(const glm::vec3& actual, const glm::vec3& expected, float tolerance = kTolerance) {
+    EXPECT_NEAR(actual.x, expected.x, tolerance);
+    EXPECT_NEAR(actual.y, expected.y, tolerance);
+    EXPECT_NEAR(actual.z, expected.z, tolerance);
+}
+
+void expectMatrixNear(const glm::mat4& actual, const glm::mat4& expected, float tolerance = kTolerance) {
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            EXPECT_NEAR(actual[c][r], expected[c][r], tolerance) << "column " << c << " row " << r;
+        }
+    }
+}
+
+void expectMatrixNear(const glm::mat3& actual, const glm::mat3& expected, float tolerance = kTolerance) {
+    for (int c = 0; c < 3; ++c) {
+        expectNear(actual[c], expected[c], tolerance);
+    }
+}
+
+struct RandomTRS {
+    std::mt19937 rng{7};
+    std::uniform_real_distribution<float> value{-3.0f, 3.0f};
+    std::uniform_real_distribution<float> scale{0.25f, 2.0f};
+
+    glm::vec3 position() { return glm::vec3(value(rng), value(rng), value(rng)); }
+    glm::quat rotation() {
+        return glm::angleAxis(value(rng), glm::normalize(glm::vec3(value(rng), value(rng), value(rng)) + 0.01f));
+    }
+    glm::vec3 scales() { return glm::vec3(scale(rng), scale(rng), scale(rng)); }
+
+    glm::mat4 matrix() {
+        return glm::translate(glm::mat4(1.0f), position()) * glm::mat4_cast(rotation()) *
+               glm::scale(glm::mat4(1.0f), scales());
+    }
+};
+
+} // namespace
+
+// Test TRS composition against translate * rotate * scale
+TEST(SimdMathTest, ComposeTRS) {
+    RandomTRS random;
+    for (int i = 0; i < 100; ++i) {
+        glm::vec3 p = random.position();
+        glm::quat q = random.rotation();
+        glm::vec3 s = random.scales();
+        glm::mat4 expected = glm::translate(glm::mat4(1.0f), p) * glm::mat4_cast(q) * glm::scale(glm::mat4(1.0f), s);
+        expectMatrixNear(SimdMath::composeTRS(p, q, s), expected);
+    }
+}
+
+// Test affine multiply, inverse and normal matrix against glm
+TEST(SimdMathTest, AffineMatrices) {
+    RandomTRS random;
+    for (int i = 0; i < 100; ++i) {
+        glm::mat4 a = random.matrix();
+        glm::mat4 b = random.matrix();
+        expectMatrixNear(SimdMath::multiplyAffine(a, b), a * b);
+        expectMatrixNear(SimdMath::inverseAffine(a), glm::inverse(a));
+        expectMatrixNear(SimdMath::normalMatrix(a), glm::transpose(glm::inverse(glm::mat3(a))));
+    }
+
+    // Uniform scale path, including a mirroring negative scale
+    for (float scale : {0.5f, 3.0f, -2.0f}) {
+        glm::mat4 m = glm::translate(glm::mat4(1.0f), random.position()) * glm::mat4_cast(random.rotation()) *
+                      glm::scale(glm::mat4(1.0f), glm::vec3(scale));
+        expectMatrixNear(SimdMath::normalMatrix(m, scale), glm::transpose(glm::inverse(glm::mat3(m))));
+    }
+}
+
+// Test that array kernels match the single-item kernels
+TEST(SimdMathTest, MatrixArrays) {
+    RandomTRS random;
+    const size_t count = 37;
+    std::vector<glm::vec3> positions, scales;
+    std::vector<glm::quat> rotations;
+    std::vector<glm::mat4> a, b;
+    for (size_t i = 0; i < count; ++i) {
+        positions.push_back(random.position());
+        rotations.push_back(random.rotation());
+        scales.push_back(random.scales());
+        a.push_back(random.matrix());
+        b.push_back(random.matrix());
+    }
+
+    std::vector<glm::mat4> composed(count), products(count), inverses(count);
+    std::vector<glm::mat3> normals(count);
+    SimdMath::composeTRS(positions.data(), rotations.data(), scales.data(), composed.data(), count);
+    SimdMath::multiplyAffine(a.data(), b.data(), products.data(), count);
+    SimdMath::inverseAffine(a.data(), inverses.data(), count);
+    SimdMath::normalMatrix(a.data(), normals.data(), count);
+
+    for (size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(composed[i], SimdMath::composeTRS(positions[i], rotations[i], scales[i]));
+        EXPECT_EQ(products[i], SimdMath::multiplyAffine(a[i], b[i]));
+        EXPECT_EQ(inverses[i], SimdMath::inverseAffine(a[i]));
+        EXPECT_EQ(normals[i], SimdMath::normalMatrix(a[i]));
+    }
+}
+
+// Test point and normal batches, including counts that leave a remainder
+TEST(SimdMathTest, TransformPointsAndNormals) {
+    RandomTRS random;
+    glm::mat4 m = random.matrix();
+    glm::mat3 n = glm::transpose(glm::inverse(glm::mat3(m)));
+
+    for (size_t count : {0u, 1u, 3u, 4u, 5u, 8u, 103u}) {
+        std::vector<glm::vec3> points, dirs;
+        for (size_t i = 0; i < count; ++i) {
+            points.push_back(random.position());
+            dirs.push_back(glm::normalize(random.position() + 0.01f));
+        }
+
+        std::vector<glm::vec3> outPoints(count), outNormals(count), raw(count);
+        SimdMath::transformPoints(m, points.data(), outPoints.data(), count);
+        SimdMath::transformNormals(n, dirs.data(), outNormals.data(), count);
+        SimdMath::transformNormals(n, dirs.data(), raw.data(), count, false);
+
+        for (size_t i = 0; i < count; ++i) {
+            expectNear(outPoints[i], glm::vec3(m * glm::vec4(points[i], 1.0f)));
+            expectNear(outNormals[i], glm::normalize(n * dirs[i]));
+            expectNear(raw[i], n * dirs[i]);
+        }
+
+        // In place
+        SimdMath::transformPoints(m, points.data(), points.data(), count);
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_EQ(points[i], outPoints[i]);
+        }
+    }
+}
+
+// Test box transforms against the eight transformed corners
+TEST(SimdMathTest, TransformBoxes) {
+    RandomTRS random;
+    std::vector<glm::mat4> matrices;
+    std::vector<BoundingBox> boxes;
+    for (int i = 0; i < 50; ++i) {
+        BoundingBox box;
+        box.expand(random.position());
+        box.expand(random.position());
+        boxes.push_back(box);
+        matrices.push_back(random.matrix());
+    }
+    boxes.push_back(BoundingBox());     // Invalid boxes pass through
+    matrices.push_back(random.matrix());
+
+    std::vector<BoundingBox> out(boxes.size());
+    SimdMath::transformBoxes(matrices.data(), boxes.data(), out.data(), boxes.size());
+
+    for (size_t i = 0; i + 1 < boxes.size(); ++i) {
+        BoundingBox expected;
+        for (int corner = 0; corner < 8; ++corner) {
+            glm::vec3 p((corner & 1) ? boxes[i].max.x : boxes[i].min.x,
+                        (corner & 2) ? boxes[i].max.y : boxes[i].min.y,
+                        (corner & 4) ? boxes[i].max.z : boxes[i].min.z);
+            expected.expand(glm::vec3(matrices[i] * glm::vec4(p, 1.0f)));
+        }
+        expectNear(out[i].min, expected.min);
+        expectNear(out[i].max, expected.max);
+        expectNear(out[i].min, boxes[i].transformed(matrices[i]).min);
+    }
+    EXPECT_FALSE(out.back().isValid());
+}
+
+// Test expanding a box by a batch of points
+TEST(SimdMathTest, ExpandBox) {
+    RandomTRS random;
+    std::vector<glm::vec3> points;
+    for (int i = 0; i < 23; ++i) {
+        points.push_back(random.position());
+    }
+
+    BoundingBox expected;
+    for (const glm::vec3& p : points) {
+        expected.expand(p);
+    }
+
+    BoundingBox box;
+    SimdMath::expandBox(box, points.data(), points.size());
+    EXPECT_EQ(box.min, expected.min);
+    EXPECT_EQ(box.max, expected.max);
+
+    // Expanding an existing box keeps its extent
+    BoundingBox big;
+    big.expand(glm::vec3(-10.0f));
+    big.expand(glm::vec3(10.0f));
+    SimdMath::expandBox(big, points.data(), points.size());
+    EXPECT_EQ(big.min, glm::vec3(-10.0f));
+    EXPECT_EQ(big.max, glm::vec3(10.0f));
+}
+
+// Test batched box and sphere frustum tests against Frustum
+TEST(SimdMathTest, FrustumCulling) {
+    std::mt19937 rng(13);
+    std::uniform_real_distribution<float> position(-30.0f, 30.0f);
+    std::uniform_real_distribution<float> extent(0.05f, 3.0f);
+
+    std::vector<BoundingBox> boxes;
+    std::vector<glm::vec4> spheres;
+    for (int i = 0; i < 1001; ++i) {
+        glm::vec3 center(position(rng), position(rng), position(rng));
+        glm::vec3 half(extent(rng), extent(rng), extent(rng));
+        BoundingBox box;
+        box.min = center - half;
+        box.max = center + half;
+        boxes.push_back(box);
+        spheres.push_back(glm::vec4(center, half.x));
+    }
+
+    std::vector<uint8_t> visible(boxes.size());
+    for (int i = 0; i < 10; ++i) {
+        glm::vec3 eye(position(rng), position(rng), position(rng));
+        glm::mat4 view = glm::lookAt(eye, glm::vec3(position(rng), 0.0f, position(rng)), glm::vec3(0.0f, 1.0f, 0.0f));
+        glm::mat4 projection = (i % 2)
+            ? glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 40.0f)
+            : glm::ortho(-15.0f, 15.0f, -10.0f, 10.0f, 0.1f, 50.0f);
+        Frustum frustum(projection * view);
+        SimdMath::FrustumPlanes planes = SimdMath::preparePlanes(frustum);
+
+        size_t inside = 0;
+        SimdMath::cullBoxes(planes, boxes.data(), visible.data(), boxes.size());
+        for (size_t b = 0; b < boxes.size(); ++b) {
+            bool expected = frustum.intersects(boxes[b]);
+            EXPECT_EQ(visible[b] != 0, expected) << "box " << b;
+            EXPECT_EQ(SimdMath::intersects(planes, boxes[b]), expected);
+            inside += expected;
+        }
+        EXPECT_GT(inside, 0u);
+
+        SimdMath::cullSpheres(planes, spheres.data(), visible.data(), spheres.size());
+        for (size_t b = 0; b < spheres.size(); ++b) {
+            glm::vec3 center(spheres[b]);
+            bool expected = frustum.intersects(center, spheres[b].w);
+            EXPECT_EQ(visible[b] != 0, expected) << "sphere " << b;
+            EXPECT_EQ(SimdMath::intersects(planes, center, spheres[b].w), expected);
+        }
+    }
+}
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,144 @@
+/// Headless Tests
+/// Tests for Platform/Headless subsystems and headless Application runs
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <atomic>
+
+namespace Pina {
+namespace Tests {
+
+// Test headless window simulates close and resize
+TEST(HeadlessWindowTest, CloseAndResize) {
+    HeadlessWindow window;
+    WindowConfig config;
+    config.width = 640;
+    config.height = 480;
+    ASSERT_TRUE(window.create(config));
+
+    int resizedWidth = 0;
+    bool closed = false;
+    window.setResizeCallback([&](int w, int h) { (void)h; resizedWidth = w; });
+    window.setCloseCallback([&]() { closed = true; });
+
+    window.resize(800, 600);
+    EXPECT_EQ(resizedWidth, 800);
+    EXPECT_EQ(window.getHeight(), 600);
+
+    EXPECT_FALSE(window.shouldClose());
+    window.requestClose();
+    EXPECT_TRUE(window.shouldClose());
+    EXPECT_TRUE(closed);
+}
+
+// Test headless window frame limit closes the window
+TEST(HeadlessWindowTest, FrameLimit) {
+    HeadlessWindow window;
+    window.create(WindowConfig());
+    window.setFrameLimit(3);
+
+    window.pollEvents();
+    window.pollEvents();
+    EXPECT_FALSE(window.shouldClose());
+    window.pollEvents();
+    EXPECT_TRUE(window.shouldClose());
+}
+
+// Test headless input edge detection
+TEST(HeadlessInputTest, KeyEdges) {
+    HeadlessInput input;
+
+    input.processKeyDown(Key::W);
+    EXPECT_TRUE(input.isKeyDown(Key::W));
+    EXPECT_TRUE(input.isKeyPressed(Key::W));
+
+    input.advanceFrame();
+    EXPECT_TRUE(input.isKeyDown(Key::W));
+    EXPECT_FALSE(input.isKeyPressed(Key::W));
+
+    input.processKeyUp(Key::W);
+    EXPECT_TRUE(input.isKeyReleased(Key::W));
+}
+
+// Test headless input forwards events to the dispatcher
+TEST(HeadlessInputTest, DispatchesEvents) {
+    EventDispatcher dispatcher;
+    HeadlessInput input;
+    input.setEventDispatcher(&dispatcher);
+
+    int presses = 0;
+    dispatcher.subscribe<MouseButtonPressedEvent>([&](MouseButtonPressedEvent&) { presses++; });
+
+    input.processMouseDown(MouseButton::Left);
+    EXPECT_EQ(presses, 1);
+    EXPECT_TRUE(input.isMouseButtonDown(MouseButton::Left));
+}
+
+// Headless application that renders a scene through the pipeline
+class HeadlessApplication : public Application {
+public:
+    explicit HeadlessApplication(uint64_t frames) {
+        m_config.headless = true;
+        m_config.maxFrames = frames;
+        m_config.windowWidth = 320;
+        m_config.windowHeight = 240;
+        m_config.jobWorkerCount = 2;
+    }
+
+    int updateCount = 0;
+    uint32_t shaderBinds = 0;
+    std::atomic<size_t> jobItems{0};
+    int framesWithStaleArena = 0;
+
+protected:
+    void onInit() override {
+        m_scene.setDevice(getDevice());
+        m_scene.createCube("Cube");
+        m_camera = m_scene.getOrCreateDefaultCamera();
+    }
+
+    void onUpdate(float deltaTime) override {
+        (void)deltaTime;
+        updateCount++;
+
+        // Frame arena must have been reset by the previous frame
+        if (getFrameArena().getUsed() != 0) {
+            framesWithStaleArena++;
+        }
+        getFrameArena().allocate(256);
+
+        if (auto* jobs = getJobSystem()) {
+            jobs->parallelFor(0, 100, 10, [this](size_t begin, size_t end) {
+                jobItems.fetch_add(end - begin);
+            });
+        }
+    }
+
+    void onRender() override {
+        getPipeline()->render(&m_scene, m_camera, 0.016f);
+    }
+
+    void onShutdown() override {
+        auto* device = dynamic_cast<RecordingDevice*>(getDevice());
+        shaderBinds = device ? device->getStats().shaderBinds : 0;
+    }
+
+private:
+    Scene m_scene;
+    Camera* m_camera = nullptr;
+};
+
+// Test Application::run completes a fixed number of frames headlessly
+TEST(HeadlessApplicationTest, RunsFixedFrames) {
+    HeadlessApplication app(5);
+
+    EXPECT_EQ(app.run(), 0);
+    EXPECT_EQ(app.getFrameCount(), 5u);
+    EXPECT_EQ(app.updateCount, 5);
+    EXPECT_GT(app.shaderBinds, 0u);
+    EXPECT_EQ(app.jobItems.load(), 500u);
+    EXPECT_EQ(app.framesWithStaleArena, 0);
+}
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,348 @@
+/// Input Replay Tests
+/// Tests for Input/InputRecorder and the headless ReplayInput
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+/// Input state visible to game code in one frame
+struct InputSnapshot {
+    glm::vec2 position;
+    glm::vec2 delta;
+    glm::vec2 scroll;
+    bool wDown;
+    bool wPressed;
+    bool leftDown;
+    bool leftReleased;
+    bool focus;
+
+    bool operator==(const InputSnapshot& o) const {
+        return position == o.position && delta == o.delta && scroll == o.scroll &&
+               wDown == o.wDown && wPressed == o.wPressed && leftDown == o.leftDown &&
+               leftReleased == o.leftReleased && focus == o.focus;
+    }
+};
+
+InputSnapshot snapshot(const Input& input) {
+    return {input.getMousePosition(), input.getMouseDelta(), input.getScrollDelta(),
+            input.isKeyDown(Key::W), input.isKeyPressed(Key::W),
+            input.isMouseButtonDown(MouseButton::Left),
+            input.isMouseButtonReleased(MouseButton::Left), input.hasFocus()};
+}
+
+/// Scripted session: camera drag, key hold, scroll and a focus change
+void injectFrame(HeadlessInput& input, int frame) {
+    input.processMouseMove(100.0f + frame * 3.25f, 50.0f - frame * 0.1f);
+    if (frame % 4 == 0) {
+        input.processMouseMove(100.0f + frame * 3.5f, 50.0f + frame / 3.0f);
+    }
+    if (frame == 2) {
+        input.processModifiersChanged(KeyModifier::Shift);
+        input.processKeyDown(Key::W);
+    }
+    if (frame == 5) input.processKeyDown(Key::W);   // Repeat
+    if (frame == 8) input.processKeyUp(Key::W);
+    if (frame == 3) input.processMouseDown(MouseButton::Left);
+    if (frame == 9) input.processMouseUp(MouseButton::Left);
+    if (frame == 6) input.processScroll(0.0f, -1.5f);
+    if (frame == 10) input.processFocusChange(false);
+    if (frame == 11) input.processFocusChange(true);
+}
+
+constexpr int kScriptFrames = 14;
+constexpr float kFixedDelta = 1.0f / 60.0f;
+
+} // namespace
+
+// Test the recorder captures event fields and frame numbers
+TEST(InputRecorderTest, CapturesEvents) {
+    EventDispatcher dispatcher;
+    HeadlessInput input;
+    input.setEventDispatcher(&dispatcher);
+
+    InputRecorder recorder;
+    recorder.start(&dispatcher);
+    EXPECT_TRUE(recorder.isRecording());
+
+    input.processKeyDown(Key::A);
+    recorder.endFrame();
+    input.processMouseMove(10.0f, 20.0f);
+    input.processMouseDown(MouseButton::Right);
+    recorder.endFrame();
+    input.processScroll(0.5f, 2.0f);
+    recorder.stop();
+
+    // Not recorded after stop
+    input.processKeyUp(Key::A);
+    EXPECT_FALSE(recorder.isRecording());
+    EXPECT_EQ(dispatcher.getHandlerCount<KeyReleasedEvent>(), 0u);
+
+    const InputRecording& recording = recorder.getRecording();
+    EXPECT_EQ(recording.frameCount, 2u);
+    ASSERT_EQ(recording.events.size(), 4u);
+
+    EXPECT_EQ(recording.events[0].type, RecordedInputType::KeyDown);
+    EXPECT_EQ(recording.events[0].key, Key::A);
+    EXPECT_EQ(recording.events[0].frame, 0u);
+
+    EXPECT_EQ(recording.events[1].type, RecordedInputType::MouseMove);
+    EXPECT_EQ(recording.events[1].position, glm::vec2(10.0f, 20.0f));
+    EXPECT_EQ(recording.events[1].frame, 1u);
+
+    EXPECT_EQ(recording.events[2].type, RecordedInputType::MouseDown);
+    EXPECT_EQ(recording.events[2].button, MouseButton::Right);
+
+    EXPECT_EQ(recording.events[3].type, RecordedInputType::Scroll);
+    EXPECT_EQ(recording.events[3].delta, glm::vec2(0.5f, 2.0f));
+    EXPECT_EQ(recording.events[3].frame, 2u);
+    EXPECT_GE(recording.events[3].time, recording.events[0].time);
+}
+
+// Test the recorder sees events before a consuming handler
+TEST(InputRecorderTest, RecordsConsumedEvents) {
+    EventDispatcher dispatcher;
+    dispatcher.subscribe<KeyPressedEvent>([](KeyPressedEvent& e) { e.consume(); });
+
+    InputRecorder recorder;
+    recorder.start(&dispatcher);
+
+    KeyPressedEvent event(Key::Escape, KeyModifier::None);
+    dispatcher.dispatch(event);
+    EXPECT_EQ(recorder.getRecording().events.size(), 1u);
+}
+
+// Test recordings round-trip through a file bit-exact
+TEST(InputRecorderTest, SaveLoadRoundTrip) {
+    InputRecording recording;
+    recording.frameCount = 42;
+
+    RecordedInputEvent move;
+    move.frame = 7;
+    move.time = 0.123456789012345;
+    move.type = RecordedInputType::MouseMove;
+    move.position = glm::vec2(1.0f / 3.0f, 123456.789f);
+    move.delta = glm::vec2(-0.1f, 1e-7f);
+    recording.events.push_back(move);
+
+    RecordedInputEvent key;
+    key.frame = 9;
+    key.type = RecordedInputType::KeyDown;
+    key.key = Key::Space;
+    key.modifiers = KeyModifier::Control;
+    key.flag = true;
+    recording.events.push_back(key);
+
+    std::string path = ::testing::TempDir() + "pina_input_roundtrip.txt";
+    ASSERT_TRUE(recording.save(path));
+
+    InputRecording loaded;
+    ASSERT_TRUE(loaded.load(path));
+    std::remove(path.c_str());
+
+    EXPECT_EQ(loaded.frameCount, 42u);
+    ASSERT_EQ(loaded.events.size(), 2u);
+    EXPECT_EQ(loaded.events[0].frame, 7u);
+    EXPECT_EQ(loaded.events[0].time, move.time);
+    EXPECT_EQ(loaded.events[0].type, RecordedInputType::MouseMove);
+    EXPECT_EQ(loaded.events[0].position, move.position);
+    EXPECT_EQ(loaded.events[0].delta, move.delta);
+    EXPECT_EQ(loaded.events[1].type, RecordedInputType::KeyDown);
+    EXPECT_EQ(loaded.events[1].key, Key::Space);
+    EXPECT_EQ(loaded.events[1].modifiers, KeyModifier::Control);
+    EXPECT_TRUE(loaded.events[1].flag);
+}
+
+// Test malformed files are rejected without touching the recording
+TEST(InputRecorderTest, LoadRejectsMalformedFiles) {
+    std::string path = ::testing::TempDir() + "pina_input_bad.txt";
+    {
+        std::ofstream file(path);
+        file << "pina-input 1\nframes 3\nevents 1\n0 0 teleport 0 0 0 0 0 0 0 0\n";
+    }
+
+    InputRecording recording;
+    recording.frameCount = 5;
+    EXPECT_FALSE(recording.load(path));
+    EXPECT_EQ(recording.frameCount, 5u);
+    std::remove(path.c_str());
+
+    EXPECT_FALSE(recording.load(::testing::TempDir() + "pina_input_missing.txt"));
+}
+
+// Test replay reproduces the per-frame input state and event stream of a live session
+TEST(ReplayInputTest, ReproducesLiveSession) {
+    // Live session: events arrive before the Input update, as with OS input
+    EventDispatcher liveDispatcher;
+    HeadlessInput live;
+    live.setEventDispatcher(&liveDispatcher);
+    InputRecorder recorder;
+    recorder.start(&liveDispatcher);
+
+    std::vector<InputSnapshot> liveFrames;
+    for (int frame = 0; frame < kScriptFrames; ++frame) {
+        injectFrame(live, frame);
+        live.update(kFixedDelta);
+        liveFrames.push_back(snapshot(live));
+        live.advanceFrame();
+        recorder.endFrame();
+    }
+    recorder.stop();
+
+    // Replay, re-recording what it dispatches
+    EventDispatcher replayDispatcher;
+    ReplayInput replay(recorder.getRecording());
+    replay.setEventDispatcher(&replayDispatcher);
+    InputRecorder rerecorder;
+    rerecorder.start(&replayDispatcher);
+
+    std::vector<InputSnapshot> replayFrames;
+    while (!replay.isFinished()) {
+        replay.update(kFixedDelta);
+        replayFrames.push_back(snapshot(replay));
+        replay.advanceFrame();
+        rerecorder.endFrame();
+    }
+
+    ASSERT_EQ(replayFrames.size(), liveFrames.size());
+    for (size_t i = 0; i < liveFrames.size(); ++i) {
+        EXPECT_TRUE(replayFrames[i] == liveFrames[i]) << "Frame " << i;
+    }
+
+    const auto& original = recorder.getRecording().events;
+    const auto& replayed = rerecorder.getRecording().events;
+    ASSERT_EQ(replayed.size(), original.size());
+    for (size_t i = 0; i < original.size(); ++i) {
+        EXPECT_EQ(replayed[i].frame, original[i].frame);
+        EXPECT_EQ(replayed[i].type, original[i].type);
+        EXPECT_EQ(replayed[i].key, original[i].key);
+        EXPECT_EQ(replayed[i].modifiers, original[i].modifiers);
+        EXPECT_EQ(replayed[i].flag, original[i].flag);
+        EXPECT_EQ(replayed[i].position, original[i].position);
+        EXPECT_EQ(replayed[i].delta, original[i].delta);
+    }
+}
+
+// Test replayed mouse delta comes from the recording (captured mouse)
+TEST(ReplayInputTest, RecordedMouseDelta) {
+    InputRecording recording;
+    recording.frameCount = 2;
+
+    RecordedInputEvent move;
+    move.type = RecordedInputType::MouseMove;
+    move.position = glm::vec2(320.0f, 240.0f);   // Cursor locked to center
+    move.delta = glm::vec2(4.0f, -2.0f);
+    recording.events.push_back(move);
+    move.delta = glm::vec2(1.0f, 1.0f);
+    recording.events.push_back(move);
+
+    ReplayInput replay(recording);
+    replay.update(kFixedDelta);
+    EXPECT_EQ(replay.getMouseDelta(), glm::vec2(5.0f, -1.0f));
+    replay.advanceFrame();
+
+    replay.update(kFixedDelta);
+    EXPECT_EQ(replay.getMouseDelta(), glm::vec2(0.0f));
+    EXPECT_TRUE(replay.isFinished());
+}
+
+// Headless application that drives input from a script and records what it sees
+class ScriptedInputApplication : public Application {
+public:
+    ScriptedInputApplication(const std::string& recordPath, const std::string& replayPath) {
+        m_config.headless = true;
+        m_config.windowWidth = 320;
+        m_config.windowHeight = 240;
+        m_config.jobWorkerCount = 1;
+        m_config.inputRecordPath = recordPath;
+        m_config.inputReplayPath = replayPath;
+        if (replayPath.empty()) {
+            m_config.maxFrames = kScriptFrames;
+            m_config.fixedDeltaTime = kFixedDelta;
+        }
+    }
+
+    std::vector<InputSnapshot> frames;
+    std::vector<float> deltaTimes;
+    glm::vec2 cameraAngles{0.0f};
+
+protected:
+    void onUpdate(float deltaTime) override {
+        Input* input = getInput();
+        frames.push_back(snapshot(*input));
+        deltaTimes.push_back(deltaTime);
+        cameraAngles += input->getMouseDelta() * deltaTime;
+
+        // Live session only: drive the headless input like an OS would
+        if (m_config.inputReplayPath.empty()) {
+            injectFrame(*static_cast<HeadlessInput*>(input), static_cast<int>(getFrameCount()));
+        }
+    }
+};
+
+// Test an application session replays with identical input state and fixed delta time
+TEST(ReplayInputTest, ApplicationRecordAndReplay) {
+    std::string recordPath = ::testing::TempDir() + "pina_app_input.txt";
+    std::string rerecordPath = ::testing::TempDir() + "pina_app_input_replayed.txt";
+
+    ScriptedInputApplication recordApp(recordPath, "");
+    ASSERT_EQ(recordApp.run(), 0);
+
+    InputRecording recording;
+    ASSERT_TRUE(recording.load(recordPath));
+    EXPECT_EQ(recording.frameCount, static_cast<uint64_t>(kScriptFrames));
+    EXPECT_FALSE(recording.events.empty());
+
+    // Two replays stop when the recording ends and agree bit for bit
+    ScriptedInputApplication first("", recordPath);
+    ASSERT_EQ(first.run(), 0);
+    ScriptedInputApplication second(rerecordPath, recordPath);
+    ASSERT_EQ(second.run(), 0);
+
+    EXPECT_EQ(first.getFrameCount(), static_cast<uint64_t>(kScriptFrames));
+    ASSERT_EQ(first.frames.size(), second.frames.size());
+    for (size_t i = 0; i < first.frames.size(); ++i) {
+        EXPECT_TRUE(first.frames[i] == second.frames[i]) << "Frame " << i;
+        EXPECT_EQ(first.deltaTimes[i], 1.0f / 60.0f);
+    }
+    EXPECT_EQ(first.cameraAngles, second.cameraAngles);
+    EXPECT_NE(first.cameraAngles, glm::vec2(0.0f));
+
+    // Replaying dispatches the recorded event stream again
+    InputRecording rerecorded;
+    ASSERT_TRUE(rerecorded.load(rerecordPath));
+    ASSERT_EQ(rerecorded.events.size(), recording.events.size());
+    for (size_t i = 0; i < recording.events.size(); ++i) {
+        EXPECT_EQ(rerecorded.events[i].type, recording.events[i].type);
+        EXPECT_EQ(rerecorded.events[i].position, recording.events[i].position);
+    }
+
+    std::remove(recordPath.c_str());
+    std::remove(rerecordPath.c_str());
+}
+
+// Test replay is scheduled alone on the main thread, as its update runs event handlers
+TEST(ReplayInputTest, RunsExclusiveOnMainThread) {
+    ReplayInput replay{InputRecording()};
+    SubsystemDependencies deps;
+    replay.declareDependencies(deps);
+    EXPECT_EQ(deps.getPhase(), SubsystemPhase::PreUpdate);
+    EXPECT_TRUE(deps.isMainThread());
+    EXPECT_TRUE(deps.isExclusive());
+}
+
+// Test a missing replay file fails to start
+TEST(ReplayInputTest, ApplicationMissingRecording) {
+    ScriptedInputApplication app("", ::testing::TempDir() + "pina_missing_input.txt");
+    EXPECT_EQ(app.run(), -1);
+}
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,344 @@
+/// Occlusion Culler Tests
+/// Tests for the software depth rasterizer and hierarchical box tests against brute force
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+glm::mat4 testViewProjection() {
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 2.0f, 10.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    return glm::perspective(glm::radians(60.0f), 2.0f, 0.5f, 100.0f) * view;
+}
+
+/// Random quads (two triangles each) scattered in front of the camera
+struct Occluders {
+    std::vector<glm::vec3> positions;
+    std::vector<uint32_t> indices;
+
+    Occluders(size_t quadCount, uint32_t seed) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> center(-8.0f, 8.0f);
+        std::uniform_real_distribution<float> depth(-10.0f, 2.0f);
+        std::uniform_real_distribution<float> edge(-2.5f, 2.5f);
+        for (size_t q = 0; q < quadCount; ++q) {
+            glm::vec3 c(center(rng), center(rng) * 0.5f, depth(rng));
+            glm::vec3 u(edge(rng), edge(rng), edge(rng) * 0.3f);
+            glm::vec3 v(edge(rng), edge(rng), edge(rng) * 0.3f);
+            uint32_t base = static_cast<uint32_t>(positions.size());
+            positions.push_back(c - u - v);
+            positions.push_back(c + u - v);
+            positions.push_back(c + u + v);
+            positions.push_back(c - u + v);
+            indices.insert(indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+    }
+
+    void addTo(OcclusionCuller& culler) const {
+        culler.addOccluder(glm::mat4(1.0f), positions.data(), positions.size(), indices.data(), indices.size());
+    }
+};
+
+std::vector<BoundingBox> randomBoxes(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> position(-12.0f, 12.0f);
+    std::uniform_real_distribution<float> depth(-40.0f, 5.0f);
+    std::uniform_real_distribution<float> extent(0.05f, 1.5f);
+    std::vector<BoundingBox> boxes;
+    for (size_t i = 0; i < count; ++i) {
+        glm::vec3 center(position(rng), position(rng) * 0.5f, depth(rng));
+        glm::vec3 half(extent(rng), extent(rng), extent(rng));
+        BoundingBox box;
+        box.min = center - half;
+        box.max = center + half;
+        boxes.push_back(box);
+    }
+    return boxes;
+}
+
+BoundingBox box(const glm::vec3& center, const glm::vec3& half) {
+    BoundingBox result;
+    result.min = center - half;
+    result.max = center + half;
+    return result;
+}
+
+} // namespace
+
+// Test the tiled SIMD rasterizer against a per-pixel brute force over all
+// triangles: written pixels are covered throughout, no nearer than the
+// occluders anywhere in them, and as near as any triangle covering them alone
+TEST(OcclusionCullerTest, DepthMatchesBruteForce) {
+    OcclusionCuller culler;
+    const glm::mat4 viewProjection = testViewProjection();
+    Occluders occluders(40, 3);
+
+    culler.beginFrame(viewProjection);
+    occluders.addTo(culler);
+    culler.rasterize();
+    EXPECT_EQ(culler.getOccluderTriangleCount(), 80u);
+    EXPECT_GT(culler.getRasterizedTriangleCount(), 0u);
+
+    // Screen-space triangles in double precision
+    const double width = culler.getWidth();
+    const double height = culler.getHeight();
+    std::vector<glm::dvec3> screen;
+    for (const glm::vec3& p : occluders.positions) {
+        glm::vec4 clip = viewProjection * glm::vec4(p, 1.0f);
+        screen.emplace_back((clip.x / clip.w * 0.5 + 0.5) * width, (clip.y / clip.w * 0.5 + 0.5) * height,
+                            clip.z / clip.w);
+    }
+
+    // Barycentric weights of a point in triangle t
+    auto weights = [&](size_t t, double px, double py) {
+        const glm::dvec3& a = screen[occluders.indices[t]];
+        const glm::dvec3& b = screen[occluders.indices[t + 1]];
+        const glm::dvec3& c = screen[occluders.indices[t + 2]];
+        double area = (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+        double w0 = ((c.x - b.x) * (py - b.y) - (c.y - b.y) * (px - b.x)) / area;
+        double w1 = ((a.x - c.x) * (py - c.y) - (a.y - c.y) * (px - c.x)) / area;
+        return glm::dvec3(w0, w1, 1.0 - w0 - w1);
+    };
+    auto depthAt = [&](size_t t, const glm::dvec3& w) {
+        return w.x * screen[occluders.indices[t]].z + w.y * screen[occluders.indices[t + 1]].z +
+               w.z * screen[occluders.indices[t + 2]].z;
+    };
+    const double tolerance = 1e-3;
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    size_t covered = 0;
+    size_t coveredByQuadsOnly = 0;
+    for (uint32_t y = 0; y < culler.getHeight(); ++y) {
+        for (uint32_t x = 0; x < culler.getWidth(); ++x) {
+            // Nearest triangle holding the whole pixel, at its farthest corner
+            double expected = infinity;
+            for (size_t t = 0; t < occluders.indices.size(); t += 3) {
+                double farthest = -infinity;
+                bool inside = true;
+                for (int corner = 0; corner < 4 && inside; ++corner) {
+                    glm::dvec3 w = weights(t, x + (corner & 1), y + (corner >> 1));
+                    inside = std::min(w.x, std::min(w.y, w.z)) > tolerance;
+                    farthest = std::max(farthest, depthAt(t, w));
+                }
+                if (inside) {
+                    expected = std::min(expected, farthest);
+                }
+            }
+
+            float depth = culler.getDepth(x, y);
+            if (!std::isinf(expected)) {
+                EXPECT_LE(depth, expected + 1e-4) << x << ", " << y;
+            }
+            if (std::isinf(depth)) continue;
+
+            covered++;
+            coveredByQuadsOnly += std::isinf(expected);
+
+            // Every point of the pixel lies on an occluder no farther than the depth
+            for (int sample = 0; sample < 9; ++sample) {
+                double px = x + 0.5 * (sample % 3), py = y + 0.5 * (sample / 3);
+                double nearest = infinity;
+                for (size_t t = 0; t < occluders.indices.size(); t += 3) {
+                    glm::dvec3 w = weights(t, px, py);
+                    if (std::min(w.x, std::min(w.y, w.z)) >= -tolerance) {
+                        nearest = std::min(nearest, depthAt(t, w));
+                    }
+                }
+                EXPECT_LE(nearest, depth + 1e-4) << x << ", " << y << " sample " << sample;
+            }
+        }
+    }
+    EXPECT_GT(covered, 0u);
+    EXPECT_LT(covered, static_cast<size_t>(culler.getWidth()) * culler.getHeight());
+
+    // Pixels across a quad's diagonal are written only because its two
+    // triangles are rasterized together
+    EXPECT_GT(coveredByQuadsOnly, 0u);
+
+    // Tile depths are the farthest of their pixels
+    for (uint32_t ty = 0; ty < culler.getTileCountY(); ++ty) {
+        for (uint32_t tx = 0; tx < culler.getTileCountX(); ++tx) {
+            float farthest = -std::numeric_limits<float>::infinity();
+            for (uint32_t y = 0; y < OcclusionCuller::TileSize; ++y) {
+                for (uint32_t x = 0; x < OcclusionCuller::TileSize; ++x) {
+                    farthest = std::max(farthest, culler.getDepth(tx * OcclusionCuller::TileSize + x,
+                                                                  ty * OcclusionCuller::TileSize + y));
+                }
+            }
+            EXPECT_EQ(culler.getTileMaxDepth(tx, ty), farthest);
+        }
+    }
+}
+
+// Test the hierarchical box test against a per-pixel test over the same depth
+TEST(OcclusionCullerTest, BoxesMatchReference) {
+    OcclusionCuller culler;
+    Occluders occluders(60, 5);
+    culler.beginFrame(testViewProjection());
+    occluders.addTo(culler);
+    culler.rasterize();
+
+    std::vector<BoundingBox> boxes = randomBoxes(3000, 11);
+    std::vector<uint8_t> visible(boxes.size());
+    culler.testBoxes(boxes.data(), visible.data(), boxes.size());
+
+    size_t hidden = 0;
+    for (size_t i = 0; i < boxes.size(); ++i) {
+        bool expected = culler.isVisibleReference(boxes[i]);
+        EXPECT_EQ(culler.isVisible(boxes[i]), expected) << "box " << i;
+        EXPECT_EQ(visible[i] != 0, expected) << "box " << i;
+        hidden += !expected;
+    }
+    EXPECT_GT(hidden, 0u);
+    EXPECT_LT(hidden, boxes.size());
+}
+
+// Test simple cases behind, in front of and around a wall
+TEST(OcclusionCullerTest, Wall) {
+    OcclusionCuller culler;
+    culler.beginFrame(testViewProjection());
+
+    // Nothing rasterized: everything is visible
+    EXPECT_TRUE(culler.isVisible(box(glm::vec3(0.0f, 0.0f, -20.0f), glm::vec3(1.0f))));
+
+    std::vector<glm::vec3> wall = {
+        {-4.0f, -3.0f, 0.0f}, {4.0f, -3.0f, 0.0f}, {4.0f, 3.0f, 0.0f}, {-4.0f, 3.0f, 0.0f}
+    };
+    std::vector<uint32_t> indices = {0, 1, 2, 0, 2, 3};
+    EXPECT_TRUE(culler.addOccluder(glm::mat4(1.0f), wall.data(), wall.size(), indices.data(), indices.size()));
+    culler.rasterize();
+
+    EXPECT_FALSE(culler.isVisible(box(glm::vec3(0.0f, 0.0f, -2.0f), glm::vec3(1.0f))));
+    EXPECT_TRUE(culler.isVisible(box(glm::vec3(0.0f, 0.0f, 2.0f), glm::vec3(1.0f))));
+
+    // Behind, but reaching past the wall's side
+    EXPECT_TRUE(culler.isVisible(box(glm::vec3(4.0f, 0.0f, -2.0f), glm::vec3(1.0f))));
+
+    // Crossing the wall
+    EXPECT_TRUE(culler.isVisible(box(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f))));
+
+    // Crossing the near plane, and invalid bounds
+    EXPECT_TRUE(culler.isVisible(box(glm::vec3(0.0f, 2.0f, 10.0f), glm::vec3(1.0f))));
+    EXPECT_TRUE(culler.isVisible(BoundingBox()));
+
+    EXPECT_GT(culler.getScreenArea(box(glm::vec3(0.0f), glm::vec3(4.0f, 3.0f, 0.0f))), 0.1f);
+    EXPECT_EQ(culler.getScreenArea(box(glm::vec3(0.0f, 0.0f, 20.0f), glm::vec3(1.0f))), 1.0f);
+    EXPECT_EQ(culler.getScreenArea(box(glm::vec3(200.0f, 0.0f, 0.0f), glm::vec3(1.0f))), 0.0f);
+
+    // The next frame starts empty
+    culler.beginFrame(testViewProjection());
+    EXPECT_TRUE(culler.isVisible(box(glm::vec3(0.0f, 0.0f, -2.0f), glm::vec3(1.0f))));
+}
+
+// Test boxes within a pixel an occluder only partly covers stay visible
+TEST(OcclusionCullerTest, PartlyCoveredPixels) {
+    OcclusionCuller culler;
+    culler.beginFrame(glm::mat4(1.0f));   // Screen x = (ndc + 1) * 128, y = (ndc + 1) * 64
+    auto ndcX = [](float x) { return x / 128.0f - 1.0f; };
+
+    // Wall sloping back to the right, its right edge 0.6 pixels into pixel 140
+    std::vector<glm::vec3> wall = {
+        {-0.9f, -0.5f, 0.05f}, {ndcX(140.6f), -0.5f, 0.5f + 0.5f * ndcX(140.6f)},
+        {ndcX(140.6f), 0.5f, 0.5f + 0.5f * ndcX(140.6f)}, {-0.9f, 0.5f, 0.05f}
+    };
+    std::vector<uint32_t> indices = {0, 1, 2, 0, 2, 3};
+    culler.addOccluder(glm::mat4(1.0f), wall.data(), wall.size(), indices.data(), indices.size());
+    culler.rasterize();
+
+    // Far behind the wall is hidden
+    EXPECT_FALSE(culler.isVisible(box(glm::vec3(-0.3f, 0.0f, 0.9f), glm::vec3(0.1f, 0.1f, 0.01f))));
+
+    // Behind, but just outside the wall's edge within pixel 140
+    BoundingBox outside;
+    outside.min = glm::vec3(ndcX(140.7f), -0.1f, 0.9f);
+    outside.max = glm::vec3(ndcX(140.9f), 0.1f, 0.95f);
+    EXPECT_TRUE(culler.isVisible(outside));
+
+    // Behind the wall at pixel 100's center, but in front of it at the pixel's right side
+    float centerDepth = 0.5f + 0.5f * ndcX(100.5f);
+    BoundingBox slope;
+    slope.min = glm::vec3(ndcX(100.7f), -0.1f, centerDepth + 0.5f * (0.5f / 128.0f) * 0.5f);
+    slope.max = glm::vec3(ndcX(100.9f), 0.1f, 0.95f);
+    EXPECT_TRUE(culler.isVisible(slope));
+    slope.min.z = centerDepth + 0.5f / 128.0f;
+    EXPECT_FALSE(culler.isVisible(slope));
+}
+
+// Test occluders crossing the near plane are skipped rather than clipped
+TEST(OcclusionCullerTest, NearPlaneOccluders) {
+    OcclusionCuller culler;
+    culler.beginFrame(testViewProjection());
+
+    // Floor running from behind the camera into the distance
+    std::vector<glm::vec3> floor = {
+        {-50.0f, 0.0f, 50.0f}, {50.0f, 0.0f, 50.0f}, {50.0f, 0.0f, -50.0f}, {-50.0f, 0.0f, -50.0f}
+    };
+    std::vector<uint32_t> indices = {0, 1, 2, 0, 2, 3};
+    culler.addOccluder(glm::mat4(1.0f), floor.data(), floor.size(), indices.data(), indices.size());
+    culler.rasterize();
+
+    EXPECT_EQ(culler.getRasterizedTriangleCount(), 0u);
+    EXPECT_TRUE(culler.isVisible(box(glm::vec3(0.0f, -3.0f, -20.0f), glm::vec3(1.0f))));
+}
+
+// Test the triangle budget
+TEST(OcclusionCullerTest, TriangleBudget) {
+    OcclusionCullerConfig config;
+    config.maxOccluderTriangles = 100;
+    OcclusionCuller culler(config);
+    culler.beginFrame(testViewProjection());
+
+    Occluders occluders(30, 7);
+    EXPECT_TRUE(culler.addOccluder(glm::mat4(1.0f), occluders.positions.data(), occluders.positions.size(),
+                                   occluders.indices.data(), 180));
+    EXPECT_FALSE(culler.addOccluder(glm::mat4(1.0f), occluders.positions.data(), occluders.positions.size(),
+                                    occluders.indices.data(), 180));
+    EXPECT_EQ(culler.getOccluderTriangleCount(), 60u);
+}
+
+// Test results on the job system match the serial results exactly
+TEST(OcclusionCullerTest, JobSystem) {
+    JobSystemConfig jobConfig;
+    jobConfig.workerCount = 3;
+    JobSystem jobs(jobConfig);
+    jobs.initialize();
+
+    Occluders occluders(2000, 17);
+    std::vector<BoundingBox> boxes = randomBoxes(5000, 19);
+
+    OcclusionCuller serial;
+    OcclusionCuller parallel;
+    parallel.setJobSystem(&jobs);
+
+    std::vector<uint8_t> serialVisible(boxes.size());
+    std::vector<uint8_t> parallelVisible(boxes.size());
+    for (OcclusionCuller* culler : {&serial, &parallel}) {
+        culler->beginFrame(testViewProjection());
+        occluders.addTo(*culler);
+        culler->rasterize();
+    }
+    serial.testBoxes(boxes.data(), serialVisible.data(), boxes.size());
+    parallel.testBoxes(boxes.data(), parallelVisible.data(), boxes.size());
+
+    EXPECT_EQ(parallel.getRasterizedTriangleCount(), serial.getRasterizedTriangleCount());
+    for (uint32_t y = 0; y < serial.getHeight(); ++y) {
+        for (uint32_t x = 0; x < serial.getWidth(); ++x) {
+            ASSERT_EQ(parallel.getDepth(x, y), serial.getDepth(x, y));
+        }
+    }
+    EXPECT_EQ(parallelVisible, serialVisible);
+
+    jobs.shutdown();
+}
+
+} // namespace Tests
+} // namespace Pina
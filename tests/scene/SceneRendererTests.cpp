@@ -0,0 +1,469 @@
+/// Scene Renderer Tests
+/// Tests for SceneRenderer and ShadowPass frustum culling against brute force over world bounds,
+/// and for the render queue the scene pass gathers and submits
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+/// Cubes scattered well beyond the default camera's view, rendered through the pipeline
+struct CulledScene {
+    RecordingDevice device;
+    RenderPipeline pipeline{&device};
+    Scene scene;
+    Camera* camera = nullptr;
+    std::vector<Node*> cubes;
+
+    explicit CulledScene(size_t count) {
+        pipeline.resize(320, 240);
+        pipeline.setToneMappingEnabled(false);
+        scene.setDevice(&device);
+
+        std::mt19937 rng(9);
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f);
+        for (size_t i = 0; i < count; ++i) {
+            Node* cube = scene.createCube("Cube");
+            cube->getTransform().setLocalPosition(glm::vec3(position(rng), position(rng), position(rng)));
+            cubes.push_back(cube);
+        }
+        camera = scene.getOrCreateDefaultCamera();
+        scene.update(0.0f);
+    }
+
+    size_t countInside(const Frustum& frustum) const {
+        size_t inside = 0;
+        for (Node* cube : cubes) {
+            inside += frustum.intersects(cube->getTransform().getWorldBounds());
+        }
+        return inside;
+    }
+
+    size_t render() {
+        device.reset();
+        pipeline.render(&scene, camera, 0.016f);
+        return device.getStats().drawCalls;
+    }
+
+    const SceneRenderer* renderer() { return pipeline.getScenePass()->getSceneRenderer(); }
+};
+
+/// Quad facing the camera, centered at (x, 0, z) in its model's space
+UNIQUE<StaticMesh> createQuad(RecordingDevice& device, float x, float z) {
+    std::vector<float> vertices = {
+        x - 0.5f, -0.5f, z,  0, 0, 1,  0, 0,
+        x + 0.5f, -0.5f, z,  0, 0, 1,  1, 0,
+        x + 0.5f,  0.5f, z,  0, 0, 1,  1, 1,
+        x - 0.5f,  0.5f, z,  0, 0, 1,  0, 1,
+    };
+    return StaticMesh::create(&device, vertices, {0, 1, 2, 0, 2, 3});
+}
+
+/// Mesh of each recorded indexed draw, in submission order
+std::vector<uint32_t> drawnVertexArrays(const RecordingDevice& device) {
+    std::vector<uint32_t> result;
+    for (const RecordedCommand& command : device.getCommands()) {
+        if (command.type == RecordedCommandType::DrawIndexed) result.push_back(command.resource);
+    }
+    return result;
+}
+
+} // namespace
+
+// Test primitive meshes get local bounds from their vertices
+TEST(SceneRendererTest, MeshBounds) {
+    RecordingDevice device;
+    Scene scene;
+    scene.setDevice(&device);
+    Node* cube = scene.createCube("Cube", 2.0f);
+    ASSERT_NE(cube, nullptr);
+
+    const BoundingBox& bounds = cube->getMesh()->getBoundingBox();
+    EXPECT_EQ(bounds.min, glm::vec3(-1.0f));
+    EXPECT_EQ(bounds.max, glm::vec3(1.0f));
+    EXPECT_EQ(cube->getTransform().getLocalBounds().max, glm::vec3(1.0f));
+
+    cube->getTransform().setLocalPosition(glm::vec3(10.0f, 0.0f, 0.0f));
+    scene.update(0.0f);
+    EXPECT_EQ(cube->getTransform().getWorldBounds().min, glm::vec3(9.0f, -1.0f, -1.0f));
+}
+
+// Test the scene pass draws only nodes inside the camera frustum
+TEST(SceneRendererTest, FrustumCulling) {
+    CulledScene s(500);
+    size_t expected = s.countInside(Frustum(s.camera->getViewProjectionMatrix()));
+    ASSERT_GT(expected, 0u);
+    ASSERT_LT(expected, s.cubes.size());
+
+    size_t drawCalls = s.render();
+    EXPECT_EQ(drawCalls, expected);
+    EXPECT_EQ(s.renderer()->getVisibleNodeCount(), expected);
+    EXPECT_EQ(s.renderer()->getCulledNodeCount(), s.cubes.size() - expected);
+
+    // Moving the camera changes what is drawn
+    s.camera->lookAt(glm::vec3(0.0f, 80.0f, 0.0f), glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+    expected = s.countInside(Frustum(s.camera->getViewProjectionMatrix()));
+    EXPECT_EQ(s.render(), expected);
+    EXPECT_EQ(s.renderer()->getVisibleNodeCount(), expected);
+
+    // Disabled: everything is drawn
+    s.pipeline.getScenePass()->frustumCulling = false;
+    EXPECT_EQ(s.render(), s.cubes.size());
+    EXPECT_EQ(s.renderer()->getVisibleNodeCount(), s.cubes.size());
+    EXPECT_EQ(s.renderer()->getCulledNodeCount(), 0u);
+}
+
+// Test nodes without bounds are never culled
+TEST(SceneRendererTest, NodesWithoutBoundsAreDrawn) {
+    CulledScene s(50);
+    Node* unbounded = s.cubes.back();
+    unbounded->getTransform().setLocalBounds(BoundingBox());
+    unbounded->getTransform().setLocalPosition(glm::vec3(0.0f, 0.0f, 500.0f));
+    s.scene.update(0.0f);
+
+    size_t expected = s.countInside(Frustum(s.camera->getViewProjectionMatrix()));
+    s.render();
+    EXPECT_EQ(s.renderer()->getVisibleNodeCount(), expected + 1);
+}
+
+// Test the shadow pass skips casters outside the light's view volume
+TEST(SceneRendererTest, ShadowCasterCulling) {
+    CulledScene s(500);
+    s.pipeline.setShadowsEnabled(true);
+    ShadowPass* shadows = s.pipeline.getShadowPass();
+    ASSERT_NE(shadows, nullptr);
+
+    size_t withCulling = s.render();
+    size_t rendered = shadows->getRenderedCasterCount();
+    EXPECT_EQ(rendered + shadows->getCulledCasterCount(), s.cubes.size());
+    EXPECT_EQ(rendered, s.countInside(Frustum(shadows->getLightSpaceMatrix())));
+    EXPECT_GT(shadows->getCulledCasterCount(), 0u);
+
+    shadows->frustumCulling = false;
+    size_t withoutCulling = s.render();
+    EXPECT_EQ(shadows->getRenderedCasterCount(), s.cubes.size());
+    EXPECT_EQ(withoutCulling - withCulling, s.cubes.size() - rendered);
+}
+
+// Test cubes behind a wall are occluded before they reach the device
+TEST(SceneRendererTest, OcclusionCulling) {
+    RecordingDevice device;
+    RenderPipeline pipeline(&device);
+    pipeline.resize(320, 240);
+    pipeline.setToneMappingEnabled(false);
+    Scene scene;
+    scene.setDevice(&device);
+    Camera* camera = scene.getOrCreateDefaultCamera();
+
+    // Wall filling the view, with cubes behind and in front of it
+    Node* wall = scene.createCube("Wall");
+    wall->getTransform().setLocalScale(glm::vec3(40.0f, 40.0f, 1.0f));
+    wall->getTransform().setLocalPosition(glm::vec3(0.0f, 0.0f, -5.0f));
+    for (int i = 0; i < 20; ++i) {
+        Node* cube = scene.createCube("Hidden");
+        cube->getTransform().setLocalPosition(glm::vec3(float(i % 5) - 2.0f, float(i / 5) - 2.0f, -20.0f));
+    }
+    for (int i = 0; i < 3; ++i) {
+        Node* cube = scene.createCube("Front");
+        cube->getTransform().setLocalPosition(glm::vec3(float(i) - 1.0f, 0.0f, 0.0f));
+    }
+    scene.update(0.0f);
+
+    auto render = [&]() {
+        device.reset();
+        pipeline.render(&scene, camera, 0.016f);
+        return device.getStats().drawCalls;
+    };
+    const SceneRenderer* renderer = pipeline.getScenePass()->getSceneRenderer();
+
+    // Off by default
+    EXPECT_FALSE(pipeline.getOcclusionCullingEnabled());
+    EXPECT_EQ(render(), 24u);
+    EXPECT_EQ(renderer->getOccludedNodeCount(), 0u);
+
+    // The wall covers the screen, so it is picked as an occluder automatically
+    pipeline.setOcclusionCullingEnabled(true);
+    EXPECT_EQ(render(), 4u);
+    EXPECT_EQ(renderer->getOccluderCount(), 1u);
+    EXPECT_EQ(renderer->getOccludedNodeCount(), 20u);
+    EXPECT_EQ(renderer->getVisibleNodeCount(), 4u);
+
+    // Transparent meshes never occlude
+    Material glass = Material::createDefault();
+    glass.setOpacity(0.5f);
+    wall->setMaterial(glass);
+    render();
+    EXPECT_EQ(renderer->getOccluderCount(), 0u);
+    EXPECT_EQ(renderer->getOccludedNodeCount(), 0u);
+}
+
+// Test mesh nodes are submitted grouped by material, front to back within a group
+TEST(SceneRendererTest, RenderQueueGroupsByMaterial) {
+    CulledScene s(200);
+    s.pipeline.getScenePass()->frustumCulling = false;
+    s.pipeline.getScenePass()->enableTransparency = false;
+    s.pipeline.setInstancingEnabled(false);   // One draw per node
+
+    Material red = Material::createPlastic(Color::red());
+    Material blue = Material::createPlastic(Color::blue());
+    for (size_t i = 0; i < s.cubes.size(); ++i) {
+        s.cubes[i]->setMesh(s.cubes[0]->getMesh());
+        s.cubes[i]->setMaterial(i % 2 ? red : blue);
+    }
+    s.scene.update(0.0f);
+
+    EXPECT_EQ(s.render(), s.cubes.size());
+    const RenderQueueStats& stats = s.renderer()->getQueueStats();
+    EXPECT_EQ(stats.drawCalls, s.cubes.size());
+    EXPECT_EQ(stats.transformChanges, s.cubes.size());
+    EXPECT_EQ(stats.materialChanges, 2u);
+    EXPECT_EQ(stats.shaderChanges, 1u);
+    EXPECT_EQ(stats.meshChanges, 1u);
+
+    auto quantize = [&s](float depth) {
+        return RenderQueue::quantizeDepth(depth, s.camera->getNearPlane(), s.camera->getFarPlane());
+    };
+    const RenderQueue& queue = s.renderer()->getRenderQueue();
+    ASSERT_TRUE(queue.isSorted());
+    ASSERT_EQ(queue.getOrder().size(), s.cubes.size());
+    size_t materialRuns = 1;
+    for (size_t i = 1; i < queue.getOrder().size(); ++i) {
+        const RenderItem& previous = queue.getItem(queue.getOrder()[i - 1]);
+        const RenderItem& item = queue.getItem(queue.getOrder()[i]);
+        if (*item.material != *previous.material) {
+            materialRuns++;
+        } else {
+            EXPECT_LE(quantize(previous.depth), quantize(item.depth));
+        }
+    }
+    EXPECT_EQ(materialRuns, 2u);
+}
+
+// Test nodes sharing a mesh and material are drawn with one instanced draw
+TEST(SceneRendererTest, InstancingBatchesSharedMeshes) {
+    CulledScene s(200);
+    s.pipeline.getScenePass()->frustumCulling = false;
+    s.pipeline.getScenePass()->enableTransparency = false;
+    ASSERT_TRUE(s.pipeline.getInstancingEnabled());
+
+    // All but the last cube share one mesh; tints do not split batches
+    Material red = Material::createPlastic(Color::red());
+    Material blue = Material::createPlastic(Color::blue());
+    for (size_t i = 0; i + 1 < s.cubes.size(); ++i) {
+        s.cubes[i]->setMesh(s.cubes[0]->getMesh());
+        s.cubes[i]->setMaterial(i % 2 ? red : blue);
+        s.cubes[i]->setTint(Color(1.0f, i / 200.0f, 0.5f));
+    }
+    s.cubes.back()->setMaterial(red);
+    s.scene.update(0.0f);
+
+    EXPECT_EQ(s.render(), 3u);
+    const RenderQueueStats& stats = s.renderer()->getQueueStats();
+    EXPECT_EQ(stats.items, s.cubes.size());
+    EXPECT_EQ(stats.drawCalls, 3u);
+    EXPECT_EQ(stats.instancedDrawCalls, 2u);
+    EXPECT_EQ(stats.instances, s.cubes.size() - 1);
+    EXPECT_EQ(stats.transformChanges, 1u);
+    EXPECT_EQ(s.renderer()->getDrawCallCount(), 3u);
+
+    const RecordingStats& device = s.device.getStats();
+    EXPECT_EQ(device.instancedDrawCalls, 2u);
+    EXPECT_EQ(device.instancesSubmitted, s.cubes.size() - 1);
+
+    // Both instanced draws are of the shared mesh; the main shader is bound afterwards
+    const uint32_t sharedMesh = s.cubes[0]->getMesh()->getVertexArray()->getID();
+    int instances = 0;
+    for (const RecordedCommand& command : s.device.getCommands()) {
+        if (command.type == RecordedCommandType::DrawIndexedInstanced) {
+            EXPECT_EQ(command.resource, sharedMesh);
+            instances += command.ints.x;
+        }
+    }
+    EXPECT_EQ(instances, 199);
+    EXPECT_EQ(s.device.getBoundShader(), s.pipeline.getStandardShader()->getID());
+
+    // Disabled: one draw per node again
+    s.pipeline.setInstancingEnabled(false);
+    EXPECT_EQ(s.render(), s.cubes.size());
+    EXPECT_EQ(s.renderer()->getQueueStats().instancedDrawCalls, 0u);
+}
+
+// Test opaque draws are submitted before transparent ones in a combined render
+TEST(SceneRendererTest, RenderQueueBuckets) {
+    CulledScene s(40);
+    Material glass = Material::createDefault();
+    glass.setOpacity(0.5f);
+    for (size_t i = 0; i < s.cubes.size(); i += 3) {
+        s.cubes[i]->setMaterial(glass);
+    }
+
+    SceneRenderer renderer(&s.device);
+    renderer.setFrustumCulling(false);
+    auto shader = s.device.createShader();
+    renderer.render(&s.scene, shader.get());
+    EXPECT_EQ(renderer.getDrawCallCount(), s.cubes.size());
+
+    // Depths are compared as quantized (everything behind the camera is equal)
+    auto quantize = [&s](float depth) {
+        return RenderQueue::quantizeDepth(depth, s.camera->getNearPlane(), s.camera->getFarPlane());
+    };
+    const RenderQueue& queue = renderer.getRenderQueue();
+    bool transparent = false;
+    uint32_t lastDepth = 0;
+    for (uint32_t index : queue.getOrder()) {
+        const RenderItem& item = queue.getItem(index);
+        if (RenderQueue::getBucket(item.key) == RenderBucket::Transparent) {
+            EXPECT_TRUE(item.material->isTransparent());
+            if (transparent) {
+                EXPECT_GE(lastDepth, quantize(item.depth));
+            }
+            transparent = true;
+            lastDepth = quantize(item.depth);
+        } else {
+            EXPECT_FALSE(transparent) << "opaque draw after a transparent one";
+        }
+    }
+    EXPECT_TRUE(transparent);
+}
+
+// Test a gather on the job system fills the queue exactly like a serial one
+TEST(SceneRendererTest, RenderQueueJobSystem) {
+    JobSystemConfig jobConfig;
+    jobConfig.workerCount = 3;
+    JobSystem jobs(jobConfig);
+    jobs.initialize();
+
+    CulledScene s(1500);
+    Material materials[] = {Material::createMatte(Color::green()), Material::createPBRMetal(Color::white()),
+                            Material::createPlastic(Color::yellow())};
+    for (size_t i = 0; i < s.cubes.size(); ++i) {
+        s.cubes[i]->setMaterial(materials[i % 3]);
+    }
+    s.pipeline.getScenePass()->frustumCulling = false;
+    s.pipeline.getScenePass()->enableTransparency = false;
+
+    s.render();
+    RenderQueue serial = s.renderer()->getRenderQueue();
+    RenderQueueStats serialStats = s.renderer()->getQueueStats();
+
+    s.pipeline.getScenePass()->jobSystem = &jobs;
+    s.render();
+    const RenderQueue& parallel = s.renderer()->getRenderQueue();
+    ASSERT_EQ(parallel.size(), serial.size());
+    EXPECT_EQ(parallel.getOrder(), serial.getOrder());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        EXPECT_EQ(parallel.getItem(i).key, serial.getItem(i).key);
+        EXPECT_EQ(parallel.getItem(i).mesh, serial.getItem(i).mesh);
+        EXPECT_EQ(parallel.getItem(i).transform, serial.getItem(i).transform);
+    }
+    EXPECT_EQ(s.renderer()->getQueueStats().materialChanges, serialStats.materialChanges);
+    EXPECT_EQ(s.renderer()->getQueueStats().shaderChanges, 2u);
+
+    jobs.shutdown();
+}
+
+// Test transparent meshes of one model interleave with other nodes by depth
+TEST(SceneRendererTest, TransparentSortPerMesh) {
+    RecordingDevice device;
+    Scene scene;
+    scene.setDevice(&device);
+    Camera* camera = scene.getOrCreateDefaultCamera();
+    camera->lookAt(glm::vec3(0.0f, 0.0f, 10.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+    Material glass = Material::createDefault();
+    glass.setOpacity(0.5f);
+
+    // Model with a near and a far quad, and a transparent cube between them
+    auto model = Model::create();
+    model->addMesh(createQuad(device, 0.0f, 4.0f), glass);
+    model->addMesh(createQuad(device, 0.0f, -4.0f), glass);
+    Node* modelNode = scene.createNode("Model");
+    modelNode->setModel(model.get());
+    Node* cube = scene.createCube("Cube");
+    cube->setMaterial(glass);
+    cube->getTransform().setLocalPosition(glm::vec3(0.0f, 0.0f, -1.0f));
+    scene.update(0.0f);
+
+    SceneRenderer renderer(&device);
+    auto shader = device.createShader();
+    StaticMesh* nearQuad = model->getMesh(0);
+    StaticMesh* farQuad = model->getMesh(1);
+
+    // Per mesh: far quad (depth 14), cube (11), near quad (6)
+    device.reset();
+    renderer.renderTransparent(&scene, shader.get());
+    const std::vector<TransparentDraw>& draws = renderer.getTransparentDraws();
+    ASSERT_EQ(draws.size(), 3u);
+    EXPECT_EQ(draws[0].mesh, farQuad);
+    EXPECT_EQ(draws[1].mesh, cube->getMesh());
+    EXPECT_EQ(draws[2].mesh, nearQuad);
+    EXPECT_EQ(draws[0].node, modelNode);
+    EXPECT_FLOAT_EQ(draws[0].depth, 14.0f);
+    EXPECT_FLOAT_EQ(draws[1].depth, 11.0f);
+    EXPECT_FLOAT_EQ(draws[2].depth, 6.0f);
+
+    // The device saw the same order
+    std::vector<uint32_t> expected = {farQuad->getVertexArray()->getID(),
+                                      cube->getMesh()->getVertexArray()->getID(),
+                                      nearQuad->getVertexArray()->getID()};
+    EXPECT_EQ(drawnVertexArrays(device), expected);
+
+    // Grouped: the cube (11) before the model's center (10), whose meshes stay in model order
+    renderer.setTransparentNodeGrouping(true);
+    device.reset();
+    renderer.renderOpaque(&scene, shader.get());
+    EXPECT_TRUE(renderer.getTransparentDraws().empty());
+    renderer.renderTransparent(&scene, shader.get());
+    ASSERT_EQ(renderer.getTransparentDraws().size(), 3u);
+    EXPECT_EQ(renderer.getTransparentDraws()[0].mesh, cube->getMesh());
+    EXPECT_EQ(renderer.getTransparentDraws()[1].mesh, nearQuad);
+    EXPECT_EQ(renderer.getTransparentDraws()[2].mesh, farQuad);
+    EXPECT_FLOAT_EQ(renderer.getTransparentDraws()[1].depth, 10.0f);
+}
+
+// Test transparent draws go back to front, keeping hierarchy order at equal depth
+TEST(SceneRendererTest, TransparentSortIsStable) {
+    CulledScene s(300);
+    Material glass = Material::createDefault();
+    glass.setOpacity(0.5f);
+    Material tinted = Material::createPlastic(Color::red());
+    tinted.setOpacity(0.3f);
+    for (size_t i = 0; i < s.cubes.size(); ++i) {
+        s.cubes[i]->setMaterial(i % 2 ? glass : tinted);
+    }
+
+    // A row of cubes at one depth (the default camera looks down -z)
+    std::vector<Node*> row;
+    for (int i = 0; i < 8; ++i) {
+        Node* cube = s.scene.createCube("Row");
+        cube->setMaterial(i % 2 ? glass : tinted);
+        cube->getTransform().setLocalPosition(glm::vec3(float(i) - 4.0f, 0.0f, -20.0f));
+        row.push_back(cube);
+    }
+    s.scene.update(0.0f);
+    s.pipeline.getScenePass()->frustumCulling = false;
+    s.render();
+
+    auto quantize = [&s](float depth) {
+        return RenderQueue::quantizeDepth(depth, s.camera->getNearPlane(), s.camera->getFarPlane());
+    };
+    const std::vector<TransparentDraw>& draws = s.renderer()->getTransparentDraws();
+    ASSERT_EQ(draws.size(), s.cubes.size() + row.size());
+    std::vector<const Node*> rowOrder;
+    for (size_t i = 0; i < draws.size(); ++i) {
+        if (i > 0) {
+            EXPECT_GE(quantize(draws[i - 1].depth), quantize(draws[i].depth));
+        }
+        if (std::find(row.begin(), row.end(), draws[i].node) != row.end()) rowOrder.push_back(draws[i].node);
+    }
+    EXPECT_EQ(rowOrder, std::vector<const Node*>(row.begin(), row.end()));
+}
+
+} // namespace Tests
+} // namespace Pina
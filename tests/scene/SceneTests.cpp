@@ -0,0 +1,352 @@
+/// Scene Tests
+/// Tests for the Scene node pool, generational handles, hierarchy links, traversal and name index
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+std::vector<std::string> childNames(const Node* node) {
+    std::vector<std::string> names;
+    for (const Node* child = node->getFirstChild(); child; child = child->getNextSibling()) {
+        names.push_back(child->getName());
+    }
+    return names;
+}
+
+} // namespace
+
+// Test creation, handle and ID lookup
+TEST(SceneTest, CreateAndLookup) {
+    Scene scene;
+    EXPECT_EQ(scene.getNodeCount(), 1u);
+
+    Node* a = scene.createNode("A");
+    Node* b = scene.createNode("B");
+    Node* c = a->addChild("C");
+    EXPECT_EQ(scene.getNodeCount(), 4u);
+
+    EXPECT_EQ(a->getParent(), scene.getRoot());
+    EXPECT_EQ(c->getParent(), a);
+    EXPECT_EQ(a->getScene(), &scene);
+    EXPECT_EQ(childNames(scene.getRoot()), (std::vector<std::string>{"A", "B"}));
+
+    EXPECT_EQ(scene.getNode(b->getHandle()), b);
+    EXPECT_EQ(scene.findNode(c->getID()), c);
+    EXPECT_EQ(scene.findNode("C"), c);
+    EXPECT_NE(a->getID(), b->getID());
+}
+
+// Test that destroyed nodes stop resolving, even after their slot is reused
+TEST(SceneTest, StaleHandles) {
+    Scene scene;
+    Node* a = scene.createNode("A");
+    Node* child = a->addChild("Child");
+    NodeHandle aHandle = a->getHandle();
+    NodeHandle childHandle = child->getHandle();
+    uint64_t childID = child->getID();
+
+    EXPECT_TRUE(scene.destroyNode(a));
+    EXPECT_EQ(scene.getNodeCount(), 1u);
+    EXPECT_EQ(scene.getNode(aHandle), nullptr);
+    EXPECT_EQ(scene.getNode(childHandle), nullptr);
+    EXPECT_EQ(scene.findNode(childID), nullptr);
+    EXPECT_EQ(scene.getRoot()->getChildCount(), 0u);
+
+    // New nodes reuse the slots with a new generation
+    Node* b = scene.createNode("B");
+    Node* c = scene.createNode("C");
+    EXPECT_TRUE(b->getHandle().index == aHandle.index || c->getHandle().index == aHandle.index);
+    EXPECT_EQ(scene.getNode(aHandle), nullptr);
+    EXPECT_EQ(scene.getNode(childHandle), nullptr);
+
+    // The root cannot be destroyed
+    EXPECT_FALSE(scene.destroyNode(scene.getRoot()));
+    EXPECT_FALSE(scene.destroyNode(aHandle));
+}
+
+// Test reparenting and removal keep sibling lists consistent
+TEST(SceneTest, ReparentAndRemove) {
+    Scene scene;
+    Node* a = scene.createNode("A");
+    Node* b = scene.createNode("B");
+    Node* c = scene.createNode("C");
+    Node* d = scene.createNode("D");
+
+    // Middle, first and last siblings
+    b->setParent(d);
+    a->setParent(d);
+    EXPECT_EQ(childNames(scene.getRoot()), (std::vector<std::string>{"C", "D"}));
+    EXPECT_EQ(childNames(d), (std::vector<std::string>{"B", "A"}));
+    EXPECT_EQ(d->getChild(1), a);
+    EXPECT_EQ(d->getChild(2), nullptr);
+
+    // Cycles and other scenes are refused
+    d->setParent(a);
+    EXPECT_EQ(d->getParent(), scene.getRoot());
+    Scene other;
+    c->setParent(other.getRoot());
+    EXPECT_EQ(c->getParent(), scene.getRoot());
+    EXPECT_EQ(other.createNode("X", c), nullptr);
+
+    EXPECT_FALSE(c->removeChild(a));
+    EXPECT_TRUE(d->removeChild(size_t(0)));
+    EXPECT_EQ(childNames(d), (std::vector<std::string>{"A"}));
+
+    d->removeAllChildren();
+    EXPECT_EQ(d->getChildCount(), 0u);
+    EXPECT_EQ(d->getFirstChild(), nullptr);
+    EXPECT_EQ(scene.getNodeCount(), 3u);
+}
+
+// Test traversal order, enabled filtering and the linear node pass
+TEST(SceneTest, Traversal) {
+    Scene scene;
+    Node* a = scene.createNode("A");
+    a->addChild("A1")->addChild("A1a");
+    a->addChild("A2");
+    Node* b = scene.createNode("B");
+    b->addChild("B1");
+
+    std::vector<std::string> order;
+    scene.traverse([&order](Node* node) { order.push_back(node->getName()); });
+    EXPECT_EQ(order, (std::vector<std::string>{"Root", "A", "A1", "A1a", "A2", "B", "B1"}));
+
+    // Traversal stays inside the starting subtree
+    order.clear();
+    a->traverse([&order](Node* node) { order.push_back(node->getName()); });
+    EXPECT_EQ(order, (std::vector<std::string>{"A", "A1", "A1a", "A2"}));
+
+    a->getChild(0)->setEnabled(false);
+    order.clear();
+    scene.traverseEnabled([&order](Node* node) { order.push_back(node->getName()); });
+    EXPECT_EQ(order, (std::vector<std::string>{"Root", "A", "A2", "B", "B1"}));
+    EXPECT_FALSE(scene.findNode("A1a")->isEnabledInHierarchy());
+
+    size_t count = 0;
+    scene.forEachNode([&count](Node*) { count++; });
+    EXPECT_EQ(count, scene.getNodeCount());
+}
+
+// Test iterator depth tracking, subtree skipping and enabled filtering
+TEST(SceneTest, NodeIterator) {
+    Scene scene;
+    Node* a = scene.createNode("A");
+    Node* a1 = a->addChild("A1");
+    a1->addChild("A1a");
+    a->addChild("A2");
+    scene.createNode("B")->addChild("B1");
+
+    std::vector<std::string> order;
+    std::vector<uint32_t> depths;
+    for (NodeIterator it(scene.getRoot()); it; ++it) {
+        order.push_back(it->getName());
+        depths.push_back(it.getDepth());
+        if (*it == a1) it.skipChildren();
+    }
+    EXPECT_EQ(order, (std::vector<std::string>{"Root", "A", "A1", "A2", "B", "B1"}));
+    EXPECT_EQ(depths, (std::vector<uint32_t>{0, 1, 2, 2, 1, 2}));
+
+    // Depth is relative to the start node
+    NodeIterator it(a1);
+    ++it;
+    EXPECT_EQ(it->getName(), "A1a");
+    EXPECT_EQ(it.getDepth(), 1u);
+    ++it;
+    EXPECT_FALSE(it);
+    EXPECT_TRUE(it == NodeIterator());
+
+    a1->setEnabled(false);
+    order.clear();
+    for (NodeIterator enabled(a, true); enabled; ++enabled) {
+        order.push_back(enabled->getName());
+    }
+    EXPECT_EQ(order, (std::vector<std::string>{"A", "A2"}));
+    EXPECT_FALSE(NodeIterator(a1, true));
+}
+
+// Test visitors with and without VisitResult
+TEST(SceneTest, Visitors) {
+    Scene scene;
+    Node* a = scene.createNode("A");
+    a->addChild("A1")->addChild("A1a");
+    scene.createNode("B")->addChild("B1");
+    scene.createNode("C");
+
+    size_t count = 0;
+    scene.visit([&count](Node*) { count++; });
+    EXPECT_EQ(count, scene.getNodeCount());
+
+    std::vector<std::string> order;
+    scene.visit([&order](Node* node) {
+        order.push_back(node->getName());
+        if (node->getName() == "A") return VisitResult::SkipChildren;
+        if (node->getName() == "B1") return VisitResult::Stop;
+        return VisitResult::Continue;
+    });
+    EXPECT_EQ(order, (std::vector<std::string>{"Root", "A", "B", "B1"}));
+
+    scene.findNode("B")->setEnabled(false);
+    order.clear();
+    scene.visitEnabled([&order](Node* node) { order.push_back(node->getName()); });
+    EXPECT_EQ(order, (std::vector<std::string>{"Root", "A", "A1", "A1a", "C"}));
+
+    const Scene& constScene = scene;
+    count = 0;
+    constScene.visit([&count](const Node*) { count++; });
+    EXPECT_EQ(count, scene.getNodeCount());
+}
+
+// Test that very deep hierarchies are walked without recursion
+TEST(SceneTest, DeepHierarchy) {
+    constexpr uint32_t kDepth = 100000;
+    Scene scene;
+    Node* node = scene.getRoot();
+    for (uint32_t i = 0; i < kDepth; ++i) {
+        node = node->addChild("Link");
+    }
+
+    uint32_t maxDepth = 0;
+    size_t count = 0;
+    for (NodeIterator it(scene.getRoot()); it; ++it) {
+        maxDepth = it.getDepth();
+        count++;
+    }
+    EXPECT_EQ(maxDepth, kDepth);
+    EXPECT_EQ(count, kDepth + 1);
+
+    // Destroying the chain is iterative as well
+    EXPECT_TRUE(scene.destroyNode(scene.getRoot()->getFirstChild()));
+    EXPECT_EQ(scene.getNodeCount(), 1u);
+}
+
+// Test name lookups through renames, duplicates and destruction
+TEST(SceneTest, NameIndex) {
+    Scene scene;
+    Node* car = scene.createNode("Car");
+    Node* wheel1 = car->addChild("Wheel");
+    Node* wheel2 = car->addChild("Wheel");
+
+    EXPECT_EQ(scene.findNode("Car"), car);
+    EXPECT_EQ(scene.findNodes("Wheel").size(), 2u);
+    EXPECT_EQ(scene.findNode("SceneTest_Unknown"), nullptr);
+    EXPECT_TRUE(scene.findNodes("SceneTest_Unknown").empty());
+    EXPECT_EQ(car->getInternedName(), Name("Car"));
+
+    wheel1->setName("SpareWheel");
+    EXPECT_EQ(scene.findNode("SpareWheel"), wheel1);
+    EXPECT_EQ(scene.findNodes("Wheel"), (std::vector<Node*>{wheel2}));
+
+    scene.destroyNode(wheel2);
+    EXPECT_EQ(scene.findNode("Wheel"), nullptr);
+    car->addChild("Wheel");
+    scene.destroyNode(car);
+    EXPECT_EQ(scene.findNode("Car"), nullptr);
+    EXPECT_EQ(scene.findNode("SpareWheel"), nullptr);
+    EXPECT_EQ(scene.findNode("Wheel"), nullptr);
+
+    // Index stays consistent when a middle entry is removed
+    std::vector<Node*> boxes;
+    for (int i = 0; i < 5; ++i) {
+        boxes.push_back(scene.createNode("Box"));
+    }
+    scene.destroyNode(boxes[1]);
+    boxes[3]->setName("Crate");
+    scene.destroyNode(boxes[4]);
+    std::vector<Node*> remaining = scene.findNodes("Box");
+    EXPECT_EQ(remaining.size(), 2u);
+    EXPECT_NE(std::find(remaining.begin(), remaining.end(), boxes[0]), remaining.end());
+    EXPECT_NE(std::find(remaining.begin(), remaining.end(), boxes[2]), remaining.end());
+    EXPECT_EQ(scene.findNode("Box"), boxes[0]);
+
+
+    // The index returns the earliest named duplicate; the hierarchy search
+    // checks direct children before grandchildren
+    Node* shelf = scene.createNode("Shelf");
+    Node* nestedLamp = shelf->addChild("Lamp");
+    Node* lamp = scene.createNode("Lamp");
+    EXPECT_EQ(scene.findNode("Lamp"), nestedLamp);
+    EXPECT_EQ(scene.getRoot()->findDescendant("Lamp"), lamp);
+    EXPECT_EQ(shelf->findDescendant("Lamp"), nestedLamp);
+}
+
+// Test relative and scene path queries
+TEST(SceneTest, PathQueries) {
+    Scene scene;
+    Node* vehicle = scene.createNode("vehicle");
+    Node* body = vehicle->addChild("body");
+    Node* wheel = body->addChild("wheel_fl");
+    Node* garage = scene.createNode("garage");
+    Node* parked = garage->addChild("vehicle")->addChild("body")->addChild("wheel_fl");
+
+    EXPECT_EQ(vehicle->findByPath("body/wheel_fl"), wheel);
+    EXPECT_EQ(vehicle->findByPath("body//wheel_fl/"), wheel);
+    EXPECT_EQ(vehicle->findByPath("wheel_fl"), nullptr);
+    EXPECT_EQ(vehicle->findByPath("body/SceneTest_Unknown"), nullptr);
+
+    EXPECT_EQ(scene.findNodeByPath("/vehicle/body/wheel_fl"), wheel);
+    EXPECT_EQ(scene.findNodeByPath("/garage/vehicle/body/wheel_fl"), parked);
+    EXPECT_EQ(scene.findNodeByPath("/body/wheel_fl"), nullptr);
+
+    Node* found = scene.findNodeByPath("vehicle/body/wheel_fl");
+    EXPECT_TRUE(found == wheel || found == parked);
+    EXPECT_EQ(scene.findNodeByPath("garage/vehicle"), parked->getParent()->getParent());
+    EXPECT_EQ(scene.findNodeByPath(""), nullptr);
+    EXPECT_EQ(scene.findNodeByPath("/"), nullptr);
+}
+
+// Test tag queries through adds, removes and destruction
+TEST(SceneTest, Tags) {
+    Scene scene;
+    Node* a = scene.createNode("A");
+    Node* b = scene.createNode("B");
+    Node* c = b->addChild("C");
+    Name enemy("enemy");
+
+    a->addTag(enemy);
+    a->addTag(enemy);
+    a->addTag("boss");
+    c->addTag(enemy);
+    EXPECT_EQ(a->getTagCount(), 2u);
+    EXPECT_TRUE(a->hasTag("boss"));
+    EXPECT_FALSE(b->hasTag(enemy));
+    EXPECT_EQ(scene.findNodesWithTag(enemy).size(), 2u);
+    EXPECT_EQ(scene.findNodeWithTag("boss"), a);
+    EXPECT_EQ(scene.findNodeWithTag("SceneTest_NoTag"), nullptr);
+
+    EXPECT_TRUE(a->removeTag(enemy));
+    EXPECT_FALSE(a->removeTag(enemy));
+    EXPECT_EQ(scene.findNodesWithTag(enemy), (std::vector<Node*>{c}));
+
+    scene.destroyNode(b);
+    EXPECT_TRUE(scene.findNodesWithTag(enemy).empty());
+    EXPECT_EQ(scene.findNodeWithTag("boss"), a);
+
+    // Tags on detached nodes are local only
+    Node detached("Detached");
+    detached.addTag(enemy);
+    EXPECT_TRUE(detached.hasTag(enemy));
+    EXPECT_TRUE(scene.findNodesWithTag(enemy).empty());
+}
+
+// Test that a node built outside a scene stays a leaf
+TEST(SceneTest, DetachedNode) {
+    Node node("Detached");
+    EXPECT_EQ(node.getScene(), nullptr);
+    EXPECT_EQ(node.addChild("Child"), nullptr);
+    EXPECT_EQ(node.getParent(), nullptr);
+
+    size_t visited = 0;
+    node.traverse([&visited](Node*) { visited++; });
+    node.visit([&visited](Node*) { visited++; });
+    EXPECT_EQ(visited, 2u);
+}
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,311 @@
+/// Spatial Index Tests
+/// Tests for Scene/SpatialIndex tracking, incremental refit and queries against brute force
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+/// Scene of cubes spread over a volume, some parented to movers
+struct CubeField {
+    RecordingDevice device;
+    Scene scene;
+    std::vector<Node*> cubes;
+    std::vector<Node*> movers;
+    std::mt19937 rng{5};
+    std::uniform_real_distribution<float> position{-40.0f, 40.0f};
+
+    explicit CubeField(size_t count) {
+        scene.setDevice(&device);
+        for (int i = 0; i < 8; ++i) {
+            Node* mover = scene.createNode("Mover");
+            mover->getTransform().setLocalPosition(randomPoint() * 0.25f);
+            movers.push_back(mover);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            Node* cube = scene.createCube("Cube");
+            cube->getTransform().setLocalPosition(randomPoint());
+            if (i % 4 == 0) {
+                cube->setParent(movers[(i / 4) % movers.size()]);
+            }
+            cubes.push_back(cube);
+        }
+        scene.update(0.0f);
+    }
+
+    glm::vec3 randomPoint() { return glm::vec3(position(rng), position(rng), position(rng)); }
+
+    template<typename Predicate>
+    std::vector<Node*> bruteForce(Predicate&& predicate) const {
+        std::vector<Node*> result;
+        for (Node* cube : cubes) {
+            if (predicate(cube->getTransform().getWorldBounds())) {
+                result.push_back(cube);
+            }
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+};
+
+std::vector<Node*> sorted(std::vector<Node*> nodes) {
+    std::sort(nodes.begin(), nodes.end());
+    return nodes;
+}
+
+} // namespace
+
+// Test nodes with a mesh or model are tracked, others are not
+TEST(SpatialIndexTest, Tracking) {
+    RecordingDevice device;
+    Scene scene;
+    scene.setDevice(&device);
+    SpatialIndex& index = scene.getSpatialIndex();
+
+    Node* empty = scene.createNode("Empty");
+    Node* cube = scene.createCube("Cube");
+    ASSERT_NE(cube, nullptr);
+    EXPECT_FALSE(index.isTracked(empty));
+    EXPECT_TRUE(index.isTracked(cube));
+    EXPECT_EQ(index.getTrackedCount(), 1u);
+
+    // Bounds come from the mesh
+    EXPECT_EQ(index.getTree().getProxyCount(), 1u);
+
+    StaticMesh* mesh = cube->getMesh();
+    cube->setMesh(nullptr);
+    EXPECT_FALSE(index.isTracked(cube));
+    EXPECT_EQ(index.getTree().getProxyCount(), 0u);
+
+    empty->setMesh(mesh);
+    cube->setMesh(mesh);
+    EXPECT_EQ(index.getTrackedCount(), 2u);
+
+    scene.destroyNode(empty);
+    EXPECT_EQ(index.getTrackedCount(), 1u);
+    EXPECT_TRUE(index.isTracked(cube));
+    EXPECT_TRUE(index.getTree().validate());
+}
+
+// Test update() refits only nodes whose world transform changed
+TEST(SpatialIndexTest, IncrementalRefit) {
+    CubeField field(400);
+    SpatialIndex& index = field.scene.getSpatialIndex();
+    EXPECT_EQ(index.getTrackedCount(), 400u);
+    EXPECT_EQ(index.getTree().getProxyCount(), 400u);
+
+    field.scene.update(0.0f);
+    EXPECT_EQ(index.getLastRefitCount(), 0u);
+
+    field.cubes[1]->getTransform().translate(glm::vec3(0.01f, 0.0f, 0.0f));
+    field.cubes[2]->getTransform().translate(glm::vec3(30.0f, 0.0f, 0.0f));
+    field.scene.update(0.0f);
+    EXPECT_EQ(index.getLastRefitCount(), 2u);
+
+    // Moving a parent refits its children
+    field.movers[0]->getTransform().translate(glm::vec3(0.0f, 5.0f, 0.0f));
+    field.scene.update(0.0f);
+    EXPECT_EQ(index.getLastRefitCount(), field.movers[0]->getChildCount());
+    EXPECT_TRUE(index.getTree().validate());
+
+    std::vector<Node*> found;
+    index.queryBox(field.cubes[2]->getTransform().getWorldBounds(), found);
+    EXPECT_NE(std::find(found.begin(), found.end(), field.cubes[2]), found.end());
+}
+
+// Test box, sphere and frustum queries against brute force while nodes move
+TEST(SpatialIndexTest, QueriesMatchBruteForce) {
+    CubeField field(1000);
+    SpatialIndex& index = field.scene.getSpatialIndex();
+    std::uniform_real_distribution<float> step(-3.0f, 3.0f);
+
+    std::vector<Node*> found;
+    for (int frame = 0; frame < 10; ++frame) {
+        for (size_t i = 0; i < field.cubes.size(); i += 3) {
+            field.cubes[i]->getTransform().translate(glm::vec3(step(field.rng), step(field.rng), step(field.rng)));
+        }
+        field.movers[frame % field.movers.size()]->getTransform().rotate(glm::vec3(0.0f, 30.0f, 0.0f));
+        field.scene.update(0.0f);
+        EXPECT_TRUE(index.getTree().validate());
+
+        BoundingBox region;
+        region.min = field.randomPoint();
+        region.max = region.min + glm::vec3(15.0f);
+        index.queryBox(region, found);
+        EXPECT_EQ(sorted(found), field.bruteForce([&](const BoundingBox& b) { return b.intersects(region); }));
+
+        glm::vec3 center = field.randomPoint();
+        index.querySphere(center, 10.0f, found);
+        EXPECT_EQ(sorted(found), field.bruteForce([&](const BoundingBox& b) {
+            return b.distanceSquared(center) <= 100.0f;
+        }));
+
+        glm::mat4 view = glm::lookAt(field.randomPoint(), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        Frustum frustum(glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 60.0f) * view);
+        index.queryFrustum(frustum, found);
+        EXPECT_EQ(sorted(found), field.bruteForce([&](const BoundingBox& b) { return frustum.intersects(b); }));
+    }
+}
+
+// Test ray and nearest queries against brute force
+TEST(SpatialIndexTest, RayAndNearestMatchBruteForce) {
+    CubeField field(1000);
+    SpatialIndex& index = field.scene.getSpatialIndex();
+
+    std::vector<std::pair<float, Node*>> hits;
+    std::vector<Node*> nearest;
+    for (int i = 0; i < 30; ++i) {
+        glm::vec3 origin = field.randomPoint();
+        Ray ray(origin, field.randomPoint() - origin);
+        glm::vec3 direction = ray.direction;
+        glm::vec3 invDirection = glm::vec3(1.0f) / direction;
+        const float maxDistance = 80.0f;
+
+        index.queryRay(ray, maxDistance, hits);
+        std::vector<Node*> hitNodes;
+        for (size_t h = 0; h < hits.size(); ++h) {
+            hitNodes.push_back(hits[h].second);
+            if (h > 0) {
+                EXPECT_LE(hits[h - 1].first, hits[h].first);
+            }
+        }
+        EXPECT_EQ(sorted(hitNodes), field.bruteForce([&](const BoundingBox& b) {
+            float entry;
+            return b.intersectsRay(origin, invDirection, maxDistance, entry);
+        }));
+
+        float distance = -1.0f;
+        Node* first = index.raycastBounds(ray, maxDistance, &distance);
+        if (hits.empty()) {
+            EXPECT_EQ(first, nullptr);
+        } else {
+            ASSERT_NE(first, nullptr);
+            EXPECT_FLOAT_EQ(distance, hits.front().first);
+        }
+
+        glm::vec3 point = field.randomPoint();
+        index.findNearest(point, 5, nearest);
+        std::vector<float> expected;
+        for (Node* cube : field.cubes) {
+            expected.push_back(cube->getTransform().getWorldBounds().distanceSquared(point));
+        }
+        std::sort(expected.begin(), expected.end());
+        ASSERT_EQ(nearest.size(), 5u);
+        for (size_t k = 0; k < nearest.size(); ++k) {
+            EXPECT_FLOAT_EQ(nearest[k]->getTransform().getWorldBounds().distanceSquared(point), expected[k]);
+        }
+    }
+}
+
+// Test Scene::raycast() on transformed, disabled and geometry-less nodes
+TEST(SpatialIndexTest, SceneRaycast) {
+    RecordingDevice device;
+    Scene scene;
+    scene.setDevice(&device);
+
+    Node* front = scene.createCube("Front");
+    front->getTransform().setLocalPosition(glm::vec3(0.0f, 0.0f, -5.0f));
+    Node* back = scene.createCube("Back");
+    back->getTransform().setLocalPosition(glm::vec3(0.0f, 0.0f, -10.0f));
+    back->getTransform().setLocalScale(3.0f);
+    scene.update(0.0f);
+
+    Ray ray(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+    RaycastHit hit = scene.raycast(ray);
+    ASSERT_TRUE(hit);
+    EXPECT_EQ(hit.node, front);
+    EXPECT_EQ(hit.mesh, front->getMesh());
+    EXPECT_NEAR(hit.distance, 4.5f, 1e-5f);
+    EXPECT_NEAR(hit.point.z, -4.5f, 1e-5f);
+    EXPECT_LT(hit.triangle, front->getMesh()->getIndexCount() / 3);
+
+    // Distances stay in world units through the scale
+    front->setEnabled(false);
+    hit = scene.raycast(ray);
+    ASSERT_TRUE(hit);
+    EXPECT_EQ(hit.node, back);
+    EXPECT_NEAR(hit.distance, 8.5f, 1e-5f);
+
+    // Rotated 45 degrees: the ray meets an edge of the cube
+    back->getTransform().setLocalRotationEuler(0.0f, 45.0f, 0.0f);
+    scene.update(0.0f);
+    hit = scene.raycast(ray);
+    ASSERT_TRUE(hit);
+    EXPECT_NEAR(hit.distance, 10.0f - 1.5f * std::sqrt(2.0f), 1e-4f);
+
+    EXPECT_FALSE(scene.raycast(ray, 5.0f));
+    EXPECT_FALSE(scene.raycast(Ray(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, 1.0f))));
+
+    // Meshes without CPU geometry are never hit
+    std::vector<float> vertices = {
+        -5.0f, -5.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f,
+         5.0f, -5.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 0.0f,
+         0.0f,  5.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.5f, 1.0f,
+    };
+    auto gpuOnly = StaticMesh::create(&device, vertices, {0, 1, 2});
+    Node* wall = scene.createNode("Wall");
+    wall->setMesh(gpuOnly.get());
+    wall->getTransform().setLocalPosition(glm::vec3(0.0f, 0.0f, -2.0f));
+    scene.update(0.0f);
+    hit = scene.raycast(ray);
+    ASSERT_TRUE(hit);
+    EXPECT_EQ(hit.node, back);
+}
+
+// Test Scene::raycast() against every cube's triangles in world space
+TEST(SpatialIndexTest, SceneRaycastMatchesBruteForce) {
+    CubeField field(300);
+    for (size_t i = 0; i < field.cubes.size(); i += 3) {
+        field.cubes[i]->getTransform().setLocalRotationEuler(field.randomPoint() * 4.0f);
+        field.cubes[i]->getTransform().setLocalScale(glm::vec3(1.0f, 2.5f, 0.5f));
+    }
+    field.scene.update(0.0f);
+
+    const StaticMesh* mesh = field.cubes.front()->getMesh();
+    const std::vector<glm::vec3>& positions = mesh->getPositions();
+    const std::vector<uint32_t>& indices = mesh->getIndices();
+
+    size_t hits = 0;
+    for (int i = 0; i < 200; ++i) {
+        glm::vec3 origin = field.randomPoint();
+        Ray ray(origin, field.randomPoint() - origin);
+        glm::vec3 direction = ray.direction;
+
+        Node* expectedNode = nullptr;
+        float expectedDistance = 1000.0f;
+        for (Node* cube : field.cubes) {
+            const glm::mat4& world = cube->getTransform().getWorldMatrix();
+            for (size_t t = 0; t < indices.size(); t += 3) {
+                glm::vec3 a = glm::vec3(world * glm::vec4(positions[indices[t]], 1.0f));
+                glm::vec3 b = glm::vec3(world * glm::vec4(positions[indices[t + 1]], 1.0f));
+                glm::vec3 c = glm::vec3(world * glm::vec4(positions[indices[t + 2]], 1.0f));
+                float distance, u, v;
+                if (MeshBVH::intersectTriangle(origin, direction, a, b, c, expectedDistance, distance, u, v)) {
+                    expectedNode = cube;
+                    expectedDistance = distance;
+                }
+            }
+        }
+
+        RaycastHit hit = field.scene.raycast(ray, 1000.0f);
+        ASSERT_EQ(hit.node != nullptr, expectedNode != nullptr) << "ray " << i;
+        if (hit) {
+            EXPECT_EQ(hit.node, expectedNode) << "ray " << i;
+            EXPECT_NEAR(hit.distance, expectedDistance, 1e-3f) << "ray " << i;
+            hits++;
+        }
+    }
+    EXPECT_GT(hits, 0u);
+}
+
+} // namespace Tests
+} // namespace Pina
@@ -0,0 +1,474 @@
+/// Transform Tests
+/// Tests for Scene/Transform handles and the batched TransformSystem update
+
+#include <gtest/gtest.h>
+#include <Pina.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace Pina {
+namespace Tests {
+
+namespace {
+
+void expectMatrixNear(const glm::mat4& actual, const glm::mat4& expected) {
+    for (int c = 0; c < 4; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            EXPECT_NEAR(actual[c][r], expected[c][r], 1e-4f) << "column " << c << " row " << r;
+        }
+    }
+}
+
+glm::mat4 composeTRS(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale) {
+    return glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation) *
+           glm::scale(glm::mat4(1.0f), scale);
+}
+
+/// World matrix computed from scratch through the node hierarchy
+glm::mat4 referenceWorld(const Node* node) {
+    const Transform& t = node->getTransform();
+    glm::mat4 local = composeTRS(t.getLocalPosition(), t.getLocalRotation(), t.getLocalScale());
+    return node->getParent() ? referenceWorld(node->getParent()) * local : local;
+}
+
+} // namespace
+
+// Test that a child's world matrix follows its parent without an update
+TEST(TransformTest, WorldMatrixFollowsParent) {
+    Scene scene;
+    Node& root = *scene.createNode("Root");
+    Node* child = root.addChild("Child");
+    Node* grandchild = child->addChild("Grandchild");
+
+    grandchild->getTransform().setLocalPosition(0.0f, 0.0f, 1.0f);
+    EXPECT_EQ(grandchild->getTransform().getWorldPosition(), glm::vec3(0.0f, 0.0f, 1.0f));
+
+    root.getTransform().setLocalPosition(10.0f, 0.0f, 0.0f);
+    child->getTransform().setLocalScale(2.0f);
+
+    expectMatrixNear(grandchild->getTransform().getWorldMatrix(), referenceWorld(grandchild));
+    EXPECT_EQ(grandchild->getTransform().getWorldPosition(), glm::vec3(10.0f, 0.0f, 2.0f));
+
+    root.getTransform().rotate(0.0f, 90.0f, 0.0f);
+    expectMatrixNear(grandchild->getTransform().getWorldMatrix(), referenceWorld(grandchild));
+}
+
+// Test that setters only dirty the transform itself
+TEST(TransformTest, SettersDoNotDirtyChildren) {
+    Scene scene;
+    Node& root = *scene.createNode("Root");
+    Node* child = root.addChild("Child");
+    scene.getTransformSystem().update();
+
+    root.getTransform().setLocalPosition(1.0f, 2.0f, 3.0f);
+    EXPECT_TRUE(root.getTransform().isDirty());
+    EXPECT_FALSE(child->getTransform().isDirty());
+
+    // The child still picks up the parent's change
+    EXPECT_EQ(child->getTransform().getWorldPosition(), glm::vec3(1.0f, 2.0f, 3.0f));
+}
+
+// Test reparenting and removal of nodes
+TEST(TransformTest, HierarchyChanges) {
+    Scene scene;
+    Node& root = *scene.createNode("Root");
+    Node* a = root.addChild("A");
+    Node* b = root.addChild("B");
+    a->getTransform().setLocalPosition(1.0f, 0.0f, 0.0f);
+    b->getTransform().setLocalPosition(0.0f, 5.0f, 0.0f);
+
+    // Move under a sibling created later
+    a->setParent(b);
+    EXPECT_EQ(a->getTransform().getWorldPosition(), glm::vec3(1.0f, 5.0f, 0.0f));
+
+    // Moved to the scene root, it no longer follows b
+    a->setParent(nullptr);
+    EXPECT_EQ(a->getParent(), scene.getRoot());
+    EXPECT_EQ(a->getTransform().getWorldPosition(), glm::vec3(1.0f, 0.0f, 0.0f));
+
+    root.getTransform().setLocalPosition(0.0f, 0.0f, -1.0f);
+    a->setParent(&root);
+    EXPECT_EQ(a->getTransform().getWorldPosition(), glm::vec3(1.0f, 0.0f, -1.0f));
+
+    // Removing b destroys it; a is no longer under it
+    EXPECT_TRUE(root.removeChild(b));
+    EXPECT_EQ(root.getChildCount(), 1u);
+    EXPECT_EQ(a->getTransform().getWorldPosition(), glm::vec3(1.0f, 0.0f, -1.0f));
+}
+
+// Test that copies get their own entry with the same local values
+TEST(TransformTest, CopyAndMove) {
+    Scene scene;
+    Node& root = *scene.createNode("Root");
+    Node* child = root.addChild("Child");
+    root.getTransform().setLocalPosition(5.0f, 0.0f, 0.0f);
+    child->getTransform().setLocalPosition(1.0f, 2.0f, 3.0f);
+
+    Transform copy = child->getTransform();
+    EXPECT_EQ(&copy.getSystem(), &scene.getTransformSystem());
+    EXPECT_NE(copy.getID(), child->getTransform().getID());
+    EXPECT_EQ(copy.getLocalPosition(), glm::vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(copy.getWorldPosition(), glm::vec3(1.0f, 2.0f, 3.0f));
+
+    copy.translate(1.0f, 0.0f, 0.0f);
+    EXPECT_EQ(child->getTransform().getLocalPosition(), glm::vec3(1.0f, 2.0f, 3.0f));
+
+    TransformSystem::ID id = copy.getID();
+    Transform moved = std::move(copy);
+    EXPECT_EQ(moved.getID(), id);
+    EXPECT_EQ(moved.getLocalPosition(), glm::vec3(2.0f, 2.0f, 3.0f));
+}
+
+// Test each scene updates only the transforms it owns
+TEST(TransformTest, ScenesOwnTheirTransforms) {
+    Scene a;
+    Scene b;
+    Node* nodeA = a.createNode("A");
+    Node* nodeB = b.createNode("B");
+    EXPECT_EQ(&nodeA->getTransform().getSystem(), &a.getTransformSystem());
+    EXPECT_EQ(&nodeB->getTransform().getSystem(), &b.getTransformSystem());
+    a.update(0.0f);
+    b.update(0.0f);
+
+    nodeA->getTransform().setLocalPosition(1.0f, 0.0f, 0.0f);
+    nodeB->getTransform().setLocalPosition(2.0f, 0.0f, 0.0f);
+    a.update(0.0f);
+    EXPECT_EQ(a.getTransformSystem().getLastUpdateCount(), 1u);
+    EXPECT_FALSE(nodeA->getTransform().isDirty());
+    EXPECT_TRUE(nodeB->getTransform().isDirty());
+
+    b.update(0.0f);
+    EXPECT_EQ(b.getTransformSystem().getLastUpdateCount(), 1u);
+    EXPECT_FALSE(nodeB->getTransform().isDirty());
+
+    // Transforms outside any scene still compute world values on read
+    Transform detached;
+    EXPECT_NE(&detached.getSystem(), &a.getTransformSystem());
+    detached.setLocalPosition(3.0f, 0.0f, 0.0f);
+    EXPECT_EQ(detached.getWorldPosition(), glm::vec3(3.0f, 0.0f, 0.0f));
+}
+
+// Test that update() recomputes only changed entries and their descendants
+TEST(TransformSystemTest, UpdateRecomputesChangedSubtrees) {
+    TransformSystem system;
+    TransformSystem::ID root = system.create();
+    TransformSystem::ID a = system.create();
+    TransformSystem::ID b = system.create();
+    TransformSystem::ID leaf = system.create();
+    system.setParent(a, root);
+    system.setParent(b, root);
+    system.setParent(leaf, a);
+
+    system.update();
+    EXPECT_EQ(system.getLastUpdateCount(), 4u);
+
+    system.update();
+    EXPECT_EQ(system.getLastUpdateCount(), 0u);
+
+    system.setLocalPosition(a, glm::vec3(0.0f, 1.0f, 0.0f));
+    system.update();
+    EXPECT_EQ(system.getLastUpdateCount(), 2u);
+
+    system.setLocalScale(root, glm::vec3(3.0f));
+    system.update();
+    EXPECT_EQ(system.getLastUpdateCount(), 4u);
+    EXPECT_EQ(glm::vec3(system.getWorldMatrix(leaf)[3]), glm::vec3(0.0f, 3.0f, 0.0f));
+}
+
+// Test that handles survive reordering and compaction
+TEST(TransformSystemTest, HandlesSurviveReorder) {
+    TransformSystem system;
+    std::vector<TransformSystem::ID> ids;
+    for (int i = 0; i < 8; ++i) {
+        ids.push_back(system.create());
+        system.setLocalPosition(ids.back(), glm::vec3(static_cast<float>(i), 0.0f, 0.0f));
+    }
+
+    // Chain in reverse creation order: 7 -> 6 -> ... -> 0
+    for (int i = 0; i < 7; ++i) {
+        system.setParent(ids[i], ids[i + 1]);
+    }
+    system.setParent(ids[1], ids[3]);
+    system.destroy(ids[0]);
+    system.update();
+
+    EXPECT_EQ(system.getCount(), 7u);
+    EXPECT_EQ(system.getParent(ids[1]), ids[3]);
+    EXPECT_EQ(system.getParent(ids[7]), TransformSystem::InvalidID);
+
+    // ids[1] -> 3 -> 4 -> 5 -> 6 -> 7
+    float expected = 1.0f + 3.0f + 4.0f + 5.0f + 6.0f + 7.0f;
+    EXPECT_EQ(system.getWorldMatrix(ids[1])[3].x, expected);
+}
+
+// Test that destroying a parent leaves its children as roots
+TEST(TransformSystemTest, DestroyParentDetachesChildren) {
+    TransformSystem system;
+    TransformSystem::ID parent = system.create();
+    TransformSystem::ID child = system.create();
+    system.setParent(child, parent);
+    system.setLocalPosition(parent, glm::vec3(4.0f, 0.0f, 0.0f));
+    system.setLocalPosition(child, glm::vec3(0.0f, 1.0f, 0.0f));
+    EXPECT_EQ(glm::vec3(system.getWorldMatrix(child)[3]), glm::vec3(4.0f, 1.0f, 0.0f));
+
+    system.destroy(parent);
+    EXPECT_EQ(system.getParent(child), TransformSystem::InvalidID);
+    EXPECT_EQ(glm::vec3(system.getWorldMatrix(child)[3]), glm::vec3(0.0f, 1.0f, 0.0f));
+}
+
+// Test that normal matrices and world bounds are cached with the world matrix
+TEST(TransformSystemTest, NormalMatrixAndWorldBounds) {
+    TransformSystem system;
+    TransformSystem::ID parent = system.create();
+    TransformSystem::ID child = system.create();
+    system.setParent(child, parent);
+
+    BoundingBox bounds;
+    bounds.expand(glm::vec3(-1.0f));
+    bounds.expand(glm::vec3(1.0f));
+    system.setLocalBounds(child, bounds);
+    EXPECT_FALSE(system.getWorldBounds(parent).isValid());
+
+    system.setLocalScale(parent, glm::vec3(2.0f, 1.0f, 1.0f));
+    system.setLocalPosition(child, glm::vec3(0.0f, 3.0f, 0.0f));
+    system.update();
+
+    const BoundingBox& world = system.getWorldBounds(child);
+    EXPECT_EQ(world.min, glm::vec3(-2.0f, 2.0f, -1.0f));
+    EXPECT_EQ(world.max, glm::vec3(2.0f, 4.0f, 1.0f));
+
+    glm::mat3 expected = glm::transpose(glm::inverse(glm::mat3(system.getWorldMatrix(child))));
+    glm::mat3 normal = system.getNormalMatrix(child);
+    for (int c = 0; c < 3; ++c) {
+        for (int r = 0; r < 3; ++r) {
+            EXPECT_NEAR(normal[c][r], expected[c][r], 1e-5f);
+        }
+    }
+
+    // Rotating the parent a quarter turn about Z swaps the child's X and Y extents
+    system.setLocalRotation(parent, glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 0.0f, 1.0f)));
+    const BoundingBox& rotated = system.getWorldBounds(child);
+    EXPECT_NEAR(rotated.min.x, -4.0f, 1e-5f);
+    EXPECT_NEAR(rotated.max.x, -2.0f, 1e-5f);
+    EXPECT_NEAR(rotated.min.y, -2.0f, 1e-5f);
+    EXPECT_NEAR(rotated.max.y, 2.0f, 1e-5f);
+}
+
+// Test the uniform-scale normal matrix path against the general inverse
+TEST(TransformSystemTest, UniformScaleNormalMatrix) {
+    TransformSystem system;
+    TransformSystem::ID parent = system.create();
+    TransformSystem::ID child = system.create();
+    system.setParent(child, parent);
+
+    system.setLocalScale(parent, glm::vec3(3.0f));
+    system.setLocalRotation(parent, glm::angleAxis(0.7f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f))));
+    system.setLocalScale(child, glm::vec3(-0.5f));
+    system.setLocalRotation(child, glm::angleAxis(-1.3f, glm::vec3(0.0f, 1.0f, 0.0f)));
+
+    for (int step = 0; step < 2; ++step) {
+        for (TransformSystem::ID id : {parent, child}) {
+            glm::mat3 expected = glm::transpose(glm::inverse(glm::mat3(system.getWorldMatrix(id))));
+            glm::mat3 normal = system.getNormalMatrix(id);
+            for (int c = 0; c < 3; ++c) {
+                for (int r = 0; r < 3; ++r) {
+                    EXPECT_NEAR(normal[c][r], expected[c][r], 1e-5f);
+                }
+            }
+        }
+
+        // Non-uniform parent takes the general path for the whole subtree
+        system.setLocalScale(parent, glm::vec3(1.0f, 2.0f, 3.0f));
+    }
+}
+
+// Test that world rotation and scale are cached and follow parent changes
+TEST(TransformTest, WorldRotationAndDirections) {
+    Scene scene;
+    Node& root = *scene.createNode("Root");
+    Node* child = root.addChild("Child");
+    Transform& t = child->getTransform();
+
+    glm::quat parentRotation = glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::quat childRotation = glm::angleAxis(glm::radians(30.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+    root.getTransform().setLocalRotation(parentRotation);
+    root.getTransform().setLocalScale(2.0f, 3.0f, 4.0f);
+    t.setLocalRotation(childRotation);
+
+    // Skewed by the non-uniform parent: scale is the axis lengths and right
+    // follows the X axis
+    glm::quat rotation = t.getWorldRotation();
+    glm::mat3 world(t.getWorldMatrix());
+    glm::vec3 scale = t.getWorldScale();
+    for (int c = 0; c < 3; ++c) {
+        EXPECT_NEAR(scale[c], glm::length(world[c]), 1e-5f);
+    }
+    EXPECT_NEAR(glm::dot(t.getRight(), glm::normalize(world[0])), 1.0f, 1e-5f);
+
+    root.getTransform().setLocalScale(2.0f);
+    glm::quat expected = parentRotation * childRotation;
+    EXPECT_NEAR(std::abs(glm::dot(t.getWorldRotation(), expected)), 1.0f, 1e-5f);
+    EXPECT_NE(t.getWorldRotation(), rotation);
+    EXPECT_NEAR(t.getWorldScale().x, 2.0f, 1e-5f);
+
+    glm::vec3 forward = expected * glm::vec3(0.0f, 0.0f, -1.0f);
+    glm::vec3 up = expected * glm::vec3(0.0f, 1.0f, 0.0f);
+    EXPECT_NEAR(glm::length(t.getForward() - forward), 0.0f, 1e-5f);
+    EXPECT_NEAR(glm::length(t.getUp() - up), 0.0f, 1e-5f);
+    EXPECT_NEAR(glm::length(t.getRight()), 1.0f, 1e-5f);
+
+    // A mirrored scale still yields a proper rotation
+    root.getTransform().setLocalScale(-1.0f, 1.0f, 1.0f);
+    EXPECT_NEAR(glm::length(t.getWorldRotation()), 1.0f, 1e-5f);
+    EXPECT_NEAR(glm::length(t.getWorldScale() - glm::vec3(1.0f)), 0.0f, 1e-5f);
+}
+
+// Test cached reads see values as of the last update and never recompute
+TEST(TransformTest, CachedReads) {
+    Scene scene;
+    Node* parent = scene.createNode("Parent");
+    Node* child = parent->addChild("Child");
+    BoundingBox bounds;
+    bounds.expand(glm::vec3(-1.0f));
+    bounds.expand(glm::vec3(1.0f));
+    child->getTransform().setLocalBounds(bounds);
+    EXPECT_FALSE(scene.getTransformSystem().isUpToDate());
+
+    scene.update(0.0f);
+    const Transform& t = child->getTransform();
+    EXPECT_TRUE(scene.getTransformSystem().isUpToDate());
+    EXPECT_TRUE(t.isCurrent());
+    EXPECT_EQ(t.getCachedWorldMatrix(), t.getWorldMatrix());
+    EXPECT_EQ(t.getCachedWorldBounds().max, glm::vec3(1.0f));
+
+    parent->getTransform().setLocalPosition(5.0f, 0.0f, 0.0f);
+    EXPECT_FALSE(scene.getTransformSystem().isUpToDate());
+    EXPECT_FALSE(t.isCurrent());
+
+    scene.update(0.0f);
+    EXPECT_TRUE(t.isCurrent());
+    EXPECT_EQ(t.getCachedWorldBounds().max, glm::vec3(6.0f, 1.0f, 1.0f));
+    EXPECT_EQ(glm::vec3(t.getCachedWorldMatrix()[3]), glm::vec3(5.0f, 0.0f, 0.0f));
+}
+
+// Test scenes hand their own or the default job system to their transforms
+TEST(TransformTest, SceneJobSystem) {
+    JobSystem jobs;
+    JobSystem other;
+    Scene scene;
+    EXPECT_EQ(scene.getJobSystem(), nullptr);
+
+    Scene::setDefaultJobSystem(&jobs);
+    EXPECT_EQ(scene.getJobSystem(), &jobs);
+    scene.update(0.0f);
+    EXPECT_EQ(scene.getTransformSystem().getJobSystem(), &jobs);
+
+    scene.setJobSystem(&other);
+    scene.update(0.0f);
+    EXPECT_EQ(scene.getTransformSystem().getJobSystem(), &other);
+
+    Scene::setDefaultJobSystem(nullptr);
+    scene.setJobSystem(nullptr);
+    scene.update(0.0f);
+    EXPECT_EQ(scene.getTransformSystem().getJobSystem(), nullptr);
+}
+
+// Test that a level-parallel update matches the serial update
+TEST(TransformSystemTest, ParallelUpdateMatchesSerial) {
+    JobSystemConfig config;
+    config.workerCount = 4;
+    JobSystem jobs(config);
+    jobs.initialize();
+
+    TransformSystem serial;
+    TransformSystem parallel;
+    parallel.setJobSystem(&jobs);
+
+    // Random tree, wide enough that several levels split into jobs
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+    const size_t count = TransformSystem::ParallelThreshold * 3;
+    std::vector<TransformSystem::ID> serialIDs;
+    std::vector<TransformSystem::ID> parallelIDs;
+    for (size_t i = 0; i < count; ++i) {
+        serialIDs.push_back(serial.create());
+        parallelIDs.push_back(parallel.create());
+        if (i > 0) {
+            size_t parent = (i < 64) ? 0 : rng() % (i / 2);
+            serial.setParent(serialIDs[i], serialIDs[parent]);
+            parallel.setParent(parallelIDs[i], parallelIDs[parent]);
+        }
+    }
+
+    for (int frame = 0; frame < 3; ++frame) {
+        for (int edit = 0; edit < 500; ++edit) {
+            size_t i = rng() % count;
+            glm::vec3 position(value(rng), value(rng), value(rng));
+            glm::quat rotation = glm::angleAxis(value(rng), glm::normalize(glm::vec3(1.0f, value(rng), 0.5f)));
+            serial.setLocalPosition(serialIDs[i], position);
+            parallel.setLocalPosition(parallelIDs[i], position);
+            serial.setLocalRotation(serialIDs[i], rotation);
+            parallel.setLocalRotation(parallelIDs[i], rotation);
+        }
+
+        serial.update();
+        parallel.update();
+        EXPECT_EQ(parallel.getLastUpdateCount(), serial.getLastUpdateCount());
+
+        for (size_t i = 0; i < count; ++i) {
+            ASSERT_EQ(parallel.getWorldMatrix(parallelIDs[i]), serial.getWorldMatrix(serialIDs[i]));
+        }
+    }
+
+    jobs.shutdown();
+}
+
+// Test random edits against world matrices computed from scratch
+TEST(TransformTest, RandomEditsMatchReference) {
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> value(-2.0f, 2.0f);
+
+    Scene scene;
+    Node& root = *scene.createNode("Root");
+    std::vector<Node*> nodes{&root};
+    for (int i = 0; i < 200; ++i) {
+        Node* parent = nodes[rng() % nodes.size()];
+        nodes.push_back(parent->addChild("Node"));
+    }
+
+    for (int frame = 0; frame < 20; ++frame) {
+        for (int edit = 0; edit < 30; ++edit) {
+            Node* node = nodes[1 + rng() % (nodes.size() - 1)];
+            switch (rng() % 4) {
+                case 0:
+                    node->getTransform().setLocalPosition(value(rng), value(rng), value(rng));
+                    break;
+                case 1:
+                    node->getTransform().rotate(value(rng) * 45.0f, value(rng) * 45.0f, 0.0f);
+                    break;
+                case 2:
+                    node->getTransform().setLocalScale(1.0f + value(rng) * 0.25f);
+                    break;
+                default:
+                    // setParent refuses cycles, like any other caller
+                    node->setParent(nodes[rng() % nodes.size()]);
+                    break;
+            }
+
+            // Interleave lazy reads with edits
+            if (edit % 7 == 0) {
+                Node* probe = nodes[rng() % nodes.size()];
+                expectMatrixNear(probe->getTransform().getWorldMatrix(), referenceWorld(probe));
+            }
+        }
+
+        scene.getTransformSystem().update();
+        for (Node* node : nodes) {
+            expectMatrixNear(node->getTransform().getWorldMatrix(), referenceWorld(node));
+        }
+    }
+}
+
+} // namespace Tests
+} // namespace Pina